@@ -62,6 +62,12 @@ typedef struct
 }
 tGPIOPinIntAsssign;
 
+//
+// The single-cycle FGPIO alias of a GPIO port. The core reaches it through
+// the IOPORT without a bus bridge, the DMA can not use it.
+//
+#define GPIO_FAST(a)            ((a) - GPIOA_BASE + FGPIOA_BASE)
+
 //
 // GPIO Pins Interrupt Assignment table.
 //
@@ -363,8 +369,14 @@ GPIODirModeSet(unsigned long ulPort, unsigned long ulBit,
     //
     // Set the pin direction and mode.
     //
-    xHWREG(ulPort + GPIO_PDDR) &= ~(1 << ulBit);
-    xHWREG(ulPort + GPIO_PDDR) |= (ulPinIO << ulBit);
+    if(ulPinIO == GPIO_DIR_MODE_OUT)
+    {
+        xHWREGBME_OR(ulPort + GPIO_PDDR) = (1 << ulBit);
+    }
+    else
+    {
+        xHWREGBME_AND(ulPort + GPIO_PDDR) = ~(1 << ulBit);
+    }
 	
 }
 //*****************************************************************************
@@ -452,8 +464,7 @@ GPIOPinIntEnable(unsigned long ulPort, unsigned long ulPins,
     {
         if(((ulPins >> ulBit) & 1) != 0)
         { 
-	    xHWREG(ulPortBase + PORT_PCR + ulBit * 4) &= ~PORT_PCR_IRQC_M;
-            xHWREG(ulPortBase + PORT_PCR + ulBit * 4) |= ulIntType;
+            xHWREGBME_BFI(ulPortBase + PORT_PCR + ulBit * 4, 16, 8) = ulIntType;
         }
     }
 }
@@ -486,7 +497,7 @@ GPIOPinIntDisable(unsigned long ulPort, unsigned long ulPins)
     {
         if(((ulPins >> ulBit) & 1) != 0)
         { 
-	    xHWREG(ulPortBase + PORT_PCR + ulBit * 4) &= ~PORT_PCR_IRQC_M;
+            xHWREGBME_AND(ulPortBase + PORT_PCR + ulBit * 4) = ~PORT_PCR_IRQC_M;
         }
     }
 }
@@ -604,7 +615,7 @@ GPIOPinIntClear(unsigned long ulPort, unsigned long ulPins)
     //
     // Clear the interrupts.
     //
-    xHWREG(ulPortBase + PORT_ISFR) |= ulPins; 
+    xHWREG(ulPortBase + PORT_ISFR) = ulPins;
 }
 
 //*****************************************************************************
@@ -681,7 +692,7 @@ GPIOPinRead(unsigned long ulPort, unsigned long ulPins)
     //
     // Return the pin value(s).
     //
-    return(xHWREG(ulPort + GPIO_PDIR) & (ulPins));
+    return(xHWREG(GPIO_FAST(ulPort) + GPIO_PDIR) & (ulPins));
 }
 
 //*****************************************************************************
@@ -713,9 +724,14 @@ GPIOPinWrite(unsigned long ulPort, unsigned long ulPins, unsigned char ucVal)
     //
     // Write the pins.
     //
-    xHWREG(ulPort + GPIO_PDOR) = ((ucVal & 1) ?
-                                (xHWREG(ulPort + GPIO_PDOR) | ulPins) :
-                                (xHWREG(ulPort + GPIO_PDOR) & ~(ulPins)));
+    if(ucVal & 1)
+    {
+        xHWREG(GPIO_FAST(ulPort) + GPIO_PSOR) = ulPins;
+    }
+    else
+    {
+        xHWREG(GPIO_FAST(ulPort) + GPIO_PCOR) = ulPins;
+    }
 }
 
 //*****************************************************************************
@@ -746,7 +762,7 @@ GPIOPinSet(unsigned long ulPort, unsigned long ulPins)
     //
     // Write the pins.
     //
-    xHWREG(ulPort + GPIO_PSOR) = ulPins;
+    xHWREG(GPIO_FAST(ulPort) + GPIO_PSOR) = ulPins;
 }
 
 //*****************************************************************************
@@ -777,7 +793,7 @@ GPIOPinReset(unsigned long ulPort, unsigned long ulPins)
     //
     // Write the pins.
     //
-    xHWREG(ulPort + GPIO_PCOR) = ulPins;
+    xHWREG(GPIO_FAST(ulPort) + GPIO_PCOR) = ulPins;
 }
 
 //*****************************************************************************
@@ -872,7 +888,7 @@ GPIOPinPortDoutGet(unsigned long ulPort)
     //
     xASSERT(GPIOBaseValid(ulPort));
 
-	return(xHWREG(ulPort + GPIO_PDOR));
+	return(xHWREG(GPIO_FAST(ulPort) + GPIO_PDOR));
 }
 
 //*****************************************************************************
@@ -1117,15 +1133,10 @@ GPIOPinConfigure(unsigned long ulPinConfig)
     // 
     ulMux = ulPinConfig & 0x0f; 
     
-    //
-    // Clear the corresponding pin mux first.
-    //
-    xHWREG(ulPortBase + ulPinBase) &= ~PORT_PCR_PIN_MUX_M;
-
     //
     // Set the corresponding pin mux.
     //
-    xHWREG(ulPortBase + ulPinBase) |= (ulMux << 8);
+    xHWREGBME_BFI(ulPortBase + ulPinBase, 8, 3) = (ulMux << 8);
 }
 
 //*****************************************************************************
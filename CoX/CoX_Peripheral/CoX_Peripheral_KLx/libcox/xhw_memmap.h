@@ -187,6 +187,11 @@
 #define GPIOC_BASE              0x400FF080  // GPI0 C
 #define GPIOD_BASE              0x400FF0C0  // GPI0 D
 #define GPIOE_BASE              0x400FF100  // GPI0 E
+#define FGPIOA_BASE             0xF80FF000  // GPI0 A single-cycle (IOPORT)
+#define FGPIOB_BASE             0xF80FF040  // GPI0 B single-cycle (IOPORT)
+#define FGPIOC_BASE             0xF80FF080  // GPI0 C single-cycle (IOPORT)
+#define FGPIOD_BASE             0xF80FF0C0  // GPI0 D single-cycle (IOPORT)
+#define FGPIOE_BASE             0xF80FF100  // GPI0 E single-cycle (IOPORT)
 
 #define BME_BASE                0x44000000  // Bit Manipulation Engine (BME) access to 
                                             // AIPS Peripherals for slots 0-127
@@ -138,6 +138,33 @@ typedef unsigned long (* xtEventCallback)(void *pvCBData,
         xHWREGB(((unsigned long)(x) & 0xF0000000) | 0x02000000 |              \
                (((unsigned long)(x) & 0x000FFFFF) << 5) | ((b) << 2))
 
+//
+// Bit Manipulation Engine (BME) decorated stores. The BME turns the store
+// into an atomic read-modify-write of the peripheral register, e.g.
+// xHWREGBME_OR(x) = m is x |= m without masking interrupts. AND, OR and XOR
+// reach 0x40000000 - 0x400FFFFF, BFI (insert the field of width w at bit b
+// from the stored value) reaches 0x40000000 - 0x4007FFFF only. The B forms
+// are byte stores for the 8-bit registers.
+//
+#define xHWREGBME_AND(x)                                                      \
+        xHWREG(((unsigned long)(x) & 0x000FFFFF) | 0x44000000)
+#define xHWREGBME_OR(x)                                                       \
+        xHWREG(((unsigned long)(x) & 0x000FFFFF) | 0x48000000)
+#define xHWREGBME_XOR(x)                                                      \
+        xHWREG(((unsigned long)(x) & 0x000FFFFF) | 0x4C000000)
+#define xHWREGBME_BFI(x, b, w)                                                \
+        xHWREG(((unsigned long)(x) & 0x0007FFFF) | 0x50000000 |               \
+               ((b) << 23) | (((w) - 1) << 19))
+#define xHWREGBME_ANDB(x)                                                     \
+        xHWREGB(((unsigned long)(x) & 0x000FFFFF) | 0x44000000)
+#define xHWREGBME_ORB(x)                                                      \
+        xHWREGB(((unsigned long)(x) & 0x000FFFFF) | 0x48000000)
+#define xHWREGBME_XORB(x)                                                     \
+        xHWREGB(((unsigned long)(x) & 0x000FFFFF) | 0x4C000000)
+#define xHWREGBME_BFIB(x, b, w)                                               \
+        xHWREGB(((unsigned long)(x) & 0x0007FFFF) | 0x50000000 |              \
+               ((b) << 23) | (((w) - 1) << 19))
+
 //*****************************************************************************
 //
 //! @}
@@ -113,8 +113,8 @@ static void I2CStartSend (unsigned long ulBase)
     //
     xASSERT((ulBase == I2C0_BASE) || ((ulBase == I2C1_BASE)));
     
-    xHWREGB(ulBase + I2C_STATUS) |= I2C_STATUS_IF;
-    xHWREGB(ulBase + I2C_CON1) |= I2C_CON1_MST;
+    xHWREGB(ulBase + I2C_STATUS) = I2C_STATUS_IF;
+    xHWREGBME_ORB(ulBase + I2C_CON1) = I2C_CON1_MST;
     SysCtlDelay(1000);
 
 }
@@ -143,10 +143,10 @@ I2CStopSend (unsigned long ulBase)
     //
     xASSERT((ulBase == I2C0_BASE) || ((ulBase == I2C1_BASE)));
     
-    xHWREGB(ulBase + I2C_CON1) &= ~I2C_CON1_MST;
-    xHWREGB(ulBase + I2C_STATUS) |= I2C_STATUS_IF;
+    xHWREGBME_ANDB(ulBase + I2C_CON1) = (unsigned char)~I2C_CON1_MST;
+    xHWREGB(ulBase + I2C_STATUS) = I2C_STATUS_IF;
     
-	xHWREGB(ulBase + I2C_CON1) &= ~I2C_CON1_TXAK;
+	xHWREGBME_ANDB(ulBase + I2C_CON1) = (unsigned char)~I2C_CON1_TXAK;
 
     xtStartFlag = xfalse;
 }
@@ -175,7 +175,7 @@ static unsigned long I2CByteSend (unsigned long ulBase, unsigned char ucData)
     //
     xASSERT((ulBase == I2C0_BASE) || ((ulBase == I2C1_BASE)));
 
-    xHWREGB(ulBase + I2C_CON1) |= I2C_CON1_TX;
+    xHWREGBME_ORB(ulBase + I2C_CON1) = I2C_CON1_TX;
             
     //
     // Send data to I2C BUS
@@ -185,7 +185,7 @@ static unsigned long I2CByteSend (unsigned long ulBase, unsigned char ucData)
     //
     // Make sure AA and EI bit is not active,and clear SI 
     //
-    xHWREGB(ulBase + I2C_CON1) &= ~(I2C_CON1_TXAK | I2C_CON1_IE);
+    xHWREGBME_ANDB(ulBase + I2C_CON1) = (unsigned char)~(I2C_CON1_TXAK | I2C_CON1_IE);
         
     //
     // Wait the SI be set again by hardware
@@ -230,14 +230,14 @@ static unsigned long I2CByteGet (unsigned long ulBase, unsigned char *ucpData,
     //
     if (ucAck == 1)
     {
-        xHWREGB(ulBase + I2C_CON1) |= I2C_CON1_TXAK;
+        xHWREGBME_ORB(ulBase + I2C_CON1) = I2C_CON1_TXAK;
     }
     else
     {
-        xHWREGB(ulBase + I2C_CON1) &= ~I2C_CON1_TXAK;
+        xHWREGBME_ANDB(ulBase + I2C_CON1) = (unsigned char)~I2C_CON1_TXAK;
     }
-    xHWREGB(ulBase + I2C_CON1) &= ~I2C_CON1_TX;
-    xHWREGB(ulBase + I2C_STATUS) |= I2C_STATUS_IF;
+    xHWREGBME_ANDB(ulBase + I2C_CON1) = (unsigned char)~I2C_CON1_TX;
+    xHWREGB(ulBase + I2C_STATUS) = I2C_STATUS_IF;
     
     while (!(xHWREGB(ulBase + I2C_STATUS) & I2C_STATUS_IF));
     *ucpData = (unsigned char)xHWREGB(ulBase + I2C_DAT);
@@ -280,7 +280,7 @@ I2C0IntHandler(void)
         }
         else
         {
-            xHWREGB(ulBase + I2C_STATUS) |= I2C_STATUS_IF;
+            xHWREGB(ulBase + I2C_STATUS) = I2C_STATUS_IF;
         }
         
     }
@@ -296,17 +296,17 @@ I2C0IntHandler(void)
         }
         else if(ulStatus & I2C_STATUS_IAAS)
         {
-            xHWREGB(ulBase + I2C_STATUS) |= I2C_STATUS_IF;
+            xHWREGB(ulBase + I2C_STATUS) = I2C_STATUS_IF;
             xHWREGB(ulBase + I2C_CON1) |= 0;
         }
         else if(xHWREGB(ulBase + I2C_STATUS) == I2C_SLAVE_EVENT_STOP)
         {
-            xHWREGB(ulBase + I2C_STATUS) |= I2C_STATUS_IF;
+            xHWREGB(ulBase + I2C_STATUS) = I2C_STATUS_IF;
             xHWREGB(ulBase + I2C_CON1) |= 0;
         }
         else 
         {
-            xHWREGB(ulBase + I2C_STATUS) |= I2C_STATUS_IF;
+            xHWREGB(ulBase + I2C_STATUS) = I2C_STATUS_IF;
         }
     }
         
@@ -348,7 +348,7 @@ I2C1IntHandler(void)
         }
         else
         {
-            xHWREGB(ulBase + I2C_STATUS) |= I2C_STATUS_IF;
+            xHWREGB(ulBase + I2C_STATUS) = I2C_STATUS_IF;
         }
         
     }
@@ -364,17 +364,17 @@ I2C1IntHandler(void)
         }
         else if(ulStatus & I2C_STATUS_IAAS)
         {
-            xHWREGB(ulBase + I2C_STATUS) |= I2C_STATUS_IF;
+            xHWREGB(ulBase + I2C_STATUS) = I2C_STATUS_IF;
             xHWREGB(ulBase + I2C_CON1) |= 0;
         }
         else if(xHWREGB(ulBase + I2C_STATUS) == I2C_SLAVE_EVENT_STOP)
         {
-            xHWREGB(ulBase + I2C_STATUS) |= I2C_STATUS_IF;
+            xHWREGB(ulBase + I2C_STATUS) = I2C_STATUS_IF;
             xHWREGB(ulBase + I2C_CON1) |= 0;
         }
         else 
         {
-            xHWREGB(ulBase + I2C_STATUS) |= I2C_STATUS_IF;
+            xHWREGB(ulBase + I2C_STATUS) = I2C_STATUS_IF;
         }
     }
         
@@ -409,13 +409,13 @@ I2CMasterInit(unsigned long ulBase, unsigned long ulI2CClk)
     xASSERT((ulBase == I2C0_BASE) || ((ulBase == I2C1_BASE)));
     
     
-    xHWREGB(ulBase + I2C_CON1) |= I2C_CON1_EN;
+    xHWREGBME_ORB(ulBase + I2C_CON1) = I2C_CON1_EN;
     
     ulBusClk = SysCtlBusClkGet();
     
     xHWREGB(ulBase + I2C_FREQ) = 0x80;
 
-    xHWREGB(ulBase + I2C_CON1) |= I2C_CON1_TX;
+    xHWREGBME_ORB(ulBase + I2C_CON1) = I2C_CON1_TX;
 }
 
 //*****************************************************************************
@@ -452,7 +452,7 @@ I2CSlaveInit(unsigned long ulBase, unsigned short usSlaveAddr,
     //
     xASSERT((ulBase == I2C0_BASE) || ((ulBase == I2C1_BASE)));    
 
-    xHWREGB(ulBase + I2C_CON2) &= ~(I2C_CON2_GCAEN | I2C_CON2_ADEXT);
+    xHWREGBME_ANDB(ulBase + I2C_CON2) = (unsigned char)~(I2C_CON2_GCAEN | I2C_CON2_ADEXT);
     xHWREGB(ulBase + I2C_CON2) = ulGeneralCall | ulAddrBit;
     
     if(ulAddrBit == I2C_ADDRESS_7BIT)
@@ -465,7 +465,7 @@ I2CSlaveInit(unsigned long ulBase, unsigned short usSlaveAddr,
         xHWREGB(ulBase + I2C_CON2) = (usSlaveAddr & 0x700) >> 8;
     }
         
-    xHWREGB(ulBase + I2C_CON1) &= ~I2C_CON1_MST;
+    xHWREGBME_ANDB(ulBase + I2C_CON1) = (unsigned char)~I2C_CON1_MST;
 }
 
 //*****************************************************************************
@@ -496,7 +496,7 @@ I2CSlaveSecondAddressSet(unsigned long ulBase, unsigned char ucSlaveAddr)
     //
     xASSERT((ulBase == I2C0_BASE) || ((ulBase == I2C1_BASE)));   
         
-    xHWREGB(ulBase + I2C_SMB) |= (I2C_SMB_SIICAEN);
+    xHWREGBME_ORB(ulBase + I2C_SMB) = (I2C_SMB_SIICAEN);
     xHWREGB(ulBase + I2C_A2) = ((ucSlaveAddr << 1));
 }
 
@@ -522,7 +522,7 @@ I2CSecondAddressDisable(unsigned long ulBase)
     //
     xASSERT((ulBase == I2C0_BASE) || ((ulBase == I2C1_BASE)));
     
-    xHWREGB(ulBase + I2C_SMB) &= ~(I2C_SMB_SIICAEN);
+    xHWREGBME_ANDB(ulBase + I2C_SMB) = (unsigned char)~(I2C_SMB_SIICAEN);
 }
 
 //*****************************************************************************
@@ -578,15 +578,15 @@ I2CIntEnable(unsigned long ulBase, unsigned long ulIntType)
     
     if(ulIntType & I2C_INT_FUNCTION)
     {
-        xHWREGB(ulBase + I2C_CON1) |= I2C_CON1_IE;
+        xHWREGBME_ORB(ulBase + I2C_CON1) = I2C_CON1_IE;
     }
     if(ulIntType & I2C_INT_BUS_STOP)
     {
-        xHWREGB(ulBase + I2C_FLT) |= I2C_FLT_STOPIE;
+        xHWREGBME_ORB(ulBase + I2C_FLT) = I2C_FLT_STOPIE;
     }
     if(ulIntType & I2C_INT_TIMEOUT)
     {
-        xHWREGB(ulBase + I2C_SMB) |= I2C_SMB_SHTF2IE;
+        xHWREGBME_ORB(ulBase + I2C_SMB) = I2C_SMB_SHTF2IE;
     }
     xIntEnable(INT_I2C0);
 }
@@ -638,15 +638,15 @@ I2CIntDisable(unsigned long ulBase, unsigned long ulIntType)
     
     if(ulIntType & I2C_INT_FUNCTION)
     {
-        xHWREGB(ulBase + I2C_CON1) &= ~I2C_CON1_IE;
+        xHWREGBME_ANDB(ulBase + I2C_CON1) = (unsigned char)~I2C_CON1_IE;
     }
     if(ulIntType & I2C_INT_BUS_STOP)
     {
-        xHWREGB(ulBase + I2C_FLT) &= ~I2C_FLT_STOPIE;
+        xHWREGBME_ANDB(ulBase + I2C_FLT) = (unsigned char)~I2C_FLT_STOPIE;
     }
     if(ulIntType & I2C_INT_TIMEOUT)
     {
-        xHWREGB(ulBase + I2C_SMB) &= ~I2C_SMB_SHTF2IE;
+        xHWREGBME_ANDB(ulBase + I2C_SMB) = (unsigned char)~I2C_SMB_SHTF2IE;
     }
     xIntDisable(INT_I2C0);
 }
@@ -673,7 +673,7 @@ I2CEnable(unsigned long ulBase)
     //
     xASSERT((ulBase == I2C0_BASE) || ((ulBase == I2C1_BASE)));
     
-    xHWREGB(ulBase + I2C_CON1) |= I2C_CON1_EN;
+    xHWREGBME_ORB(ulBase + I2C_CON1) = I2C_CON1_EN;
 }
 
 //*****************************************************************************
@@ -697,7 +697,7 @@ I2CDisable(unsigned long ulBase)
     //
     xASSERT((ulBase == I2C0_BASE) || ((ulBase == I2C1_BASE)));
     
-    xHWREGB(ulBase + I2C_CON1) &= ~I2C_CON1_EN;
+    xHWREGBME_ANDB(ulBase + I2C_CON1) = (unsigned char)~I2C_CON1_EN;
 }
 
 //*****************************************************************************
@@ -721,7 +721,7 @@ I2CHighDriverEnable(unsigned long ulBase)
     //
     xASSERT((ulBase == I2C0_BASE) || ((ulBase == I2C1_BASE)));
     
-    xHWREGB(ulBase + I2C_CON2) |= I2C_CON2_HDRS;
+    xHWREGBME_ORB(ulBase + I2C_CON2) = I2C_CON2_HDRS;
 }
 
 //*****************************************************************************
@@ -745,7 +745,7 @@ I2CHighDriverDisable(unsigned long ulBase)
     //
     xASSERT((ulBase == I2C0_BASE) || ((ulBase == I2C1_BASE)));
     
-    xHWREGB(ulBase + I2C_CON2) &= ~I2C_CON2_HDRS;
+    xHWREGBME_ANDB(ulBase + I2C_CON2) = (unsigned char)~I2C_CON2_HDRS;
 }
 
 //*****************************************************************************
@@ -770,7 +770,7 @@ I2CSlaveBaudEnable(unsigned long ulBase)
     //
     xASSERT((ulBase == I2C0_BASE) || ((ulBase == I2C1_BASE)));
     
-    xHWREGB(ulBase + I2C_CON2) |= I2C_CON2_SBRC;
+    xHWREGBME_ORB(ulBase + I2C_CON2) = I2C_CON2_SBRC;
 }
 
 //*****************************************************************************
@@ -795,7 +795,7 @@ I2CSlaveBaudDisable(unsigned long ulBase)
     //
     xASSERT((ulBase == I2C0_BASE) || ((ulBase == I2C1_BASE)));
     
-    xHWREGB(ulBase + I2C_CON2) &= ~I2C_CON2_SBRC;
+    xHWREGBME_ANDB(ulBase + I2C_CON2) = (unsigned char)~I2C_CON2_SBRC;
 }
 
 //*****************************************************************************
@@ -820,7 +820,7 @@ I2CWakeupEnable(unsigned long ulBase)
     //
     xASSERT((ulBase == I2C0_BASE) || ((ulBase == I2C1_BASE)));
     
-    xHWREGB(ulBase + I2C_CON1) |= I2C_CON1_WUEN;
+    xHWREGBME_ORB(ulBase + I2C_CON1) = I2C_CON1_WUEN;
 }
 
 //*****************************************************************************
@@ -845,7 +845,7 @@ I2CWakeupDisable(unsigned long ulBase)
     //
     xASSERT((ulBase == I2C0_BASE) || ((ulBase == I2C1_BASE)));
     
-    xHWREGB(ulBase + I2C_CON1) &= ~I2C_CON1_WUEN;
+    xHWREGBME_ANDB(ulBase + I2C_CON1) = (unsigned char)~I2C_CON1_WUEN;
 }
 
 //*****************************************************************************
@@ -870,7 +870,7 @@ I2CDMAEnable(unsigned long ulBase)
     //
     xASSERT((ulBase == I2C0_BASE) || ((ulBase == I2C1_BASE)));
     
-    xHWREGB(ulBase + I2C_CON1) |= I2C_CON1_DMAEN;
+    xHWREGBME_ORB(ulBase + I2C_CON1) = I2C_CON1_DMAEN;
 }
 
 //*****************************************************************************
@@ -895,7 +895,7 @@ I2CDMADisable(unsigned long ulBase)
     //
     xASSERT((ulBase == I2C0_BASE) || ((ulBase == I2C1_BASE)));
     
-    xHWREGB(ulBase + I2C_CON1) &= ~I2C_CON1_DMAEN;
+    xHWREGBME_ANDB(ulBase + I2C_CON1) = (unsigned char)~I2C_CON1_DMAEN;
 }
 
 //*****************************************************************************
@@ -921,7 +921,7 @@ I2CRangeAddrEnable(unsigned long ulBase, unsigned long ulRangeAddress)
     //
     xASSERT((ulBase == I2C0_BASE) || ((ulBase == I2C1_BASE)));
     
-    xHWREGB(ulBase + I2C_CON2) |= I2C_CON2_RMEN;
+    xHWREGBME_ORB(ulBase + I2C_CON2) = I2C_CON2_RMEN;
 	xHWREGB(ulBase + I2C_RA) = ulRangeAddress << 1;
 }
 
@@ -947,7 +947,7 @@ I2CRangeAddrDisable(unsigned long ulBase)
     //
     xASSERT((ulBase == I2C0_BASE) || ((ulBase == I2C1_BASE)));
     
-    xHWREGB(ulBase + I2C_CON2) &= ~I2C_CON2_RMEN;
+    xHWREGBME_ANDB(ulBase + I2C_CON2) = (unsigned char)~I2C_CON2_RMEN;
 }
 
 //*****************************************************************************
@@ -975,8 +975,8 @@ I2CGlitchFilterSet(unsigned long ulBase, unsigned char ucFilter)
     xASSERT((ulBase == I2C0_BASE) || ((ulBase == I2C1_BASE)));
     xASSERT((ulBase >= 0) && ((ulBase <= 31)));
     
-    xHWREGB(ulBase + I2C_FLT) &= ~I2C_FLT_FLT_M;
-    xHWREGB(ulBase + I2C_FLT) |= ucFilter;
+    xHWREGBME_ANDB(ulBase + I2C_FLT) = (unsigned char)~I2C_FLT_FLT_M;
+    xHWREGBME_ORB(ulBase + I2C_FLT) = ucFilter;
 }
 
 //*****************************************************************************
@@ -1055,7 +1055,7 @@ I2CIntFlagClear(unsigned long ulBase)
     //
     xASSERT((ulBase == I2C0_BASE) || ((ulBase == I2C1_BASE)));
 
-    xHWREGB(ulBase + I2C_STATUS) |= I2C_STATUS_IF;
+    xHWREGB(ulBase + I2C_STATUS) = I2C_STATUS_IF;
 }
 
 //*****************************************************************************
@@ -1083,7 +1083,7 @@ I2CTimeoutFlagClear(unsigned long ulBase, unsigned long ulTimeout)
     xASSERT((ulTimeout == I2C_TIMEOUT_SCL_LOW) || 
             ((ulTimeout == I2C_TIMEOUT_SCL_HIGH2)));
 
-    xHWREGB(ulBase + I2C_SMB) |= ulTimeout;
+    xHWREGBME_ORB(ulBase + I2C_SMB) = ulTimeout;
 }
 
 //*****************************************************************************
@@ -1123,8 +1123,8 @@ I2CTimeoutCounterSet(unsigned long ulBase, unsigned long ulDiv64,
     xASSERT((ulDiv64 == I2C_TIMEOUT_DIV64) || 
             (ulDiv64 == I2C_TIMEOUT_DIV_NO));
 
-    xHWREGB(ulBase + I2C_SMB) &= ~I2C_TIMEOUT_DIV64;
-    xHWREGB(ulBase + I2C_SMB) |= ulDiv64;
+    xHWREGBME_ANDB(ulBase + I2C_SMB) = (unsigned char)~I2C_TIMEOUT_DIV64;
+    xHWREGBME_ORB(ulBase + I2C_SMB) = ulDiv64;
     xHWREGB(ulBase + I2C_SLTH) = (ulTimeout & 0xFF00) >> 8;
     xHWREGB(ulBase + I2C_SLTL) = (ulTimeout & 0x00FF);
 }
@@ -1200,8 +1200,8 @@ void I2CMasterDataPut(unsigned long ulBase, unsigned char ucData)
     //
     // Make sure AA bit is active,and clear EI 
     //
-    xHWREGB(ulBase + I2C_CON1) &= ~I2C_CON1_TXAK;
-    xHWREGB(ulBase + I2C_STATUS) |= I2C_STATUS_IF;
+    xHWREGBME_ANDB(ulBase + I2C_CON1) = (unsigned char)~I2C_CON1_TXAK;
+    xHWREGB(ulBase + I2C_STATUS) = I2C_STATUS_IF;
 }
 
 //*****************************************************************************
@@ -1220,7 +1220,7 @@ unsigned long I2CMasterDataGet(unsigned long ulBase)
 {
     unsigned long ulData;
     ulData = xHWREGB(ulBase + I2C_DAT);
-    xHWREGB(ulBase + I2C_STATUS) |= I2C_STATUS_IF;
+    xHWREGB(ulBase + I2C_STATUS) = I2C_STATUS_IF;
     return ulData;
 }
 
@@ -1278,8 +1278,8 @@ I2CMasterWriteRequestS1(unsigned long ulBase, unsigned char ucSlaveAddr,
         //
         // Send Repeat start
         //   
-        xHWREGB(ulBase + I2C_STATUS) |= I2C_STATUS_IF;
-        xHWREGB(ulBase + I2C_CON1) |= I2C_CON1_RSTA;
+        xHWREGB(ulBase + I2C_STATUS) = I2C_STATUS_IF;
+        xHWREGBME_ORB(ulBase + I2C_CON1) = I2C_CON1_RSTA;
     }
     
     if(!(xHWREGB(ulBase + I2C_STATUS) & I2C_STATUS_BUSY))
@@ -1297,7 +1297,7 @@ I2CMasterWriteRequestS1(unsigned long ulBase, unsigned char ucSlaveAddr,
         I2CStopSend(ulBase);
         return;
     }
-    xHWREGB(ulBase + I2C_STATUS) |= I2C_STATUS_IF;  
+    xHWREGB(ulBase + I2C_STATUS) = I2C_STATUS_IF;  
     //
     // Send data to I2C BUS
     //
@@ -1306,7 +1306,7 @@ I2CMasterWriteRequestS1(unsigned long ulBase, unsigned char ucSlaveAddr,
     //
     // Make sure AA and EI bit is not active,and clear EI 
     //
-    //xHWREGB(ulBase + I2C_O_CON) &= ~(I2C_CON_AA | I2C_CON_EI);
+    //xHWREGBME_ANDB(ulBase + I2C_O_CON) = (unsigned char)~(I2C_CON_AA | I2C_CON_EI);
     
     
     if(bEndTransmition)
@@ -1360,7 +1360,7 @@ I2CMasterWriteRequestS2(unsigned long ulBase, unsigned char ucData,
     //
     // Make sure AA and EI bit is not active,and clear EI 
     //
-    xHWREGB(ulBase + I2C_STATUS) |= I2C_STATUS_IF;
+    xHWREGB(ulBase + I2C_STATUS) = I2C_STATUS_IF;
     
     //
     // Send the stop if End Transmition.
@@ -1583,8 +1583,8 @@ I2CMasterWriteBufS1(unsigned long ulBase, unsigned char ucSlaveAddr,
         //
         // Send Repeat start
         //   
-        xHWREGB(ulBase + I2C_STATUS) |= I2C_STATUS_IF;
-        xHWREGB(ulBase + I2C_CON1) |= I2C_CON1_RSTA;
+        xHWREGB(ulBase + I2C_STATUS) = I2C_STATUS_IF;
+        xHWREGBME_ORB(ulBase + I2C_CON1) = I2C_CON1_RSTA;
     }
     if(!(xHWREGB(ulBase + I2C_STATUS) & I2C_STATUS_BUSY))
     {
@@ -1752,7 +1752,7 @@ I2CMasterReadRequestS1(unsigned long ulBase, unsigned char ucSlaveAddr,
     // Check the arguments.
     //
     xASSERT((ulBase == I2C0_BASE) || ((ulBase == I2C1_BASE)));
-    xHWREGB(ulBase + I2C_CON1) &= ~I2C_CON1_TXAK;
+    xHWREGBME_ANDB(ulBase + I2C_CON1) = (unsigned char)~I2C_CON1_TXAK;
 
     if(xtStartFlag == xfalse)
     {
@@ -1767,8 +1767,8 @@ I2CMasterReadRequestS1(unsigned long ulBase, unsigned char ucSlaveAddr,
         //
         // Send Repeat start
         //   
-        xHWREGB(ulBase + I2C_STATUS) |= I2C_STATUS_IF;
-        xHWREGB(ulBase + I2C_CON1) |= I2C_CON1_RSTA;
+        xHWREGB(ulBase + I2C_STATUS) = I2C_STATUS_IF;
+        xHWREGBME_ORB(ulBase + I2C_CON1) = I2C_CON1_RSTA;
     }
     if(!(xHWREGB(ulBase + I2C_STATUS) & I2C_STATUS_BUSY))
     {
@@ -1786,12 +1786,12 @@ I2CMasterReadRequestS1(unsigned long ulBase, unsigned char ucSlaveAddr,
     }
     if(bEndTransmition)
     {
-        xHWREGB(ulBase + I2C_CON1) |= I2C_CON1_TXAK;
+        xHWREGBME_ORB(ulBase + I2C_CON1) = I2C_CON1_TXAK;
         I2CStopSend(ulBase);
     }
     else
     {
-        xHWREGB(ulBase + I2C_CON1) &= ~I2C_CON1_TXAK;
+        xHWREGBME_ANDB(ulBase + I2C_CON1) = (unsigned char)~I2C_CON1_TXAK;
     }
 }
 
@@ -1838,12 +1838,12 @@ I2CMasterReadRequestS2(unsigned long ulBase, xtBoolean bEndTransmition)
     //
     if(bEndTransmition)
     {
-        xHWREGB(ulBase + I2C_CON1) |= I2C_CON1_TXAK;
+        xHWREGBME_ORB(ulBase + I2C_CON1) = I2C_CON1_TXAK;
         I2CStopSend(ulBase);
     }
     else
     {
-        xHWREGB(ulBase + I2C_CON1) &= ~I2C_CON1_TXAK;
+        xHWREGBME_ANDB(ulBase + I2C_CON1) = (unsigned char)~I2C_CON1_TXAK;
     }     
 }
 
@@ -1883,7 +1883,7 @@ I2CMasterReadLastRequestS2(unsigned long ulBase)
     //
     // RECEIVE operation with negative ACK(no stop)
     //
-    xHWREGB(ulBase + I2C_CON1) |= I2C_CON1_TXAK;    
+    xHWREGBME_ORB(ulBase + I2C_CON1) = I2C_CON1_TXAK;    
     
 }
 
@@ -1939,7 +1939,7 @@ I2CMasterReadS1(unsigned long ulBase,
     xI2CMasterReadRequestS1(ulBase, ucSlaveAddr, xfalse);
 
     SysCtlDelay(100);
-    xHWREGB(ulBase + I2C_STATUS) |= I2C_STATUS_IF;
+    xHWREGB(ulBase + I2C_STATUS) = I2C_STATUS_IF;
     
     while (!(xHWREGB(ulBase + I2C_STATUS) & I2C_STATUS_IF));
 
@@ -2014,10 +2014,10 @@ I2CMasterReadS2(unsigned long ulBase,
 
     if(bEndTransmition)
     {
-        xHWREGB(ulBase + I2C_CON1) |= I2C_CON1_TXAK;
+        xHWREGBME_ORB(ulBase + I2C_CON1) = I2C_CON1_TXAK;
     } 
     
-    xHWREGB(ulBase + I2C_STATUS) |= I2C_STATUS_IF;
+    xHWREGB(ulBase + I2C_STATUS) = I2C_STATUS_IF;
     
     //
     // Waiting the I2C controller to be transmited
@@ -2122,7 +2122,7 @@ I2CMasterReadBufS1(unsigned long ulBase, unsigned char ucSlaveAddr,
         }
     }
 
-    //xHWREGB(ulBase + I2C_O_CON) |= I2C_CON_AA;
+    //xHWREGBME_ORB(ulBase + I2C_O_CON) = I2C_CON_AA;
     
     if(xtStartFlag == xfalse)
     {
@@ -2137,8 +2137,8 @@ I2CMasterReadBufS1(unsigned long ulBase, unsigned char ucSlaveAddr,
         //
         // Send Repeat start
         //   
-        xHWREGB(ulBase + I2C_STATUS) |= I2C_STATUS_IF;
-        xHWREGB(ulBase + I2C_CON1) |= I2C_CON1_RSTA;
+        xHWREGB(ulBase + I2C_STATUS) = I2C_STATUS_IF;
+        xHWREGBME_ORB(ulBase + I2C_CON1) = I2C_CON1_RSTA;
     }
     if(!(xHWREGB(ulBase + I2C_STATUS) & I2C_STATUS_BUSY))
     {
@@ -2247,10 +2247,10 @@ I2CMasterReadBufS2(unsigned long ulBase, unsigned char *pucDataBuf,
     if(bEndTransmition)
     {
         xHWREGB(ulBase + I2C_CON1) |= ~(I2C_CON1_TXAK);
-        xHWREGB(ulBase + I2C_STATUS) |= I2C_STATUS_IF;
+        xHWREGB(ulBase + I2C_STATUS) = I2C_STATUS_IF;
     }
     
-    xHWREGB(ulBase + I2C_STATUS) |= I2C_STATUS_IF;
+    xHWREGB(ulBase + I2C_STATUS) = I2C_STATUS_IF;
     
     while (!(xHWREGB(ulBase + I2C_STATUS) & I2C_STATUS_IF));
 
@@ -286,11 +286,9 @@ void UARTConfigSet(unsigned long ulBase,
         {
             if(UART0_BASE == ulBase)
             {
-                xHWREGB(ulBase + UART_0_C4) &= (unsigned char)(~UART_0_C4_M10_MASK);
-                xHWREGB(ulBase + UART_0_C4) |= (unsigned char)(UART_0_C4_M10_8_9_BIT);
+                xHWREGBME_BFIB(ulBase + UART_0_C4, 5, 1) = (unsigned char)(UART_0_C4_M10_8_9_BIT);
             }
-            xHWREGB(ulBase + UART_012_C1) &= (unsigned char)(~UART_012_C1_M_MASK);
-            xHWREGB(ulBase + UART_012_C1) |= (unsigned char)(UART_012_C1_M_8_BIT);
+            xHWREGBME_BFIB(ulBase + UART_012_C1, 4, 1) = (unsigned char)(UART_012_C1_M_8_BIT);
             break;
         }
 
@@ -298,19 +296,16 @@ void UARTConfigSet(unsigned long ulBase,
         {
             if(UART0_BASE == ulBase)
             {
-                xHWREGB(ulBase + UART_0_C4) &= (unsigned char)(~UART_0_C4_M10_MASK);
-                xHWREGB(ulBase + UART_0_C4) |= (unsigned char)(UART_0_C4_M10_8_9_BIT);
+                xHWREGBME_BFIB(ulBase + UART_0_C4, 5, 1) = (unsigned char)(UART_0_C4_M10_8_9_BIT);
             }
-            xHWREGB(ulBase + UART_012_C1) &= (unsigned char)(~UART_012_C1_M_MASK);
-            xHWREGB(ulBase + UART_012_C1) |= (unsigned char)(UART_012_C1_M_9_BIT);
+            xHWREGBME_BFIB(ulBase + UART_012_C1, 4, 1) = (unsigned char)(UART_012_C1_M_9_BIT);
             break;
         }
 
         case  UART_CONFIG_WLEN_10:
         {
-            xHWREGB(ulBase + UART_012_C1) &= (unsigned char)(~UART_012_C1_M_MASK);
-            xHWREGB(ulBase + UART_0_C4) &= (unsigned char)(~UART_0_C4_M10_MASK);
-            xHWREGB(ulBase + UART_0_C4) |= (unsigned char)(UART_0_C4_M10_10_BIT);
+            xHWREGBME_ANDB(ulBase + UART_012_C1) = (unsigned char)(~UART_012_C1_M_MASK);
+            xHWREGBME_BFIB(ulBase + UART_0_C4, 5, 1) = (unsigned char)(UART_0_C4_M10_10_BIT);
             break;
         }
     }
@@ -322,30 +317,25 @@ void UARTConfigSet(unsigned long ulBase,
     {
         case  UART_CONFIG_PAR_ODD:
         {
-            xHWREGB(ulBase + UART_012_C1) &= (unsigned char)(~UART_012_C1_PE_MASK);
-            xHWREGB(ulBase + UART_012_C1) |= (unsigned char)(UART_012_C1_PE_ENABLE);
+            xHWREGBME_BFIB(ulBase + UART_012_C1, 1, 1) = (unsigned char)(UART_012_C1_PE_ENABLE);
 
-            xHWREGB(ulBase + UART_012_C1) &= (unsigned char)(~UART_012_C1_PT_MASK);
-            xHWREGB(ulBase + UART_012_C1) |= (unsigned char)(UART_012_C1_PT_ODD);                       
+            xHWREGBME_BFIB(ulBase + UART_012_C1, 0, 1) = (unsigned char)(UART_012_C1_PT_ODD);
             
             break ;
         }
 
         case  UART_CONFIG_PAR_EVEN:
         {
-            xHWREGB(ulBase + UART_012_C1) &= (unsigned char)(~UART_012_C1_PE_MASK);
-            xHWREGB(ulBase + UART_012_C1) |= (unsigned char)(UART_012_C1_PE_ENABLE);
+            xHWREGBME_BFIB(ulBase + UART_012_C1, 1, 1) = (unsigned char)(UART_012_C1_PE_ENABLE);
 
-            xHWREGB(ulBase + UART_012_C1) &= (unsigned char)(~UART_012_C1_PT_MASK);
-            xHWREGB(ulBase + UART_012_C1) |= (unsigned char)(UART_012_C1_PT_EVEN);
+            xHWREGBME_BFIB(ulBase + UART_012_C1, 0, 1) = (unsigned char)(UART_012_C1_PT_EVEN);
 
             break ;
         }
 
         case  UART_CONFIG_PAR_NONE:
         {
-            xHWREGB(ulBase + UART_012_C1) &= (unsigned char)(~UART_012_C1_PE_MASK);
-            xHWREGB(ulBase + UART_012_C1) |= (unsigned char)(UART_012_C1_PE_DISABLE);
+            xHWREGBME_BFIB(ulBase + UART_012_C1, 1, 1) = (unsigned char)(UART_012_C1_PE_DISABLE);
 
             break ;
         }
@@ -358,16 +348,14 @@ void UARTConfigSet(unsigned long ulBase,
     {
         case  UART_CONFIG_STOP_1:
         {
-            xHWREGB(ulBase + UART_012_BDH) &= (unsigned char)(~UART_012_BDH_SBNS_MASK);
-            xHWREGB(ulBase + UART_012_BDH) |= (unsigned char)(UART_012_BDH_SBNS_ONE);
+            xHWREGBME_BFIB(ulBase + UART_012_BDH, 5, 1) = (unsigned char)(UART_012_BDH_SBNS_ONE);
 
             break;
         }
 
         case  UART_CONFIG_STOP_2:
         {
-            xHWREGB(ulBase + UART_012_BDH) &= (unsigned char)(~UART_012_BDH_SBNS_MASK);
-            xHWREGB(ulBase + UART_012_BDH) |= (unsigned char)(UART_012_BDH_SBNS_TWO);
+            xHWREGBME_BFIB(ulBase + UART_012_BDH, 5, 1) = (unsigned char)(UART_012_BDH_SBNS_TWO);
 
             break;
         }
@@ -394,7 +382,7 @@ void UARTEnable(unsigned long ulBase, unsigned long ulConfig)
             (ulBase == UART2_BASE) );
     xASSERT(0 == (ulConfig & ~(UART_TX | UART_RX)));
 
-    xHWREGB(ulBase + UART_012_C2) |= (unsigned char)(ulConfig);
+    xHWREGBME_ORB(ulBase + UART_012_C2) = (unsigned char)(ulConfig);
 }
 
 //*****************************************************************************
@@ -416,7 +404,7 @@ void UARTDisable(unsigned long ulBase, unsigned long ulConfig)
             (ulBase == UART2_BASE) );
     xASSERT(0 == ((ulConfig) & ~(UART_TX | UART_RX)));
 
-    xHWREGB(ulBase + UART_012_C2) &= (unsigned char)(~(ulConfig));
+    xHWREGBME_ANDB(ulBase + UART_012_C2) = (unsigned char)(~(ulConfig));
 }
 
 //*****************************************************************************
@@ -724,19 +712,19 @@ void UARTIntEnable(unsigned long ulBase, unsigned long ulIntFlags)
     if(0 != (ulIntFlags & UART_INT_BDH_FLAG))
     {
         ulTmp = (ulIntFlags & UART_INT_BDH_MASK) >> UART_INT_BDH_SHIFT;
-        xHWREGB(ulBase + UART_012_BDH) |= ((unsigned char)ulTmp);
+        xHWREGBME_ORB(ulBase + UART_012_BDH) = ((unsigned char)ulTmp);
     }
 
     if(0 != (ulIntFlags & UART_INT_C2_FLAG))
     {
         ulTmp = (ulIntFlags & UART_INT_C2_MASK) >> UART_INT_C2_SHIFT;
-        xHWREGB(ulBase + UART_012_C2) |= ((unsigned char)ulTmp);
+        xHWREGBME_ORB(ulBase + UART_012_C2) = ((unsigned char)ulTmp);
     }
 
     if(0 != (ulIntFlags & UART_INT_C3_FLAG))
     {
         ulTmp = (ulIntFlags & UART_INT_C3_MASK) >> UART_INT_C3_SHIFT;
-        xHWREGB(ulBase + UART_012_C3) |= ((unsigned char)ulTmp);
+        xHWREGBME_ORB(ulBase + UART_012_C3) = ((unsigned char)ulTmp);
     }
 }
 
@@ -787,19 +775,19 @@ void UARTIntDisable(unsigned long ulBase, unsigned long ulIntFlags)
     if(0 != (ulIntFlags & UART_INT_BDH_FLAG))
     {
         ulTmp = (ulIntFlags & UART_INT_BDH_MASK) >> UART_INT_BDH_SHIFT;
-        xHWREGB(ulBase + UART_012_BDH) &= ((unsigned char)~ulTmp);
+        xHWREGBME_ANDB(ulBase + UART_012_BDH) = ((unsigned char)~ulTmp);
     }
 
     if(0 != (ulIntFlags & UART_INT_C2_FLAG))
     {
         ulTmp = (ulIntFlags & UART_INT_C2_MASK) >> UART_INT_C2_SHIFT;
-        xHWREGB(ulBase + UART_012_C2) &= ((unsigned char)~ulTmp);
+        xHWREGBME_ANDB(ulBase + UART_012_C2) = ((unsigned char)~ulTmp);
     }
 
     if(0 != (ulIntFlags & UART_INT_C3_FLAG))
     {
         ulTmp = (ulIntFlags & UART_INT_C3_MASK) >> UART_INT_C3_SHIFT;
-        xHWREGB(ulBase + UART_012_C3) &= ((unsigned char)~ulTmp);
+        xHWREGBME_ANDB(ulBase + UART_012_C3) = ((unsigned char)~ulTmp);
     }
 }
 
@@ -911,7 +899,11 @@ void UARTRxErrorClear(unsigned long ulBase)
     {
         case UART0_BASE:
         {
-            xHWREGB(ulBase + UART_012_S1) |= UART_ERROR_MASK;
+            //
+            // The flags are write-1-to-clear, a read-modify-write would
+            // also clear IDLE
+            //
+            xHWREGB(ulBase + UART_012_S1) = UART_ERROR_MASK;
 
             break;
         }
@@ -991,7 +983,6 @@ void UARTLINConfig(unsigned long ulBase, unsigned long ulBaud,
             xHWREGB(ulBase + UART_012_S2 ) &= (unsigned char)(~UART_012_S2_BRK13_MASK);
             xHWREGB(ulBase + UART_012_C1 ) &= (unsigned char)(~UART_012_C1_M_MASK);
             xHWREGB(ulBase + UART_0_C4 )   &= (unsigned char)(~UART_0_C4_M10_MASK);
-            xHWREGB(ulBase + UART_012_BDH) &= (unsigned char)(~UART_012_BDH_SBNS_MASK);
 
             //
             // Configure Break Length
@@ -999,7 +990,7 @@ void UARTLINConfig(unsigned long ulBase, unsigned long ulBaud,
             xHWREGB(ulBase + UART_0_S2 ) |= (unsigned char)(ulConfig >> 24);
             xHWREGB(ulBase + UART_0_C1 ) |= (unsigned char)(ulConfig >> 16);
             xHWREGB(ulBase + UART_0_C4 ) |= (unsigned char)(ulConfig >> 8 );
-            xHWREGB(ulBase + UART_0_BDH) |= (unsigned char)(ulConfig      );
+            xHWREGBME_BFIB(ulBase + UART_0_BDH, 5, 1) = (unsigned char)(ulConfig);
             tmp = xHWREGB(ulBase + UART_0_BDH);
 
             break;
@@ -1013,14 +1004,13 @@ void UARTLINConfig(unsigned long ulBase, unsigned long ulBaud,
             //
             xHWREGB(ulBase + UART_12_S2 ) &= (unsigned char)(~UART_012_S2_BRK13_MASK);
             xHWREGB(ulBase + UART_12_C1 ) &= (unsigned char)(~UART_012_C1_M_MASK);
-            xHWREGB(ulBase + UART_12_BDH) &= (unsigned char)(~UART_012_BDH_SBNS_MASK);
 
             //
             // Configure Break Length
             //
             xHWREGB(ulBase + UART_12_S2 ) |= (unsigned char)(ulConfig >> 24);
             xHWREGB(ulBase + UART_12_C1 ) |= (unsigned char)(ulConfig >> 16);
-            xHWREGB(ulBase + UART_12_BDH) |= (unsigned char)(ulConfig      );
+            xHWREGBME_BFIB(ulBase + UART_12_BDH, 5, 1) = (unsigned char)(ulConfig);
             break;
         }
     }
@@ -1042,7 +1032,7 @@ void UARTLINEnable(unsigned long ulBase)
 {
     xASSERT((ulBase == UART0_BASE) || (ulBase == UART1_BASE) ||
             (ulBase == UART2_BASE) );
-    xHWREGB(ulBase + UART_012_S2) |= (unsigned char)(UART_012_S2_LBKDE);
+    xHWREGBME_ORB(ulBase + UART_012_S2) = (unsigned char)(UART_012_S2_LBKDE);
 }
 
 //*****************************************************************************
@@ -1061,7 +1051,7 @@ void UARTLINDisable(unsigned long ulBase)
     xASSERT((ulBase == UART0_BASE) || (ulBase == UART1_BASE) ||
             (ulBase == UART2_BASE) );
 
-    xHWREGB(ulBase + UART_012_S2) &= (unsigned char)(~UART_012_S2_LBKDE);
+    xHWREGBME_ANDB(ulBase + UART_012_S2) = (unsigned char)(~UART_012_S2_LBKDE);
 }
 
 //*****************************************************************************
@@ -1087,8 +1077,8 @@ void UARTLINSyncBreakPut(unsigned long ulBase)
     //
     //
     //
-    xHWREGB(ulBase + UART_012_C2) |= (unsigned char)(UART_012_C2_SBK_MASK);
-    xHWREGB(ulBase + UART_012_C2) &= (unsigned char)(~UART_012_C2_SBK_MASK);
+    xHWREGBME_ORB(ulBase + UART_012_C2) = (unsigned char)(UART_012_C2_SBK_MASK);
+    xHWREGBME_ANDB(ulBase + UART_012_C2) = (unsigned char)(~UART_012_C2_SBK_MASK);
 }
 
 
@@ -1131,13 +1121,13 @@ void UARTDMAEnable(unsigned long ulBase, unsigned long ulConfig)
     {
         case UART0_BASE:
             {
-                xHWREGB(ulBase + UART_0_C5) |= (unsigned char) ulConfig;
+                xHWREGBME_ORB(ulBase + UART_0_C5) = (unsigned char) ulConfig;
                 break;
             }
         case UART1_BASE:
         case UART2_BASE:
             {
-                xHWREGB(ulBase + UART_12_C4) |= (unsigned char) ulConfig;
+                xHWREGBME_ORB(ulBase + UART_12_C4) = (unsigned char) ulConfig;
                 break;
             }
     }
@@ -1182,13 +1172,13 @@ void UARTDMADisable(unsigned long ulBase, unsigned long ulConfig)
     {
         case UART0_BASE:
             {
-                xHWREGB(ulBase + UART_0_C5) &= (unsigned char)(~ulConfig);
+                xHWREGBME_ANDB(ulBase + UART_0_C5) = (unsigned char)(~ulConfig);
                 break;
             }
         case UART1_BASE:
         case UART2_BASE:
             {
-                xHWREGB(ulBase + UART_12_C4) &= (unsigned char)(~ulConfig);
+                xHWREGBME_ANDB(ulBase + UART_12_C4) = (unsigned char)(~ulConfig);
                 break;
             }
     }
@@ -1213,8 +1203,7 @@ void UARTTxInvertEnable(unsigned long ulBase)
     xASSERT((ulBase == UART0_BASE) || (ulBase == UART1_BASE) ||
             (ulBase == UART2_BASE) );
 
-    xHWREGB(ulBase + UART_012_C3) &= (unsigned char)(~UART_012_C3_TXINV_MASK);
-    xHWREGB(ulBase + UART_012_C3) |= (unsigned char)(UART_012_C3_TXINV_INVERT);
+    xHWREGBME_BFIB(ulBase + UART_012_C3, 4, 1) = (unsigned char)(UART_012_C3_TXINV_INVERT);
 }
 
 //*****************************************************************************
@@ -1236,8 +1225,7 @@ void UARTTxInvertDisable(unsigned long ulBase)
     xASSERT((ulBase == UART0_BASE) || (ulBase == UART1_BASE) ||
             (ulBase == UART2_BASE) );
 
-    xHWREGB(ulBase + UART_012_C3) &= (unsigned char)(~UART_012_C3_TXINV_MASK);
-    xHWREGB(ulBase + UART_012_C3) |= (unsigned char)(UART_012_C3_TXINV_NORMAL);
+    xHWREGBME_BFIB(ulBase + UART_012_C3, 4, 1) = (unsigned char)(UART_012_C3_TXINV_NORMAL);
 }
 
 //*****************************************************************************
@@ -1259,8 +1247,7 @@ void UARTRxInvertEnable(unsigned long ulBase)
     xASSERT((ulBase == UART0_BASE) || (ulBase == UART1_BASE) ||
             (ulBase == UART2_BASE) );
 
-    xHWREGB(ulBase + UART_012_S2) &= (unsigned char)(~UART_012_S2_RXINV_MASK);
-    xHWREGB(ulBase + UART_012_S2) |= (unsigned char)(UART_012_S2_RXINV_INVERT);
+    xHWREGBME_BFIB(ulBase + UART_012_S2, 4, 1) = (unsigned char)(UART_012_S2_RXINV_INVERT);
 }
 
 //*****************************************************************************
@@ -1282,8 +1269,7 @@ void UARTRxInvertDisable(unsigned long ulBase)
     xASSERT((ulBase == UART0_BASE) || (ulBase == UART1_BASE) ||
             (ulBase == UART2_BASE) );
 
-    xHWREGB(ulBase + UART_012_S2) &= (unsigned char)(~UART_012_S2_RXINV_MASK);
-    xHWREGB(ulBase + UART_012_S2) |= (unsigned char)(UART_012_S2_RXINV_NORMAL);
+    xHWREGBME_BFIB(ulBase + UART_012_S2, 4, 1) = (unsigned char)(UART_012_S2_RXINV_NORMAL);
 }
 
 
@@ -1318,8 +1304,11 @@ void UARTOutModeConfig(unsigned long ulBase, unsigned long ulConfig)
     xASSERT((ulBase == UART0_BASE) || (ulBase == UART1_BASE) ||
             (ulBase == UART2_BASE) );
 
-    xHWREGB(ulBase + UART_012_C1) &= (unsigned char)(~UART_MODE_MASK);
-    xHWREGB(ulBase + UART_012_C1) |= (unsigned char)(ulConfig);
+    //
+    // RSRC (bit 5) and LOOPS (bit 7) are apart, one insert each
+    //
+    xHWREGBME_BFIB(ulBase + UART_012_C1, 5, 1) = (unsigned char)(ulConfig);
+    xHWREGBME_BFIB(ulBase + UART_012_C1, 7, 1) = (unsigned char)(ulConfig);
 }
 
 //*****************************************************************************
@@ -1339,7 +1328,7 @@ void UARTWaitModeRun(unsigned long ulBase)
     xASSERT((ulBase == UART0_BASE) || (ulBase == UART1_BASE) ||
             (ulBase == UART2_BASE) );
 
-    xHWREGB(ulBase + UART_012_C1) &= (unsigned char)(~UART_012_C1_DOZEEN_ENABLE);
+    xHWREGBME_ANDB(ulBase + UART_012_C1) = (unsigned char)(~UART_012_C1_DOZEEN_ENABLE);
 }
 
 //*****************************************************************************
@@ -1358,7 +1347,7 @@ void UARTWaitModeStop(unsigned long ulBase)
     xASSERT((ulBase == UART0_BASE) || (ulBase == UART1_BASE) ||
             (ulBase == UART2_BASE) );
 
-    xHWREGB(ulBase + UART_012_C1) |= (unsigned char)(UART_012_C1_DOZEEN_DISABLE);
+    xHWREGBME_ORB(ulBase + UART_012_C1) = (unsigned char)(UART_012_C1_DOZEEN_DISABLE);
 }
 
 //*****************************************************************************
@@ -1384,8 +1373,7 @@ void UARTWakeupMethodConfig(unsigned long ulBase, unsigned long ulConfig)
             (ulBase == UART2_BASE) );
     xASSERT((ulBase == UART_WAKEUP_IDLE_LINE   ) ||
             (ulBase == UART_WAKEUP_ADDRESS_MARK) );
-    xHWREGB(ulBase + UART_012_C1) &= (unsigned char)(~UART_WAKEUP_MASK);
-    xHWREGB(ulBase + UART_012_C1) |= (unsigned char)(ulConfig);
+    xHWREGBME_BFIB(ulBase + UART_012_C1, 3, 1) = (unsigned char)(ulConfig);
 }
 
 //*****************************************************************************
@@ -1817,8 +1805,7 @@ void UARTIdleLineTypeConfig(unsigned long ulBase, unsigned long ulConfig)
             (UART_IDLE_TYPE_AFTER_START == ulConfig) ||
             (UART_IDLE_TYPE_AFTER_START == ulConfig) );
 
-    xHWREGB(ulBase + UART_012_C1) &= (unsigned char)(~UART_012_C1_ILT_MASK);
-    xHWREGB(ulBase + UART_012_C1) |= (unsigned char)(ulConfig);
+    xHWREGBME_BFIB(ulBase + UART_012_C1, 2, 1) = (unsigned char)(ulConfig);
 
 }
 
@@ -1910,6 +1897,6 @@ void UARTIdleSend(unsigned long ulBase)
     //
     while(0 == (xHWREGB(ulBase + UART_012_S1) & UART_012_S1_TDRE_MASK));
 
-    xHWREGB(ulBase + UART_012_C2) |= (unsigned char)(UART_012_C2_TE_MASK);
-    xHWREGB(ulBase + UART_012_C2) &= (unsigned char)(~UART_012_C2_TE_MASK);
+    xHWREGBME_ORB(ulBase + UART_012_C2) = (unsigned char)(UART_012_C2_TE_MASK);
+    xHWREGBME_ANDB(ulBase + UART_012_C2) = (unsigned char)(~UART_012_C2_TE_MASK);
 }
@@ -380,8 +380,7 @@ void xGPIOPinIntClear(unsigned long ulPort, unsigned long ulPins)
 //*****************************************************************************
 unsigned long xGPIOPinRead(unsigned long ulPort, unsigned long ulPins)
 {
-    xHWREG(ulPort + FIOMASK) = ~ulPins;
-    return xHWREG(ulPort + FIOPIN);
+    return (xHWREG(ulPort + FIOPIN) & ulPins);
 }
 
 //*****************************************************************************
@@ -400,8 +399,14 @@ unsigned long xGPIOPinRead(unsigned long ulPort, unsigned long ulPins)
 void xGPIOPinWrite(unsigned long ulPort, unsigned long ulPins,
         unsigned long ulVal)
 {
-    xHWREG(ulPort + FIOMASK) = ~ulPins;
-    xHWREG(ulPort + FIOPIN)  =   ulVal;
+    if(0 != (ulVal & 1))
+    {
+        xHWREG(ulPort + FIOSET) = ulPins;
+    }
+    else
+    {
+        xHWREG(ulPort + FIOCLR) = ulPins;
+    }
 }
 
 ////////////////////////////////////////////////////////////////////
@@ -625,7 +630,6 @@ void GPIOPinModeCfg(unsigned long ulPort, unsigned long ulPin, unsigned long ulC
 //*****************************************************************************
 void GPIOPinSet(unsigned long ulPort, unsigned long ulPins)
 {
-    xHWREG(ulPort + FIOMASK) =~ulPins;
     xHWREG(ulPort + FIOSET)  = ulPins;
 }
 
@@ -641,7 +645,6 @@ void GPIOPinSet(unsigned long ulPort, unsigned long ulPins)
 //*****************************************************************************
 void GPIOPinClr(unsigned long ulPort, unsigned long ulPins)
 {
-    xHWREG(ulPort + FIOMASK) =~ulPins;
     xHWREG(ulPort + FIOCLR)  = ulPins;
 }
 
@@ -657,7 +660,6 @@ void GPIOPinClr(unsigned long ulPort, unsigned long ulPins)
 //*****************************************************************************
 void GPIOPinWrite(unsigned long ulPort, unsigned long ulPins, unsigned long ulVal)
 {
-    xHWREG(ulPort + FIOMASK) = ~ulPins;
     if(0 != ulVal)
     {
         xHWREG(ulPort + FIOSET)   =  ulPins;
@@ -680,8 +682,7 @@ void GPIOPinWrite(unsigned long ulPort, unsigned long ulPins, unsigned long ulVa
 //*****************************************************************************
 unsigned long GPIOPinRead(unsigned long ulPort, unsigned long ulPin)
 {
-    xHWREG(ulPort + FIOMASK) = ~ulPin;
-    return xHWREG(ulPort + FIOPIN);
+    return (xHWREG(ulPort + FIOPIN) & ulPin);
 }
 
 //*****************************************************************************
@@ -695,7 +696,6 @@ unsigned long GPIOPinRead(unsigned long ulPort, unsigned long ulPin)
 //*****************************************************************************
 unsigned long GPIOPortRead(unsigned long ulPort)
 {
-    xHWREG(ulPort + FIOMASK) = (unsigned long) 0x00;
     return xHWREG(ulPort + FIOPIN);
 }
 
@@ -710,10 +710,117 @@ unsigned long GPIOPortRead(unsigned long ulPort)
 //*****************************************************************************
 void GPIOPortWrite(unsigned long ulPort, unsigned long ulVal)
 {
-    xHWREG(ulPort + FIOMASK) = (unsigned long) 0x00;
     xHWREG(ulPort + FIOPIN)  = ulVal;
 }
 
+//*****************************************************************************
+//
+//! \brief  Set up a parallel bus on a GPIO port.
+//!         The bus is the run of pins in \e ulMask, D0 on its lowest pin. The
+//!         store used by GPIOBusWrite() is chosen once here:
+//!         - a byte lane (pins 0-7, 8-15, 16-23 or 24-31) is written through
+//!           FIOPINn, a half-word lane through FIOPINL/FIOPINU.
+//!         - any other run is written with a word store to FIOPIN under
+//!           FIOMASK, see GPIOBusWrite().
+//!
+//! \param  [out] psBus is the bus descriptor to fill.
+//! \param  [in] ulPort is the base address of the GPIO port.
+//! \param  [in] ulMask is the bit-packed representation of the bus pins, the
+//!              pins must be contiguous.
+//!
+//! \return None.
+//
+//*****************************************************************************
+void GPIOBusInit(tGPIOBus *psBus, unsigned long ulPort, unsigned long ulMask)
+{
+    unsigned long ulShift;
+
+    xASSERT(ulMask != 0);
+
+    for(ulShift = 0; 0 == (ulMask & (1UL << ulShift)); ulShift++)
+    {
+    }
+
+    //
+    // The pins must be contiguous.
+    //
+    xASSERT(0 == (((ulMask >> ulShift) + 1) & (ulMask >> ulShift)));
+
+    psBus->ulPort  = ulPort;
+    psBus->ulMask  = ulMask;
+    psBus->ulShift = ulShift;
+
+    if((ulMask >> ulShift) == 0xFF && 0 == (ulShift & 7))
+    {
+        psBus->ulReg   = ulPort + FIOPIN0 + (ulShift >> 3);
+        psBus->ulWidth = GPIO_BUS_BYTE;
+    }
+    else if((ulMask >> ulShift) == 0xFFFF && 0 == (ulShift & 15))
+    {
+        psBus->ulReg   = ulPort + FIOPINL + (ulShift >> 3);
+        psBus->ulWidth = GPIO_BUS_HALFWORD;
+    }
+    else
+    {
+        psBus->ulReg   = ulPort + FIOPIN;
+        psBus->ulWidth = GPIO_BUS_WORD;
+    }
+}
+
+//*****************************************************************************
+//
+//! \brief  Write a value to a parallel bus with one store.
+//!
+//! \param  [in] psBus is the bus set up by GPIOBusInit().
+//! \param  [in] ulVal is the value, bit 0 goes to D0.
+//!
+//! \return None.
+//!
+//! \note   A bus off the byte and half-word lanes sets FIOMASK to the bus pins
+//!         for the store and clears it again, with the interrupts disabled.
+//!         FIOMASK also gates FIOSET, FIOCLR and the FIOPIN reads, so leaving it
+//!         set would lock the other pins of the port.
+//
+//*****************************************************************************
+void GPIOBusWrite(tGPIOBus *psBus, unsigned long ulVal)
+{
+    unsigned long ulPrimask;
+
+    if(psBus->ulWidth == GPIO_BUS_BYTE)
+    {
+        xHWREGB(psBus->ulReg) = (unsigned char)ulVal;
+    }
+    else if(psBus->ulWidth == GPIO_BUS_HALFWORD)
+    {
+        xHWREGH(psBus->ulReg) = (unsigned short)ulVal;
+    }
+    else
+    {
+        ulPrimask = xCPUcpsid();
+        xHWREG(psBus->ulPort + FIOMASK) = ~psBus->ulMask;
+        xHWREG(psBus->ulReg) = ulVal << psBus->ulShift;
+        xHWREG(psBus->ulPort + FIOMASK) = 0;
+        if(!ulPrimask)
+        {
+            xCPUcpsie();
+        }
+    }
+}
+
+//*****************************************************************************
+//
+//! \brief  Read the value on a parallel bus.
+//!
+//! \param  [in] psBus is the bus set up by GPIOBusInit().
+//!
+//! \return The bus value, D0 in bit 0.
+//
+//*****************************************************************************
+unsigned long GPIOBusRead(tGPIOBus *psBus)
+{
+    return ((xHWREG(psBus->ulPort + FIOPIN) & psBus->ulMask) >> psBus->ulShift);
+}
+
 //*****************************************************************************
 //
 //! \brief  Configure gpio pin interrupt mode.
@@ -2141,6 +2141,50 @@ extern void xGPIOPinWrite(unsigned long ulPort, unsigned long ulPins,
 //
 //*****************************************************************************
 
+//*****************************************************************************
+//
+//! \addtogroup  LPC17xx_GPIO_Bus  LPC17xx GPIO parallel bus
+//! \brief       Bus descriptor used by GPIOBusInit(), GPIOBusWrite() and
+//!              GPIOBusRead().
+//! @{
+//
+//*****************************************************************************
+
+//! Bus on a byte lane, written through FIOPINn.
+#define GPIO_BUS_BYTE           8
+
+//! Bus on a half-word lane, written through FIOPINL/FIOPINU.
+#define GPIO_BUS_HALFWORD       16
+
+//! Bus elsewhere, written through FIOPIN under FIOMASK.
+#define GPIO_BUS_WORD           32
+
+typedef struct
+{
+    //! GPIO port base address.
+    unsigned long ulPort;
+
+    //! Bus pins.
+    unsigned long ulMask;
+
+    //! Pin number of D0.
+    unsigned long ulShift;
+
+    //! Register written by GPIOBusWrite().
+    unsigned long ulReg;
+
+    //! Store width, \ref GPIO_BUS_BYTE, \ref GPIO_BUS_HALFWORD or
+    //! \ref GPIO_BUS_WORD.
+    unsigned long ulWidth;
+}
+tGPIOBus;
+
+//*****************************************************************************
+//
+//! @}
+//
+//*****************************************************************************
+
 //*****************************************************************************
 //
 //! \addtogroup LPC17xx_GPIO_Exported_APIs LPC17xx GPIO API
@@ -2166,6 +2210,9 @@ extern unsigned long GPIOPinIntFlagGet(unsigned long ulPort, unsigned long ulPin
 extern void          GPIOPinIntFlagClear(unsigned long ulPort, unsigned long ulPin);
 extern void          GPIOPinIntEnable(unsigned long ulPort, unsigned long ulPin);
 extern void          GPIOPinIntDisable(unsigned long ulPort, unsigned long ulPin);
+extern void          GPIOBusInit(tGPIOBus *psBus, unsigned long ulPort, unsigned long ulMask);
+extern void          GPIOBusWrite(tGPIOBus *psBus, unsigned long ulVal);
+extern unsigned long GPIOBusRead(tGPIOBus *psBus);
 
 //*****************************************************************************
 //
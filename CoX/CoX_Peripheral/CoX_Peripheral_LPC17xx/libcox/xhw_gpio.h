@@ -268,6 +268,71 @@
 //! Fast IO Clear register 4.
 #define FIO4CLR                        ((unsigned long)0x0000001C)
 
+//! \brief GPIO byte and half-word register aliases.
+//! \note  Use them with xHWREGB/xHWREGH and GPIO_PORTx_BASE. A store to one
+//!        lane leaves the pins of the other lanes unchanged, so an 8 or 16
+//!        bit bus on a lane is written with one store and no FIOMASK.
+
+//! Fast IO Mask register byte 0 (pins 0-7).
+#define FIOMASK0                       ((unsigned long)0x00000010)
+
+//! Fast IO Mask register byte 1 (pins 8-15).
+#define FIOMASK1                       ((unsigned long)0x00000011)
+
+//! Fast IO Mask register byte 2 (pins 16-23).
+#define FIOMASK2                       ((unsigned long)0x00000012)
+
+//! Fast IO Mask register byte 3 (pins 24-31).
+#define FIOMASK3                       ((unsigned long)0x00000013)
+
+//! Fast IO Mask register lower half-word (pins 0-15).
+#define FIOMASKL                       ((unsigned long)0x00000010)
+
+//! Fast IO Mask register upper half-word (pins 16-31).
+#define FIOMASKU                       ((unsigned long)0x00000012)
+
+//! Fast IO Value register byte 0 (pins 0-7).
+#define FIOPIN0                        ((unsigned long)0x00000014)
+
+//! Fast IO Value register byte 1 (pins 8-15).
+#define FIOPIN1                        ((unsigned long)0x00000015)
+
+//! Fast IO Value register byte 2 (pins 16-23).
+#define FIOPIN2                        ((unsigned long)0x00000016)
+
+//! Fast IO Value register byte 3 (pins 24-31).
+#define FIOPIN3                        ((unsigned long)0x00000017)
+
+//! Fast IO Value register lower half-word (pins 0-15).
+#define FIOPINL                        ((unsigned long)0x00000014)
+
+//! Fast IO Value register upper half-word (pins 16-31).
+#define FIOPINU                        ((unsigned long)0x00000016)
+
+//! Fast IO Set register byte 0 (pins 0-7).
+#define FIOSET0                        ((unsigned long)0x00000018)
+
+//! Fast IO Set register byte 1 (pins 8-15).
+#define FIOSET1                        ((unsigned long)0x00000019)
+
+//! Fast IO Set register byte 2 (pins 16-23).
+#define FIOSET2                        ((unsigned long)0x0000001A)
+
+//! Fast IO Set register byte 3 (pins 24-31).
+#define FIOSET3                        ((unsigned long)0x0000001B)
+
+//! Fast IO Clear register byte 0 (pins 0-7).
+#define FIOCLR0                        ((unsigned long)0x0000001C)
+
+//! Fast IO Clear register byte 1 (pins 8-15).
+#define FIOCLR1                        ((unsigned long)0x0000001D)
+
+//! Fast IO Clear register byte 2 (pins 16-23).
+#define FIOCLR2                        ((unsigned long)0x0000001E)
+
+//! Fast IO Clear register byte 3 (pins 24-31).
+#define FIOCLR3                        ((unsigned long)0x0000001F)
+
 //! \brief GPIO Port 0 Interrupt Rising Control register.
 //! \note  You can use those offset register with GPIO_INT_BASE
 #define IO0IntEnR                      ((unsigned long)0x00000090)
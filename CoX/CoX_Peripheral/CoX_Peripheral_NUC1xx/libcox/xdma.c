@@ -95,7 +95,7 @@ static unsigned long g_psDMAIPSelectReg[] =
 };
 
 #define PDMA_PDSRx(a)  (((a) >> 28) & 0x3)
-#define PDMA_PDSR_M(a) ((((a) & 0xF) << ((a) & 0x1f0000 >> 16)))
+#define PDMA_PDSR_M(a) ((((a) & 0xF) << (((a) & 0x1f0000) >> 16)))
 
 //*****************************************************************************
 //
@@ -466,7 +466,12 @@ PDMAChannelDynamicAssign(unsigned long ulDMASrcRequest,
             break;
         }
     }
-    if(!(ulDMASrcRequest & xDMA_REQUEST_MEM) && ulDMASrcRequest & 0x00000100)
+    //
+    // Peripheral (XX_RX) to Mem type
+    //
+    if((ulDMASrcRequest != xDMA_REQUEST_MEM) &&
+       !(ulDMASrcRequest & 0x00000100) &&
+       (ulDMADestRequest == xDMA_REQUEST_MEM))
     {
         if(g_psDMAChannelAssignTable[ulChannelID].ulChannelID != 
             xDMA_CHANNEL_NOT_EXIST)
@@ -480,7 +485,7 @@ PDMAChannelDynamicAssign(unsigned long ulDMASrcRequest,
             xHWREG(g_psDMAChannelAddress[ulChannelID] + PDMA_CSR) &= 
             ~PDMA_CSR_MODE_M;
             xHWREG(g_psDMAChannelAddress[ulChannelID] + PDMA_CSR) |= 
-            PDMA_CSR_MODE_MTOP;
+            PDMA_CSR_MODE_PTOM;
             return ulChannelID;
         }
         else
@@ -488,8 +493,13 @@ PDMAChannelDynamicAssign(unsigned long ulDMASrcRequest,
             return xDMA_CHANNEL_NOT_EXIST;
         }
     }
-    if(!(ulDMADestRequest & xDMA_REQUEST_MEM) && 
-       !(ulDMADestRequest & 0x00000100))
+
+    //
+    // Mem to Peripheral (XX_TX) type
+    //
+    if((ulDMASrcRequest == xDMA_REQUEST_MEM) &&
+       (ulDMADestRequest != xDMA_REQUEST_MEM) &&
+       (ulDMADestRequest & 0x00000100))
     {
         if(g_psDMAChannelAssignTable[ulChannelID].ulChannelID != 
             xDMA_CHANNEL_NOT_EXIST)
@@ -503,7 +513,7 @@ PDMAChannelDynamicAssign(unsigned long ulDMASrcRequest,
             xHWREG(g_psDMAChannelAddress[ulChannelID] + PDMA_CSR) &= 
             ~PDMA_CSR_MODE_M;
             xHWREG(g_psDMAChannelAddress[ulChannelID] + PDMA_CSR) |= 
-            PDMA_CSR_MODE_PTOM;
+            PDMA_CSR_MODE_MTOP;
             return ulChannelID;
         }
         else
@@ -515,8 +525,8 @@ PDMAChannelDynamicAssign(unsigned long ulDMASrcRequest,
     //
     // Mem to Mem type
     //
-    if((ulDMASrcRequest & xDMA_REQUEST_MEM) &&
-       (ulDMADestRequest & xDMA_REQUEST_MEM))
+    if((ulDMASrcRequest == xDMA_REQUEST_MEM) &&
+       (ulDMADestRequest == xDMA_REQUEST_MEM))
     {
         if(g_psDMAChannelAssignTable[ulChannelID].ulChannelID != 
             xDMA_CHANNEL_NOT_EXIST)
@@ -536,6 +546,11 @@ PDMAChannelDynamicAssign(unsigned long ulDMASrcRequest,
     //
     // when the src request is tx type, or dest request is rx type, assign false.
     //
+    if(g_psDMAChannelAssignTable[ulChannelID].ulChannelID != 
+        xDMA_CHANNEL_NOT_EXIST)
+    {
+        g_psDMAChannelAssignTable[ulChannelID].bChannelAssigned = xfalse;
+    }
     return xDMA_CHANNEL_NOT_EXIST;
 }
 
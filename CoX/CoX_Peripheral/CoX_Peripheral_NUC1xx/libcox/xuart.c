@@ -44,6 +44,7 @@
 #include "xhw_uart.h"
 #include "xdebug.h"
 #include "xsysctl.h"
+#include "xdma.h"
 #include "xuart.h"
 
 
@@ -999,6 +1000,9 @@ UARTCharGet(unsigned long ulBase)
 //! are no characters available, this function waits until a character is
 //! received before returning.
 //!
+//! \note This function polls the FIFO for every byte. To receive frames in
+//! the background use UARTDMARxStart().
+//!
 //! \return xtrue
 //
 //*****************************************************************************
@@ -1802,6 +1806,320 @@ UARTRxTimeOutSet(unsigned long ulBase, unsigned long ulValue)
     xHWREG(ulBase + UART_IER) |= UART_IER_TIME_OUT_EN;
 }
 
+//*****************************************************************************
+//
+// PDMA receive state of UART0 and UART1.
+//
+//*****************************************************************************
+typedef struct
+{
+    //
+    // Base address of the UART port.
+    //
+    unsigned long ulBase;
+
+    //
+    // The PDMA channel that fills the buffer.
+    //
+    unsigned long ulChannel;
+
+    //
+    // The circular receive buffer.
+    //
+    unsigned char *pucBuf;
+    unsigned long ulSize;
+
+    //
+    // Offset of the first byte not handed to the application yet.
+    //
+    unsigned long ulRead;
+
+    //
+    // A frame piece was handed out at the end of the buffer.
+    //
+    xtBoolean bPart;
+
+    //
+    // Frame callback of the application.
+    //
+    xtEventCallback pfnFrame;
+}
+tUARTDMARx;
+
+static tUARTDMARx g_psUARTDMARx[2];
+
+//*****************************************************************************
+//
+//! \internal
+//! \brief Hand the received bytes of a UART to the application.
+//!
+//! \param psRx is the PDMA receive state of the UART port.
+//!
+//! The PDMA write position is read from the current destination address of
+//! the channel. The bytes from the last read position up to it are given to
+//! the frame callback, in two pieces when they wrap at the end of the buffer.
+//!
+//! \return None.
+//
+//*****************************************************************************
+static void
+UARTDMARxFrameNotify(tUARTDMARx *psRx)
+{
+    unsigned long ulWrite;
+
+    ulWrite = PDMACurrentDestAddrGet(psRx->ulChannel) -
+              (unsigned long)psRx->pucBuf;
+    if(ulWrite > psRx->ulSize)
+    {
+        ulWrite = psRx->ulSize;
+    }
+
+    //
+    // The PDMA has been restarted at the buffer head, the frame wrapped.
+    //
+    if(ulWrite < psRx->ulRead)
+    {
+        psRx->pfnFrame(0, (ulWrite != 0) ? UART_DMA_EVENT_PART :
+                       UART_DMA_EVENT_FRAME, psRx->ulSize - psRx->ulRead,
+                       psRx->pucBuf + psRx->ulRead);
+        psRx->bPart = (ulWrite != 0) ? xtrue : xfalse;
+        psRx->ulRead = 0;
+    }
+
+    if(ulWrite > psRx->ulRead)
+    {
+        psRx->pfnFrame(0, UART_DMA_EVENT_FRAME, ulWrite - psRx->ulRead,
+                       psRx->pucBuf + psRx->ulRead);
+        psRx->ulRead = ulWrite;
+    }
+    else if(psRx->bPart)
+    {
+        //
+        // The frame ended right at the end of the buffer.
+        //
+        psRx->pfnFrame(0, UART_DMA_EVENT_FRAME, 0, psRx->pucBuf);
+    }
+    psRx->bPart = xfalse;
+}
+
+//*****************************************************************************
+//
+//! \internal
+//! \brief Restart the PDMA of a UART at the head of the buffer.
+//!
+//! \param psRx is the PDMA receive state of the UART port.
+//!
+//! Called when the PDMA reaches the end of the buffer. The bytes of the
+//! current frame that are still at the end of the buffer are handed out
+//! first, so a frame may be longer than the buffer.
+//!
+//! \return None.
+//
+//*****************************************************************************
+static void
+UARTDMARxRestart(tUARTDMARx *psRx)
+{
+    PDMAChannelTransferSet(psRx->ulChannel,
+                           (void *)(psRx->ulBase + UART_RBR),
+                           psRx->pucBuf, psRx->ulSize);
+
+    if(psRx->ulRead < psRx->ulSize)
+    {
+        psRx->pfnFrame(0, UART_DMA_EVENT_PART, psRx->ulSize - psRx->ulRead,
+                       psRx->pucBuf + psRx->ulRead);
+        psRx->bPart = xtrue;
+    }
+    psRx->ulRead = 0;
+}
+
+//*****************************************************************************
+//
+//! \internal
+//! \brief UART interrupt callbacks in PDMA receive mode.
+//!
+//! \return 0.
+//
+//*****************************************************************************
+static unsigned long
+UART0DMARxIntCallback(void *pvCBData, unsigned long ulEvent,
+                      unsigned long ulMsgParam, void *pvMsgData)
+{
+    if(ulMsgParam & (UART_ISR_HW_TOUT_INT | UART_ISR_TOUT_INT))
+    {
+        UARTDMARxFrameNotify(&g_psUARTDMARx[0]);
+    }
+    return 0;
+}
+
+static unsigned long
+UART1DMARxIntCallback(void *pvCBData, unsigned long ulEvent,
+                      unsigned long ulMsgParam, void *pvMsgData)
+{
+    if(ulMsgParam & (UART_ISR_HW_TOUT_INT | UART_ISR_TOUT_INT))
+    {
+        UARTDMARxFrameNotify(&g_psUARTDMARx[1]);
+    }
+    return 0;
+}
+
+//*****************************************************************************
+//
+//! \internal
+//! \brief PDMA interrupt callbacks in UART PDMA receive mode.
+//!
+//! \return 0.
+//
+//*****************************************************************************
+static unsigned long
+UART0DMARxTCCallback(void *pvCBData, unsigned long ulEvent,
+                     unsigned long ulMsgParam, void *pvMsgData)
+{
+    if(ulMsgParam)
+    {
+        UARTDMARxRestart(&g_psUARTDMARx[0]);
+    }
+    return 0;
+}
+
+static unsigned long
+UART1DMARxTCCallback(void *pvCBData, unsigned long ulEvent,
+                     unsigned long ulMsgParam, void *pvMsgData)
+{
+    if(ulMsgParam)
+    {
+        UARTDMARxRestart(&g_psUARTDMARx[1]);
+    }
+    return 0;
+}
+
+//*****************************************************************************
+//
+//! \brief Start receiving a UART into a circular buffer by PDMA.
+//!
+//! \param ulBase is the base address of the UART port, \b UART0_BASE or
+//! \b UART1_BASE.
+//! \param pucBuf is the circular receive buffer.
+//! \param ulSize is the size of the buffer in bytes.
+//! \param ulTimeOut is the idle time, in bit times, that ends a frame. It
+//! must be less than 64, 35 is 3.5 characters of 8N1 (Modbus RTU).
+//! \param pfnFrame is the frame callback.
+//!
+//! A PDMA channel moves every received byte into the buffer, no interrupt is
+//! taken per byte. When the line stays idle for \e ulTimeOut bit times the RX
+//! time-out interrupt reads the PDMA write position and calls \e pfnFrame
+//! with the new bytes:
+//!
+//! - pvCBData not used, always 0.
+//! - ulEvent is \b UART_DMA_EVENT_FRAME for the last piece of a frame, or
+//! \b UART_DMA_EVENT_PART when the frame goes on at the buffer head.
+//! - ulMsgParam is the length of the piece, the last piece may be empty.
+//! - pvMsgData points to the piece in the buffer.
+//! .
+//!
+//! The PDMA is restarted at the head of the buffer each time it reaches the
+//! end, so one frame costs one interrupt, plus one per buffer wrap. The
+//! callbacks run in interrupt context and the pieces are overwritten after
+//! another \e ulSize bytes, copy them out or parse them in the callback.
+//!
+//! \note The PDMA clock is enabled here. INT_PDMA and the UART interrupt must
+//! be enabled by the application, at the same priority.
+//!
+//! \return Returns \b xtrue if a PDMA channel was assigned, \b xfalse
+//! otherwise.
+//
+//*****************************************************************************
+xtBoolean
+UARTDMARxStart(unsigned long ulBase, unsigned char *pucBuf,
+               unsigned long ulSize, unsigned long ulTimeOut,
+               xtEventCallback pfnFrame)
+{
+    tUARTDMARx *psRx;
+    unsigned long ulChannel;
+
+    //
+    // Check the arguments.
+    //
+    xASSERT((ulBase == UART0_BASE) || (ulBase == UART1_BASE));
+    xASSERT((pucBuf != 0) && (ulSize != 0) && (pfnFrame != 0));
+
+    SysCtlPeripheralEnable(SYSCTL_PERIPH_PDMA);
+
+    ulChannel = PDMAChannelDynamicAssign((ulBase == UART0_BASE) ?
+                                         xDMA_REQUEST_UART0_RX :
+                                         xDMA_REQUEST_UART1_RX,
+                                         xDMA_REQUEST_MEM);
+    if(ulChannel == xDMA_CHANNEL_NOT_EXIST)
+    {
+        return xfalse;
+    }
+
+    psRx = &g_psUARTDMARx[(ulBase == UART0_BASE) ? 0 : 1];
+    psRx->ulBase = ulBase;
+    psRx->ulChannel = ulChannel;
+    psRx->pucBuf = pucBuf;
+    psRx->ulSize = ulSize;
+    psRx->ulRead = 0;
+    psRx->bPart = xfalse;
+    psRx->pfnFrame = pfnFrame;
+
+    //
+    // Peripheral to memory, byte wide, into the buffer.
+    //
+    PDMAEnable(ulChannel);
+    PDMAChannelControlSet(ulChannel, PDMA_SRC_DIR_FIXED | PDMA_DST_DIR_INC |
+                                     PDMA_WIDTH_8BIT);
+    PDMAChannelIntCallbackInit(ulChannel, (ulBase == UART0_BASE) ?
+                               UART0DMARxTCCallback : UART1DMARxTCCallback);
+    PDMAChannelIntEnable(ulChannel, PDMA_EVENT_TC);
+    PDMAChannelTransferSet(ulChannel, (void *)(ulBase + UART_RBR),
+                           pucBuf, ulSize);
+
+    //
+    // The RX time-out marks the end of a frame.
+    //
+    UARTIntCallbackInit(ulBase, (ulBase == UART0_BASE) ?
+                        UART0DMARxIntCallback : UART1DMARxIntCallback);
+    UARTRxTimeOutSet(ulBase, ulTimeOut);
+    xHWREG(ulBase + UART_IER) |= UART_IER_RTO_IEN | UART_IER_DMA_RX_EN;
+
+    return xtrue;
+}
+
+//*****************************************************************************
+//
+//! \brief Stop the PDMA receive of a UART.
+//!
+//! \param ulBase is the base address of the UART port, \b UART0_BASE or
+//! \b UART1_BASE.
+//!
+//! Stops the receive started by UARTDMARxStart() and frees its PDMA channel.
+//! Bytes that are not yet handed out are dropped.
+//!
+//! \return None.
+//
+//*****************************************************************************
+void
+UARTDMARxStop(unsigned long ulBase)
+{
+    tUARTDMARx *psRx;
+
+    //
+    // Check the arguments.
+    //
+    xASSERT((ulBase == UART0_BASE) || (ulBase == UART1_BASE));
+
+    psRx = &g_psUARTDMARx[(ulBase == UART0_BASE) ? 0 : 1];
+
+    xHWREG(ulBase + UART_IER) &= ~(UART_IER_RTO_IEN | UART_IER_TIME_OUT_EN |
+                                   UART_IER_DMA_RX_EN);
+    UARTIntCallbackInit(ulBase, 0);
+
+    PDMAChannelIntDisable(psRx->ulChannel, PDMA_EVENT_TC);
+    PDMAChannelIntCallbackInit(psRx->ulChannel, 0);
+    PDMADisable(psRx->ulChannel);
+    PDMAChannelDeAssign(psRx->ulChannel);
+}
+
 //*****************************************************************************
 //
 //! \brief Enables SIR (IrDA) mode on the specified UART.
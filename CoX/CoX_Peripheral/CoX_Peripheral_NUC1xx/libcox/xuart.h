@@ -1567,6 +1567,32 @@ extern void xUARTIrDAConfig(unsigned long ulBase, unsigned long ulBaud,
 //
 //*****************************************************************************
 
+//*****************************************************************************
+//
+//! \addtogroup NUC1xx_UART_DMA_Rx_Event NUC1xx UART PDMA Receive Event
+//! \brief Values that show NUC1xx UART PDMA receive events
+//! Values that are passed to the frame callback of UARTDMARxStart() as
+//! \e ulEvent.
+//! @{
+//
+//*****************************************************************************
+
+//
+//! The piece ends the frame.
+//
+#define UART_DMA_EVENT_FRAME    0x00000001
+
+//
+//! The piece ends at the buffer end, the frame goes on at the buffer head.
+//
+#define UART_DMA_EVENT_PART     0x00000002
+
+//*****************************************************************************
+//
+//! @}
+//
+//*****************************************************************************
+
 //*****************************************************************************
 //
 //! \addtogroup NUC1xx_UART_OUTPUT_RTS NUC1xx UART OUTPUT RTS
@@ -1754,6 +1780,10 @@ extern unsigned long UARTModemStatusGet(unsigned long ulBase);
 extern void UARTFlowControlSet(unsigned long ulBase, unsigned long ulMode);
 extern unsigned long UARTFlowControlGet(unsigned long ulBase);
 extern void UARTRxTimeOutSet(unsigned long ulBase, unsigned long ulValue);
+extern xtBoolean UARTDMARxStart(unsigned long ulBase, unsigned char *pucBuf,
+                                unsigned long ulSize, unsigned long ulTimeOut,
+                                xtEventCallback pfnFrame);
+extern void UARTDMARxStop(unsigned long ulBase);
 extern void UART485Config(unsigned long ulBase, unsigned long ulBaud,
                           unsigned long ul485Config,
                           unsigned long ulUARTConfig);
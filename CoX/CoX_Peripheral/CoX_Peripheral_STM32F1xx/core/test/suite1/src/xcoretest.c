@@ -0,0 +1,180 @@
+//*****************************************************************************
+//
+//! @page xcore_testcase xcore test
+//!
+//! File: @ref xcoretest.c
+//!
+//! <h2>Description</h2>
+//! This module implements the test sequence for the xcore sub component.<br><br>
+//! - \p Board: EMSTM32V100 <br><br>
+//! - \p Last-Time(about): 0.1s <br><br>
+//! - \p Phenomenon: Success or failure information will be printed on the UART. <br><br>
+//! .
+//!
+//! <h2>Preconditions</h2>
+//! The module requires the following options:<br><br>
+//! - \p Option-define:
+//! <br>(1)CORE_RAM_VECTORS set to 1 in xhw_config.h.<br><br>
+//! - \p Option-hardware:
+//! <br>(1)None.<br><br>
+//! - \p Option-OtherModule:
+//! <br>Connect an COM cable to the development board.<br>
+//! .
+//! In case some of the required options are not enabled then some or all tests
+//! may be skipped or result FAILED.<br>
+//!
+//! <h2>Test Cases</h2>
+//! The module contain those sub tests:<br><br>
+//! - \subpage test_xcore_register
+//! .
+//! \file xcoretest.c
+//! \brief xcore test source file
+//! \brief xcore test header file <br>
+//
+//*****************************************************************************
+
+#include "test.h"
+
+//*****************************************************************************
+//
+//!\page test_xcore_register test_xcore_register
+//!
+//!<h2>Description</h2>
+//!Test xIntRegister() and xIntUnregister() on the TIM2 vector, pended by
+//!software so no timer runs. <br>
+//!
+//
+//*****************************************************************************
+
+//
+// Times the registered handler was entered.
+//
+static unsigned long ulHandlerCount;
+
+//*****************************************************************************
+//
+//! \brief The handler put in the TIM2 vector.
+//!
+//! \return None.
+//
+//*****************************************************************************
+static void xcoreTestHandler(void)
+{
+    ulHandlerCount++;
+}
+
+//*****************************************************************************
+//
+//! \brief Get the Test description of xcore001 register test.
+//!
+//! \return the desccription of the xcore001 test.
+//
+//*****************************************************************************
+static char* xcore001GetTest(void)
+{
+    return "xcore [001]: interrupt register test";
+}
+
+//*****************************************************************************
+//
+//! \brief something should do before the test execute of xcore001 test.
+//!
+//! \return None.
+//
+//*****************************************************************************
+static void xcore001Setup(void)
+{
+    ulHandlerCount = 0;
+}
+
+//*****************************************************************************
+//
+//! \brief something should do after the test execute of xcore001 test.
+//!
+//! \return None.
+//
+//*****************************************************************************
+static void xcore001TearDown(void)
+{
+    xIntDisable(INT_TIM2);
+    xIntPendClear(INT_TIM2);
+}
+
+//*****************************************************************************
+//
+//! \brief xcore 001 test execute main body.
+//!
+//! \return None.
+//
+//*****************************************************************************
+static void xcore001Execute(void)
+{
+#if (CORE_RAM_VECTORS == 1)
+    unsigned long ulTable, ulTimer, ulSysTick, ulTimeOut;
+
+    ulTable = xHWREG(NVIC_VTOR);
+    ulTimer = xHWREG(ulTable + INT_TIM2 * 4);
+    ulSysTick = xHWREG(ulTable + FAULT_SYSTICK * 4);
+
+    //
+    // The table moves to SRAM, only the TIM2 vector changes.
+    //
+    xIntRegister(INT_TIM2, xcoreTestHandler);
+    TestAssert(xHWREG(NVIC_VTOR) != ulTable,
+               "xcore API \"xIntRegister\" error");
+    ulTable = xHWREG(NVIC_VTOR);
+    TestAssert(xHWREG(ulTable + INT_TIM2 * 4) ==
+               (unsigned long)xcoreTestHandler,
+               "xcore API \"xIntRegister\" error");
+    TestAssert(xHWREG(ulTable + FAULT_SYSTICK * 4) == ulSysTick,
+               "xcore API \"xIntRegister\" error");
+
+    //
+    // The pended interrupt enters the new handler.
+    //
+    xIntEnable(INT_TIM2);
+    xIntPendSet(INT_TIM2);
+    ulTimeOut = 0xFFFF;
+    while((ulHandlerCount == 0) && (--ulTimeOut != 0))
+    {
+    }
+    TestAssert(ulHandlerCount == 1, "xcore API \"xIntRegister\" error");
+    xIntDisable(INT_TIM2);
+
+    //
+    // A second register keeps the table in SRAM.
+    //
+    xIntRegister(INT_TIM2, xcoreTestHandler);
+    TestAssert(xHWREG(NVIC_VTOR) == ulTable,
+               "xcore API \"xIntRegister\" error");
+
+    //
+    // The flash handler is back, the table stays in SRAM.
+    //
+    xIntUnregister(INT_TIM2);
+    TestAssert((xHWREG(NVIC_VTOR) == ulTable) &&
+               (xHWREG(ulTable + INT_TIM2 * 4) == ulTimer),
+               "xcore API \"xIntUnregister\" error");
+#else
+    TestAssert(0, "xcore API \"xIntRegister\" needs CORE_RAM_VECTORS 1");
+#endif
+}
+
+//
+// xcore register test case struct.
+//
+const tTestCase sTestxcore001Register = {
+    xcore001GetTest,
+    xcore001Setup,
+    xcore001TearDown,
+    xcore001Execute
+};
+
+//
+// xcore test suits.
+//
+const tTestCase * const psPatternXcore00[] =
+{
+    &sTestxcore001Register,
+    0
+};
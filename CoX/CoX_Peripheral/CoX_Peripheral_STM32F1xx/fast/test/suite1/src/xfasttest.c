@@ -0,0 +1,404 @@
+//*****************************************************************************
+//
+//! @page xfast_testcase xfast benchmark
+//!
+//! File: @ref xfasttest.c
+//!
+//! <h2>Description</h2>
+//! This module measures the libcox primitives against their xfast.h inline
+//! variants.<br><br>
+//! - \p Board: EMSTM32V100 <br><br>
+//! - \p Last-Time(about): 0.1s <br><br>
+//! - \p Phenomenon: For each primitive a line
+//! <tt>FAST name instr=I cycles=C -> instr=I cycles=C</tt> (libcox call ->
+//! inline variant) and the success or failure information will be printed on
+//! the UART. <br><br>
+//! .
+//!
+//! <h2>Preconditions</h2>
+//! The module requires the following options:<br><br>
+//! - \p Option-define:
+//! <br>(1)Build with optimization (-O2), else nothing is inlined.<br><br>
+//! - \p Option-hardware:
+//! <br>(1)None, USART2 and SPI2 are used without their pins.<br><br>
+//! - \p Option-OtherModule:
+//! <br>Connect an COM cable to the development board.<br>
+//! .
+//! In case some of the required options are not enabled then some or all tests
+//! may be skipped or result FAILED.<br>
+//!
+//! <h2>Test Cases</h2>
+//! The module contain those sub tests:<br><br>
+//! - \subpage test_xfast_bench
+//! .
+//! \file xfasttest.c
+//! \brief xfast test source file
+//! \brief xfast test header file <br>
+//
+//*****************************************************************************
+
+#include "test.h"
+#include "xspi.h"
+#include "xhw_spi.h"
+#include "xfast.h"
+
+//*****************************************************************************
+//
+//!\page test_xfast_bench test_xfast_bench
+//!
+//!<h2>Description</h2>
+//!Count the instructions and cycles of one call of each primitive. <br>
+//!
+//! The instructions are worked out from the DWT profiling counters:
+//! CYCCNT - CPICNT - EXCCNT - SLEEPCNT - LSUCNT + FOLDCNT. The 8-bit
+//! counters are cleared before every call, which takes far less than 256
+//! stall cycles. The cost of calling an empty function the same way is taken
+//! off, so the numbers are those of the call site: argument set up, the
+//! call and the body. The SPI lines include the wait for the 8 bit clocks.
+//
+//*****************************************************************************
+
+//
+// DWT profiling counters.
+//
+#define DWT_CTRL                0xE0001000
+#define DWT_CYCCNT              0xE0001004
+#define DWT_CPICNT              0xE0001008
+#define DWT_EXCCNT              0xE000100C
+#define DWT_SLEEPCNT            0xE0001010
+#define DWT_LSUCNT              0xE0001014
+#define DWT_FOLDCNT             0xE0001018
+
+//
+// CYCCNTENA, CPIEVTENA, EXCEVTENA, SLEEPEVTENA, LSUEVTENA and FOLDEVTENA.
+//
+#define DWT_CTRL_COUNT_EN       0x003E0001
+
+//
+// Trace enable bit of NVIC_DBG_INT (DEMCR).
+//
+#define NVIC_DBG_INT_TRCENA     0x01000000
+
+//
+// Best of this many calls is kept.
+//
+#define FAST_RUNS               8
+
+typedef struct
+{
+    char *pcName;
+
+    //
+    // Wait for the peripheral to be ready, not counted.
+    //
+    void (*pfnSetup)(void);
+
+    void (*pfnLib)(void);
+    void (*pfnFast)(void);
+}
+tFastBench;
+
+static unsigned char ucData[8];
+
+//*****************************************************************************
+//
+//! \brief Print a string on the test port.
+//
+//*****************************************************************************
+static void
+FastPrint(char *pcMsg)
+{
+    while(*pcMsg)
+    {
+        TestIOPut(*pcMsg++);
+    }
+}
+
+//*****************************************************************************
+//
+//! \brief Print a decimal number on the test port.
+//
+//*****************************************************************************
+static void
+FastPrintN(unsigned long ulNum)
+{
+    char cBuf[11];
+    int i = 10;
+
+    cBuf[i] = 0;
+    do
+    {
+        cBuf[--i] = '0' + ulNum % 10;
+        ulNum /= 10;
+    }
+    while(ulNum);
+    FastPrint(&cBuf[i]);
+}
+
+//
+// The primitives with constant arguments, libcox call and inline variant.
+//
+static void FastEmpty(void)
+{
+}
+
+static void GPIOWriteLib(void)
+{
+    GPIOPinWrite(GPIOC_BASE, GPIO_PIN_13, 1);
+}
+
+static void GPIOWriteFast(void)
+{
+    GPIOFastPinWrite(GPIOC_BASE, GPIO_PIN_13, 1);
+}
+
+static void GPIOReadLib(void)
+{
+    ucData[0] = (unsigned char)GPIOPinRead(GPIOC_BASE, GPIO_PIN_13);
+}
+
+static void GPIOReadFast(void)
+{
+    ucData[0] = (unsigned char)GPIOFastPinRead(GPIOC_BASE, GPIO_PIN_13);
+}
+
+static void UARTPutLib(void)
+{
+    UARTCharPut(USART2_BASE, 'U');
+}
+
+static void UARTPutFast(void)
+{
+    UARTFastCharPut(USART2_BASE, 'U');
+}
+
+static void UARTGetLib(void)
+{
+    ucData[0] = (unsigned char)UARTCharGetNonBlocking(USART2_BASE);
+}
+
+static void UARTGetFast(void)
+{
+    ucData[0] = (unsigned char)UARTFastCharGetNonBlocking(USART2_BASE);
+}
+
+static void SPIXferLib(void)
+{
+    ucData[0] = (unsigned char)SPISingleDataReadWrite(SPI2_BASE, 0x55);
+}
+
+static void SPIXferFast(void)
+{
+    ucData[0] = SPIFastReadWrite8(SPI2_BASE, 0x55);
+}
+
+static void SPIWriteLib(void)
+{
+    SPIDataWrite(SPI2_BASE, ucData, sizeof(ucData));
+}
+
+static void SPIWriteFast(void)
+{
+    SPIFastDataWrite8(SPI2_BASE, ucData, sizeof(ucData));
+}
+
+static void UARTWait(void)
+{
+    while(!(xHWREG(USART2_BASE + USART_SR) & USART_SR_TXE))
+    {
+    }
+}
+
+static void SPIWait(void)
+{
+    while(xHWREG(SPI2_BASE + SPI_SR) & SPI_SR_BSY)
+    {
+    }
+    while(xHWREG(SPI2_BASE + SPI_SR) & SPI_SR_RXNE)
+    {
+        ucData[0] = (unsigned char)xHWREG(SPI2_BASE + SPI_DR);
+    }
+}
+
+static const tFastBench sFastBench[] =
+{
+    {"GPIOPinWrite",           0,        GPIOWriteLib, GPIOWriteFast},
+    {"GPIOPinRead",            0,        GPIOReadLib,  GPIOReadFast},
+    {"UARTCharPut",            UARTWait, UARTPutLib,   UARTPutFast},
+    {"UARTCharGetNonBlocking", 0,        UARTGetLib,   UARTGetFast},
+    {"SPISingleDataReadWrite", SPIWait,  SPIXferLib,   SPIXferFast},
+    {"SPIDataWrite(8 bytes)",  SPIWait,  SPIWriteLib,  SPIWriteFast},
+};
+
+//*****************************************************************************
+//
+//! \brief Count the instructions and cycles of one function, best of
+//! FAST_RUNS calls.
+//!
+//! \return None.
+//
+//*****************************************************************************
+static void
+FastCount(void (*pfnSetup)(void), void (*pfnRun)(void),
+          unsigned long *pulInstr, unsigned long *pulCycle)
+{
+    unsigned long ulCycle, ulInstr, i;
+
+    *pulInstr = 0xFFFFFFFF;
+    *pulCycle = 0xFFFFFFFF;
+    for(i = 0; i < FAST_RUNS; i++)
+    {
+        if(pfnSetup)
+        {
+            pfnSetup();
+        }
+
+        TestDisableIRQ();
+        xHWREG(DWT_CPICNT) = 0;
+        xHWREG(DWT_EXCCNT) = 0;
+        xHWREG(DWT_SLEEPCNT) = 0;
+        xHWREG(DWT_LSUCNT) = 0;
+        xHWREG(DWT_FOLDCNT) = 0;
+        xHWREG(DWT_CYCCNT) = 0;
+        pfnRun();
+        ulCycle = xHWREG(DWT_CYCCNT);
+        ulInstr = ulCycle - xHWREG(DWT_CPICNT) - xHWREG(DWT_EXCCNT) -
+                  xHWREG(DWT_SLEEPCNT) - xHWREG(DWT_LSUCNT) +
+                  xHWREG(DWT_FOLDCNT);
+        TestEnableIRQ();
+
+        if(ulCycle < *pulCycle)
+        {
+            *pulCycle = ulCycle;
+        }
+        if(ulInstr < *pulInstr)
+        {
+            *pulInstr = ulInstr;
+        }
+    }
+}
+
+//*****************************************************************************
+//
+//! \brief Get the Test description of xfast benchmark.
+//!
+//! \return the desccription of the xfast benchmark.
+//
+//*****************************************************************************
+static char* xfast001GetTest(void)
+{
+    return "xfast, 001, inline fast path benchmark";
+}
+
+//*****************************************************************************
+//
+//! \brief Something should do before the test execute of xfast benchmark.
+//!
+//! \return None.
+//
+//*****************************************************************************
+static void xfast001Setup(void)
+{
+    xHWREG(NVIC_DBG_INT) |= NVIC_DBG_INT_TRCENA;
+    xHWREG(DWT_CTRL) |= DWT_CTRL_COUNT_EN;
+
+    xSysCtlPeripheralEnable(SYSCTL_PERIPH_IOPC);
+    xGPIOSDirModeSet(PC13, xGPIO_DIR_MODE_OUT);
+
+    xSysCtlPeripheralEnable(SYSCTL_PERIPH_USART2);
+    xUARTConfigSet(USART2_BASE, 115200, (UART_CONFIG_WLEN_8 |
+                                         UART_CONFIG_STOP_ONE |
+                                         UART_CONFIG_PAR_NONE));
+    xUARTEnable(USART2_BASE, (UART_BLOCK_UART | UART_BLOCK_TX | UART_BLOCK_RX));
+
+    xSysCtlPeripheralEnable(SYSCTL_PERIPH_SPI2);
+    xSPIConfigSet(SPI2_BASE, 4000000, xSPI_MOTO_FORMAT_MODE_0 |
+                                      xSPI_MODE_MASTER |
+                                      xSPI_MSB_FIRST |
+                                      xSPI_DATA_WIDTH8);
+    xSPISSSet(SPI2_BASE, SPI_SS_SOFTWARE, xSPI_SS_NONE);
+    xSPIEnable(SPI2_BASE);
+}
+
+//*****************************************************************************
+//
+//! \brief Something should do after the test execute of xfast benchmark.
+//!
+//! \return None.
+//
+//*****************************************************************************
+static void xfast001TearDown(void)
+{
+    xSPIDisable(SPI2_BASE);
+    xUARTDisable(USART2_BASE, (UART_BLOCK_UART | UART_BLOCK_TX |
+                               UART_BLOCK_RX));
+}
+
+//*****************************************************************************
+//
+//! \brief xfast benchmark execute main body.
+//!
+//! \return None.
+//
+//*****************************************************************************
+static void xfast001Execute(void)
+{
+    unsigned long ulInstr[2], ulCycle[2], ulBaseInstr, ulBaseCycle, i, j;
+
+    //
+    // The inline variants do what the libcox calls do.
+    //
+    GPIOFastPinWrite(GPIOC_BASE, GPIO_PIN_13, 1);
+    TestAssert(GPIOPinRead(GPIOC_BASE, GPIO_PIN_13) == GPIO_PIN_13,
+               "xfast API \"GPIOFastPinWrite()\" error!");
+    TestAssert(xGPIOFastSPinRead(PC13) == 1,
+               "xfast API \"xGPIOFastSPinRead()\" error!");
+    xGPIOFastSPinWrite(PC13, 0);
+    TestAssert(GPIOFastPinRead(GPIOC_BASE, GPIO_PIN_13) == 0,
+               "xfast API \"xGPIOFastSPinWrite()\" error!");
+
+    FastCount(0, FastEmpty, &ulBaseInstr, &ulBaseCycle);
+
+    for(i = 0; i < sizeof(sFastBench) / sizeof(sFastBench[0]); i++)
+    {
+        FastCount(sFastBench[i].pfnSetup, sFastBench[i].pfnLib,
+                  &ulInstr[0], &ulCycle[0]);
+        FastCount(sFastBench[i].pfnSetup, sFastBench[i].pfnFast,
+                  &ulInstr[1], &ulCycle[1]);
+
+        FastPrint("FAST ");
+        FastPrint(sFastBench[i].pcName);
+        for(j = 0; j < 2; j++)
+        {
+            ulInstr[j] -= (ulInstr[j] > ulBaseInstr) ? ulBaseInstr : ulInstr[j];
+            ulCycle[j] -= (ulCycle[j] > ulBaseCycle) ? ulBaseCycle : ulCycle[j];
+            FastPrint(j ? " -> instr=" : " instr=");
+            FastPrintN(ulInstr[j]);
+            FastPrint(" cycles=");
+            FastPrintN(ulCycle[j]);
+        }
+        FastPrint("\r\n");
+
+        TestAssert(ulInstr[1] < ulInstr[0], "xfast benchmark: the inline "
+                   "variant is not shorter!");
+    }
+}
+
+//
+// xfast benchmark case struct.
+//
+const tTestCase sTestXFastBench = {
+    xfast001GetTest,
+    xfast001Setup,
+    xfast001TearDown,
+    xfast001Execute
+};
+
+//
+// xfast test suits.
+//
+const tTestCase * const psPatternXfast00[] =
+{
+    &sTestXFastBench,
+    0
+};
@@ -45,6 +45,11 @@
 //
 //*****************************************************************************
 
+//
+// Data of the PA.0 interrupt callback.
+//
+static unsigned long ulLineData;
+
 //*****************************************************************************
 //! \breif External interrupt handler.
 //!
@@ -54,7 +59,13 @@
 unsigned long user_Callback0(void *pvCBData, unsigned long ulEvent, 
                                      unsigned long ulMsgParam, void *pvMsgData)                                        
 {
-    TestEmitToken('a');
+    //
+    // The line data and the pin of the line are passed.
+    //
+    if((pvCBData == &ulLineData) && (ulEvent == GPIO_PIN_0))
+    {
+        TestEmitToken('a');
+    }
     xIntDisable(xINT_GPIOA);
     return 0;
 }
@@ -116,6 +127,7 @@ static void xgpio002Execute(void)
     // Set GPIO pin interrupt callback.
     //
     xGPIOPinIntCallbackInit(xGPIO_PORTA_BASE, xGPIO_PIN_0, user_Callback0);
+    GPIOPinIntCallbackDataSet(xGPIO_PORTA_BASE, xGPIO_PIN_0, &ulLineData);
     
     //
     // Enable GPIO pin interrupt.
@@ -0,0 +1,252 @@
+//*****************************************************************************
+//
+//! @page xidle_testcase xidle test
+//!
+//! File: @ref xidletest.c
+//!
+//! <h2>Description</h2>
+//! This module implements the test sequence for the xidle sub component.<br><br>
+//! - \p Board: EMSTM32V100 <br><br>
+//! - \p Last-Time(about): 1s <br><br>
+//! - \p Phenomenon: Success or failure information will be printed on the UART. <br><br>
+//! .
+//!
+//! <h2>Preconditions</h2>
+//! The module requires the following options:<br><br>
+//! - \p Option-define:
+//! <br>(1)None.<br><br>
+//! - \p Option-hardware:
+//! <br>(1)A 32768 Hz LSE crystal, the RTC runs at 1024 Hz.<br><br>
+//! - \p Option-OtherModule:
+//! <br>Connect an COM cable to the development board.<br>
+//! .
+//! In case some of the required options are not enabled then some or all tests
+//! may be skipped or result FAILED.<br>
+//!
+//! <h2>Test Cases</h2>
+//! The module contain those sub tests:<br><br>
+//! - \subpage test_xidle_timer
+//! .
+//! \file xidletest.c
+//! \brief xidle test source file
+//! \brief xidle test header file <br>
+//
+//*****************************************************************************
+
+#include "test.h"
+#include "xhw_rtc.h"
+#include "xrtc.h"
+#include "xdma.h"
+#include "xidle.h"
+
+//*****************************************************************************
+//
+//!\page test_xidle_timer test_xidle_timer
+//!
+//!<h2>Description</h2>
+//!Test the software timers, the mode limits and the tick compensation of
+//!Sleep and Stop. <br>
+//
+//*****************************************************************************
+
+//
+// 1 ms tick, RTC on LSE with a 1024 Hz counter.
+//
+#define IDLE_TEST_TICK_FREQ     1000
+#define IDLE_TEST_RTC_DIV       32
+
+static tIdleTimer sTimer[3];
+static unsigned long ulOrder[3];
+static unsigned long ulFired;
+
+static unsigned long ulDMAData[4];
+
+//*****************************************************************************
+//
+//! \brief The tick of the idle manager.
+//!
+//! \return None.
+//
+//*****************************************************************************
+void SysTickIntHandler(void)
+{
+    xIdleTickHandler();
+}
+
+//*****************************************************************************
+//
+//! \brief Timer callback, records the timer order.
+//!
+//! \return None.
+//
+//*****************************************************************************
+static void xidleTimerCallback(void *pvArg)
+{
+    if(ulFired < 3)
+    {
+        ulOrder[ulFired] = (unsigned long)pvArg;
+    }
+    ulFired++;
+}
+
+//*****************************************************************************
+//
+//! \brief Read the RTC counter.
+//!
+//! \return the RTC counter.
+//
+//*****************************************************************************
+static unsigned long xidleRTCGet(void)
+{
+    return ((xHWREG(RTC_CNTH) << 16) | (xHWREG(RTC_CNTL) & 0xFFFF));
+}
+
+//*****************************************************************************
+//
+//! \brief Get the Test description of xidle001 test.
+//!
+//! \return the desccription of the xidle001 test.
+//
+//*****************************************************************************
+static char* xidle001GetTest(void)
+{
+    return "xidle, 001, timers, limits and Stop mode test";
+}
+
+//*****************************************************************************
+//
+//! \brief something should do before the test execute of xidle001 test.
+//!
+//! \return None.
+//
+//*****************************************************************************
+static void xidle001Setup(void)
+{
+    xSysCtlPeripheralEnable(SYSCTL_PERIPH_PWR);
+    SysCtlBackupAccessEnable();
+    SysCtlLSEConfig(SYSCTL_LSE_OSC_EN);
+    SysCtlPeripheralClockSourceSet(SYSCTL_RTC_LSE, 1);
+    xSysCtlPeripheralEnable(SYSCTL_PERIPH_RTC);
+    RTCTimeInit(IDLE_TEST_RTC_DIV - 1);
+
+    xSysCtlPeripheralEnable(SYSCTL_PERIPH_DMA1);
+
+    xIdleInit(IDLE_TEST_TICK_FREQ, 32768, IDLE_TEST_RTC_DIV);
+}
+
+//*****************************************************************************
+//
+//! \brief something should do after the test execute of xidle001 test.
+//!
+//! \return None.
+//
+//*****************************************************************************
+static void xidle001TearDown(void)
+{
+    xIdleModeLimit(xIDLE_SOURCE_USER(1), xIDLE_MODE_STANDBY);
+    DMADisable(DMA1_CHANNEL_1);
+    xSysTickIntDisable();
+    xSysTickDisable();
+}
+
+//*****************************************************************************
+//
+//! \brief xidle 001 test execute main body.
+//!
+//! \return None.
+//
+//*****************************************************************************
+static void xidle001Execute(void)
+{
+    unsigned long ulTick, ulRTC, ulStat, ulMs;
+
+    //
+    // Timers expire in deadline order, a stopped timer does not.
+    //
+    ulFired = 0;
+    xIdleTimerStart(&sTimer[0], 30, xidleTimerCallback, (void *)0);
+    xIdleTimerStart(&sTimer[1], 10, xidleTimerCallback, (void *)1);
+    xIdleTimerStart(&sTimer[2], 20, xidleTimerCallback, (void *)2);
+    xIdleTimerStop(&sTimer[2]);
+    ulTick = xIdleTickGet();
+    xIdleDelay(40);
+    TestAssert((xIdleTickGet() - ulTick >= 40) && (ulFired == 2) &&
+               (ulOrder[0] == 1) && (ulOrder[1] == 0),
+               "xidle API \"xIdleTimerStart()\" error!");
+
+    //
+    // The lightest limit wins, Standby only when the system allows it.
+    //
+    TestAssert(xIdleModeGet() == xIDLE_MODE_STOP,
+               "xidle API \"xIdleInit()\" error!");
+    xIdleModeLimit(xIDLE_SOURCE_USER(1), xIDLE_MODE_SLEEP);
+    TestAssert(xIdleModeGet() == xIDLE_MODE_SLEEP,
+               "xidle API \"xIdleModeLimit()\" error!");
+    xIdleModeLimit(xIDLE_SOURCE_USER(1), xIDLE_MODE_RUN);
+    TestAssert(xIdleModeGet() == xIDLE_MODE_RUN,
+               "xidle API \"xIdleModeLimit()\" error!");
+    xIdleModeLimit(xIDLE_SOURCE_SYSTEM, xIDLE_MODE_STANDBY);
+    xIdleModeLimit(xIDLE_SOURCE_USER(1), xIDLE_MODE_STANDBY);
+    TestAssert(xIdleModeGet() == xIDLE_MODE_STANDBY,
+               "xidle API \"xIdleModeLimit()\" error!");
+    xIdleModeLimit(xIDLE_SOURCE_SYSTEM, xIDLE_MODE_STOP);
+
+    //
+    // A DMA channel waiting for data keeps the clocks on.
+    //
+    DMAChannelTransferSet(DMA1_CHANNEL_1, (void *)ulDMAData,
+                          (void *)ulDMAData, 4);
+    DMAEnable(DMA1_CHANNEL_1);
+    TestAssert(xIdleModeGet() == xIDLE_MODE_SLEEP,
+               "xidle API \"xIdleModeGet()\" error!");
+    DMADisable(DMA1_CHANNEL_1);
+    TestAssert(xIdleModeGet() == xIDLE_MODE_STOP,
+               "xidle API \"xIdleModeGet()\" error!");
+
+    //
+    // Sleep stretches the tick, the ticks still add up.
+    //
+    xIdleModeLimit(xIDLE_SOURCE_USER(1), xIDLE_MODE_SLEEP);
+    ulStat = xIdleStatGet(xIDLE_MODE_SLEEP);
+    ulTick = xIdleTickGet();
+    ulRTC = xidleRTCGet();
+    xIdleDelay(200);
+    ulMs = (xidleRTCGet() - ulRTC) * 1000 / 1024;
+    ulTick = xIdleTickGet() - ulTick;
+    TestAssert((xIdleStatGet(xIDLE_MODE_SLEEP) - ulStat > 100) &&
+               (ulTick >= 200) && (ulMs + 3 >= ulTick) && (ulTick + 3 >= ulMs),
+               "xidle API \"xIdleEnter()\" Sleep error!");
+    xIdleModeLimit(xIDLE_SOURCE_USER(1), xIDLE_MODE_STANDBY);
+
+    //
+    // Stop stops SysTick, the time slept is taken from the RTC.
+    //
+    ulStat = xIdleStatGet(xIDLE_MODE_STOP);
+    ulTick = xIdleTickGet();
+    ulRTC = xidleRTCGet();
+    xIdleDelay(500);
+    ulMs = (xidleRTCGet() - ulRTC) * 1000 / 1024;
+    ulTick = xIdleTickGet() - ulTick;
+    TestAssert((xIdleStatGet(xIDLE_MODE_STOP) - ulStat > 250) &&
+               (ulTick >= 500) && (ulMs + 3 >= ulTick) && (ulTick + 3 >= ulMs),
+               "xidle API \"xIdleEnter()\" Stop error!");
+}
+
+//
+// xidle test case struct.
+//
+const tTestCase sTestXIdle001 = {
+    xidle001GetTest,
+    xidle001Setup,
+    xidle001TearDown,
+    xidle001Execute
+};
+
+//
+// xidle test suits.
+//
+const tTestCase * const psPatternXidle00[] =
+{
+    &sTestXIdle001,
+    0
+};
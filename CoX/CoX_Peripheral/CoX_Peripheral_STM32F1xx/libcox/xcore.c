@@ -74,6 +74,31 @@ static const unsigned long g_pulRegs[] =
     NVIC_PRI14, NVIC_PRI15, NVIC_PRI16, NVIC_PRI17, NVIC_PRI18
 };
 
+#if (CORE_RAM_VECTORS == 1)
+//*****************************************************************************
+//
+// The vector table in SRAM used by xIntRegister(). VTOR needs the table
+// aligned on its size rounded up to a power of 2, 128 words.
+//
+//*****************************************************************************
+#if defined(ewarm) || defined(__ICCARM__)
+#pragma data_alignment=512
+static __no_init void (*g_pfnRAMVectors[NUM_INTERRUPTS])(void);
+#elif defined(rvmdk) || defined(__CC_ARM)
+__align(512) static void (*g_pfnRAMVectors[NUM_INTERRUPTS])(void);
+#else
+static void (*g_pfnRAMVectors[NUM_INTERRUPTS])(void)
+                                                __attribute__((aligned(512)));
+#endif
+
+//*****************************************************************************
+//
+// The vector table in use before xIntRegister() moved it to SRAM
+//
+//*****************************************************************************
+static unsigned long g_ulRomVectors;
+#endif
+
 //Note: Commented by cedar 2013-5-27
 //      To avoid the compiler warning: 
 //      "Warning[Pe177]: function "IntDefaultHandler" was declared but never referenced"
@@ -359,6 +384,82 @@ xCPUwfe(void)
 }
 #endif
 
+//*****************************************************************************
+//
+// Wrapper function for the DSB instruction.
+//
+//*****************************************************************************
+#if defined(gcc) || defined(__GNUC__)
+void __attribute__((naked))
+xCPUdsb(void)
+{
+    //
+    // Wait for the memory accesses before it to complete.
+    //
+    __asm("    dsb\n"
+          "    bx      lr\n");
+}
+#endif
+#if defined(ewarm)
+void
+xCPUdsb(void)
+{
+    //
+    // Wait for the memory accesses before it to complete.
+    //
+    __asm("    dsb\n");
+}
+#endif
+#if defined(rvmdk) || defined(__ARMCC_VERSION)
+__asm void
+xCPUdsb(void)
+{
+    //
+    // Wait for the memory accesses before it to complete.
+    //
+    dsb;
+    bx      lr
+}
+#endif
+
+//*****************************************************************************
+//
+// Wrapper function for the ISB instruction.
+//
+//*****************************************************************************
+#if defined(gcc) || defined(__GNUC__)
+void __attribute__((naked))
+xCPUisb(void)
+{
+    //
+    // Flush the pipeline, the next instructions see the new state.
+    //
+    __asm("    isb\n"
+          "    bx      lr\n");
+}
+#endif
+#if defined(ewarm)
+void
+xCPUisb(void)
+{
+    //
+    // Flush the pipeline, the next instructions see the new state.
+    //
+    __asm("    isb\n");
+}
+#endif
+#if defined(rvmdk) || defined(__ARMCC_VERSION)
+__asm void
+xCPUisb(void)
+{
+    //
+    // Flush the pipeline, the next instructions see the new state.
+    //
+    isb;
+    bx      lr
+}
+#endif
+
 //*****************************************************************************
 //
 // Wrapper function for writing the BASEPRI register.
@@ -1428,6 +1529,107 @@ xIntPriorityMaskGet(void)
     return(xCPUbasepriGet());
 }
 
+#if (CORE_RAM_VECTORS == 1)
+//*****************************************************************************
+//
+//! Registers a function to be called when an interrupt occurs.
+//!
+//! \param ulInterrupt specifies the interrupt in question.
+//! \param pfnHandler is a pointer to the function to be called.
+//!
+//! This function puts \e pfnHandler in the vector of \e ulInterrupt, so the
+//! processor enters it directly, without the driver handler and the
+//! xtEventCallback of the driver. The handler must clear the interrupt
+//! source itself.
+//!
+//! The first call copies the vector table in use to SRAM and points VTOR to
+//! it. The other vectors keep their handlers, so the drivers and their
+//! callbacks keep working. Set the priority with xIntPrioritySet() and
+//! enable the interrupt with xIntEnable() as usual.
+//!
+//! \e ulInterrupt must be a single vector, \b FAULT_NMI to
+//! \b INT_OTGFS. The tags as \b INT_GPIO, \b INT_DMA1 are not accepted.
+//!
+//! \note It needs CORE_RAM_VECTORS set to 1 in xhw_config.h.
+//!
+//! \return None.
+//
+//*****************************************************************************
+void
+xIntRegister(unsigned long ulInterrupt, void (*pfnHandler)(void))
+{
+    unsigned long ulIdx, ulPrimask;
+
+    //
+    // Check the arguments.
+    //
+    xASSERT((ulInterrupt >= FAULT_NMI) && (ulInterrupt < NUM_INTERRUPTS));
+    xASSERT(pfnHandler != 0);
+
+    ulPrimask = xCPUcpsid();
+
+    //
+    // Copy the vector table to SRAM the first time.
+    //
+    if(xHWREG(NVIC_VTOR) != (unsigned long)g_pfnRAMVectors)
+    {
+        g_ulRomVectors = xHWREG(NVIC_VTOR);
+        for(ulIdx = 0; ulIdx < NUM_INTERRUPTS; ulIdx++)
+        {
+            g_pfnRAMVectors[ulIdx] = (void (*)(void))
+                                     xHWREG(g_ulRomVectors + ulIdx * 4);
+        }
+        xHWREG(NVIC_VTOR) = (unsigned long)g_pfnRAMVectors;
+    }
+
+    g_pfnRAMVectors[ulInterrupt] = pfnHandler;
+
+    //
+    // The table and VTOR writes must be done before an exception can take
+    // the vector, as ARM requires after a vector table change.
+    //
+    xCPUdsb();
+    xCPUisb();
+
+    if(!ulPrimask)
+    {
+        xCPUcpsie();
+    }
+}
+
+//*****************************************************************************
+//
+//! Unregisters the function to be called when an interrupt occurs.
+//!
+//! \param ulInterrupt specifies the interrupt in question.
+//!
+//! This function puts the handler of the flash vector table back in the
+//! vector of \e ulInterrupt, the driver handler and its callback are called
+//! again.
+//!
+//! \note It needs CORE_RAM_VECTORS set to 1 in xhw_config.h.
+//!
+//! \return None.
+//
+//*****************************************************************************
+void
+xIntUnregister(unsigned long ulInterrupt)
+{
+    //
+    // Check the arguments.
+    //
+    xASSERT((ulInterrupt >= FAULT_NMI) && (ulInterrupt < NUM_INTERRUPTS));
+
+    if(xHWREG(NVIC_VTOR) == (unsigned long)g_pfnRAMVectors)
+    {
+        g_pfnRAMVectors[ulInterrupt] = (void (*)(void))
+                                       xHWREG(g_ulRomVectors + ulInterrupt * 4);
+        xCPUdsb();
+        xCPUisb();
+    }
+}
+#endif
+
 //*****************************************************************************
 //
 //! Enables the SysTick counter.
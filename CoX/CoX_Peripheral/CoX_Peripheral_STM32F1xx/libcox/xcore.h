@@ -107,6 +107,8 @@ extern unsigned long xCPUcpsie(void);
 extern unsigned long xCPUprimask(void);
 extern void xCPUwfi(void);
 extern void xCPUwfe(void);
+extern void xCPUdsb(void);
+extern void xCPUisb(void);
 extern unsigned long xCPUbasepriGet(void);
 extern void xCPUbasepriSet(unsigned long ulNewBasepri);
 extern void xCPUpspSet(unsigned long ulNewPspStack);
@@ -127,6 +129,8 @@ extern void xIntPendSet(unsigned long ulInterrupt);
 extern void xIntPendClear(unsigned long ulInterrupt);
 extern void xIntPriorityMaskSet(unsigned long ulPriorityMask);
 extern unsigned long xIntPriorityMaskGet(void);
+extern void xIntRegister(unsigned long ulInterrupt, void (*pfnHandler)(void));
+extern void xIntUnregister(unsigned long ulInterrupt);
 
 extern void xSysTickEnable(void);
 extern void xSysTickDisable(void);
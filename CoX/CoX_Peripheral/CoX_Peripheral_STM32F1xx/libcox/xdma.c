@@ -45,6 +45,7 @@
 #include "xhw_sysctl.h"
 #include "xhw_dma.h"
 #include "xdebug.h"
+#include "xtrace.h"
 #include "xcore.h"
 #include "xsysctl.h"
 #include "xdma.h"
@@ -160,6 +161,7 @@ DMA1Channel1IntHandler(void)
 {
     unsigned long ulChannelID = 0;
     unsigned long ulStatus;
+    xTRACE_ISR_ENTER();
     ulStatus = xHWREG(DMA1_BASE + DMA_ISR);
     xHWREG(DMA1_BASE + DMA_IFCR) = (ulStatus & (0xF << ulChannelID*4));
     if(g_psDMAChannelAssignTable[ulChannelID].bChannelAssigned == xtrue)
@@ -186,6 +188,8 @@ DMA1Channel1IntHandler(void)
            }
         }
     }
+
+    xTRACE_ISR_EXIT();
 }
 
 //*****************************************************************************
@@ -202,6 +206,7 @@ DMA1Channel3IntHandler(void)
 {
     unsigned long ulChannelID = 2;
     unsigned long ulStatus;
+    xTRACE_ISR_ENTER();
     ulStatus = xHWREG(DMA1_BASE + DMA_ISR);
     xHWREG(DMA1_BASE + DMA_IFCR) = (ulStatus & (0xF << ulChannelID*4));
     if(g_psDMAChannelAssignTable[ulChannelID].bChannelAssigned == xtrue)
@@ -228,6 +233,8 @@ DMA1Channel3IntHandler(void)
            }
         }
     }
+
+    xTRACE_ISR_EXIT();
 }
 
 //*****************************************************************************
@@ -244,6 +251,7 @@ DMA1Channel2IntHandler(void)
 {
     unsigned long ulChannelID = 1;
     unsigned long ulStatus;
+    xTRACE_ISR_ENTER();
     ulStatus = xHWREG(DMA1_BASE + DMA_ISR);
     xHWREG(DMA1_BASE + DMA_IFCR) = (ulStatus & 0xF0);
     if(g_psDMAChannelAssignTable[ulChannelID].bChannelAssigned == xtrue)
@@ -270,6 +278,8 @@ DMA1Channel2IntHandler(void)
            }
         }
     }
+
+    xTRACE_ISR_EXIT();
 }
 
 //*****************************************************************************
@@ -286,6 +296,7 @@ DMA1Channel4IntHandler(void)
 {
     unsigned long ulChannelID = 3;
     unsigned long ulStatus;
+    xTRACE_ISR_ENTER();
     ulStatus = xHWREG(DMA1_BASE + DMA_ISR);
     xHWREG(DMA1_BASE + DMA_IFCR) = (ulStatus & (0xF << ulChannelID*4));
     if(g_psDMAChannelAssignTable[ulChannelID].bChannelAssigned == xtrue)
@@ -312,6 +323,8 @@ DMA1Channel4IntHandler(void)
            }
         }
     }
+
+    xTRACE_ISR_EXIT();
 }
 
 //*****************************************************************************
@@ -328,6 +341,7 @@ DMA1Channel5IntHandler(void)
 {
     unsigned long ulChannelID = 4;
     unsigned long ulStatus;
+    xTRACE_ISR_ENTER();
     ulStatus = xHWREG(DMA1_BASE + DMA_ISR);
     xHWREG(DMA1_BASE + DMA_IFCR) = (ulStatus & (0xF << ulChannelID*4));
     if(g_psDMAChannelAssignTable[ulChannelID].bChannelAssigned == xtrue)
@@ -354,6 +368,8 @@ DMA1Channel5IntHandler(void)
            }
         }
     }
+
+    xTRACE_ISR_EXIT();
 }
 
 //*****************************************************************************
@@ -370,6 +386,7 @@ DMA1Channel6IntHandler(void)
 {
     unsigned long ulChannelID = 5;
     unsigned long ulStatus;
+    xTRACE_ISR_ENTER();
     ulStatus = xHWREG(DMA1_BASE + DMA_ISR);
     xHWREG(DMA1_BASE + DMA_IFCR) = (ulStatus & (0xF << ulChannelID*4));
     if(g_psDMAChannelAssignTable[ulChannelID].bChannelAssigned == xtrue)
@@ -396,6 +413,8 @@ DMA1Channel6IntHandler(void)
            }
         }
     }
+
+    xTRACE_ISR_EXIT();
 }
 
 //*****************************************************************************
@@ -412,6 +431,7 @@ DMA1Channel7IntHandler(void)
 {
     unsigned long ulChannelID = 6;
     unsigned long ulStatus;
+    xTRACE_ISR_ENTER();
     ulStatus = xHWREG(DMA1_BASE + DMA_ISR);
     xHWREG(DMA1_BASE + DMA_IFCR) = (ulStatus & (0xF << ulChannelID*4));
     if(g_psDMAChannelAssignTable[ulChannelID].bChannelAssigned == xtrue)
@@ -438,6 +458,8 @@ DMA1Channel7IntHandler(void)
            }
         }
     }
+
+    xTRACE_ISR_EXIT();
 }
 
 //*****************************************************************************
@@ -454,6 +476,7 @@ DMA2Channel1IntHandler(void)
 {
     unsigned long ulChannelID = 0;
     unsigned long ulStatus;
+    xTRACE_ISR_ENTER();
     ulStatus = xHWREG(DMA2_BASE + DMA_ISR);
     xHWREG(DMA2_BASE + DMA_IFCR) = (ulStatus & (0xF << ulChannelID*4));
     if(g_psDMAChannelAssignTable[ulChannelID].bChannelAssigned == xtrue)
@@ -480,6 +503,8 @@ DMA2Channel1IntHandler(void)
            }
         }
     }
+
+    xTRACE_ISR_EXIT();
 }
 
 //*****************************************************************************
@@ -496,6 +521,7 @@ DMA2Channel2IntHandler(void)
 {
     unsigned long ulChannelID = 1;
     unsigned long ulStatus;
+    xTRACE_ISR_ENTER();
     ulStatus = xHWREG(DMA2_BASE + DMA_ISR);
     xHWREG(DMA2_BASE + DMA_IFCR) = (ulStatus & (0xF << ulChannelID*4));
     if(g_psDMAChannelAssignTable[ulChannelID].bChannelAssigned == xtrue)
@@ -522,6 +548,8 @@ DMA2Channel2IntHandler(void)
            }
         }
     }
+
+    xTRACE_ISR_EXIT();
 }
 
 //*****************************************************************************
@@ -538,6 +566,7 @@ DMA2Channel3IntHandler(void)
 {
     unsigned long ulChannelID = 2;
     unsigned long ulStatus;
+    xTRACE_ISR_ENTER();
     ulStatus = xHWREG(DMA2_BASE + DMA_ISR);
     xHWREG(DMA2_BASE + DMA_IFCR) = (ulStatus & (0xF << ulChannelID*4));
     if(g_psDMAChannelAssignTable[ulChannelID].bChannelAssigned == xtrue)
@@ -564,6 +593,8 @@ DMA2Channel3IntHandler(void)
            }
         }
     }
+
+    xTRACE_ISR_EXIT();
 }
 
 //*****************************************************************************
@@ -580,6 +611,7 @@ DMA2Channel4IntHandler(void)
 {
     unsigned long ulChannelID = 3;
     unsigned long ulStatus;
+    xTRACE_ISR_ENTER();
     ulStatus = xHWREG(DMA2_BASE + DMA_ISR);
     xHWREG(DMA2_BASE + DMA_IFCR) = (ulStatus & (0xF << ulChannelID*4));
     if(g_psDMAChannelAssignTable[ulChannelID].bChannelAssigned == xtrue)
@@ -606,6 +638,8 @@ DMA2Channel4IntHandler(void)
            }
         }
     }
+
+    xTRACE_ISR_EXIT();
 }
 
 //*****************************************************************************
@@ -622,6 +656,7 @@ DMA2Channel5IntHandler(void)
 {
     unsigned long ulChannelID = 4;
     unsigned long ulStatus;
+    xTRACE_ISR_ENTER();
     ulStatus = xHWREG(DMA2_BASE + DMA_ISR);
     xHWREG(DMA2_BASE + DMA_IFCR) = (ulStatus & (0xF << ulChannelID*4));
     if(g_psDMAChannelAssignTable[ulChannelID].bChannelAssigned == xtrue)
@@ -648,6 +683,8 @@ DMA2Channel5IntHandler(void)
            }
         }
     }
+
+    xTRACE_ISR_EXIT();
 }
 
 //*****************************************************************************
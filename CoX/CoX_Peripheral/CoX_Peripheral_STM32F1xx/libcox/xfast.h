@@ -0,0 +1,478 @@
+//*****************************************************************************
+//
+//! \file xfast.h
+//! \brief Inline fast paths of the hot GPIO, UART and SPI primitives.
+//! \version V2.2.1.0
+//! \date 10/19/2026
+//! \author CooCox
+//! \copy
+//!
+//! Copyright (c)  2013, CooCox
+//! All rights reserved.
+//!
+//! Redistribution and use in source and binary forms, with or without
+//! modification, are permitted provided that the following conditions
+//! are met:
+//!
+//!     * Redistributions of source code must retain the above copyright
+//! notice, this list of conditions and the following disclaimer.
+//!     * Redistributions in binary form must reproduce the above copyright
+//! notice, this list of conditions and the following disclaimer in the
+//! documentation and/or other materials provided with the distribution.
+//!     * Neither the name of the <ORGANIZATION> nor the names of its
+//! contributors may be used to endorse or promote products derived
+//! from this software without specific prior written permission.
+//!
+//! THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+//! AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+//! IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+//! ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+//! LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+//! CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+//! SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+//! INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//! CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+//! ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+//! THE POSSIBILITY OF SUCH DAMAGE.
+//
+//*****************************************************************************
+
+#ifndef __xFAST_H__
+#define __xFAST_H__
+
+#include "xhw_types.h"
+#include "xhw_memmap.h"
+#include "xdebug.h"
+#include "xhw_gpio.h"
+#include "xgpio.h"
+#include "xhw_uart.h"
+#include "xhw_spi.h"
+
+//*****************************************************************************
+//
+// If building with a C++ compiler, make all of the definitions in this header
+// have a C binding.
+//
+//*****************************************************************************
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+//*****************************************************************************
+//
+//! \addtogroup CoX_Peripheral_Lib
+//! @{
+//
+//*****************************************************************************
+
+//*****************************************************************************
+//
+//! \addtogroup xFast xFast
+//! \brief Static inline variants of the hot libcox primitives.
+//!
+//! GPIOPinWrite(), UARTCharPut(), SPISingleDataReadWrite() and friends are
+//! out of line calls that check the base address and, for SPI, read the data
+//! width from SPI_CR1 again for every element. The functions here are
+//! compiled into the caller. With a constant base address the address checks
+//! and the register offsets fold at compile time, a pin write becomes one
+//! store to BSRR or BRR, and the SPI data width is chosen by the function
+//! name instead of SPI_CR1_DFF.
+//!
+//! \section xFast_How How to use the fast paths?
+//! -# Include xfast.h in the source files that need them, nothing else in
+//! libcox changes and the out of line functions stay as they are.
+//! -# Call the xxxFastXxx() function in place of the libcox one, best with a
+//! constant base address. The peripheral must be set up with the libcox APIs
+//! first, and the SPI data width must match the function used.
+//! .
+//!
+//! The arguments are still checked with xASSERT() in an \b xDEBUG build.
+//! The benchmark in fast/test/suite1 prints the instructions and cycles of
+//! each primitive before and after.
+//!
+//! @{
+//
+//*****************************************************************************
+
+//
+//! Storage class of the fast paths. They are static, so each source file
+//! gets its own copy where the compiler decides not to inline.
+//
+#if defined(__GNUC__)
+#define xFAST_INLINE            static __inline __attribute__((always_inline))
+#else
+#define xFAST_INLINE            static __inline
+#endif
+
+//*****************************************************************************
+//
+//! \addtogroup xFast_GPIO xFast GPIO
+//! @{
+//
+//*****************************************************************************
+
+//*****************************************************************************
+//
+//! \brief Writes a value to the specified pin(s), as GPIOPinWrite().
+//!
+//! \param ulPort is the base address of the GPIO port.
+//! \param ulPins is the bit-packed representation of the pin(s).
+//! \param ucVal is the value to write to the pin(s), 0 or 1.
+//!
+//! The pins are set through GPIO_BSRR or cleared through GPIO_BRR with a
+//! single store, so unlike the read-modify-write of ODR it is also safe
+//! against interrupts writing other pins of the port.
+//!
+//! \return None.
+//
+//*****************************************************************************
+xFAST_INLINE void
+GPIOFastPinWrite(unsigned long ulPort, unsigned long ulPins,
+                 unsigned char ucVal)
+{
+    xASSERT((ulPort == GPIOA_BASE) || (ulPort == GPIOB_BASE) ||
+            (ulPort == GPIOC_BASE) || (ulPort == GPIOD_BASE) ||
+            (ulPort == GPIOE_BASE) || (ulPort == GPIOF_BASE) ||
+            (ulPort == GPIOG_BASE));
+
+    xHWREG(ulPort + ((ucVal & 1) ? GPIO_BSRR : GPIO_BRR)) = ulPins;
+}
+
+//*****************************************************************************
+//
+//! \brief Reads the values of the specified pin(s), as GPIOPinRead().
+//!
+//! \param ulPort is the base address of the GPIO port.
+//! \param ulPins is the bit-packed representation of the pin(s).
+//!
+//! \return the pin values, the bits not in \e ulPins are 0.
+//
+//*****************************************************************************
+xFAST_INLINE long
+GPIOFastPinRead(unsigned long ulPort, unsigned long ulPins)
+{
+    xASSERT((ulPort == GPIOA_BASE) || (ulPort == GPIOB_BASE) ||
+            (ulPort == GPIOC_BASE) || (ulPort == GPIOD_BASE) ||
+            (ulPort == GPIOE_BASE) || (ulPort == GPIOF_BASE) ||
+            (ulPort == GPIOG_BASE));
+
+    return (xHWREG(ulPort + GPIO_IDR) & ulPins);
+}
+
+//*****************************************************************************
+//
+//! \brief Write a value to a short pin, as xGPIOSPinWrite().
+//!
+//! \param eShortPin Specified port and pin, such as PA9.
+//! \param ucVal is the value to write to the pin, 0 or 1.
+//!
+//! \return None.
+//
+//*****************************************************************************
+#define xGPIOFastSPinWrite(eShortPin, ucVal)                                  \
+        GPIOFastPinWrite(G##eShortPin, ucVal)
+
+//*****************************************************************************
+//
+//! \brief Read the value of a short pin, as xGPIOSPinRead().
+//!
+//! \param eShortPin Specified port and pin, such as PA9.
+//!
+//! \return 1 if the pin is high, else 0.
+//
+//*****************************************************************************
+#define xGPIOFastSPinRead(eShortPin)                                          \
+        (GPIOFastPinRead(G##eShortPin) ? 1 : 0)
+
+//*****************************************************************************
+//
+//! @}
+//
+//*****************************************************************************
+
+//*****************************************************************************
+//
+//! \addtogroup xFast_UART xFast UART
+//! @{
+//
+//*****************************************************************************
+
+//*****************************************************************************
+//
+//! \brief Waits to send a character, as UARTCharPut().
+//!
+//! \param ulBase is the base address of the UART port.
+//! \param ucData is the character to be transmitted.
+//!
+//! \return None.
+//
+//*****************************************************************************
+xFAST_INLINE void
+UARTFastCharPut(unsigned long ulBase, unsigned char ucData)
+{
+    xASSERT((ulBase == USART1_BASE) || (ulBase == USART2_BASE) ||
+            (ulBase == USART3_BASE) || (ulBase == USART4_BASE) ||
+            (ulBase == USART5_BASE));
+
+    while(!(xHWREG(ulBase + USART_SR) & USART_SR_TXE))
+    {
+    }
+    xHWREG(ulBase + USART_DR) = ucData;
+}
+
+//*****************************************************************************
+//
+//! \brief Sends a character if there is room, as UARTCharPutNonBlocking().
+//!
+//! \param ulBase is the base address of the UART port.
+//! \param ucData is the character to be transmitted.
+//!
+//! \return \b xtrue if the character was written, else \b xfalse.
+//
+//*****************************************************************************
+xFAST_INLINE xtBoolean
+UARTFastCharPutNonBlocking(unsigned long ulBase, unsigned char ucData)
+{
+    xASSERT((ulBase == USART1_BASE) || (ulBase == USART2_BASE) ||
+            (ulBase == USART3_BASE) || (ulBase == USART4_BASE) ||
+            (ulBase == USART5_BASE));
+
+    if(xHWREG(ulBase + USART_SR) & USART_SR_TXE)
+    {
+        xHWREG(ulBase + USART_DR) = ucData;
+        return (xtrue);
+    }
+    return (xfalse);
+}
+
+//*****************************************************************************
+//
+//! \brief Waits for a character, as UARTCharGet().
+//!
+//! \param ulBase is the base address of the UART port.
+//!
+//! \return the character read.
+//
+//*****************************************************************************
+xFAST_INLINE long
+UARTFastCharGet(unsigned long ulBase)
+{
+    xASSERT((ulBase == USART1_BASE) || (ulBase == USART2_BASE) ||
+            (ulBase == USART3_BASE) || (ulBase == USART4_BASE) ||
+            (ulBase == USART5_BASE));
+
+    while(!(xHWREG(ulBase + USART_SR) & USART_SR_RXNE))
+    {
+    }
+    return (xHWREG(ulBase + USART_DR));
+}
+
+//*****************************************************************************
+//
+//! \brief Gets a character if one is there, as UARTCharGetNonBlocking().
+//!
+//! \param ulBase is the base address of the UART port.
+//!
+//! \return the character read, or -1 if there is none.
+//
+//*****************************************************************************
+xFAST_INLINE long
+UARTFastCharGetNonBlocking(unsigned long ulBase)
+{
+    xASSERT((ulBase == USART1_BASE) || (ulBase == USART2_BASE) ||
+            (ulBase == USART3_BASE) || (ulBase == USART4_BASE) ||
+            (ulBase == USART5_BASE));
+
+    if(xHWREG(ulBase + USART_SR) & USART_SR_RXNE)
+    {
+        return (xHWREG(ulBase + USART_DR));
+    }
+    return (-1);
+}
+
+//*****************************************************************************
+//
+//! @}
+//
+//*****************************************************************************
+
+//*****************************************************************************
+//
+//! \addtogroup xFast_SPI xFast SPI
+//! \brief The 8 and 16 bit functions must match the data width the port was
+//! configured with (SPI_CR1_DFF).
+//! @{
+//
+//*****************************************************************************
+
+//*****************************************************************************
+//
+//! \brief Exchanges one 8-bit element, as SPISingleDataReadWrite().
+//!
+//! \param ulBase specifies the SPI module base address.
+//! \param ucData is the data to transmit.
+//!
+//! \return the data received.
+//
+//*****************************************************************************
+xFAST_INLINE unsigned char
+SPIFastReadWrite8(unsigned long ulBase, unsigned char ucData)
+{
+    xASSERT((ulBase == SPI1_BASE) || (ulBase == SPI2_BASE) ||
+            (ulBase == SPI3_BASE));
+
+    while(!(xHWREG(ulBase + SPI_SR) & SPI_SR_TXE))
+    {
+    }
+    xHWREG(ulBase + SPI_DR) = ucData;
+
+    while(!(xHWREG(ulBase + SPI_SR) & SPI_SR_RXNE))
+    {
+    }
+    return ((unsigned char)xHWREG(ulBase + SPI_DR));
+}
+
+//*****************************************************************************
+//
+//! \brief Exchanges one 16-bit element, as SPISingleDataReadWrite().
+//!
+//! \param ulBase specifies the SPI module base address.
+//! \param usData is the data to transmit.
+//!
+//! \return the data received.
+//
+//*****************************************************************************
+xFAST_INLINE unsigned short
+SPIFastReadWrite16(unsigned long ulBase, unsigned short usData)
+{
+    xASSERT((ulBase == SPI1_BASE) || (ulBase == SPI2_BASE) ||
+            (ulBase == SPI3_BASE));
+
+    while(!(xHWREG(ulBase + SPI_SR) & SPI_SR_TXE))
+    {
+    }
+    xHWREG(ulBase + SPI_DR) = usData;
+
+    while(!(xHWREG(ulBase + SPI_SR) & SPI_SR_RXNE))
+    {
+    }
+    return ((unsigned short)xHWREG(ulBase + SPI_DR));
+}
+
+//*****************************************************************************
+//
+//! \brief Writes 8-bit elements, as SPIDataWrite() without the SPI_CR1 read
+//! per element.
+//!
+//! \param ulBase specifies the SPI module base address.
+//! \param pucData is the data to transmit.
+//! \param ulLen is the number of elements.
+//!
+//! \return None.
+//
+//*****************************************************************************
+xFAST_INLINE void
+SPIFastDataWrite8(unsigned long ulBase, const unsigned char *pucData,
+                  unsigned long ulLen)
+{
+    while(ulLen--)
+    {
+        SPIFastReadWrite8(ulBase, *pucData++);
+    }
+}
+
+//*****************************************************************************
+//
+//! \brief Reads 8-bit elements, as SPIDataRead() without the SPI_CR1 read
+//! per element. 0xFF is sent for every element.
+//!
+//! \param ulBase specifies the SPI module base address.
+//! \param pucData receives the data.
+//! \param ulLen is the number of elements.
+//!
+//! \return None.
+//
+//*****************************************************************************
+xFAST_INLINE void
+SPIFastDataRead8(unsigned long ulBase, unsigned char *pucData,
+                 unsigned long ulLen)
+{
+    while(ulLen--)
+    {
+        *pucData++ = SPIFastReadWrite8(ulBase, 0xFF);
+    }
+}
+
+//*****************************************************************************
+//
+//! \brief Writes 16-bit elements, as SPIDataWrite() without the SPI_CR1 read
+//! per element.
+//!
+//! \param ulBase specifies the SPI module base address.
+//! \param pusData is the data to transmit.
+//! \param ulLen is the number of elements.
+//!
+//! \return None.
+//
+//*****************************************************************************
+xFAST_INLINE void
+SPIFastDataWrite16(unsigned long ulBase, const unsigned short *pusData,
+                   unsigned long ulLen)
+{
+    while(ulLen--)
+    {
+        SPIFastReadWrite16(ulBase, *pusData++);
+    }
+}
+
+//*****************************************************************************
+//
+//! \brief Reads 16-bit elements, as SPIDataRead() without the SPI_CR1 read
+//! per element. 0xFFFF is sent for every element.
+//!
+//! \param ulBase specifies the SPI module base address.
+//! \param pusData receives the data.
+//! \param ulLen is the number of elements.
+//!
+//! \return None.
+//
+//*****************************************************************************
+xFAST_INLINE void
+SPIFastDataRead16(unsigned long ulBase, unsigned short *pusData,
+                  unsigned long ulLen)
+{
+    while(ulLen--)
+    {
+        *pusData++ = SPIFastReadWrite16(ulBase, 0xFFFF);
+    }
+}
+
+//*****************************************************************************
+//
+//! @}
+//
+//*****************************************************************************
+
+//*****************************************************************************
+//
+//! @}
+//
+//*****************************************************************************
+
+//*****************************************************************************
+//
+//! @}
+//
+//*****************************************************************************
+
+//*****************************************************************************
+//
+// Mark the end of the C bindings section for C++ compilers.
+//
+//*****************************************************************************
+#ifdef __cplusplus
+}
+#endif
+
+#endif // __xFAST_H__
@@ -44,32 +44,31 @@
 #include "xhw_sysctl.h"
 #include "xhw_gpio.h"
 #include "xdebug.h"
+#include "xtrace.h"
 #include "xsysctl.h"
 #include "xcore.h"
 #include "xgpio.h"
 
 
-typedef struct
-{
-    //
-    // Pin ID.
-    //
-    unsigned long ulpinID;
-
-    //
-    //
-    //
-    xtEventCallback pfnGPIOPinHandlerCallback;
-}
-tGPIOPinIntAsssign;
+//
+// The callback and its data of each EXTI line, indexed by the line (pin)
+// number. A line serves one port at a time (AFIO_EXTICRx), so 16 entries
+// cover every pin.
+//
+static xtEventCallback g_pfnGPIOLineCallback[16];
+static void *g_pvGPIOLineData[16];
 
 //
-// GPIO Pins Interrupt Assignment table.
+// Index of the highest set bit of a non-zero word.
 //
-static tGPIOPinIntAsssign g_psGPIOPinIntAssignTable[xGPIO_INT_NUMBER] =
-{
-    {0,0}
-};
+#if defined(gcc) || defined(__GNUC__)
+#define GPIOLineHighest(ulBits) (31 - __builtin_clz(ulBits))
+#elif defined(ewarm)
+#include <intrinsics.h>
+#define GPIOLineHighest(ulBits) (31 - __CLZ(ulBits))
+#elif defined(rvmdk) || defined(__ARMCC_VERSION)
+#define GPIOLineHighest(ulBits) (31 - __clz(ulBits))
+#endif
 
 //*****************************************************************************
 //
@@ -114,35 +113,62 @@ GPIOBaseValid(unsigned long ulPort)
 //*****************************************************************************
 //
 //! \internal
-//! \brief External interrupt/event line 0 ISR.
+//! \brief Serve the pending EXTI lines of one interrupt vector.
 //!
-//! \param None
+//! \param ulLines is the mask of the lines that share the vector.
+//!
+//! Only the pending and enabled lines in \e ulLines are acknowledged, a
+//! write of 1 clears a pending bit and 0 leaves it, and each of them goes
+//! straight to its callback. The callback gets the data set by
+//! GPIOPinIntCallbackDataSet() and the pin mask of the line as \e ulEvent.
 //!
 //! \return None.
 //
 //*****************************************************************************
-void EXTI0IntHandler(void)
+static void
+GPIOLineDispatch(unsigned long ulLines)
 {
-    unsigned long i, ulTemp;
+    unsigned long ulPending, ulLine;
+
+    ulPending = xHWREG(EXTI_PR) & xHWREG(EXTI_IMR) & ulLines;
 
     //
     // Clear the interrupt flag.
     //
-    ulTemp = xHWREG(EXTI_PR);
-	xHWREG(EXTI_PR) |= (0x00000001 << 0);
+    xHWREG(EXTI_PR) = ulPending;
 
-    for(i=0; i<xGPIO_INT_NUMBER; i++)
+    while(ulPending)
     {
-        if((g_psGPIOPinIntAssignTable[i].ulpinID & 0xffff) == GPIO_PIN_0)
+        ulLine = GPIOLineHighest(ulPending);
+        ulPending &= ~(1UL << ulLine);
+
+        if(g_pfnGPIOLineCallback[ulLine] != 0)
         {
-            if(g_psGPIOPinIntAssignTable[i].pfnGPIOPinHandlerCallback != 0)
-            {
-                g_psGPIOPinIntAssignTable[i].pfnGPIOPinHandlerCallback(0,ulTemp,0,0);
-            }
+            g_pfnGPIOLineCallback[ulLine](g_pvGPIOLineData[ulLine],
+                                          1UL << ulLine, 0, 0);
         }
     }
 }
 
+//*****************************************************************************
+//
+//! \internal
+//! \brief External interrupt/event line 0 ISR.
+//!
+//! \param None
+//!
+//! \return None.
+//
+//*****************************************************************************
+void EXTI0IntHandler(void)
+{
+    xTRACE_ISR_ENTER();
+
+    GPIOLineDispatch(0x0001);
+
+    xTRACE_ISR_EXIT();
+}
+
 //*****************************************************************************
 //
 //! \internal
@@ -155,22 +181,11 @@ void EXTI0IntHandler(void)
 //*****************************************************************************
 void EXTI1IntHandler(void)
 {
-    unsigned long i, ulTemp;
+    xTRACE_ISR_ENTER();
 
-    // Clear the interrupt flag.
-    //
-    ulTemp = xHWREG(EXTI_PR);
-	xHWREG(EXTI_PR) |= (0x00000001 << 1);
-    for(i=0; i<xGPIO_INT_NUMBER; i++)
-    {
-        if((g_psGPIOPinIntAssignTable[i].ulpinID & 0xffff) == GPIO_PIN_1)
-        {
-            if(g_psGPIOPinIntAssignTable[i].pfnGPIOPinHandlerCallback != 0)
-            {
-                g_psGPIOPinIntAssignTable[i].pfnGPIOPinHandlerCallback(0,ulTemp,0,0);
-            }
-        }
-    }
+    GPIOLineDispatch(0x0002);
+
+    xTRACE_ISR_EXIT();
 }
 
 //*****************************************************************************
@@ -185,24 +200,11 @@ void EXTI1IntHandler(void)
 //*****************************************************************************
 void EXTI2IntHandler(void)
 {
-    unsigned long i, ulTemp;
+    xTRACE_ISR_ENTER();
 
-	//
-    // Clear the interrupt flag.
-    //
-    ulTemp = xHWREG(EXTI_PR);
-	xHWREG(EXTI_PR) |= (0x00000001 << 2);
+    GPIOLineDispatch(0x0004);
 
-    for(i=0; i<xGPIO_INT_NUMBER; i++)
-    {
-        if((g_psGPIOPinIntAssignTable[i].ulpinID & 0xffff) == GPIO_PIN_2)
-        {
-            if(g_psGPIOPinIntAssignTable[i].pfnGPIOPinHandlerCallback != 0)
-            {
-                g_psGPIOPinIntAssignTable[i].pfnGPIOPinHandlerCallback(0,ulTemp,0,0);
-            }
-        }
-    }
+    xTRACE_ISR_EXIT();
 }
 
 //*****************************************************************************
@@ -217,28 +219,11 @@ void EXTI2IntHandler(void)
 //*****************************************************************************
 void EXTI3IntHandler(void)
 {
-    unsigned long i, ulTemp;
-
-	//
-    // Clear the interrupt flag.
-    //
-    ulTemp = xHWREG(EXTI_PR);
-	xHWREG(EXTI_PR) |= (0x00000001 << 3);
+    xTRACE_ISR_ENTER();
 
-    //
-    // Clear the interrupt flag.
-    //
+    GPIOLineDispatch(0x0008);
 
-    for(i=0; i<xGPIO_INT_NUMBER; i++)
-    {
-        if((g_psGPIOPinIntAssignTable[i].ulpinID & 0xffff) == GPIO_PIN_3)
-        {
-            if(g_psGPIOPinIntAssignTable[i].pfnGPIOPinHandlerCallback != 0)
-            {
-                g_psGPIOPinIntAssignTable[i].pfnGPIOPinHandlerCallback(0,ulTemp,0,0);
-            }
-        }
-    }
+    xTRACE_ISR_EXIT();
 }
 
 //*****************************************************************************
@@ -253,24 +238,11 @@ void EXTI3IntHandler(void)
 //*****************************************************************************
 void EXTI4IntHandler(void)
 {
-    unsigned long i, ulTemp;
+    xTRACE_ISR_ENTER();
 
-	//
-    // Clear the interrupt flag.
-    //
-    ulTemp = xHWREG(EXTI_PR);
-	xHWREG(EXTI_PR) |= (0x00000001 << 4);
+    GPIOLineDispatch(0x0010);
 
-    for(i=0; i<xGPIO_INT_NUMBER; i++)
-    {
-        if((g_psGPIOPinIntAssignTable[i].ulpinID & 0xffff) == GPIO_PIN_4)
-        {
-            if(g_psGPIOPinIntAssignTable[i].pfnGPIOPinHandlerCallback != 0)
-            {
-                g_psGPIOPinIntAssignTable[i].pfnGPIOPinHandlerCallback(0,ulTemp,0,0);
-            }
-        }
-    }
+    xTRACE_ISR_EXIT();
 }
 
 //*****************************************************************************
@@ -285,48 +257,11 @@ void EXTI4IntHandler(void)
 //*****************************************************************************
 void EXTI95IntHandler(void)
 {
-    unsigned long i, ulTemp, ulShift;
+    xTRACE_ISR_ENTER();
 
-	//
-    // Clear the interrupt flag.
-    //
-    ulTemp = xHWREG(EXTI_PR);
-    if((ulTemp & (0x00000001 << 5)) != 0)
-	{
-	    ulShift = 5;
-	}
-	else if((ulTemp & (0x00000001 << 6)) != 0)
-	{
-	    ulShift = 6;
-	}
-	else if((ulTemp & (0x00000001 << 7)) != 0)
-	{
-	    ulShift = 7;
-	}
-	else if((ulTemp & (0x00000001 << 8)) != 0)
-	{
-	    ulShift = 8;
-	}
-	else
-	{
-	    ulShift = 9;
-	}
-
-
-	xHWREG(EXTI_PR) |= (0x00000001 << ulShift);
-
-
-    for(i=0; i<xGPIO_INT_NUMBER; i++)
-    {
-        if((g_psGPIOPinIntAssignTable[i].ulpinID & 0xffff) == (GPIO_PIN_0 << ulShift))
-        {
-            if(g_psGPIOPinIntAssignTable[i].pfnGPIOPinHandlerCallback != 0)
-            {
-                g_psGPIOPinIntAssignTable[i].pfnGPIOPinHandlerCallback(0,0,0,0);
-            }
-        }
-    }
+    GPIOLineDispatch(0x03E0);
 
+    xTRACE_ISR_EXIT();
 }
 
 //*****************************************************************************
@@ -341,50 +276,11 @@ void EXTI95IntHandler(void)
 //*****************************************************************************
 void EXTI1510IntHandler(void)
 {
-    unsigned long i, ulTemp, ulShift;
+    xTRACE_ISR_ENTER();
 
-	//
-    // Clear the interrupt flag.
-    //
-    ulTemp = xHWREG(EXTI_PR);
-    if((ulTemp & (0x00000001 << 10)) != 0)
-	{
-	    ulShift = 10;
-	}
-	else if((ulTemp & (0x00000001 << 11)) != 0)
-	{
-	    ulShift = 11;
-	}
-	else if((ulTemp & (0x00000001 << 12)) != 0)
-	{
-	    ulShift = 12;
-	}
-	else if((ulTemp & (0x00000001 << 13)) != 0)
-	{
-	    ulShift = 13;
-	}
-	else if((ulTemp & (0x00000001 << 14)) != 0)
-	{
-	    ulShift = 14;
-	}
-	else
-	{
-	    ulShift = 15;
-	}
-
-	xHWREG(EXTI_PR) |= (0x00000001 << ulShift);
-
-
-    for(i=0; i<xGPIO_INT_NUMBER; i++)
-    {
-        if((g_psGPIOPinIntAssignTable[i].ulpinID & 0xffff) == (GPIO_PIN_0 << ulShift))
-        {
-            if(g_psGPIOPinIntAssignTable[i].pfnGPIOPinHandlerCallback != 0)
-            {
-                g_psGPIOPinIntAssignTable[i].pfnGPIOPinHandlerCallback(0,ulTemp,0,0);
-            }
-        }
-    }
+    GPIOLineDispatch(0xFC00);
+
+    xTRACE_ISR_EXIT();
 }
 
 //*****************************************************************************
@@ -713,36 +609,55 @@ void
 GPIOPinIntCallbackInit(unsigned long ulPort, unsigned long ulPin,
                        xtEventCallback xtPortCallback)
 {
-    int i;
-    unsigned long ulPinID;
+    unsigned long ulLine;
+
     //
     // Check the arguments.
     //
     xASSERT(GPIOBaseValid(ulPort));
+    xASSERT((ulPin & 0xFFFF) != 0);
 
     //
-    // changed ?? (ulPort  << 16) | i ?? to ?? (ulPort  << 16) | ulPin ?? by
-    // niuyj 09/09/2011
+    // Init the interrupts callback of each line in ulPin.
     //
-    ulPinID = (ulPort  << 16) | ulPin;
+    for(ulLine = 0; ulLine < 16; ulLine++)
+    {
+        if(ulPin & (1UL << ulLine))
+        {
+            g_pfnGPIOLineCallback[ulLine] = xtPortCallback;
+        }
+    }
+}
+
+//*****************************************************************************
+//
+//! \brief Set the data passed to the interrupt callback of the pin(s).
+//!
+//! \param ulPort is the base address of the GPIO port.
+//! \param ulPin is the bit-packed representation of the pin(s).
+//! \param pvCBData is passed as \e pvCBData to the callback, so one callback
+//! can serve several pins, e.g. the two channels of an encoder.
+//!
+//! \return None.
+//
+//*****************************************************************************
+void
+GPIOPinIntCallbackDataSet(unsigned long ulPort, unsigned long ulPin,
+                          void *pvCBData)
+{
+    unsigned long ulLine;
 
     //
-    // Init the interrupts callback.
+    // Check the arguments.
     //
-    for(i=0; i<xGPIO_INT_NUMBER; i++)
+    xASSERT(GPIOBaseValid(ulPort));
+    xASSERT((ulPin & 0xFFFF) != 0);
+
+    for(ulLine = 0; ulLine < 16; ulLine++)
     {
-        if(g_psGPIOPinIntAssignTable[i].ulpinID == ulPinID)
-        {
-            g_psGPIOPinIntAssignTable[i].pfnGPIOPinHandlerCallback =
-                                         xtPortCallback;
-            break;
-        }
-        if (g_psGPIOPinIntAssignTable[i].ulpinID == 0)
+        if(ulPin & (1UL << ulLine))
         {
-            g_psGPIOPinIntAssignTable[i].ulpinID = ulPinID;
-            g_psGPIOPinIntAssignTable[i].pfnGPIOPinHandlerCallback =
-                                         xtPortCallback;
-            break;
+            g_pvGPIOLineData[ulLine] = pvCBData;
         }
     }
 }
@@ -792,9 +707,9 @@ GPIOPinIntClear(unsigned long ulPort, unsigned long ulPins)
     xASSERT(GPIOBaseValid(ulPort));
 
     //
-    // Clear the interrupts.
+    // Clear the interrupts, a write of 0 leaves a pending bit as it is.
     //
-    xHWREG(EXTI_PR) |= ulPins;
+    xHWREG(EXTI_PR) = ulPins;
 }
 
 //*****************************************************************************
@@ -3525,6 +3525,8 @@ extern void GPIOPinIntEnable(unsigned long ulPort, unsigned long ulPins,
 extern void GPIOPinIntDisable(unsigned long ulPort, unsigned long ulPins);
 extern void GPIOPinIntCallbackInit(unsigned long ulPort, unsigned long ulPin, 
                                    xtEventCallback xtPortCallback);
+extern void GPIOPinIntCallbackDataSet(unsigned long ulPort, unsigned long ulPin,
+                                      void *pvCBData);
 extern unsigned long GPIOPinIntStatus(void);
 extern void GPIOPinIntClear(unsigned long ulPort, unsigned long ulPins);
 extern long GPIOPinRead(unsigned long ulPort, unsigned long ulPins);
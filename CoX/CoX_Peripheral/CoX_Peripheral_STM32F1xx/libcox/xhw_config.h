@@ -166,64 +166,36 @@
 #define GPIO_INT_NUMBER         8  
 
 //
-//! STM32F1xx Timer1 function select
+//! STM32F1xx trace recorder event slots (must be a power of 2), each slot
+//! takes 8 bytes of RAM in an xTRACE build.
 //
-#define TIM1_FUNCTION_SELECT    TIM_PWM
+#define TRACE_BUF_SIZE          256
 
 //
-//! STM32F1xx Timer2 function select
+//! STM32F1xx idle manager, the shortest wait in ticks that enters Stop mode.
+//! The PLL and HSE restart after each Stop wake-up.
 //
-#define TIM2_FUNCTION_SELECT    TIM_TIMER
+#define IDLE_STOP_MIN_TICKS     5
 
 //
-//! STM32F1xx Timer3 function select
+//! STM32F1xx idle manager, the shortest wait in ticks that enters Standby
+//! mode when it is allowed. The wake-up is a full reset.
 //
-#define TIM3_FUNCTION_SELECT    TIM_TIMER
+#define IDLE_STANDBY_MIN_TICKS  1000
 
 //
-//! STM32F1xx Timer4 function select
+//! STM32F1xx clock change callbacks, the number of drivers that can register
+//! with SysCtlClockNotifyRegister().
 //
-#define TIM4_FUNCTION_SELECT    TIM_TIMER
+#define SYSCTL_CLOCK_NOTIFY_NUM 8
 
 //
-//! STM32F1xx Timer5 function select
+//! STM32F1xx vector table in SRAM config.
+//! It can be one of the following values:
+//! 0 or 1.  0: the vector table stays in flash
+//!          1: xIntRegister() moves it to SRAM (512 bytes)
 //
-#define TIM5_FUNCTION_SELECT    TIM_TIMER
-
-//
-//! STM32F1xx Timer8 function select
-//
-#define TIM8_FUNCTION_SELECT    TIM_PWM
-
-//
-//! STM32F1xx Timer9 function select
-//
-#define TIM9_FUNCTION_SELECT    TIM_TIMER
-
-//
-//! STM32F1xx Timer10 function select
-//
-#define TIM10_FUNCTION_SELECT   TIM_TIMER
-
-//
-//! STM32F1xx Timer11 function select
-//
-#define TIM11_FUNCTION_SELECT   TIM_TIMER
-
-//
-//! STM32F1xx Timer12 function select
-//
-#define TIM12_FUNCTION_SELECT   TIM_TIMER
-
-//
-//! STM32F1xx Timer13 function select
-//
-#define TIM13_FUNCTION_SELECT   TIM_TIMER
-
-//
-//! STM32F1xx Timer14 function select
-//
-#define TIM14_FUNCTION_SELECT   TIM_TIMER
+#define CORE_RAM_VECTORS        0
 
 //*****************************************************************************
 //
@@ -316,31 +288,6 @@
 //
 //*****************************************************************************
 
-//*****************************************************************************
-//
-//! \addtogroup STM32F1xx_LowLayer_Tim_Function STM32F1xx timer Function 
-//! \brief STM32F1xx timer Function .
-//! @{
-//
-//*****************************************************************************
-
-//
-//! timer Function is used as a timer.
-//
-#define TIM_TIMER               0
-
-//
-//! timer Function is used as a PWM.
-//
-#define TIM_PWM                 1
-
-//*****************************************************************************
-//
-//! @}
-//
-//*****************************************************************************
-
-
 //*****************************************************************************
 //
 //! @}
@@ -235,6 +235,11 @@
 //
 #define NVIC_INT_CTRL           0xE000ED04
 
+//
+//! Vector Table Offset
+//
+#define NVIC_VTOR               0xE000ED08
+
 //
 //! Application Interrupt and Reset Control
 //
@@ -1638,6 +1643,30 @@
 //
 //*****************************************************************************
 
+//*****************************************************************************
+//
+//! \addtogroup STM32F1xx_NVIC_Register_NVIC_VTOR NVIC Vector Table Offset Register(NVIC_VTOR)
+//! \brief Defines for the bit fields in the NVIC_VTOR register.
+//! @{
+//
+//*****************************************************************************
+
+//
+//! Table base is in Code(0) or SRAM(1)
+//
+#define NVIC_VTOR_TBLBASE       0x20000000
+
+//
+//! Vector table base offset from the bottom of the Code or SRAM space
+//
+#define NVIC_VTOR_TBLOFF_M      0x1FFFFF80
+
+//*****************************************************************************
+//
+//! @}
+//
+//*****************************************************************************
+
 //*****************************************************************************
 //
 //! \addtogroup STM32F1xx_NVIC_Register_NVIC_APINT NVIC APINT Register(NVIC_APINT)
@@ -58,6 +58,34 @@
 //*****************************************************************************
 static xtEventCallback g_pfnI2CHandlerCallbacks[2]={0};
 
+//*****************************************************************************
+//
+// The timing asked by I2CMasterInit() or I2CInit() on an I2C
+//
+//*****************************************************************************
+typedef struct
+{
+    //
+    // The SCL rate in Hz, 0 if the I2C is not set up.
+    //
+    unsigned long ulSCLClk;
+
+    //
+    // xtrue if I2CMasterInit() set up the I2C, xfalse if I2CInit() did.
+    //
+    xtBoolean bMaster;
+    xtBoolean bFast;
+    xtBoolean bDutyCycle;
+}
+tI2CTiming;
+
+//*****************************************************************************
+//
+// The timing of I2C1 and I2C2, set again when the system clock changes
+//
+//*****************************************************************************
+static tI2CTiming g_psI2CTiming[2];
+
 //*****************************************************************************
 //
 //! \internal
@@ -331,6 +359,51 @@ I2C2EVIntHandler(void)
     }
 }
 
+//*****************************************************************************
+//
+//! \internal
+//! \brief Sets the I2C timings again after a system clock change.
+//!
+//! The timing registers are computed from the APB1 clock, so I2CMasterInit()
+//! or I2CInit() runs again with the parameters it was given. The clock must
+//! not change while an I2C transfer is in progress.
+//!
+//! \return 0.
+//
+//*****************************************************************************
+static unsigned long
+I2CClockNotify(void *pvCBData, unsigned long ulEvent,
+               unsigned long ulMsgParam, void *pvMsgData)
+{
+    unsigned long i, ulBase;
+
+    if(ulEvent != SYSCTL_CLOCK_POST_CHANGE)
+    {
+        return 0;
+    }
+
+    for(i = 0; i < 2; i++)
+    {
+        ulBase = (i == 0) ? I2C1_BASE : I2C2_BASE;
+        if(g_psI2CTiming[i].ulSCLClk == 0)
+        {
+            continue;
+        }
+
+        if(g_psI2CTiming[i].bMaster)
+        {
+            I2CMasterInit(ulBase, SysCtlAPB1ClockGet(),
+                          g_psI2CTiming[i].bFast, g_psI2CTiming[i].bDutyCycle);
+        }
+        else
+        {
+            I2CInit(ulBase, g_psI2CTiming[i].ulSCLClk);
+        }
+    }
+
+    return 0;
+}
+
 //*****************************************************************************
 //
 //! Initializes the I2C Master block.
@@ -354,7 +427,8 @@ I2C2EVIntHandler(void)
 //! The peripheral clock will be the same as the PCLK1 clock.  This will be
 //! the value returned by SysCtlAPB1ClockGet(), or it can be explicitly hard
 //! coded if it is constant and known (to save the code/execution overhead of
-//! a call to SysCtlAPB1ClockGet()).
+//! a call to SysCtlAPB1ClockGet()). When SysCtlClockSet() changes the system
+//! clock, the timing is set again from SysCtlAPB1ClockGet().
 //!
 //! \return None.
 //
@@ -366,6 +440,7 @@ I2CMasterInit(unsigned long ulBase, unsigned long ulI2CClk,
     unsigned long ulSCLFreq;
     unsigned long ulCCR;
     unsigned long ulTRISE;
+    unsigned long i;
 
     //
     // Check the arguments.
@@ -424,6 +499,16 @@ I2CMasterInit(unsigned long ulBase, unsigned long ulI2CClk,
         xHWREG(ulBase + I2C_TRISE) = ulTRISE + 1;
     }
     I2CEnable(ulBase);
+
+    //
+    // Keep the timing for the clock changes.
+    //
+    i = (ulBase == I2C1_BASE) ? 0 : 1;
+    g_psI2CTiming[i].ulSCLClk = ulSCLFreq;
+    g_psI2CTiming[i].bMaster = xtrue;
+    g_psI2CTiming[i].bFast = bFast;
+    g_psI2CTiming[i].bDutyCycle = bDutyCycle;
+    SysCtlClockNotifyRegister(I2CClockNotify, 0);
 }
 
 //*****************************************************************************
@@ -2507,6 +2592,7 @@ void I2CInit(unsigned long ulBase, unsigned long ulClk)
     unsigned long ultmpreg = 0;
     unsigned long ulAPBClk = 0;
     unsigned long result   = 0;
+    unsigned long i;
 
     //
     // Check the arguments.
@@ -2596,5 +2682,12 @@ void I2CInit(unsigned long ulBase, unsigned long ulClk)
     ultmpreg = (I2C_CR1_ACK | I2C_CR1_PE);
     xHWREG(ulBase + I2C_CR1) = ultmpreg;
 
+    //
+    // Keep the timing for the clock changes.
+    //
+    i = (ulBase == I2C1_BASE) ? 0 : 1;
+    g_psI2CTiming[i].ulSCLClk = ulClk;
+    g_psI2CTiming[i].bMaster = xfalse;
+    SysCtlClockNotifyRegister(I2CClockNotify, 0);
 }
 
@@ -0,0 +1,1025 @@
+//*****************************************************************************
+//
+//! \file xidle.c
+//! \brief Tickless low-power idle manager on SysTick and the RTC alarm.
+//! \version V2.2.1.0
+//! \date 10/19/2026
+//! \author CooCox
+//! \copy
+//!
+//! Copyright (c)  2013, CooCox
+//! All rights reserved.
+//! 
+//! Redistribution and use in source and binary forms, with or without 
+//! modification, are permitted provided that the following conditions 
+//! are met: 
+//! 
+//!     * Redistributions of source code must retain the above copyright 
+//! notice, this list of conditions and the following disclaimer. 
+//!     * Redistributions in binary form must reproduce the above copyright
+//! notice, this list of conditions and the following disclaimer in the
+//! documentation and/or other materials provided with the distribution. 
+//!     * Neither the name of the <ORGANIZATION> nor the names of its 
+//! contributors may be used to endorse or promote products derived 
+//! from this software without specific prior written permission. 
+//! 
+//! THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+//! AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE 
+//! IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+//! ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE 
+//! LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR 
+//! CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF 
+//! SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+//! INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN 
+//! CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) 
+//! ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF 
+//! THE POSSIBILITY OF SUCH DAMAGE.
+//
+//*****************************************************************************
+
+#include "xhw_types.h"
+#include "xhw_ints.h"
+#include "xhw_memmap.h"
+#include "xhw_config.h"
+#include "xhw_nvic.h"
+#include "xhw_sysctl.h"
+#include "xhw_rtc.h"
+#include "xhw_dma.h"
+#include "xhw_uart.h"
+#include "xhw_gpio.h"
+#include "xdebug.h"
+#include "xcore.h"
+#include "xsysctl.h"
+#include "xidle.h"
+
+//
+// The RTC alarm reaches the core through EXTI line 17.
+//
+#define IDLE_EXTI_RTC_ALARM     0x00020000
+
+//
+// Largest number of ticks one SysTick period can be stretched to.
+//
+#define IDLE_SLEEP_MAX_TICKS    ((NVIC_ST_RELOAD_M + 1) / g_ulIdlePeriod)
+
+//*****************************************************************************
+//
+// The DMA channels (CCR address) and UARTs that keep the idle state at Sleep
+// while they are busy.
+//
+//*****************************************************************************
+static const unsigned long g_pulIdleDMAChannel[] =
+{
+    0x40020008,   //DMA 1 Ch 1
+    0x4002001C,   //DMA 1 Ch 2
+    0x40020030,   //DMA 1 Ch 3
+    0x40020044,   //DMA 1 Ch 4
+    0x40020058,   //DMA 1 Ch 5
+    0x4002006C,   //DMA 1 Ch 6
+    0x40020080,   //DMA 1 Ch 7
+#if (STM32F1xx_DEVICE >= STM32F10X_HD_VL)
+    0x40020408,   //DMA 2 Ch 1
+    0x4002041C,   //DMA 2 Ch 2
+    0x40020430,   //DMA 2 Ch 3
+    0x40020444,   //DMA 2 Ch 4
+    0x40020458    //DMA 2 Ch 5
+#endif
+};
+
+static const unsigned long g_pulIdleUART[] =
+{
+    USART1_BASE,
+    USART2_BASE,
+    USART3_BASE,
+#if (STM32F1xx_DEVICE >= STM32F10X_HD_VL)
+    USART4_BASE,
+    USART5_BASE
+#endif
+};
+
+//*****************************************************************************
+//
+// The tick counter and the software timers, sorted by expiry.
+//
+//*****************************************************************************
+static volatile unsigned long g_ulIdleTick;
+static tIdleTimer *g_psIdleTimer;
+
+//*****************************************************************************
+//
+// SysTick clocks per tick, the tick rate and the RTC clock and prescaler.
+//
+//*****************************************************************************
+static unsigned long g_ulIdlePeriod;
+static unsigned long g_ulIdleTickFreq;
+static unsigned long g_ulIdleRTCClk;
+static unsigned long g_ulIdleRTCDiv;
+
+//*****************************************************************************
+//
+// One bit per source that forbids Sleep, Stop and Standby.
+//
+//*****************************************************************************
+static unsigned long g_pulIdleBlock[3];
+
+//*****************************************************************************
+//
+// Ticks slept with the tick stretched, per mode.
+//
+//*****************************************************************************
+static unsigned long g_pulIdleStat[4];
+
+//*****************************************************************************
+//
+//! \brief Run the software timers that have expired.
+//!
+//! \return None.
+//
+//*****************************************************************************
+static void
+IdleTimerRun(void)
+{
+    tIdleTimer *psTimer;
+
+    while((g_psIdleTimer != 0) &&
+          ((long)(g_ulIdleTick - g_psIdleTimer->ulExpire) >= 0))
+    {
+        psTimer = g_psIdleTimer;
+        g_psIdleTimer = psTimer->psNext;
+        psTimer->bActive = xfalse;
+        if(psTimer->pfnCallback != 0)
+        {
+            psTimer->pfnCallback(psTimer->pvArg);
+        }
+    }
+}
+
+//*****************************************************************************
+//
+//! \brief Take a software timer out of the list.
+//!
+//! \param psTimer is the timer.
+//!
+//! Call it with interrupts disabled.
+//!
+//! \return None.
+//
+//*****************************************************************************
+static void
+IdleTimerRemove(tIdleTimer *psTimer)
+{
+    tIdleTimer **ppsNext;
+
+    for(ppsNext = &g_psIdleTimer; *ppsNext != 0;
+        ppsNext = &(*ppsNext)->psNext)
+    {
+        if(*ppsNext == psTimer)
+        {
+            *ppsNext = psTimer->psNext;
+            break;
+        }
+    }
+    psTimer->bActive = xfalse;
+}
+
+//*****************************************************************************
+//
+//! \brief Get the ticks left to the first timer deadline.
+//!
+//! \return the ticks left, 0 if a timer is due, or \ref xIDLE_FOREVER.
+//
+//*****************************************************************************
+static unsigned long
+IdleTicksLeft(void)
+{
+    long lLeft;
+
+    if(g_psIdleTimer == 0)
+    {
+        return xIDLE_FOREVER;
+    }
+
+    lLeft = (long)(g_psIdleTimer->ulExpire - g_ulIdleTick);
+    return ((lLeft > 0) ? (unsigned long)lLeft : 0);
+}
+
+//*****************************************************************************
+//
+//! \brief Count the ticks passed with the tick interrupt stopped.
+//!
+//! \param ulTicks is the number of ticks.
+//!
+//! \return None.
+//
+//*****************************************************************************
+static void
+IdleTickAdvance(unsigned long ulTicks)
+{
+    g_ulIdleTick += ulTicks;
+    IdleTimerRun();
+}
+
+//*****************************************************************************
+//
+//! \brief Restart SysTick with a shorter first period.
+//!
+//! \param ulRemain is the number of clocks to the next tick.
+//!
+//! \return None.
+//
+//*****************************************************************************
+static void
+IdleSysTickRestart(unsigned long ulRemain)
+{
+    //
+    // A reload value of 0 never fires.
+    //
+    if(ulRemain < 2)
+    {
+        ulRemain = 2;
+    }
+
+    //
+    // The counter takes the short reload now and the tick period at the
+    // following wrap.
+    //
+    xHWREG(NVIC_ST_RELOAD) = ulRemain - 1;
+    xHWREG(NVIC_ST_CURRENT) = 0;
+    xHWREG(NVIC_ST_CTRL) |= NVIC_ST_CTRL_ENABLE;
+    xHWREG(NVIC_ST_RELOAD) = g_ulIdlePeriod - 1;
+}
+
+//*****************************************************************************
+//
+//! \brief Check if a driver needs the peripheral clocks.
+//!
+//! An enabled DMA channel with data left, a UART receiving with the RXNE
+//! interrupt or a UART still sending would lose data in Stop mode.
+//!
+//! \return xtrue if one is found.
+//
+//*****************************************************************************
+static xtBoolean
+IdleDriverBusy(void)
+{
+    unsigned long i, ulCCR, ulCR1;
+
+    for(i = 0; i < sizeof(g_pulIdleDMAChannel) / 4; i++)
+    {
+        ulCCR = g_pulIdleDMAChannel[i];
+        if((xHWREG(ulCCR) & DMA_CCR1_EN) &&
+           (xHWREG(ulCCR + DMA_CNDTR1 - DMA_CCR1) != 0))
+        {
+            return xtrue;
+        }
+    }
+
+    for(i = 0; i < sizeof(g_pulIdleUART) / 4; i++)
+    {
+        ulCR1 = xHWREG(g_pulIdleUART[i] + USART_CR1);
+        if((ulCR1 & (USART_CR1_UE | USART_CR1_RE | USART_CR1_RXNEIE)) ==
+           (USART_CR1_UE | USART_CR1_RE | USART_CR1_RXNEIE))
+        {
+            return xtrue;
+        }
+        if(((ulCR1 & (USART_CR1_UE | USART_CR1_TE)) ==
+            (USART_CR1_UE | USART_CR1_TE)) &&
+           !(xHWREG(g_pulIdleUART[i] + USART_SR) & USART_SR_TC))
+        {
+            return xtrue;
+        }
+    }
+
+    return xfalse;
+}
+
+//*****************************************************************************
+//
+//! \brief Read the RTC counter and prescaler divider together.
+//!
+//! \param pulCount is the RTC counter.
+//! \param pulDiv is the RTC prescaler divider, it counts down to 0.
+//!
+//! \return None.
+//
+//*****************************************************************************
+static void
+IdleRTCRead(unsigned long *pulCount, unsigned long *pulDiv)
+{
+    unsigned long ulCount;
+
+    do
+    {
+        ulCount = (xHWREG(RTC_CNTH) << RTC_CNTH_CNT_S) |
+                  (xHWREG(RTC_CNTL) & RTC_CNTL_CNT_M);
+        *pulDiv = ((xHWREG(RTC_DIVH) << RTC_DIVH_DIV_S) & RTC_DIVH_DIV_M) |
+                  (xHWREG(RTC_DIVL) & RTC_DIVL_DIV_M);
+        *pulCount = (xHWREG(RTC_CNTH) << RTC_CNTH_CNT_S) |
+                    (xHWREG(RTC_CNTL) & RTC_CNTL_CNT_M);
+    }
+    while(*pulCount != ulCount);
+}
+
+//*****************************************************************************
+//
+//! \brief Get the last RTC count that is reached before a deadline.
+//!
+//! \param ulTicks is the number of ticks to the deadline.
+//! \param ulCount is the RTC counter now.
+//! \param ulDiv is the RTC prescaler divider now.
+//! \param pulAlarm is the alarm value.
+//!
+//! The current tick is left out, so the alarm comes up to one tick early.
+//!
+//! \return xfalse if the counter does not step before the deadline, or the
+//! RTC is not running.
+//
+//*****************************************************************************
+static xtBoolean
+IdleAlarmGet(unsigned long ulTicks, unsigned long ulCount,
+             unsigned long ulDiv, unsigned long *pulAlarm)
+{
+    unsigned long long ullWait;
+
+    if(g_ulIdleRTCClk == 0)
+    {
+        return xfalse;
+    }
+
+    ullWait = (unsigned long long)(ulTicks - 1) * g_ulIdleRTCClk /
+              g_ulIdleTickFreq;
+
+    //
+    // The counter steps ulDiv + 1 clocks from now, then once per prescaler
+    // period.
+    //
+    if(ullWait < ulDiv + 1)
+    {
+        return xfalse;
+    }
+
+    *pulAlarm = ulCount + 1 +
+                (unsigned long)((ullWait - ulDiv - 1) / g_ulIdleRTCDiv);
+    return xtrue;
+}
+
+//*****************************************************************************
+//
+//! \brief Arm the RTC alarm as a wake-up source.
+//!
+//! \param ulAlarm is the RTC count of the alarm.
+//!
+//! \return None.
+//
+//*****************************************************************************
+static void
+IdleAlarmSet(unsigned long ulAlarm)
+{
+    while(!(xHWREG(RTC_CRL) & RTC_CRL_RTOFF));
+    xHWREG(RTC_CRL) |= RTC_CRL_CNF;
+    xHWREG(RTC_ALRH) = ulAlarm >> 16;
+    xHWREG(RTC_ALRL) = ulAlarm & 0xFFFF;
+    xHWREG(RTC_CRH) |= RTC_CRH_ALRIE;
+    xHWREG(RTC_CRL) &= ~(RTC_CRL_CNF | RTC_CRL_ALRF);
+    while(!(xHWREG(RTC_CRL) & RTC_CRL_RTOFF));
+
+    xHWREG(EXTI_PR) = IDLE_EXTI_RTC_ALARM;
+    xHWREG(EXTI_RTSR) |= IDLE_EXTI_RTC_ALARM;
+    xHWREG(EXTI_IMR) |= IDLE_EXTI_RTC_ALARM;
+    xIntEnable(INT_RTCALARM);
+}
+
+//*****************************************************************************
+//
+//! \brief Disarm the RTC alarm.
+//!
+//! \param ulCRH is the RTC_CRH value before IdleAlarmSet().
+//!
+//! The alarm interrupt is cleared before interrupts are enabled again, so
+//! no handler is needed for it.
+//!
+//! \return None.
+//
+//*****************************************************************************
+static void
+IdleAlarmClear(unsigned long ulCRH)
+{
+    xIntDisable(INT_RTCALARM);
+    xHWREG(EXTI_IMR) &= ~IDLE_EXTI_RTC_ALARM;
+    xHWREG(EXTI_PR) = IDLE_EXTI_RTC_ALARM;
+
+    while(!(xHWREG(RTC_CRL) & RTC_CRL_RTOFF));
+    xHWREG(RTC_CRH) = ulCRH;
+    xHWREG(RTC_CRL) &= ~RTC_CRL_ALRF;
+    while(!(xHWREG(RTC_CRL) & RTC_CRL_RTOFF));
+
+    xIntPendClear(INT_RTCALARM);
+}
+
+//*****************************************************************************
+//
+//! \brief Restore the system clock after Stop mode.
+//!
+//! \param ulCR is RCC_CR before Stop mode.
+//! \param ulCFGR is RCC_CFGR before Stop mode.
+//!
+//! The core wakes up on HSI with HSE and the PLLs off.
+//!
+//! \return None.
+//
+//*****************************************************************************
+static void
+IdleClockRestore(unsigned long ulCR, unsigned long ulCFGR)
+{
+    static const unsigned long pulOn[] =
+    {
+        RCC_CR_HSEON, RCC_CR_PLL2ON, RCC_CR_PLL3ON, RCC_CR_PLLON
+    };
+    unsigned long i;
+
+    //
+    // The ready flag is the bit above the on bit.
+    //
+    for(i = 0; i < sizeof(pulOn) / 4; i++)
+    {
+        if(ulCR & pulOn[i])
+        {
+            xHWREG(RCC_CR) |= pulOn[i];
+            while(!(xHWREG(RCC_CR) & (pulOn[i] << 1)));
+        }
+    }
+
+    ulCFGR &= RCC_CFGR_SW_M;
+    xHWREG(RCC_CFGR) = (xHWREG(RCC_CFGR) & ~RCC_CFGR_SW_M) | ulCFGR;
+    while(((xHWREG(RCC_CFGR) & RCC_CFGR_SWS_M) >> RCC_CFGR_SWS_S) != ulCFGR);
+}
+
+//*****************************************************************************
+//
+//! \brief Sleep with SysTick stretched to the deadline.
+//!
+//! \param ulTicks is the number of ticks to the deadline.
+//!
+//! Call it with interrupts disabled and no tick pending.
+//!
+//! \return None.
+//
+//*****************************************************************************
+static void
+IdleSleep(unsigned long ulTicks)
+{
+    unsigned long ulValue, ulLoad, ulElapsed, ulDone, ulRemain;
+
+    if(ulTicks > IDLE_SLEEP_MAX_TICKS)
+    {
+        ulTicks = IDLE_SLEEP_MAX_TICKS;
+    }
+
+    xHWREG(NVIC_ST_CTRL) &= ~NVIC_ST_CTRL_ENABLE;
+    ulValue = xHWREG(NVIC_ST_CURRENT);
+    if((ulTicks < 2) || (ulValue == 0) ||
+       (xHWREG(NVIC_INT_CTRL) & NVIC_INT_CTRL_PENDSTSET))
+    {
+        xHWREG(NVIC_ST_CTRL) |= NVIC_ST_CTRL_ENABLE;
+        xCPUwfi();
+        return;
+    }
+
+    //
+    // The tick fires in ulValue clocks, stretch it by ulTicks - 1 periods.
+    //
+    ulLoad = ulValue + (ulTicks - 1) * g_ulIdlePeriod;
+    IdleSysTickRestart(ulLoad);
+
+    xCPUwfi();
+
+    xHWREG(NVIC_ST_CTRL) &= ~NVIC_ST_CTRL_ENABLE;
+    if(xHWREG(NVIC_INT_CTRL) & NVIC_INT_CTRL_PENDSTSET)
+    {
+        //
+        // Slept to the deadline. The pending tick interrupt counts the last
+        // tick, the counter already runs the next period.
+        //
+        xHWREG(NVIC_ST_CTRL) |= NVIC_ST_CTRL_ENABLE;
+        g_pulIdleStat[xIDLE_MODE_SLEEP] += ulTicks;
+        IdleTickAdvance(ulTicks - 1);
+        return;
+    }
+
+    //
+    // Woken early by another interrupt, count the ticks passed and keep the
+    // phase of the current one.
+    //
+    ulElapsed = ulLoad - xHWREG(NVIC_ST_CURRENT);
+    if(ulElapsed < ulValue)
+    {
+        ulDone = 0;
+        ulRemain = ulValue - ulElapsed;
+    }
+    else
+    {
+        ulElapsed -= ulValue;
+        ulDone = 1 + ulElapsed / g_ulIdlePeriod;
+        ulRemain = g_ulIdlePeriod - ulElapsed % g_ulIdlePeriod;
+    }
+    IdleSysTickRestart(ulRemain);
+    g_pulIdleStat[xIDLE_MODE_SLEEP] += ulDone;
+    IdleTickAdvance(ulDone);
+}
+
+//*****************************************************************************
+//
+//! \brief Enter Stop mode until the deadline.
+//!
+//! \param ulTicks is the number of ticks to the deadline, or
+//! \ref xIDLE_FOREVER.
+//!
+//! Call it with interrupts disabled and no tick pending. SysTick stops in
+//! Stop mode, the time slept is measured on the RTC and added to the tick
+//! counter.
+//!
+//! \return xfalse if the RTC alarm can not fire before the deadline, or the
+//! RTC is not running.
+//
+//*****************************************************************************
+static xtBoolean
+IdleStop(unsigned long ulTicks)
+{
+    unsigned long ulValue, ulCount, ulDiv, ulCount1, ulDiv1, ulAlarm;
+    unsigned long ulCR, ulCFGR, ulCRH;
+    unsigned long long ullUnits, ullTick;
+
+    //
+    // The time slept can not be measured without the RTC.
+    //
+    if(g_ulIdleRTCClk == 0)
+    {
+        return xfalse;
+    }
+
+    //
+    // Stop SysTick and keep the part of the current tick.
+    //
+    xHWREG(NVIC_ST_CTRL) &= ~NVIC_ST_CTRL_ENABLE;
+    ulValue = xHWREG(NVIC_ST_CURRENT);
+
+    IdleRTCRead(&ulCount, &ulDiv);
+    ulCRH = xHWREG(RTC_CRH);
+    if(ulTicks != xIDLE_FOREVER)
+    {
+        if(!IdleAlarmGet(ulTicks, ulCount, ulDiv, &ulAlarm))
+        {
+            xHWREG(NVIC_ST_CTRL) |= NVIC_ST_CTRL_ENABLE;
+            return xfalse;
+        }
+        IdleAlarmSet(ulAlarm);
+    }
+
+    ulCR = xHWREG(RCC_CR);
+    ulCFGR = xHWREG(RCC_CFGR);
+
+    SysCtlStopModeConfig(SYSCTL_REGULATOR_LP | SYSCTL_STOP_WFI);
+
+    xHWREG(NVIC_SYS_CTRL) &= ~NVIC_SYS_CTRL_SLEEPDEEP;
+    IdleClockRestore(ulCR, ulCFGR);
+
+    //
+    // The RTC registers are valid again after RSF is set.
+    //
+    xHWREG(RTC_CRL) &= ~RTC_CRL_RSF;
+    while(!(xHWREG(RTC_CRL) & RTC_CRL_RSF));
+    if(ulTicks != xIDLE_FOREVER)
+    {
+        IdleAlarmClear(ulCRH);
+    }
+    IdleRTCRead(&ulCount1, &ulDiv1);
+
+    //
+    // Time slept in units of 1 / (RTC clock * tick period), plus the part
+    // of the tick before Stop.
+    //
+    ullUnits = (unsigned long long)(ulCount1 - ulCount) * g_ulIdleRTCDiv +
+               ulDiv - ulDiv1;
+    ullUnits = ullUnits * g_ulIdleTickFreq * g_ulIdlePeriod +
+               (unsigned long long)(g_ulIdlePeriod - ulValue) *
+               g_ulIdleRTCClk;
+    ullTick = (unsigned long long)g_ulIdleRTCClk * g_ulIdlePeriod;
+
+    IdleSysTickRestart(g_ulIdlePeriod -
+                       (unsigned long)((ullUnits % ullTick) /
+                                       g_ulIdleRTCClk));
+    g_pulIdleStat[xIDLE_MODE_STOP] += (unsigned long)(ullUnits / ullTick);
+    IdleTickAdvance((unsigned long)(ullUnits / ullTick));
+
+    return xtrue;
+}
+
+//*****************************************************************************
+//
+//! \brief Enter Standby mode until the deadline.
+//!
+//! \param ulTicks is the number of ticks to the deadline, or
+//! \ref xIDLE_FOREVER.
+//!
+//! It only returns if the RTC alarm can not fire before the deadline, or an
+//! interrupt is pending.
+//!
+//! \return None.
+//
+//*****************************************************************************
+static void
+IdleStandby(unsigned long ulTicks)
+{
+    unsigned long ulCount, ulDiv, ulAlarm, ulCRH;
+
+    IdleRTCRead(&ulCount, &ulDiv);
+    ulCRH = xHWREG(RTC_CRH);
+    if(ulTicks != xIDLE_FOREVER)
+    {
+        if(!IdleAlarmGet(ulTicks, ulCount, ulDiv, &ulAlarm))
+        {
+            return;
+        }
+        IdleAlarmSet(ulAlarm);
+    }
+
+    SysCtlEnterStandbyMode();
+
+    xHWREG(PWR_CR) &= ~PWR_CR_PDDS;
+    xHWREG(NVIC_SYS_CTRL) &= ~NVIC_SYS_CTRL_SLEEPDEEP;
+    if(ulTicks != xIDLE_FOREVER)
+    {
+        IdleAlarmClear(ulCRH);
+    }
+}
+
+//*****************************************************************************
+//
+//! \brief Keep the tick rate over a system clock change.
+//!
+//! The SysTick period is computed again from the new HCLK given in
+//! \e ulMsgParam, the rest of the current tick is scaled to the new clock.
+//!
+//! \return 0.
+//
+//*****************************************************************************
+static unsigned long
+IdleClockNotify(void *pvCBData, unsigned long ulEvent,
+                unsigned long ulMsgParam, void *pvMsgData)
+{
+    unsigned long ulOldPeriod, ulValue;
+
+    if(ulEvent != SYSCTL_CLOCK_POST_CHANGE)
+    {
+        return 0;
+    }
+
+    ulOldPeriod = g_ulIdlePeriod;
+    ulValue = xHWREG(NVIC_ST_CURRENT);
+    g_ulIdlePeriod = ulMsgParam / g_ulIdleTickFreq;
+    xASSERT((g_ulIdlePeriod > 1) && (g_ulIdlePeriod <= NVIC_ST_RELOAD_M + 1));
+
+    IdleSysTickRestart((unsigned long)((unsigned long long)ulValue *
+                                       g_ulIdlePeriod / ulOldPeriod));
+
+    return 0;
+}
+
+//*****************************************************************************
+//
+//! \brief Start the idle manager.
+//!
+//! \param ulTickFreq is the tick rate in Hz.
+//! \param ulRTCClk is the RTC clock in Hz (e.g. 32768 on LSE), or 0 if the
+//! RTC is not running.
+//! \param ulRTCDiv is the RTC prescaler, the value given to RTCTimeInit()
+//! plus one.
+//!
+//! Set the system clock and start the RTC first. It programs SysTick for
+//! the tick, clears the timers and limits the state to Stop, or to Sleep
+//! without an RTC. The RTC alarm belongs to the manager from now on.
+//! SysCtlClockSet() can change the system clock later, the tick rate is
+//! kept.
+//!
+//! \return None.
+//
+//*****************************************************************************
+void
+xIdleInit(unsigned long ulTickFreq, unsigned long ulRTCClk,
+          unsigned long ulRTCDiv)
+{
+    unsigned long i;
+
+    xASSERT(ulTickFreq != 0);
+    xASSERT((ulRTCClk == 0) || (ulRTCDiv != 0));
+
+    SysCtlPeripheralEnable(SYSCTL_PERIPH_PWR);
+    SysCtlPeripheralEnable(SYSCTL_PERIPH_BKP);
+    SysCtlBackupAccessEnable();
+
+    g_ulIdleTickFreq = ulTickFreq;
+    g_ulIdleRTCClk = ulRTCClk;
+    g_ulIdleRTCDiv = ulRTCDiv;
+    g_ulIdlePeriod = SysCtlHClockGet() / ulTickFreq;
+    xASSERT((g_ulIdlePeriod > 1) && (g_ulIdlePeriod <= NVIC_ST_RELOAD_M + 1));
+
+    g_ulIdleTick = 0;
+    g_psIdleTimer = 0;
+    for(i = 0; i < 3; i++)
+    {
+        g_pulIdleBlock[i] = 0;
+    }
+    for(i = 0; i < 4; i++)
+    {
+        g_pulIdleStat[i] = 0;
+    }
+    xIdleModeLimit(xIDLE_SOURCE_SYSTEM,
+                   (ulRTCClk != 0) ? xIDLE_MODE_STOP : xIDLE_MODE_SLEEP);
+
+    xHWREG(NVIC_ST_CTRL) = 0;
+    xHWREG(NVIC_ST_RELOAD) = g_ulIdlePeriod - 1;
+    xHWREG(NVIC_ST_CURRENT) = 0;
+    xHWREG(NVIC_ST_CTRL) = NVIC_ST_CTRL_CLK_SRC | NVIC_ST_CTRL_INTEN |
+                           NVIC_ST_CTRL_ENABLE;
+
+    SysCtlClockNotifyRegister(IdleClockNotify, 0);
+}
+
+//*****************************************************************************
+//
+//! \brief Count one tick and run the timers that expire.
+//!
+//! Call it from SysTickIntHandler().
+//!
+//! \return None.
+//
+//*****************************************************************************
+void
+xIdleTickHandler(void)
+{
+    IdleTickAdvance(1);
+}
+
+//*****************************************************************************
+//
+//! \brief Get the tick counter.
+//!
+//! The counter includes the time slept in Stop mode.
+//!
+//! \return the number of ticks since xIdleInit().
+//
+//*****************************************************************************
+unsigned long
+xIdleTickGet(void)
+{
+    return g_ulIdleTick;
+}
+
+//*****************************************************************************
+//
+//! \brief Start a software timer.
+//!
+//! \param psTimer is the timer, it must stay valid until it expires or is
+//! stopped.
+//! \param ulTicks is the number of ticks to wait.
+//! \param pfnCallback is called when the timer expires, may be 0.
+//! \param pvArg is passed to \e pfnCallback.
+//!
+//! A running timer is started again. The callback may start its own timer
+//! again for a periodic timer.
+//!
+//! \return None.
+//
+//*****************************************************************************
+void
+xIdleTimerStart(tIdleTimer *psTimer, unsigned long ulTicks,
+                tIdleCallback pfnCallback, void *pvArg)
+{
+    tIdleTimer **ppsNext;
+    unsigned long ulPrimask;
+
+    xASSERT(psTimer != 0);
+    xASSERT(ulTicks < 0x80000000);
+
+    ulPrimask = xCPUcpsid();
+
+    if(psTimer->bActive)
+    {
+        IdleTimerRemove(psTimer);
+    }
+
+    psTimer->ulExpire = g_ulIdleTick + ulTicks;
+    psTimer->pfnCallback = pfnCallback;
+    psTimer->pvArg = pvArg;
+
+    ppsNext = &g_psIdleTimer;
+    while((*ppsNext != 0) &&
+          ((*ppsNext)->ulExpire - g_ulIdleTick <= ulTicks))
+    {
+        ppsNext = &(*ppsNext)->psNext;
+    }
+    psTimer->psNext = *ppsNext;
+    *ppsNext = psTimer;
+    psTimer->bActive = xtrue;
+
+    if(!ulPrimask)
+    {
+        xCPUcpsie();
+    }
+}
+
+//*****************************************************************************
+//
+//! \brief Stop a software timer.
+//!
+//! \param psTimer is the timer.
+//!
+//! \return None.
+//
+//*****************************************************************************
+void
+xIdleTimerStop(tIdleTimer *psTimer)
+{
+    unsigned long ulPrimask;
+
+    xASSERT(psTimer != 0);
+
+    ulPrimask = xCPUcpsid();
+    if(psTimer->bActive)
+    {
+        IdleTimerRemove(psTimer);
+    }
+    if(!ulPrimask)
+    {
+        xCPUcpsie();
+    }
+}
+
+//*****************************************************************************
+//
+//! \brief Limit the idle state for a user.
+//!
+//! \param ulSource is the user, see \ref xIdle_Source.
+//! \param ulMode is the deepest state the user allows, see \ref xIdle_Mode.
+//!
+//! A driver limits the state to \ref xIDLE_MODE_SLEEP while it needs its
+//! clock and gives \ref xIDLE_MODE_STANDBY back when done. The manager uses
+//! the lightest of the limits.
+//!
+//! \return None.
+//
+//*****************************************************************************
+void
+xIdleModeLimit(unsigned long ulSource, unsigned long ulMode)
+{
+    unsigned long i, ulPrimask;
+
+    xASSERT(ulSource < 32);
+    xASSERT(ulMode <= xIDLE_MODE_STANDBY);
+
+    ulPrimask = xCPUcpsid();
+    for(i = 0; i < 3; i++)
+    {
+        if(ulMode <= i)
+        {
+            g_pulIdleBlock[i] |= (1 << ulSource);
+        }
+        else
+        {
+            g_pulIdleBlock[i] &= ~(1 << ulSource);
+        }
+    }
+    if(!ulPrimask)
+    {
+        xCPUcpsie();
+    }
+}
+
+//*****************************************************************************
+//
+//! \brief Get the deepest idle state that is safe now.
+//!
+//! It takes the limits of xIdleModeLimit() and the busy DMA channels and
+//! UARTs into account, not the timer deadline.
+//!
+//! \return the state, see \ref xIdle_Mode.
+//
+//*****************************************************************************
+unsigned long
+xIdleModeGet(void)
+{
+    unsigned long ulMode;
+
+    ulMode = xIDLE_MODE_RUN;
+    while((ulMode < xIDLE_MODE_STANDBY) && (g_pulIdleBlock[ulMode] == 0))
+    {
+        ulMode++;
+    }
+
+    if((ulMode > xIDLE_MODE_SLEEP) && IdleDriverBusy())
+    {
+        ulMode = xIDLE_MODE_SLEEP;
+    }
+
+    return ulMode;
+}
+
+//*****************************************************************************
+//
+//! \brief Enter the deepest safe low-power state until the next deadline.
+//!
+//! Call it from the main loop when there is nothing to do. It returns after
+//! any interrupt, check the work and call it again. Stop is used for waits
+//! of at least \b IDLE_STOP_MIN_TICKS, Standby for waits of at least
+//! \b IDLE_STANDBY_MIN_TICKS, see xhw_config.h.
+//!
+//! \return the state that was used, \ref xIDLE_MODE_RUN if a tick or timer
+//! was due. Standby does not return.
+//
+//*****************************************************************************
+unsigned long
+xIdleEnter(void)
+{
+    unsigned long ulPrimask, ulMode, ulTicks;
+
+    ulPrimask = xCPUcpsid();
+
+    ulMode = xIdleModeGet();
+    ulTicks = IdleTicksLeft();
+    if((ulTicks == 0) || (xHWREG(NVIC_INT_CTRL) & NVIC_INT_CTRL_PENDSTSET))
+    {
+        ulMode = xIDLE_MODE_RUN;
+    }
+
+    if((ulMode == xIDLE_MODE_STANDBY) && (ulTicks < IDLE_STANDBY_MIN_TICKS))
+    {
+        ulMode = xIDLE_MODE_STOP;
+    }
+    if(ulMode == xIDLE_MODE_STANDBY)
+    {
+        IdleStandby(ulTicks);
+        ulMode = xIDLE_MODE_RUN;
+    }
+
+    if((ulMode == xIDLE_MODE_STOP) && ((ulTicks < IDLE_STOP_MIN_TICKS) ||
+                                       !IdleStop(ulTicks)))
+    {
+        ulMode = xIDLE_MODE_SLEEP;
+    }
+    if(ulMode == xIDLE_MODE_SLEEP)
+    {
+        IdleSleep(ulTicks);
+    }
+
+    if(!ulPrimask)
+    {
+        xCPUcpsie();
+    }
+
+    return ulMode;
+}
+
+//*****************************************************************************
+//
+//! \brief Wait in the idle state.
+//!
+//! \param ulTicks is the number of ticks to wait.
+//!
+//! It replaces xSysCtlDelay() for waits of a tick or more. Do not call it
+//! from an interrupt handler.
+//!
+//! \return None.
+//
+//*****************************************************************************
+void
+xIdleDelay(unsigned long ulTicks)
+{
+    tIdleTimer sTimer;
+
+    sTimer.bActive = xfalse;
+    xIdleTimerStart(&sTimer, ulTicks, 0, 0);
+    while(sTimer.bActive)
+    {
+        xIdleEnter();
+    }
+}
+
+//*****************************************************************************
+//
+//! \brief Get the time slept with the tick stopped or stretched.
+//!
+//! \param ulMode is \ref xIDLE_MODE_SLEEP or \ref xIDLE_MODE_STOP.
+//!
+//! Divided by the ticks since xIdleInit() it gives the share of time spent
+//! in the state.
+//!
+//! \return the number of ticks.
+//
+//*****************************************************************************
+unsigned long
+xIdleStatGet(unsigned long ulMode)
+{
+    xASSERT((ulMode == xIDLE_MODE_SLEEP) || (ulMode == xIDLE_MODE_STOP));
+
+    return g_pulIdleStat[ulMode];
+}
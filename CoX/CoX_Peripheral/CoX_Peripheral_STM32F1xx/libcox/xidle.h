@@ -0,0 +1,261 @@
+//*****************************************************************************
+//
+//! \file xidle.h
+//! \brief Prototypes for the tickless low-power idle manager.
+//! \version V2.2.1.0
+//! \date 10/19/2026
+//! \author CooCox
+//! \copy
+//!
+//! Copyright (c)  2013, CooCox
+//! All rights reserved.
+//! 
+//! Redistribution and use in source and binary forms, with or without 
+//! modification, are permitted provided that the following conditions 
+//! are met: 
+//! 
+//!     * Redistributions of source code must retain the above copyright 
+//! notice, this list of conditions and the following disclaimer. 
+//!     * Redistributions in binary form must reproduce the above copyright
+//! notice, this list of conditions and the following disclaimer in the
+//! documentation and/or other materials provided with the distribution. 
+//!     * Neither the name of the <ORGANIZATION> nor the names of its 
+//! contributors may be used to endorse or promote products derived 
+//! from this software without specific prior written permission. 
+//! 
+//! THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+//! AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE 
+//! IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+//! ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE 
+//! LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR 
+//! CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF 
+//! SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+//! INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN 
+//! CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) 
+//! ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF 
+//! THE POSSIBILITY OF SUCH DAMAGE.
+//
+//*****************************************************************************
+
+#ifndef __xIDLE_H__
+#define __xIDLE_H__
+
+//*****************************************************************************
+//
+// If building with a C++ compiler, make all of the definitions in this header
+// have a C binding.
+//
+//*****************************************************************************
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+//*****************************************************************************
+//
+//! \addtogroup CoX_Peripheral_Lib
+//! @{
+//
+//*****************************************************************************
+
+//*****************************************************************************
+//
+//! \addtogroup xIdle xIdle
+//! \brief Puts the MCU in the deepest low-power state that is safe.
+//!
+//! The manager keeps a tick counter on SysTick and a list of software
+//! timers. When the application has nothing to do it calls xIdleEnter(),
+//! which picks a state from the next timer deadline and the limits of the
+//! drivers:
+//!
+//! - \b Sleep, WFI with SysTick stretched to the deadline, so the core is
+//! not woken for every tick.
+//! - \b Stop, all clocks off, the RTC alarm wakes the core before the
+//! deadline. The system clock is restored and the time slept, measured on
+//! the RTC, is added to the tick counter.
+//! - \b Standby, the RTC alarm wakes the MCU with a reset. It is only used
+//! when the application allows it.
+//! .
+//!
+//! An enabled DMA channel with data left, a UART with the RXNE interrupt on
+//! or a UART still sending needs the peripheral clocks, so the manager does
+//! not go below Sleep while one of them is found. Other users limit the state
+//! with xIdleModeLimit().
+//!
+//! \section xIdle_How How to use the Idle Manager?
+//! -# Set the system clock, then start the RTC (e.g. on LSE with
+//! RTCTimeInit()).
+//! -# Call xIdleInit() with the tick rate and the RTC clock and prescaler.
+//! -# Call xIdleTickHandler() from SysTickIntHandler().
+//! -# Use xIdleTimerStart() and xIdleDelay() instead of busy waiting, and
+//! call xIdleEnter() from the main loop when there is no work.
+//! .
+//!
+//! The RTC alarm only fires on a counter edge, so Stop is used for deadlines
+//! at least one RTC counter period away. A 1 Hz calendar RTC gives Stop for
+//! waits of a second or more; a faster prescaler gives finer Stop. The RTC
+//! alarm belongs to the manager.
+//!
+//! @{
+//
+//*****************************************************************************
+
+//*****************************************************************************
+//
+//! \addtogroup xIdle_Mode xIdle Mode
+//! \brief Low-power states, from the lightest to the deepest.
+//! @{
+//
+//*****************************************************************************
+
+//
+//! The core keeps running.
+//
+#define xIDLE_MODE_RUN          0
+
+//
+//! WFI, the peripherals keep their clocks.
+//
+#define xIDLE_MODE_SLEEP        1
+
+//
+//! Stop mode with the regulator in low-power mode, RAM is kept.
+//
+#define xIDLE_MODE_STOP         2
+
+//
+//! Standby mode, RAM is lost and the wake-up is a reset.
+//
+#define xIDLE_MODE_STANDBY      3
+
+//*****************************************************************************
+//
+//! @}
+//
+//*****************************************************************************
+
+//*****************************************************************************
+//
+//! \addtogroup xIdle_Source xIdle Source
+//! \brief The users that can limit the state, values that can be passed to
+//! xIdleModeLimit() as \e ulSource.
+//! @{
+//
+//*****************************************************************************
+
+//
+//! The manager itself. xIdleInit() limits it to Stop, or to Sleep without an
+//! RTC. Limit it to Standby to allow Standby.
+//
+#define xIDLE_SOURCE_SYSTEM     0
+
+//
+//! User or driver \e n, 1 to 31.
+//
+#define xIDLE_SOURCE_USER(n)    (n)
+
+//*****************************************************************************
+//
+//! @}
+//
+//*****************************************************************************
+
+//*****************************************************************************
+//
+//! \addtogroup xIdle_Types xIdle Types
+//! @{
+//
+//*****************************************************************************
+
+//
+//! No timer is pending.
+//
+#define xIDLE_FOREVER           0xFFFFFFFF
+
+//
+//! Software timer callback. Called from the SysTick interrupt, or from
+//! xIdleEnter() with interrupts disabled after a Stop wake-up.
+//
+typedef void (*tIdleCallback)(void *pvArg);
+
+typedef struct tIdleTimer
+{
+    //
+    //! Next timer of the list.
+    //
+    struct tIdleTimer *psNext;
+
+    //
+    //! Tick count when the timer expires.
+    //
+    unsigned long ulExpire;
+
+    //
+    //! Called when the timer expires, may be 0.
+    //
+    tIdleCallback pfnCallback;
+
+    void *pvArg;
+
+    //
+    //! xtrue from xIdleTimerStart() until the timer expires or is stopped.
+    //
+    volatile xtBoolean bActive;
+}
+tIdleTimer;
+
+//*****************************************************************************
+//
+//! @}
+//
+//*****************************************************************************
+
+//*****************************************************************************
+//
+//! \addtogroup xIdle_Exported_APIs xIdle API
+//! \brief xIdle API Reference.
+//! @{
+//
+//*****************************************************************************
+
+extern void xIdleInit(unsigned long ulTickFreq, unsigned long ulRTCClk,
+                      unsigned long ulRTCDiv);
+extern void xIdleTickHandler(void);
+extern unsigned long xIdleTickGet(void);
+extern void xIdleTimerStart(tIdleTimer *psTimer, unsigned long ulTicks,
+                            tIdleCallback pfnCallback, void *pvArg);
+extern void xIdleTimerStop(tIdleTimer *psTimer);
+extern void xIdleModeLimit(unsigned long ulSource, unsigned long ulMode);
+extern unsigned long xIdleModeGet(void);
+extern unsigned long xIdleEnter(void);
+extern void xIdleDelay(unsigned long ulTicks);
+extern unsigned long xIdleStatGet(unsigned long ulMode);
+
+//*****************************************************************************
+//
+//! @}
+//
+//*****************************************************************************
+
+//*****************************************************************************
+//
+//! @}
+//
+//*****************************************************************************
+
+//*****************************************************************************
+//
+//! @}
+//
+//*****************************************************************************
+
+//*****************************************************************************
+//
+// Mark the end of the C bindings section for C++ compilers.
+//
+//*****************************************************************************
+#ifdef __cplusplus
+}
+#endif
+
+#endif // __xIDLE_H__
@@ -46,6 +46,7 @@
 #include "xdebug.h"
 #include "xcore.h"
 #include "xsysctl.h"
+#include "xtimer.h"
 #include "xpwm.h"
 
 //*****************************************************************************
@@ -55,6 +56,24 @@
 //*****************************************************************************
 static xtEventCallback g_pfnPWMHandlerCallbacks[12]={0};
 
+//*****************************************************************************
+//
+// The PWM bases, in the order of g_ulPWMFrequency
+//
+//*****************************************************************************
+static const unsigned long g_ulPWMBase[12] =
+{
+    TIM1_BASE, TIM8_BASE,  TIM2_BASE,  TIM3_BASE,  TIM4_BASE,  TIM5_BASE,
+    TIM9_BASE, TIM12_BASE, TIM10_BASE, TIM11_BASE, TIM13_BASE, TIM14_BASE
+};
+
+//*****************************************************************************
+//
+// The frequency set by PWMFrequencySet() on each PWM, 0 if it is not set
+//
+//*****************************************************************************
+static unsigned long g_ulPWMFrequency[12] = {0};
+
 //*****************************************************************************
 //
 //! \internal
@@ -81,466 +100,83 @@ PWMBaseValid(unsigned long ulBase)
 }
 #endif
 
-#if (TIM1_FUNCTION_SELECT == TIM_PWM)
-//*****************************************************************************
-//
-//! \brief The PWMA default IRQ, declared in start up code. 
-//!
-//! \param None.
-//!
-//! This function is to give a default PWMA IRQ service.
-//!
-//! \note The Callback function have two effective parameters,One is indicate
-//! is a PWM or Capture interrupt.And the other one show which channel have a 
-//! interrupt.
-//!
-//! \return None.
-//
-//*****************************************************************************
-void 
-TIM1CCIntHandler(void)
-{
-    unsigned long ulPWMStastus;
-    unsigned long ulBase = xPWMA_BASE;
-    
-    //
-    // Clear the PWMA INT Flag
-    //
- 
-    ulPWMStastus = xHWREG(ulBase + TIMER_SR);
-    xHWREG(ulBase + TIMER_SR) &= ~ulPWMStastus;
-    
-    if (g_pfnPWMHandlerCallbacks[0] != 0)        
-    {
-        if(ulPWMStastus != 0)
-        {
-            g_pfnPWMHandlerCallbacks[0](0, PWM_EVENT_PWM, ulPWMStastus, 0);
-        }
-    }
-}
-#endif
-
-#if (STM32F1xx_DEVICE == STM32F10X_XL || STM32F1xx_DEVICE == STM32F10X_HD_VL)
-#if (TIM8_FUNCTION_SELECT == TIM_PWM)
 //*****************************************************************************
 //
-//! \brief The PWMB default IRQ, declared in start up code. 
-//!
-//! \param None.
-//!
-//! This function is to give a default PWMB IRQ service.
-//!
-//! \note The Callback function have two effective parameters,One is indicate
-//! is a PWM or Capture interrupt.And the other one show which channel have a 
-//! interrupt.
-//!
-//! \return None.
-//
-//*****************************************************************************
-void 
-TIM8CCIntHandler(void)
-{
-    unsigned long ulPWMStastus;
-    unsigned long ulBase = xPWMB_BASE;
-    
-    //
-    // Clear the PWMA INT Flag
-    //        
-    ulPWMStastus = xHWREG(ulBase + TIMER_SR) & 0x1E;
-    xHWREG(ulBase + TIMER_SR) &= ~ulPWMStastus;
-    
-    if (g_pfnPWMHandlerCallbacks[1] != 0)        
-    {
-        if(ulPWMStastus != 0)
-        {
-            g_pfnPWMHandlerCallbacks[1](0, PWM_EVENT_PWM, ulPWMStastus, 0);
-        }
-    }
-}
-#endif
-#endif
-
-#if (TIM2_FUNCTION_SELECT == TIM_PWM)
-//*****************************************************************************
-//
-//! \brief The PWMC default IRQ, declared in start up code. 
-//!
-//! \param None.
-//!
-//! This function is to give a default PWMC IRQ service.
-//!
-//! \note The Callback function have two effective parameters,One is indicate
-//! is a PWM or Capture interrupt.And the other one show which channel have a 
-//! interrupt.
-//!
-//! \return None.
-//
-//*****************************************************************************
-void 
-TIM2IntHandler(void)
-{
-    unsigned long ulPWMStastus;
-    unsigned long ulBase = xPWMC_BASE;
-    
-    //
-    // Clear the PWMA INT Flag
-    //        
-    ulPWMStastus = xHWREG(ulBase + TIMER_SR) & 0x1E;
-    xHWREG(ulBase + TIMER_SR) &= ~ulPWMStastus;
-    
-    if (g_pfnPWMHandlerCallbacks[2] != 0)        
-    {
-        if(ulPWMStastus != 0)
-        {
-            g_pfnPWMHandlerCallbacks[2](0, PWM_EVENT_PWM, ulPWMStastus, 0);
-        }
-    }
-}
-#endif
-
-#if (TIM3_FUNCTION_SELECT == TIM_PWM)
-//*****************************************************************************
-//
-//! \brief The PWMD default IRQ, declared in start up code. 
-//!
-//! \param None.
-//!
-//! This function is to give a default PWMD IRQ service.
-//!
-//! \note The Callback function have two effective parameters,One is indicate
-//! is a PWM or Capture interrupt.And the other one show which channel have a 
-//! interrupt.
-//!
-//! \return None.
-//
-//*****************************************************************************
-void 
-TIM3IntHandler(void)
-{
-    unsigned long ulPWMStastus;
-    unsigned long ulBase = xPWMD_BASE;
-    
-    //
-    // Clear the PWMA INT Flag
-    //        
-    ulPWMStastus = xHWREG(ulBase + TIMER_SR) & 0x1E;
-    xHWREG(ulBase + TIMER_SR) &= ~ulPWMStastus;
-    
-    if (g_pfnPWMHandlerCallbacks[3] != 0)        
-    {
-        if(ulPWMStastus != 0)
-        {
-            g_pfnPWMHandlerCallbacks[3](0, PWM_EVENT_PWM, ulPWMStastus, 0);
-        }
-    }
-}
-#endif
-
-#if (TIM4_FUNCTION_SELECT == TIM_PWM)
-//*****************************************************************************
-//
-//! \brief The PWME default IRQ, declared in start up code. 
-//!
-//! \param None.
-//!
-//! This function is to give a default PWME IRQ service.
+//! \internal
+//! \brief Gets the index of a PWM in g_ulPWMBase.
 //!
-//! \note The Callback function have two effective parameters,One is indicate
-//! is a PWM or Capture interrupt.And the other one show which channel have a 
-//! interrupt.
+//! \param ulBase is the base address of the PWM port.
 //!
-//! \return None.
+//! \return The index of the PWM.
 //
 //*****************************************************************************
-void 
-TIM4IntHandler(void)
+static unsigned long
+PWMIndexGet(unsigned long ulBase)
 {
-    unsigned long ulPWMStastus;
-    unsigned long ulBase = xPWME_BASE;
-    
-    //
-    // Clear the PWMA INT Flag
-    //        
-    ulPWMStastus = xHWREG(ulBase + TIMER_SR) & 0x1E;
-    xHWREG(ulBase + TIMER_SR) &= ~ulPWMStastus;
-    
-    if (g_pfnPWMHandlerCallbacks[4] != 0)        
-    {
-        if(ulPWMStastus != 0)
-        {
-            g_pfnPWMHandlerCallbacks[4](0, PWM_EVENT_PWM, ulPWMStastus, 0);
-        }
-    }
-}
-#endif
+    unsigned long i;
 
-#if (TIM5_FUNCTION_SELECT == TIM_PWM)
-//*****************************************************************************
-//
-//! \brief The PWMF default IRQ, declared in start up code. 
-//!
-//! \param None.
-//!
-//! This function is to give a default PWMF IRQ service.
-//!
-//! \note The Callback function have two effective parameters,One is indicate
-//! is a PWM or Capture interrupt.And the other one show which channel have a 
-//! interrupt.
-//!
-//! \return None.
-//
-//*****************************************************************************
-void 
-TIM5IntHandler(void)
-{
-    unsigned long ulPWMStastus;
-    unsigned long ulBase = xPWMF_BASE;
-    
-    //
-    // Clear the PWMA INT Flag
-    //        
-    ulPWMStastus = xHWREG(ulBase + TIMER_SR) & 0x1E;
-    xHWREG(ulBase + TIMER_SR) &= ~ulPWMStastus;
-    
-    if (g_pfnPWMHandlerCallbacks[5] != 0)        
+    for(i = 0; i < 11; i++)
     {
-        if(ulPWMStastus != 0)
+        if(g_ulPWMBase[i] == ulBase)
         {
-            g_pfnPWMHandlerCallbacks[5](0, PWM_EVENT_PWM, ulPWMStastus, 0);
+            break;
         }
     }
-}
-#endif
+    xASSERT(g_ulPWMBase[i] == ulBase);
 
-#if (STM32F1xx_DEVICE == STM32F10X_XL)
-#if (TIM9_FUNCTION_SELECT == TIM_PWM)
-//*****************************************************************************
-//
-//! \brief The PWMG default IRQ, declared in start up code. 
-//!
-//! \param None.
-//!
-//! This function is to give a default PWMG IRQ service.
-//!
-//! \note The Callback function have two effective parameters,One is indicate
-//! is a PWM or Capture interrupt.And the other one show which channel have a 
-//! interrupt.
-//!
-//! \return None.
-//
-//*****************************************************************************
-void
-TIM1BRKTIM9IntHandler(void)
-{
-    unsigned long ulPWMStastus;
-    unsigned long ulBase = xPWMG_BASE;
-    
-    //
-    // Clear the PWMA INT Flag
-    //        
-    ulPWMStastus = xHWREG(ulBase + TIMER_SR) & 0x1E;
-    xHWREG(ulBase + TIMER_SR) &= ~ulPWMStastus;
-    
-    if (g_pfnPWMHandlerCallbacks[6] != 0)        
-    {
-        if(ulPWMStastus != 0)
-        {
-            g_pfnPWMHandlerCallbacks[6](0, PWM_EVENT_PWM, ulPWMStastus, 0);
-        }
-    }
+    return i;
 }
-#endif
 
-#if (TIM12_FUNCTION_SELECT == TIM_PWM)
 //*****************************************************************************
 //
-//! \brief The PWMH default IRQ, declared in start up code. 
-//!
-//! \param None.
+//! \internal
+//! \brief The callback of the timer sources claimed by the PWM.
 //!
-//! This function is to give a default PWMH IRQ service.
+//! \param pvCBData is the index of the PWM in g_ulPWMBase.
+//! \param ulEvent is the timer source, \b TIMER_INT_CH1CC ... 
+//! \b TIMER_INT_CH4CC or \b TIMER_INT_UEV.
 //!
-//! \note The Callback function have two effective parameters,One is indicate
-//! is a PWM or Capture interrupt.And the other one show which channel have a 
-//! interrupt.
+//! The timer interrupt handlers in xtimer.c call it for the channels of
+//! this PWM only, the other channels of the timer may have other users.
+//! It calls the callback of PWMIntCallbackInit() with the source.
 //!
-//! \return None.
+//! \return The value of the PWM callback.
 //
 //*****************************************************************************
-void
-TIM8BRKTIM12IntHandler(void)
+static unsigned long
+PWMIntDispatch(void *pvCBData, unsigned long ulEvent,
+               unsigned long ulMsgParam, void *pvMsgData)
 {
-    unsigned long ulPWMStastus;
-    unsigned long ulBase = xPWMH_BASE;
-    
-    //
-    // Clear the PWMA INT Flag
-    //        
-    ulPWMStastus = xHWREG(ulBase + TIMER_SR) & 0x1E;
-    xHWREG(ulBase + TIMER_SR) &= ~ulPWMStastus;
-    
-    if (g_pfnPWMHandlerCallbacks[7] != 0)        
-    {
-        if(ulPWMStastus != 0)
-        {
-            g_pfnPWMHandlerCallbacks[7](0, PWM_EVENT_PWM, ulPWMStastus, 0);
-        }
-    }
-}
-#endif
+    unsigned long i = (unsigned long)pvCBData;
 
-#if (TIM10_FUNCTION_SELECT == TIM_PWM)
-//*****************************************************************************
-//
-//! \brief The PWMI default IRQ, declared in start up code. 
-//!
-//! \param None.
-//!
-//! This function is to give a default PWMI IRQ service.
-//!
-//! \note The Callback function have two effective parameters,One is indicate
-//! is a PWM or Capture interrupt.And the other one show which channel have a 
-//! interrupt.
-//!
-//! \return None.
-//
-//*****************************************************************************
-void
-TIM1UPTIM10IntHandler(void)
-{
-    unsigned long ulPWMStastus;
-    unsigned long ulBase = xPWMI_BASE;
-    
-    //
-    // Clear the PWMA INT Flag
-    //        
-    ulPWMStastus = xHWREG(ulBase + TIMER_SR) & 0x1E;
-    xHWREG(ulBase + TIMER_SR) &= ~ulPWMStastus;
-    
-    if (g_pfnPWMHandlerCallbacks[8] != 0)        
+    if(g_pfnPWMHandlerCallbacks[i] == 0)
     {
-        if(ulPWMStastus != 0)
-        {
-            g_pfnPWMHandlerCallbacks[8](0, PWM_EVENT_PWM, ulPWMStastus, 0);
-        }
+        return 0;
     }
-}
-#endif
 
-#if (TIM11_FUNCTION_SELECT == TIM_PWM)
-//*****************************************************************************
-//
-//! \brief The PWMJ default IRQ, declared in start up code. 
-//!
-//! \param None.
-//!
-//! This function is to give a default PWMJ IRQ service.
-//!
-//! \note The Callback function have two effective parameters,One is indicate
-//! is a PWM or Capture interrupt.And the other one show which channel have a 
-//! interrupt.
-//!
-//! \return None.
-//
-//*****************************************************************************
-void
-TIM1TRGCOMTIM11IntHandler(void)
-{
-    unsigned long ulPWMStastus;
-    unsigned long ulBase = xPWMJ_BASE;
-    
-    //
-    // Clear the PWMA INT Flag
-    //        
-    ulPWMStastus = xHWREG(ulBase + TIMER_SR) & 0x1E;
-    xHWREG(ulBase + TIMER_SR) &= ~ulPWMStastus;
-    
-    if (g_pfnPWMHandlerCallbacks[9] != 0)        
-    {
-        if(ulPWMStastus != 0)
-        {
-            g_pfnPWMHandlerCallbacks[9](0, PWM_EVENT_PWM, ulPWMStastus, 0);
-        }
-    }
+    return g_pfnPWMHandlerCallbacks[i](0, PWM_EVENT_PWM, ulEvent, 0);
 }
-#endif
 
-#if (TIM13_FUNCTION_SELECT == TIM_PWM)
 //*****************************************************************************
 //
-//! \brief The PWMK default IRQ, declared in start up code. 
-//!
-//! \param None.
-//!
-//! This function is to give a default PWMK IRQ service.
+//! \internal
+//! \brief Claims the timer sources of a PWM channel.
 //!
-//! \note The Callback function have two effective parameters,One is indicate
-//! is a PWM or Capture interrupt.And the other one show which channel have a 
-//! interrupt.
+//! \param ulBase is the base address of the PWM port.
+//! \param ulSources is the timer sources, see TimerResClaim().
 //!
-//! \return None.
+//! \return \b xtrue if the sources are claimed, \b xfalse if they are used
+//! by another user of the timer.
 //
 //*****************************************************************************
-void
-TIM8UPTIM13IntHandler(void)
+static xtBoolean
+PWMResClaim(unsigned long ulBase, unsigned long ulSources)
 {
-    unsigned long ulPWMStastus;
-    unsigned long ulBase = xPWMK_BASE;
-    
-    //
-    // Clear the PWMA INT Flag
-    //        
-    ulPWMStastus = xHWREG(ulBase + TIMER_SR) & 0x1E;
-    xHWREG(ulBase + TIMER_SR) &= ~ulPWMStastus;
-    
-    if (g_pfnPWMHandlerCallbacks[10] != 0)        
-    {
-        if(ulPWMStastus != 0)
-        {
-            g_pfnPWMHandlerCallbacks[10](0, PWM_EVENT_PWM, ulPWMStastus, 0);
-        }
-    }
-}
-#endif
+    unsigned long i = PWMIndexGet(ulBase);
 
-#if (TIM14_FUNCTION_SELECT == TIM_PWM)
-//*****************************************************************************
-//
-//! \brief The PWML default IRQ, declared in start up code. 
-//!
-//! \param None.
-//!
-//! This function is to give a default PWML IRQ service.
-//!
-//! \note The Callback function have two effective parameters,One is indicate
-//! is a PWM or Capture interrupt.And the other one show which channel have a 
-//! interrupt.
-//!
-//! \return None.
-//
-//*****************************************************************************
-void
-TIM8TRGCOMTIM14IntHandler(void)
-{
-    unsigned long ulPWMStastus;
-    unsigned long ulBase = xPWML_BASE;
-    
-    //
-    // Clear the PWMA INT Flag
-    //        
-    ulPWMStastus = xHWREG(ulBase + TIMER_SR) & 0x1E;
-    xHWREG(ulBase + TIMER_SR) &= ~ulPWMStastus;
-    
-    if (g_pfnPWMHandlerCallbacks[11] != 0)        
-    {
-        if(ulPWMStastus != 0)
-        {
-            g_pfnPWMHandlerCallbacks[11](0, PWM_EVENT_PWM, ulPWMStastus, 0);
-        }
-    }
+    return TimerResClaim(ulBase, ulSources, TIMER_OWNER_PWM, PWMIntDispatch,
+                         (void *)i);
 }
-#endif
-#endif
 
 //*****************************************************************************
 //
@@ -566,6 +202,10 @@ TIM8TRGCOMTIM14IntHandler(void)
 //! becomes a complementary pair for PWM group A and the pair of PWM4 and 
 //! PWM5 becomes a complementary pair for PWM group B.
 //!
+//! \note The channel is claimed for the PWM with TimerResClaim(). When a
+//! capture or another timer user holds it the channel is not configured,
+//! check it with TimerResOwnerGet() in a release build.
+//!
 //! \return None.
 //
 //*****************************************************************************
@@ -579,6 +219,15 @@ xPWMInitConfigure(unsigned long ulBase, unsigned long ulChannel,
     xASSERT(PWMBaseValid(ulBase));
     xASSERT(((ulChannel >= 0) || (ulChannel <= 3)));
 
+    //
+    // The channel must not be used by a capture or another timer user
+    //
+    if(!PWMResClaim(ulBase, TIMER_INT_CH1CC << ulChannel))
+    {
+        xASSERT(0);
+        return;
+    }
+
     //
     // Set PWM Mode
     //
@@ -629,6 +278,10 @@ xPWMInitConfigure(unsigned long ulBase, unsigned long ulChannel,
 //! \b PWM_CNT_MODE_UP, \b PWM_CNT_MODE_DOWN, \b PWM_CNT_MODE_CENTER_1,
 //! \b PWM_CNT_MODE_CENTER_2, \b PWM_CNT_MODE_CENTER_3.
 //!
+//! \note The channel is claimed for the PWM with TimerResClaim(). When a
+//! capture or another timer user holds it the channel is not configured,
+//! check it with TimerResOwnerGet() in a release build.
+//!
 //! \return None.
 //
 //*****************************************************************************
@@ -649,6 +302,15 @@ PWMInitConfigure(unsigned long ulBase, unsigned long ulChannel,
             (ulDir == PWM_CNT_MODE_DOWN) || (ulDir == PWM_CNT_MODE_CENTER_2) ||
             (ulDir == PWM_CNT_MODE_CENTER_3));
 
+    //
+    // The channel must not be used by a capture or another timer user
+    //
+    if(!PWMResClaim(ulBase, TIMER_INT_CH1CC << ulChannel))
+    {
+        xASSERT(0);
+        return;
+    }
+
     //
     // Selcet the count direction
     //
@@ -800,6 +462,9 @@ PWMDutyGet(unsigned long ulBase, unsigned long ulChannel)
 //! The \e ulIntType parameter can be values:
 //! \b PWM_INT_CHXCC, \b PWM_INT_UEV1.
 //!
+//! \note \b PWM_INT_UEV1 is not enabled when a time base on the same timer
+//! holds the update event.
+//!
 //! \return None.
 //
 //*****************************************************************************
@@ -816,7 +481,13 @@ PWMIntEnable(unsigned long ulBase, unsigned long ulChannel,
 
     if (ulIntType == PWM_INT_UEV1)
     {
-        xHWREG(ulBase + TIMER_DIER) |= PWM_INT_UEV1; 
+        //
+        // The update event stays with a time base on the same timer
+        //
+        if(PWMResClaim(ulBase, TIMER_INT_UEV))
+        {
+            xHWREG(ulBase + TIMER_DIER) |= PWM_INT_UEV1;
+        }
     }
     else
     {
@@ -994,6 +665,56 @@ PWMStop(unsigned long ulBase)
     xHWREG(ulBase + TIMER_BDTR) &= ~TIMER_BDTR_MOE;
 }
 
+//*****************************************************************************
+//
+//! \internal
+//! \brief Keeps the PWM frequencies and duties over a system clock change.
+//!
+//! PWMFrequencySet() runs again with the frequency it was given, and the
+//! compare values are scaled by the change of the auto-reload value, so the
+//! duty of each channel is kept.
+//!
+//! \return 0.
+//
+//*****************************************************************************
+static unsigned long
+PWMClockNotify(void *pvCBData, unsigned long ulEvent,
+               unsigned long ulMsgParam, void *pvMsgData)
+{
+    unsigned long i, j, ulBase, ulOldARR, ulNewARR, ulCCR;
+
+    if(ulEvent != SYSCTL_CLOCK_POST_CHANGE)
+    {
+        return 0;
+    }
+
+    for(i = 0; i < 12; i++)
+    {
+        ulBase = g_ulPWMBase[i];
+        if(g_ulPWMFrequency[i] == 0)
+        {
+            continue;
+        }
+
+        ulOldARR = xHWREG(ulBase + TIMER_ARR);
+        PWMFrequencySet(ulBase, g_ulPWMFrequency[i]);
+        ulNewARR = xHWREG(ulBase + TIMER_ARR);
+        if((ulOldARR == 0) || (ulOldARR == ulNewARR))
+        {
+            continue;
+        }
+
+        for(j = 0; j < 4; j++)
+        {
+            ulCCR = xHWREG(ulBase + TIMER_CCR1 + j * 4) & TIMER_CCR1_CCR1_M;
+            ulCCR = (ulCCR * ulNewARR + ulOldARR / 2) / ulOldARR;
+            xHWREG(ulBase + TIMER_CCR1 + j * 4) = ulCCR;
+        }
+    }
+
+    return 0;
+}
+
 //*****************************************************************************
 //
 //! \brief Set the PWM frequency of the PWM module. 
@@ -1006,6 +727,9 @@ PWMStop(unsigned long ulBase)
 //! The \e ulFrequency parameter can be values: Any values ,ulFrequency > 0 &&
 //! ulFrequency < PWM module input clock.
 //!
+//! The frequency and the duties are set again when SysCtlClockSet() changes
+//! the system clock.
+//!
 //! \return the Actual Frequency of PWM.
 //
 //*****************************************************************************
@@ -1064,6 +788,12 @@ PWMFrequencySet(unsigned long ulBase, unsigned long ulFrequency)
     xHWREG(ulBase + TIMER_ARR) = usCNRData;
     xHWREG(ulBase + TIMER_PSC) = ulPreScale - 1;
 
+    //
+    // Keep the frequency for the clock changes.
+    //
+    g_ulPWMFrequency[PWMIndexGet(ulBase)] = ulFrequency;
+    SysCtlClockNotifyRegister(PWMClockNotify, 0);
+
     if((ulBase==TIM1_BASE) || (ulBase==TIM8_BASE) || (ulBase==TIM9_BASE)||
     	 (ulBase==TIM10_BASE) || (ulBase==TIM11_BASE))
     {
@@ -44,6 +44,7 @@
 #include "xhw_sysctl.h"
 #include "xhw_spi.h"
 #include "xdebug.h"
+#include "xtrace.h"
 #include "xsysctl.h"
 #include "xspi.h"
 
@@ -54,6 +55,20 @@
 //*****************************************************************************
 static xtEventCallback g_pfnSPIHandlerCallbacks[3]={0};
 
+//*****************************************************************************
+//
+// The SPI bases, in the order of g_ulSPIBitRate
+//
+//*****************************************************************************
+static const unsigned long g_ulSPIBase[3] = {SPI1_BASE, SPI2_BASE, SPI3_BASE};
+
+//*****************************************************************************
+//
+// The bit rate set by SPIConfig() on each SPI, 0 if it is not set
+//
+//*****************************************************************************
+static unsigned long g_ulSPIBitRate[3] = {0};
+
 //*****************************************************************************
 //
 //! \brief SPI1 interrupt handler. Clear the SPI interrupt flag and execute the 
@@ -324,6 +339,109 @@ void xSPISSSet(unsigned long ulBase, unsigned long ulSSMode,
 
 }
 
+//*****************************************************************************
+//
+//! \internal
+//! \brief Sets the bit rate of a SPI from its current APB clock.
+//!
+//! \param ulBase specifies the SPI module base address.
+//! \param ulBitRate specifies the clock rate.
+//!
+//! \return None.
+//
+//*****************************************************************************
+static void
+SPIBitRateSet(unsigned long ulBase, unsigned long ulBitRate)
+{
+    unsigned long ulPCLK;
+    unsigned long ulPreDiv;
+
+    if(ulBase == SPI1_BASE)
+    {
+        ulPCLK = SysCtlAPB2ClockGet();
+    }
+    else
+    {
+        ulPCLK = SysCtlAPB1ClockGet();
+    }
+    ulPreDiv = (((ulPCLK / ulBitRate)+1) >> 1) -1 ;
+    if (ulPreDiv <= 2)
+    {
+        ulPreDiv = 0;
+    }
+    else if(ulPreDiv <= 4)
+    {
+        ulPreDiv = 1;
+    }
+    else if(ulPreDiv <= 8)
+    {
+        ulPreDiv = 2;
+    }
+    else if(ulPreDiv <= 16)
+    {
+        ulPreDiv = 3;
+    }
+    else if(ulPreDiv <= 32)
+    {
+        ulPreDiv = 4;
+    }
+    else if(ulPreDiv <= 64)
+    {
+        ulPreDiv = 5;
+    }
+    else if(ulPreDiv <= 128)
+    {
+        ulPreDiv = 6;
+    }
+    else
+    {
+        ulPreDiv = 7;
+    }
+    xHWREG(ulBase + SPI_CR1) &= ~SPI_CR1_BR_M;
+    xHWREG(ulBase + SPI_CR1) |= (ulPreDiv << SPI_CR1_BR_S);
+}
+
+//*****************************************************************************
+//
+//! \internal
+//! \brief Keeps the bit rates of the SPIs over a system clock change.
+//!
+//! Before the change it waits for the enabled SPIs to finish the frame on the
+//! bus, after the change it sets the bit rates again from the new APB clocks.
+//!
+//! \return 0.
+//
+//*****************************************************************************
+static unsigned long
+SPIClockNotify(void *pvCBData, unsigned long ulEvent,
+               unsigned long ulMsgParam, void *pvMsgData)
+{
+    unsigned long i, ulBase;
+
+    for(i = 0; i < 3; i++)
+    {
+        ulBase = g_ulSPIBase[i];
+        if(g_ulSPIBitRate[i] == 0)
+        {
+            continue;
+        }
+
+        if(ulEvent == SYSCTL_CLOCK_PRE_CHANGE)
+        {
+            if(xHWREG(ulBase + SPI_CR1) & SPI_CR1_SPE)
+            {
+                while(xHWREG(ulBase + SPI_SR) & SPI_SR_BSY);
+            }
+        }
+        else
+        {
+            SPIBitRateSet(ulBase, g_ulSPIBitRate[i]);
+        }
+    }
+
+    return 0;
+}
+
 //*****************************************************************************
 //
 //! \brief Configures the synchronous serial interface.
@@ -371,6 +489,9 @@ void xSPISSSet(unsigned long ulBase, unsigned long ulSSMode,
 //! The bidirectional data mode, can be one of the following values:
 //! \b SPI_2LINE_FULL, \b SPI_1LINE_RX, \b SPI_1LINE_TX, or \b SPI_2LINE_RX.
 //!
+//! The bit rate is set again from the new APB clock when SysCtlClockSet()
+//! changes the system clock.
+//!
 //! \return None.
 //
 //*****************************************************************************
@@ -378,8 +499,7 @@ void
 SPIConfig(unsigned long ulBase, unsigned long ulBitRate,
           unsigned long ulConfig)
 {
-    unsigned long ulPCLK;
-    unsigned long ulPreDiv;
+    unsigned long i;
 
     //
     // Check the arguments.
@@ -408,52 +528,19 @@ SPIConfig(unsigned long ulBase, unsigned long ulBitRate,
         xHWREG(ulBase + SPI_CR1) &= ~0x00000087;
     xHWREG(ulBase + SPI_CR1) |= ulConfig;
 
+    SPIBitRateSet(ulBase, ulBitRate);
+
     //
-    // Set the clock rate.
+    // Keep the bit rate for the clock changes.
     //
-    if(ulBase == SPI1_BASE)
-    {
-        ulPCLK = SysCtlAPB2ClockGet();
-    }
-    else
-    {
-        ulPCLK = SysCtlAPB1ClockGet();
-    }
-    ulPreDiv = (((ulPCLK / ulBitRate)+1) >> 1) -1 ;
-    if (ulPreDiv <= 2)
-    {
-        ulPreDiv = 0;
-    }
-    else if(ulPreDiv <= 4)
-    {
-        ulPreDiv = 1;
-    }
-    else if(ulPreDiv <= 8)
-    {
-        ulPreDiv = 2;
-    }
-    else if(ulPreDiv <= 16)
-    {
-        ulPreDiv = 3;
-    }
-    else if(ulPreDiv <= 32)
-    {
-        ulPreDiv = 4;
-    }
-    else if(ulPreDiv <= 64)
+    for(i = 0; i < 3; i++)
     {
-        ulPreDiv = 5;
-    }
-    else if(ulPreDiv <= 128)
-    {
-        ulPreDiv = 6;
-    }
-    else
-    {
-        ulPreDiv = 7;
+        if(g_ulSPIBase[i] == ulBase)
+        {
+            g_ulSPIBitRate[i] = ulBitRate;
+        }
     }
-    xHWREG(ulBase + SPI_CR1) &= ~SPI_CR1_BR_M;
-    xHWREG(ulBase + SPI_CR1) |= (ulPreDiv << SPI_CR1_BR_S);
+    SysCtlClockNotifyRegister(SPIClockNotify, 0);
 }
 
 //*****************************************************************************
@@ -534,6 +621,8 @@ SPIDataRead(unsigned long ulBase, void *pulRData, unsigned long ulLen)
     xASSERT((ulBase == SPI3_BASE) || (ulBase == SPI1_BASE)||
             (ulBase == SPI2_BASE));
 
+    xTRACE_API_BEGIN(xTRACE_ID_SPI_DATA_READ);
+
     for (i=0; i<ulLen; i++)
     {
         if ((xHWREG(ulBase + SPI_CR1) & SPI_CR1_DFF) != SPI_CR1_DFF)
@@ -547,6 +636,8 @@ SPIDataRead(unsigned long ulBase, void *pulRData, unsigned long ulLen)
             SPISingleDataReadWrite(ulBase, 0xFFFF);
         }   
     }
+
+    xTRACE_API_END(xTRACE_ID_SPI_DATA_READ);
 }
 
 //*****************************************************************************
@@ -581,6 +672,8 @@ SPIDataWrite(unsigned long ulBase, void *pulWData, unsigned long ulLen)
     xASSERT((ulBase == SPI3_BASE) || (ulBase == SPI1_BASE)||
             (ulBase == SPI2_BASE));
 
+    xTRACE_API_BEGIN(xTRACE_ID_SPI_DATA_WRITE);
+
     for (i=0; i<ulLen; i++)
     {
         if ((xHWREG(ulBase + SPI_CR1) & SPI_CR1_DFF) != SPI_CR1_DFF)
@@ -592,6 +685,8 @@ SPIDataWrite(unsigned long ulBase, void *pulWData, unsigned long ulLen)
             SPISingleDataReadWrite(ulBase, ((unsigned short*)pulWData)[i]);
         }   
     }
+
+    xTRACE_API_END(xTRACE_ID_SPI_DATA_WRITE);
 }
 
 //*****************************************************************************
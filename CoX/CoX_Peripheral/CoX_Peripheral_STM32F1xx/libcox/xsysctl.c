@@ -158,6 +158,32 @@ tPeripheralTable;
 //*****************************************************************************
 static xtEventCallback g_pfnRCCHandlerCallbacks[1]={0};
 
+//*****************************************************************************
+//
+// A clock change callback and its data
+//
+//*****************************************************************************
+typedef struct
+{
+    xtEventCallback pfnCallback;
+    void *pvCBData;
+}
+tClockNotify;
+
+//*****************************************************************************
+//
+// An array of the drivers that get the events of SysCtlClockSet()
+//
+//*****************************************************************************
+static tClockNotify g_psClockNotify[SYSCTL_CLOCK_NOTIFY_NUM];
+
+//*****************************************************************************
+//
+// The HCLK that SysCtlDelayUs() counts with, 0 until it is first read
+//
+//*****************************************************************************
+static unsigned long g_ulDelayHClk = 0;
+
 //*****************************************************************************
 //
 // An array that maps the peripheral base and peripheral ID and interrupt number
@@ -291,6 +317,39 @@ SysCtlDelay(unsigned long ulCount)
 }
 #endif
 
+//*****************************************************************************
+//
+//! \brief Provides a delay in microseconds.
+//!
+//! \param ulUs is the delay in microseconds.
+//!
+//! This function turns \e ulUs into SysCtlDelay() loops for the HCLK set by
+//! the last SysCtlClockSet(), so the delay keeps its length when the system
+//! clock changes. Flash wait states make the delay longer than asked.
+//!
+//! \return None.
+//
+//*****************************************************************************
+void
+SysCtlDelayUs(unsigned long ulUs)
+{
+    unsigned long ulLoops;
+
+    if(g_ulDelayHClk == 0)
+    {
+        g_ulDelayHClk = SysCtlHClockGet();
+    }
+
+    //
+    // The loop takes 3 cycles.
+    //
+    ulLoops = (g_ulDelayHClk / 1000000) * ulUs / 3;
+    if(ulLoops != 0)
+    {
+        SysCtlDelay(ulLoops);
+    }
+}
+
 //*****************************************************************************
 //
 //! \internal
@@ -620,39 +679,17 @@ xSysCtlPeripheralIntNumGet(unsigned long ulPeripheralBase)
 
 //*****************************************************************************
 //
-//! \brief Sets the clock of the device.
+//! \internal
+//! \brief Switches the clock of the device, the body of SysCtlClockSet().
 //!
+//! \param ulSysClk is the requested HCLK in Hz.
 //! \param ulConfig is the required configuration of the device clock.
 //!
-//! This function configures the clock of the device.  The input crystal
-//! frequency, oscillator to be used, use of the PLL, and the system clock
-//! divider are all configured with this function.
-//!
-//! The \e ulConfig parameter is the logical OR of several different values,
-//! many of which are grouped into sets where only one can be chosen.
-//!
-//! The external crystal frequency is chosen with one of the following values:
-//! \ref SYSCTL_XTAL_4MHZ, \ref SYSCTL_XTAL_5MHZ, \ref SYSCTL_XTAL_6MHZ,
-//! \ref SYSCTL_XTAL_16MHZ.
-//!
-//! The oscillator source is chosen with one of the following values:
-//! \ref SYSCTL_OSC_MAIN, \ref SYSCTL_OSC_INT.
-//!
-//! The internal and main oscillators and PLL are disabled with the
-//! \ref SYSCTL_INT_OSC_DIS and \ref SYSCTL_MAIN_OSC_DIS flags, 
-//! \ref SYSCTL_PLL_PWRDN respectively.
-//! The external oscillator must be enabled in order to use an external clock
-//! source.  Note that attempts to disable the oscillator used to clock the
-//! device will be prevented by the hardware.
-//! <br />
-//! Details please refer to \ref XSysCtl_Clock_Set_Config_CoX.
-//! 
-//!
 //! \return None.
 //
 //*****************************************************************************
-void
-SysCtlClockSet(unsigned long ulSysClk, unsigned long ulConfig)
+static void
+SysCtlClockSwitch(unsigned long ulSysClk, unsigned long ulConfig)
 {
     volatile unsigned long ulStartUpCounter = 0;
     xtBoolean xtStatus;
@@ -932,6 +969,153 @@ SysCtlClockSet(unsigned long ulSysClk, unsigned long ulConfig)
     }
 }
 
+//*****************************************************************************
+//
+//! \internal
+//! \brief Sends a clock change event to the registered drivers.
+//!
+//! \param ulEvent is \b SYSCTL_CLOCK_PRE_CHANGE or \b SYSCTL_CLOCK_POST_CHANGE.
+//! \param ulHClk is the HCLK in Hz.
+//!
+//! \return None.
+//
+//*****************************************************************************
+static void
+SysCtlClockNotify(unsigned long ulEvent, unsigned long ulHClk)
+{
+    unsigned long i;
+
+    for(i = 0; i < SYSCTL_CLOCK_NOTIFY_NUM; i++)
+    {
+        if(g_psClockNotify[i].pfnCallback != 0)
+        {
+            g_psClockNotify[i].pfnCallback(g_psClockNotify[i].pvCBData,
+                                           ulEvent, ulHClk, 0);
+        }
+    }
+}
+
+//*****************************************************************************
+//
+//! \brief Sets the clock of the device.
+//!
+//! \param ulConfig is the required configuration of the device clock.
+//!
+//! This function configures the clock of the device.  The input crystal
+//! frequency, oscillator to be used, use of the PLL, and the system clock
+//! divider are all configured with this function.
+//!
+//! The \e ulConfig parameter is the logical OR of several different values,
+//! many of which are grouped into sets where only one can be chosen.
+//!
+//! The external crystal frequency is chosen with one of the following values:
+//! \ref SYSCTL_XTAL_4MHZ, \ref SYSCTL_XTAL_5MHZ, \ref SYSCTL_XTAL_6MHZ,
+//! \ref SYSCTL_XTAL_16MHZ.
+//!
+//! The oscillator source is chosen with one of the following values:
+//! \ref SYSCTL_OSC_MAIN, \ref SYSCTL_OSC_INT.
+//!
+//! The internal and main oscillators and PLL are disabled with the
+//! \ref SYSCTL_INT_OSC_DIS and \ref SYSCTL_MAIN_OSC_DIS flags, 
+//! \ref SYSCTL_PLL_PWRDN respectively.
+//! The external oscillator must be enabled in order to use an external clock
+//! source.  Note that attempts to disable the oscillator used to clock the
+//! device will be prevented by the hardware.
+//! <br />
+//! Details please refer to \ref XSysCtl_Clock_Set_Config_CoX.
+//!
+//! The drivers registered with SysCtlClockNotifyRegister() get
+//! \b SYSCTL_CLOCK_PRE_CHANGE before the switch and
+//! \b SYSCTL_CLOCK_POST_CHANGE after it, so the UART baud rates, SPI bit rates,
+//! I2C timings and timer ticks survive a change of the system clock.
+//!
+//! \return None.
+//
+//*****************************************************************************
+void
+SysCtlClockSet(unsigned long ulSysClk, unsigned long ulConfig)
+{
+    SysCtlClockNotify(SYSCTL_CLOCK_PRE_CHANGE, SysCtlHClockGet());
+
+    SysCtlClockSwitch(ulSysClk, ulConfig);
+
+    g_ulDelayHClk = SysCtlHClockGet();
+    SysCtlClockNotify(SYSCTL_CLOCK_POST_CHANGE, g_ulDelayHClk);
+}
+
+//*****************************************************************************
+//
+//! \brief Registers a driver for the clock change events.
+//!
+//! \param pfnCallback is the callback that gets the events.
+//! \param pvCBData is the first argument of the callback.
+//!
+//! The callback is called by SysCtlClockSet() with \b SYSCTL_CLOCK_PRE_CHANGE
+//! and the old HCLK before the switch, then with \b SYSCTL_CLOCK_POST_CHANGE
+//! and the new HCLK after it. Registering the same callback again only
+//! updates \e pvCBData.
+//!
+//! \return \b xtrue if the callback is registered, \b xfalse if all the
+//! SYSCTL_CLOCK_NOTIFY_NUM slots are in use.
+//
+//*****************************************************************************
+xtBoolean
+SysCtlClockNotifyRegister(xtEventCallback pfnCallback, void *pvCBData)
+{
+    unsigned long i, ulFree = SYSCTL_CLOCK_NOTIFY_NUM;
+
+    //
+    // Check the arguments.
+    //
+    xASSERT(pfnCallback != 0);
+
+    for(i = 0; i < SYSCTL_CLOCK_NOTIFY_NUM; i++)
+    {
+        if(g_psClockNotify[i].pfnCallback == pfnCallback)
+        {
+            g_psClockNotify[i].pvCBData = pvCBData;
+            return xtrue;
+        }
+        if((g_psClockNotify[i].pfnCallback == 0) &&
+           (ulFree == SYSCTL_CLOCK_NOTIFY_NUM))
+        {
+            ulFree = i;
+        }
+    }
+
+    if(ulFree == SYSCTL_CLOCK_NOTIFY_NUM)
+    {
+        return xfalse;
+    }
+
+    g_psClockNotify[ulFree].pvCBData = pvCBData;
+    g_psClockNotify[ulFree].pfnCallback = pfnCallback;
+    return xtrue;
+}
+
+//*****************************************************************************
+//
+//! \brief Unregisters a driver from the clock change events.
+//!
+//! \param pfnCallback is the callback given to SysCtlClockNotifyRegister().
+//!
+//! \return None.
+//
+//*****************************************************************************
+void
+SysCtlClockNotifyUnregister(xtEventCallback pfnCallback)
+{
+    unsigned long i;
+
+    for(i = 0; i < SYSCTL_CLOCK_NOTIFY_NUM; i++)
+    {
+        if(g_psClockNotify[i].pfnCallback == pfnCallback)
+        {
+            g_psClockNotify[i].pfnCallback = 0;
+        }
+    }
+}
+
 //*****************************************************************************
 //
 //! \brief Enable the system control interrupts.
@@ -1599,6 +1599,32 @@ extern unsigned long xSysCtlPeripheralIntNumGet(unsigned long ulPeripheralBase);
 #define SYSCTL_STOP_WFE         0x00000000
 
 
+//*****************************************************************************
+//
+//! @}
+//
+//*****************************************************************************
+
+//*****************************************************************************
+//
+//! \addtogroup STM32F1xx_SysCtl_Clock_Event STM32F1xx SysCtl Clock Event
+//! \brief Events that SysCtlClockSet() sends to the callbacks registered with
+//! SysCtlClockNotifyRegister(). The \e ulMsgParam of the callback is the
+//! HCLK in Hz, the old one before the change and the new one after it.
+//! @{
+//
+//*****************************************************************************
+
+//
+//! The system clock is about to change, finish the transfers in progress.
+//
+#define SYSCTL_CLOCK_PRE_CHANGE 0x00000001
+
+//
+//! The system clock has changed, recompute the clock dividers.
+//
+#define SYSCTL_CLOCK_POST_CHANGE 0x00000002
+
 //*****************************************************************************
 //
 //! @}
@@ -1890,6 +1916,7 @@ extern unsigned long xSysCtlPeripheralIntNumGet(unsigned long ulPeripheralBase);
         ulDivide);
         
 extern void SysCtlDelay(unsigned long ulCount);
+extern void SysCtlDelayUs(unsigned long ulUs);
 
 extern void SysCtlPeripheralReset(unsigned long ulPeripheral);
 extern void SysCtlPeripheralEnable(unsigned long ulPeripheral);
@@ -1901,6 +1928,9 @@ extern void SysCtlPeripheralClockSourceSet(unsigned long ulPeripheralSrc,
 extern unsigned long SysCtlHClockGet(void);
 extern unsigned long SysCtlAPB1ClockGet(void);
 extern unsigned long SysCtlAPB2ClockGet(void);
+extern xtBoolean SysCtlClockNotifyRegister(xtEventCallback pfnCallback,
+                                           void *pvCBData);
+extern void SysCtlClockNotifyUnregister(xtEventCallback pfnCallback);
 extern void SysCtlLSIConfig(unsigned long ulLSIConfig);
 extern void SysCtlLSEConfig(unsigned long ulLSEConfig);
 
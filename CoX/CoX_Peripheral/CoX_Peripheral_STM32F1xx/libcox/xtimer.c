@@ -50,72 +50,187 @@
 
 //*****************************************************************************
 //
-// An array is Timer Callback function point
+// The timer bases, bit n of g_ulTimerRetime is the timer g_ulTimerBase[n]
 //
 //*****************************************************************************
-static xtEventCallback g_pfnTimerHandlerCallbacks[22]={0};
+static const unsigned long g_ulTimerBase[14] =
+{
+    TIM1_BASE,  TIM2_BASE,  TIM3_BASE,  TIM4_BASE,  TIM5_BASE,
+    TIM6_BASE,  TIM7_BASE,  TIM8_BASE,  TIM9_BASE,  TIM10_BASE,
+    TIM11_BASE, TIM12_BASE, TIM13_BASE, TIM14_BASE
+};
+
+//*****************************************************************************
+//
+// The timers set up by xTimerInitConfig(), their prescalers follow the clock
+//
+//*****************************************************************************
+static unsigned long g_ulTimerRetime = 0;
+
+//*****************************************************************************
+//
+// The APB1 and APB2 timer clocks before a system clock change
+//
+//*****************************************************************************
+static unsigned long g_ulTimerOldClk[2];
 
-#if (TIM1_FUNCTION_SELECT == TIM_TIMER || TIM9_FUNCTION_SELECT == TIM_TIMER)
 //*****************************************************************************
 //
-//! \brief TIM1 Break and IIM9 global interrupt serivice function.
+// The users of each timer, in the order of g_ulTimerBase. Slot n is the
+// interrupt source of SR bit n (TIMER_INT_UEV ... TIMER_INT_BRK).
+//
+//*****************************************************************************
+typedef struct
+{
+    //
+    // The owner of each source, TIMER_OWNER_NONE if it is free
+    //
+    unsigned char ucOwner[8];
+
+    //
+    // The callback of each source, 0 to use pfnDefault
+    //
+    xtEventCallback pfnCallback[8];
+
+    //
+    // The data passed to each callback
+    //
+    void *pvCBData[8];
+
+    //
+    // The callback of xTimerIntCallbackInit(), gets the other sources
+    //
+    xtEventCallback pfnDefault;
+}
+tTimerRes;
+
+static tTimerRes g_psTimerRes[14];
+
+//*****************************************************************************
+//
+//! \internal
+//! \brief Gets the index of a timer in g_ulTimerBase.
 //!
-//! \param None.
+//! \param ulBase is the base address of the Timer port.
+//!
+//! \return The index of the timer.
+//
+//*****************************************************************************
+static unsigned long
+TimerIndexGet(unsigned long ulBase)
+{
+    unsigned long i;
+
+    for(i = 0; i < 13; i++)
+    {
+        if(g_ulTimerBase[i] == ulBase)
+        {
+            break;
+        }
+    }
+    xASSERT(g_ulTimerBase[i] == ulBase);
+
+    return i;
+}
+
+//*****************************************************************************
+//
+//! \internal
+//! \brief Dispatches the pending interrupts of a timer.
 //!
-//! This function is to give a default Timer IRQ service.
+//! \param ulIndex is the index of the timer in g_ulTimerBase.
+//! \param ulSources is the sources on the interrupt vector, the logical OR
+//! of \b TIMER_INT_UEV ... \b TIMER_INT_BRK.
 //!
-//! \note None
+//! The pending flags are cleared before the callbacks run, so an event that
+//! comes again in a callback is kept. Each source with a callback gets its
+//! own call, with the flag as the event and the CCRx value of a channel as
+//! the parameter. The other pending sources go to the xTimerIntCallbackInit()
+//! callback in one call, with the TIMER_SR value read on entry as the
+//! parameter.
 //!
 //! \return None.
 //
 //*****************************************************************************
-void 
-TIM1BRKTIM9IntHandler(void)
+static void
+TimerResDispatch(unsigned long ulIndex, unsigned long ulSources)
 {
-    unsigned long ulTemp = 0, ulTemp1 = 0;
+    tTimerRes *psRes = &g_psTimerRes[ulIndex];
+    unsigned long ulBase = g_ulTimerBase[ulIndex];
+    unsigned long ulSR, ulStatus, ulFlag, i;
+
+    ulSR = xHWREG(ulBase + TIMER_SR);
+    ulStatus = ulSR & xHWREG(ulBase + TIMER_DIER) & ulSources;
+    if(ulStatus == 0)
+    {
+        return;
+    }
 
     //
-    // The SR register read cleared
+    // The flags are cleared by writing 0, the ones written 1 are kept
     //
-    ulTemp = xHWREG(RCC_APB2ENR) & RCC_APB2ENR_TIM1EN;
+    xHWREG(ulBase + TIMER_SR) = ~ulStatus;
 
-    if(ulTemp != 0)
+    for(i = 0, ulFlag = TIMER_INT_UEV; ulFlag <= TIMER_INT_BRK;
+        i++, ulFlag <<= 1)
     {
-        ulTemp = xHWREG(TIM1_BASE + TIMER_SR);
-    }
+        if(!(ulStatus & ulFlag) || (psRes->pfnCallback[i] == 0))
+        {
+            continue;
+        }
+        ulStatus &= ~ulFlag;
 
-#if (STM32F1xx_DEVICE == STM32F10X_XL)
-    ulTemp1 = xHWREG(RCC_APB2ENR) & RCC_APB2ENR_TIM9EN;
-    
-    if(ulTemp1 != 0)
-    {
-        ulTemp1 = xHWREG(TIM9_BASE + TIMER_SR);
+        if(ulFlag & (TIMER_INT_CH1CC | TIMER_INT_CH2CC |
+                     TIMER_INT_CH3CC | TIMER_INT_CH4CC))
+        {
+            psRes->pfnCallback[i](psRes->pvCBData[i], ulFlag,
+                                  xHWREG(ulBase + TIMER_CCR1 + (i - 1) * 4),
+                                  0);
+        }
+        else
+        {
+            psRes->pfnCallback[i](psRes->pvCBData[i], ulFlag, 0, 0);
+        }
     }
-#endif
 
-    if((ulTemp & TIMER_SR_BIF) != 0)
-    {
-        g_pfnTimerHandlerCallbacks[0](0, 0, ulTemp, 0);
-    }
-    else
+    //
+    // ulStatus now holds the pending sources with no owner callback
+    //
+    if((ulStatus != 0) && (psRes->pfnDefault != 0))
     {
-        g_pfnTimerHandlerCallbacks[16](0, 0, ulTemp1, 0);
+        psRes->pfnDefault(0, 0, ulSR, 0);
     }
-    
 }
-#endif
 
+//*****************************************************************************
+//
+//! \brief TIM1 Break and TIM9 global interrupt service function.
+//!
+//! \param None.
+//!
+//! The vector is shared by the break source of TIM1 and all the sources of
+//! TIM9, each goes to its own user.
+//!
+//! \return None.
+//
+//*****************************************************************************
+void 
+TIM1BRKTIM9IntHandler(void)
+{
+    TimerResDispatch(0, TIMER_INT_BRK);
+#if (STM32F1xx_DEVICE == STM32F10X_XL)
+    TimerResDispatch(8, 0xFF);
+#endif
+}
 
-#if (TIM1_FUNCTION_SELECT == TIM_TIMER || TIM10_FUNCTION_SELECT == TIM_TIMER)
 //*****************************************************************************
 //
 //! \brief TIM1 Update and TIM10 global interrupt service function.
 //!
 //! \param None.
 //!
-//! This function is to give a default Timer IRQ service.
-//!
-//! \note None
+//! The vector is shared by the update source of TIM1 and all the sources of
+//! TIM10, each goes to its own user.
 //!
 //! \return None.
 //
@@ -123,36 +238,12 @@ TIM1BRKTIM9IntHandler(void)
 void 
 TIM1UPTIM10IntHandler(void)
 {
-    unsigned long ulTemp = 0, ulTemp1 = 0;
-
-    ulTemp = xHWREG(RCC_APB2ENR) & RCC_APB2ENR_TIM1EN;
-
-    if(ulTemp != 0)
-    {
-        ulTemp = xHWREG(TIM1_BASE + TIMER_SR);
-    }
-
+    TimerResDispatch(0, TIMER_INT_UEV);
 #if (STM32F1xx_DEVICE == STM32F10X_XL)
-    ulTemp1 = xHWREG(RCC_APB2ENR) & RCC_APB2ENR_TIM10EN;
-    if(ulTemp1 != 0)
-    {
-        ulTemp1 = xHWREG(TIM10_BASE + TIMER_SR);
-    }
+    TimerResDispatch(9, 0xFF);
 #endif
-
-    if((ulTemp & TIMER_SR_UIF) != 0)
-    {
-        g_pfnTimerHandlerCallbacks[1](0, 0, ulTemp, 0);
-    }
-    else
-    {
-        g_pfnTimerHandlerCallbacks[17](0, 0, ulTemp1, 0);
-    }    
 }
-#endif
 
-
-#if (TIM1_FUNCTION_SELECT == TIM_TIMER || TIM11_FUNCTION_SELECT == TIM_TIMER)
 //*****************************************************************************
 //
 //! \brief TIM1 Trigger and Commutation and TIM11 global interrupt service 
@@ -160,9 +251,8 @@ TIM1UPTIM10IntHandler(void)
 //!
 //! \param None.
 //!
-//! This function is to give a default Timer IRQ service.
-//!
-//! \note None
+//! The vector is shared by the trigger and commutation sources of TIM1 and
+//! all the sources of TIM11, each goes to its own user.
 //!
 //! \return None.
 //
@@ -170,51 +260,19 @@ TIM1UPTIM10IntHandler(void)
 void 
 TIM1TRGCOMTIM11IntHandler(void)
 {
-    unsigned long ulTemp = 0, ulTemp1 = 0;
-
-    //
-    // The SR register read cleared
-    //
-    ulTemp = xHWREG(RCC_APB2ENR) & RCC_APB2ENR_TIM1EN;
-
-    if(ulTemp != 0)
-    {
-        ulTemp = xHWREG(TIM1_BASE + TIMER_SR);
-    }
-
+    TimerResDispatch(0, TIMER_INT_TEV | TIMER_INT_COM);
 #if (STM32F1xx_DEVICE == STM32F10X_XL)
-    ulTemp1 = xHWREG(RCC_APB2ENR) & RCC_APB2ENR_TIM11EN;
-    if(ulTemp1 != 0)
-    {
-        ulTemp = xHWREG(TIM11_BASE + TIMER_SR);
-    }
+    TimerResDispatch(10, 0xFF);
 #endif
-
-    if((ulTemp & TIMER_SR_TIF) != 0)
-    {
-        g_pfnTimerHandlerCallbacks[2](0, 0, ulTemp, 0);
-    }
-    else if((ulTemp & TIMER_SR_COMIF) != 0)
-    {
-        g_pfnTimerHandlerCallbacks[3](0, 0, ulTemp, 0);
-    }
-    else
-    {
-        g_pfnTimerHandlerCallbacks[18](0, 0, ulTemp1, 0);
-    }    
 }
-#endif
 
-#if (TIM1_FUNCTION_SELECT == TIM_TIMER)
 //*****************************************************************************
 //
 //! \brief TIM1 Capture Compare interrupt service function.
 //!
 //! \param None.
 //!
-//! This function is to give a default Timer IRQ service.
-//!
-//! \note None
+//! Each of the 4 channels goes to its own user.
 //!
 //! \return None.
 //
@@ -222,29 +280,17 @@ TIM1TRGCOMTIM11IntHandler(void)
 void 
 TIM1CCIntHandler(void)
 {
-    unsigned long ulTemp = 0;
-
-    //
-    // The SR register read cleared
-    //
-    ulTemp = xHWREG(TIM1_BASE + TIMER_SR);
-    xHWREG(TIM1_BASE + TIMER_SR) &= ~0x1E;
-
-    g_pfnTimerHandlerCallbacks[4](0, 0, ulTemp, 0);
-    
+    TimerResDispatch(0, TIMER_INT_CH1CC | TIMER_INT_CH2CC |
+                        TIMER_INT_CH3CC | TIMER_INT_CH4CC);
 }
-#endif
 
-#if (TIM2_FUNCTION_SELECT == TIM_TIMER)
 //*****************************************************************************
 //
 //! \brief TIM2 global interrupt service function.
 //!
 //! \param None.
 //!
-//! This function is to give a default Timer IRQ service.
-//!
-//! \note None
+//! The update event and each channel go to their own users.
 //!
 //! \return None.
 //
@@ -252,28 +298,16 @@ TIM1CCIntHandler(void)
 void 
 TIM2IntHandler(void)
 {
-    unsigned long ulTemp = 0;
-
-    //
-    // The SR register read cleared
-    //
-    ulTemp = xHWREG(TIM2_BASE + TIMER_SR);
-
-    g_pfnTimerHandlerCallbacks[5](0, 0, ulTemp, 0);
-    
+    TimerResDispatch(1, 0xFF);
 }
-#endif
 
-#if (TIM3_FUNCTION_SELECT == TIM_TIMER)
 //*****************************************************************************
 //
 //! \brief TIM3 global interrupt service function.
 //!
 //! \param None.
 //!
-//! This function is to give a default Timer IRQ service.
-//!
-//! \note None
+//! The update event and each channel go to their own users.
 //!
 //! \return None.
 //
@@ -281,28 +315,16 @@ TIM2IntHandler(void)
 void 
 TIM3IntHandler(void)
 {
-    unsigned long ulTemp = 0;
-
-    //
-    // The SR register read cleared
-    //
-    ulTemp = xHWREG(TIM3_BASE + TIMER_SR);
-
-    g_pfnTimerHandlerCallbacks[6](0, 0, ulTemp, 0);
-    
+    TimerResDispatch(2, 0xFF);
 }
-#endif
 
-#if (TIM4_FUNCTION_SELECT == TIM_TIMER)
 //*****************************************************************************
 //
 //! \brief TIM4 global interrupt service function.
 //!
 //! \param None.
 //!
-//! This function is to give a default Timer IRQ service.
-//!
-//! \note None
+//! The update event and each channel go to their own users.
 //!
 //! \return None.
 //
@@ -310,28 +332,16 @@ TIM3IntHandler(void)
 void 
 TIM4IntHandler(void)
 {
-    unsigned long ulTemp = 0;
-
-    //
-    // The SR register read cleared
-    //
-    ulTemp = xHWREG(TIM4_BASE + TIMER_SR);
-
-    g_pfnTimerHandlerCallbacks[7](0, 0, ulTemp, 0);
-    
+    TimerResDispatch(3, 0xFF);
 }
-#endif
 
-#if (TIM5_FUNCTION_SELECT == TIM_TIMER)
 //*****************************************************************************
 //
 //! \brief TIM5 global interrupt service function.
 //!
 //! \param None.
 //!
-//! This function is to give a default Timer IRQ service.
-//!
-//! \note None
+//! The update event and each channel go to their own users.
 //!
 //! \return None.
 //
@@ -339,17 +349,8 @@ TIM4IntHandler(void)
 void 
 TIM5IntHandler(void)
 {
-    unsigned long ulTemp = 0;
-
-    //
-    // The SR register read cleared
-    //
-    ulTemp = xHWREG(TIM5_BASE + TIMER_SR);
-
-    g_pfnTimerHandlerCallbacks[8](0, 0, ulTemp, 0);
-    
+    TimerResDispatch(4, 0xFF);
 }
-#endif
 
 #if (STM32F1xx_DEVICE == STM32F10X_XL || STM32F1xx_DEVICE == STM32F10X_HD_VL || \
      STM32F1xx_DEVICE == STM32F10X_CL)
@@ -360,9 +361,7 @@ TIM5IntHandler(void)
 //!
 //! \param None.
 //!
-//! This function is to give a default Timer IRQ service.
-//!
-//! \note None
+//! The update event goes to its user.
 //!
 //! \return None.
 //
@@ -370,15 +369,7 @@ TIM5IntHandler(void)
 void 
 TIM6IntHandler(void)
 {
-    unsigned long ulTemp = 0;
-
-    //
-    // The SR register read cleared
-    //
-    ulTemp = xHWREG(TIM6_BASE + TIMER_SR);
-
-    g_pfnTimerHandlerCallbacks[9](0, 0, ulTemp, 0);
-    
+    TimerResDispatch(5, TIMER_INT_UEV);
 }
 
 //*****************************************************************************
@@ -387,9 +378,7 @@ TIM6IntHandler(void)
 //!
 //! \param None.
 //!
-//! This function is to give a default Timer IRQ service.
-//!
-//! \note None
+//! The update event goes to its user.
 //!
 //! \return None.
 //
@@ -397,29 +386,19 @@ TIM6IntHandler(void)
 void 
 TIM7IntHandler(void)
 {
-    unsigned long ulTemp = 0;
-
-    //
-    // The SR register read cleared
-    //
-    ulTemp = xHWREG(TIM7_BASE + TIMER_SR);
-
-    g_pfnTimerHandlerCallbacks[10](0, 0, ulTemp, 0);
-    
+    TimerResDispatch(6, TIMER_INT_UEV);
 }
 #endif
 
 #if (STM32F1xx_DEVICE == STM32F10X_XL || STM32F1xx_DEVICE == STM32F10X_HD_VL)
-#if (TIM8_FUNCTION_SELECT == TIM_TIMER || TIM12_FUNCTION_SELECT == TIM_TIMER)
 //*****************************************************************************
 //
 //! \brief TIM8 Break and TIM12 global interrupt serivice function.
 //!
 //! \param None.
 //!
-//! This function is to give a default Timer IRQ service.
-//!
-//! \note None
+//! The vector is shared by the break source of TIM8 and all the sources of
+//! TIM12, each goes to its own user.
 //!
 //! \return None.
 //
@@ -427,51 +406,20 @@ TIM7IntHandler(void)
 void 
 TIM8BRKTIM12IntHandler(void)
 {
-    unsigned long ulTemp = 0, ulTemp1 = 0;
-
-    //
-    // The SR register read cleared
-    //
-#if((STM32F1xx_DEVICE == STM32F10X_HD_VL) || (STM32F1xx_DEVICE == STM32F10X_XL))
-    ulTemp = xHWREG(RCC_APB2ENR) & RCC_APB2ENR_TIM8EN;
-
-    if(ulTemp != 0)
-    {
-        ulTemp = xHWREG(TIM8_BASE + TIMER_SR);
-    }
-#endif
-
-#if(STM32F1xx_DEVICE == STM32F10X_XL)
-    ulTemp1 = xHWREG(RCC_APB1ENR) & RCC_APB1ENR_TIM12EN;
-
-    if(ulTemp1 != 0)
-    {
-        ulTemp1 = xHWREG(TIM12_BASE + TIMER_SR);
-    }
+    TimerResDispatch(7, TIMER_INT_BRK);
+#if (STM32F1xx_DEVICE == STM32F10X_XL)
+    TimerResDispatch(11, 0xFF);
 #endif
-
-    if(ulTemp & TIMER_SR_BIF != 0)
-    {
-        g_pfnTimerHandlerCallbacks[11](0, 0, ulTemp, 0);
-    }
-    else
-    {
-        g_pfnTimerHandlerCallbacks[19](0, 0, ulTemp1, 0);
-    }
-    
 }
-#endif
 
-#if (TIM8_FUNCTION_SELECT == TIM_TIMER || TIM13_FUNCTION_SELECT == TIM_TIMER)
 //*****************************************************************************
 //
 //! \brief TIM8 Update interrupt and TIM13 global interrupt service function.
 //!
 //! \param None.
 //!
-//! This function is to give a default Timer IRQ service.
-//!
-//! \note None
+//! The vector is shared by the update source of TIM8 and all the sources of
+//! TIM13, each goes to its own user.
 //!
 //! \return None.
 //
@@ -479,37 +427,12 @@ TIM8BRKTIM12IntHandler(void)
 void 
 TIM8UPTIM13IntHandler(void)
 {
-    unsigned long ulTemp = 0, ulTemp1 = 0;
-
-#if((STM32F1xx_DEVICE == STM32F10X_HD_VL) || (STM32F1xx_DEVICE == STM32F10X_XL))
-    ulTemp = xHWREG(RCC_APB2ENR) & RCC_APB2ENR_TIM8EN;
-
-    if(ulTemp != 0)
-    {
-        ulTemp = xHWREG(TIM8_BASE + TIMER_SR);
-    }
-#endif
-#if(STM32F1xx_DEVICE == STM32F10X_XL)
-    ulTemp1 = xHWREG(RCC_APB1ENR) & RCC_APB1ENR_TIM13EN;
-
-    if(ulTemp1 != 0)
-    {
-        ulTemp1 = xHWREG(TIM13_BASE + TIMER_SR);
-    }
+    TimerResDispatch(7, TIMER_INT_UEV);
+#if (STM32F1xx_DEVICE == STM32F10X_XL)
+    TimerResDispatch(12, 0xFF);
 #endif
-
-    if(ulTemp & TIMER_SR_UIF != 0)
-    {
-        g_pfnTimerHandlerCallbacks[12](0, 0, ulTemp, 0);
-    }
-    else
-    {
-        g_pfnTimerHandlerCallbacks[20](0, 0, ulTemp1, 0);
-    }    
 }
-#endif
 
-#if (TIM8_FUNCTION_SELECT == TIM_TIMER || TIM14_FUNCTION_SELECT == TIM_TIMER)
 //*****************************************************************************
 //
 //! \brief TIM8 Trigger and Commutation and TIM14 global interrupt service 
@@ -517,9 +440,8 @@ TIM8UPTIM13IntHandler(void)
 //!
 //! \param None.
 //!
-//! This function is to give a default Timer IRQ service.
-//!
-//! \note None
+//! The vector is shared by the trigger and commutation sources of TIM8 and
+//! all the sources of TIM14, each goes to its own user.
 //!
 //! \return None.
 //
@@ -527,71 +449,133 @@ TIM8UPTIM13IntHandler(void)
 void 
 TIM8TRGCOMTIM14IntHandler(void)
 {
-    unsigned long ulTemp = 0, ulTemp1 = 0;
-
-    //
-    // The SR register read cleared
-    //
-#if((STM32F1xx_DEVICE == STM32F10X_HD_VL) || (STM32F1xx_DEVICE == STM32F10X_XL))
-    ulTemp = xHWREG(RCC_APB2ENR) & RCC_APB2ENR_TIM8EN;
-
-    if(ulTemp != 0)
-    {
-        ulTemp = xHWREG(TIM8_BASE + TIMER_SR);
-    }
+    TimerResDispatch(7, TIMER_INT_TEV | TIMER_INT_COM);
+#if (STM32F1xx_DEVICE == STM32F10X_XL)
+    TimerResDispatch(13, 0xFF);
 #endif
-#if(STM32F1xx_DEVICE == STM32F10X_XL)
-    ulTemp1 = xHWREG(RCC_APB1ENR) & RCC_APB1ENR_TIM14EN;
+}
 
-    if(ulTemp1 != 0)
-    {
-        ulTemp1 = xHWREG(TIM14_BASE + TIMER_SR);
-    }
+//*****************************************************************************
+//
+//! \brief TIM8 Capture Compare interrupt service function.
+//!
+//! \param None.
+//!
+//! Each of the 4 channels goes to its own user.
+//!
+//! \return None.
+//
+//*****************************************************************************
+void 
+TIM8CCIntHandler(void)
+{
+    TimerResDispatch(7, TIMER_INT_CH1CC | TIMER_INT_CH2CC |
+                        TIMER_INT_CH3CC | TIMER_INT_CH4CC);
+}
 #endif
-    if(ulTemp & TIMER_SR_TIF != 0)
-    {
-        g_pfnTimerHandlerCallbacks[13](0, 0, ulTemp, 0);
-    }
-    else if(ulTemp & TIMER_SR_COMIF != 0)
+
+//*****************************************************************************
+//
+//! \internal
+//! \brief Gets the clock of the timers on APB1 or APB2.
+//!
+//! \param bAPB2 is \b xtrue for the APB2 timers.
+//!
+//! The timer clock is twice the APB clock when the APB clock is divided.
+//!
+//! \return The timer clock in Hz.
+//
+//*****************************************************************************
+static unsigned long
+TimerBusClockGet(xtBoolean bAPB2)
+{
+    unsigned long ulClk, ulDiv;
+
+    if(bAPB2)
     {
-        g_pfnTimerHandlerCallbacks[14](0, 0, ulTemp, 0);
+        ulClk = SysCtlAPB2ClockGet();
+        ulDiv = (xHWREG(RCC_CFGR) & RCC_CFGR_PPRE2_M) >> RCC_CFGR_PPRE2_S;
     }
     else
     {
-        g_pfnTimerHandlerCallbacks[21](0, 0, ulTemp1, 0);
-    }    
+        ulClk = SysCtlAPB1ClockGet();
+        ulDiv = (xHWREG(RCC_CFGR) & RCC_CFGR_PPRE1_M) >> RCC_CFGR_PPRE1_S;
+    }
+
+    return (ulDiv & 0x4) ? (ulClk * 2) : ulClk;
 }
-#endif
 
-#if (TIM8_FUNCTION_SELECT == TIM_TIMER)
 //*****************************************************************************
 //
-//! \brief TIM1 Capture Compare interrupt service function.
-//!
-//! \param None.
+//! \internal
+//! \brief Keeps the tick frequency of the timers over a system clock change.
 //!
-//! This function is to give a default Timer IRQ service.
+//! The prescaler of each timer set up by xTimerInitConfig() is scaled by the
+//! change of its timer clock, the auto-reload and compare values are kept.
+//! The new prescaler is loaded at the next update event. The timers counting
+//! external clocks or encoder inputs are left alone.
 //!
-//! \note None
-//!
-//! \return None.
+//! \return 0.
 //
 //*****************************************************************************
-void 
-TIM8CCIntHandler(void)
+static unsigned long
+TimerClockNotify(void *pvCBData, unsigned long ulEvent,
+                 unsigned long ulMsgParam, void *pvMsgData)
 {
-    unsigned long ulTemp = 0;
+    unsigned long i, ulBase, ulNewClk[2], ulSMS, ulBus;
+    unsigned long long ullPSC;
 
-    //
-    // The SR register read cleared
-    //
-    ulTemp = xHWREG(TIM8_BASE + TIMER_SR);
+    if(ulEvent == SYSCTL_CLOCK_PRE_CHANGE)
+    {
+        g_ulTimerOldClk[0] = TimerBusClockGet(xfalse);
+        g_ulTimerOldClk[1] = TimerBusClockGet(xtrue);
+        return 0;
+    }
 
-    g_pfnTimerHandlerCallbacks[15](0, 0, ulTemp, 0);
-    
+    ulNewClk[0] = TimerBusClockGet(xfalse);
+    ulNewClk[1] = TimerBusClockGet(xtrue);
+
+    for(i = 0; i < 14; i++)
+    {
+        ulBase = g_ulTimerBase[i];
+        if(!(g_ulTimerRetime & (1 << i)))
+        {
+            continue;
+        }
+
+        ulSMS = xHWREG(ulBase + TIMER_SMCR) & TIMER_SMCR_SMS_M;
+        if((xHWREG(ulBase + TIMER_SMCR) & TIMER_SMCR_ECE) ||
+           (ulSMS == TIMER_SMCR_SMS_EC1) || (ulSMS == TIMER_SMCR_SMS_EC2) ||
+           (ulSMS == TIMER_SMCR_SMS_EC3) || (ulSMS == TIMER_SMCR_SMS_EXC1))
+        {
+            continue;
+        }
+
+        ulBus = ((ulBase == TIM1_BASE) || (ulBase == TIM8_BASE) ||
+                 (ulBase == TIM9_BASE) || (ulBase == TIM10_BASE) ||
+                 (ulBase == TIM11_BASE)) ? 1 : 0;
+        if((g_ulTimerOldClk[ulBus] == 0) ||
+           (g_ulTimerOldClk[ulBus] == ulNewClk[ulBus]))
+        {
+            continue;
+        }
+
+        ullPSC = (unsigned long long)(xHWREG(ulBase + TIMER_PSC) + 1) *
+                 ulNewClk[ulBus];
+        ullPSC = (ullPSC + g_ulTimerOldClk[ulBus] / 2) / g_ulTimerOldClk[ulBus];
+        if(ullPSC == 0)
+        {
+            ullPSC = 1;
+        }
+        else if(ullPSC > 0x10000)
+        {
+            ullPSC = 0x10000;
+        }
+        xHWREG(ulBase + TIMER_PSC) = (unsigned long)ullPSC - 1;
+    }
+
+    return 0;
 }
-#endif
-#endif
 
 //*****************************************************************************
 //
@@ -621,6 +605,11 @@ TIM8CCIntHandler(void)
 //! The \e ulTickFreq parameter is the the timer tick frequency.It can be any
 //! values but ulTickFreq > 0 and ulTickFreq < timer clock source.
 //!
+//! The update event and the channel are claimed for the mode, see
+//! TimerResClaim(). Their interrupts go to the xTimerIntCallbackInit()
+//! callback. When a PWM or another user holds one of them the timer is not
+//! configured, check it with TimerResOwnerGet() in a release build.
+//!
 //! \note For HT32F125x, each timer only one channel.
 //!
 //! \return None.
@@ -634,6 +623,7 @@ xTimerInitConfig(unsigned long ulBase, unsigned long ulChannel,
     unsigned long ulPreScale;
     unsigned long ulTCMPRValue;
     unsigned long ulTemp;
+    unsigned long ulSources, ulOwner;
     
     //
     // Check the arguments.
@@ -643,6 +633,38 @@ xTimerInitConfig(unsigned long ulBase, unsigned long ulChannel,
             (ulChannel == xTIMER_CHANNEL2) ||
             (ulChannel == xTIMER_CHANNEL3));
 
+    //
+    // Take the update event and the channel for the mode, the ones taken
+    // before by this API are given back first. A channel used by PWM or an
+    // encoder is not set up.
+    //
+    ulSources = TIMER_INT_UEV | (TIMER_INT_CH1CC << (ulChannel - 1));
+    switch(ulConfig & 0x000000F0)
+    {
+        case xTIMER_MODE_ONESHOT:
+            ulOwner = TIMER_OWNER_ONEPULSE;
+            break;
+        case xTIMER_MODE_CAPTURE:
+            ulOwner = TIMER_OWNER_CAPTURE;
+            ulSources &= ~TIMER_INT_UEV;
+            break;
+        case xTIMER_MODE_CONTINUOUS:
+            ulOwner = TIMER_OWNER_TIMEBASE;
+            ulSources = TIMER_INT_UEV;
+            break;
+        default:
+            ulOwner = TIMER_OWNER_TIMEBASE;
+            break;
+    }
+    TimerResRelease(ulBase, ulSources, TIMER_OWNER_TIMEBASE);
+    TimerResRelease(ulBase, ulSources, TIMER_OWNER_ONEPULSE);
+    TimerResRelease(ulBase, ulSources, TIMER_OWNER_CAPTURE);
+    if(!TimerResClaim(ulBase, ulSources, ulOwner, 0, 0))
+    {
+        xASSERT(0);
+        return;
+    }
+
     //
     // Get the timer clock source frequency
     //
@@ -783,7 +805,12 @@ xTimerInitConfig(unsigned long ulBase, unsigned long ulChannel,
     TimerARRPreloadConfigure(ulBase, TIMER_ARPE_ENABLE);
     TimerAutoReloadSet(ulBase, ulTCMPRValue);
     TimerPrescalerConfigure(ulBase, ulPreScale, TIMER_PSC_RLD_UPDATE);
-    
+
+    //
+    // Keep the tick frequency for the clock changes.
+    //
+    g_ulTimerRetime |= (1 << TimerIndexGet(ulBase));
+    SysCtlClockNotifyRegister(TimerClockNotify, 0);
 }
 
 //*****************************************************************************
@@ -1079,7 +1106,13 @@ xTimerStatusGet(unsigned long ulBase, unsigned long ulChannel,
 //! \param ulBase is the base address of the Timer port.
 //! \param xtPortCallback is callback for the timer.
 //!
-//! Init interrupts callback for the timer.
+//! Init interrupts callback for the timer. The callback is called when a
+//! source that has no callback of its own, see TimerResClaim(), is pending.
+//! \e ulMsgParam is the TIMER_SR value read when the interrupt came.
+//!
+//! \note The pending flags are cleared before the callback is called, so
+//! TIMER_SR no longer shows them, use \e ulMsgParam. A callback that
+//! clears them itself still works.
 //!
 //! \return None.
 //
@@ -1087,56 +1120,21 @@ xTimerStatusGet(unsigned long ulBase, unsigned long ulChannel,
 void 
 xTimerIntCallbackInit(unsigned long ulBase, xtEventCallback xtTimerCallback)
 {
+    //
+    // Check the arguments.
+    //
+    xASSERT((ulBase == TIM1_BASE) || (ulBase == TIM2_BASE) || 
+            (ulBase == TIM3_BASE) || (ulBase == TIM4_BASE) || 
+            (ulBase == TIM6_BASE) || (ulBase == TIM7_BASE) || 
+            (ulBase == TIM5_BASE) || (ulBase == TIM8_BASE) || 
+            (ulBase == TIM9_BASE) || (ulBase == TIM10_BASE) || 
+            (ulBase == TIM11_BASE) || (ulBase == TIM12_BASE) || 
+            (ulBase == TIM13_BASE) || (ulBase == TIM14_BASE)); 
+
     //
     // Init the interrupts callback.
     //
-    switch(ulBase)
-    {
-        case TIM1_BASE:
-            g_pfnTimerHandlerCallbacks[1] = xtTimerCallback;
-            g_pfnTimerHandlerCallbacks[4] = xtTimerCallback;
-            break;
-        case TIM2_BASE:
-            g_pfnTimerHandlerCallbacks[5] = xtTimerCallback;
-            break;
-        case TIM3_BASE:
-            g_pfnTimerHandlerCallbacks[6] = xtTimerCallback;
-            break;
-        case TIM4_BASE:
-            g_pfnTimerHandlerCallbacks[7] = xtTimerCallback;
-            break;
-        case TIM5_BASE:
-            g_pfnTimerHandlerCallbacks[8] = xtTimerCallback;
-            break;
-        case TIM6_BASE:
-            g_pfnTimerHandlerCallbacks[9] = xtTimerCallback;
-            break;
-        case TIM7_BASE:
-            g_pfnTimerHandlerCallbacks[10] = xtTimerCallback;
-            break;
-        case TIM8_BASE:
-            g_pfnTimerHandlerCallbacks[12] = xtTimerCallback;
-            g_pfnTimerHandlerCallbacks[15] = xtTimerCallback;
-            break;
-        case TIM9_BASE:
-            g_pfnTimerHandlerCallbacks[16] = xtTimerCallback;
-            break;
-        case TIM10_BASE:
-            g_pfnTimerHandlerCallbacks[17] = xtTimerCallback;
-            break;
-        case TIM11_BASE:
-            g_pfnTimerHandlerCallbacks[18] = xtTimerCallback;
-            break;
-        case TIM12_BASE:
-            g_pfnTimerHandlerCallbacks[19] = xtTimerCallback;
-            break;
-        case TIM13_BASE:
-            g_pfnTimerHandlerCallbacks[20] = xtTimerCallback;
-            break;
-        case TIM14_BASE:
-            g_pfnTimerHandlerCallbacks[21] = xtTimerCallback;
-            break;
-    }
+    g_psTimerRes[TimerIndexGet(ulBase)].pfnDefault = xtTimerCallback;
 }
 
 //*****************************************************************************
@@ -5741,7 +5739,9 @@ TimerFlagStatusClear(unsigned long ulBase, unsigned long ulFlag)
 //!       - TIMER_INT_BRK is used only with TIM1, TIM8.
 //!       - TIMER_INT_COM is used only with TIM1, TIM8.
 //!
-//! Init interrupts callback for the timer.
+//! Init interrupts callback for the timer. It replaces the callback of the
+//! source whoever claimed it, a free source is claimed for
+//! \b TIMER_OWNER_TIMEBASE.
 //!
 //! \return None.
 //
@@ -5750,6 +5750,9 @@ void
 TimerIntCallbackInit(unsigned long ulBase, unsigned long ulIntType,
                      xtEventCallback xtTimerCallback)
 {
+    tTimerRes *psRes;
+    unsigned long i, ulPrimask;
+
     xASSERT((ulBase == TIM1_BASE) || (ulBase == TIM2_BASE) || 
             (ulBase == TIM3_BASE) || (ulBase == TIM4_BASE) || 
             (ulBase == TIM6_BASE) || (ulBase == TIM7_BASE) || 
@@ -5762,91 +5765,24 @@ TimerIntCallbackInit(unsigned long ulBase, unsigned long ulIntType,
             (ulIntType == TIMER_INT_UEV) || (ulIntType == TIMER_INT_TEV) ||
             (ulIntType == TIMER_INT_COM) || (ulIntType == TIMER_INT_BRK));
 
+    psRes = &g_psTimerRes[TimerIndexGet(ulBase)];
+    for(i = 0; (ulIntType >> i) != 1; i++)
+    {
+    }
+
     //
-    // Init the interrupts callback.
+    // Init the interrupts callback, a free source is taken as a time base.
     //
-    switch(ulBase)
+    ulPrimask = xCPUcpsid();
+    if(psRes->ucOwner[i] == TIMER_OWNER_NONE)
     {
-        case TIM1_BASE:
-            if(ulIntType == TIMER_INT_BRK)
-            {
-                g_pfnTimerHandlerCallbacks[0] = xtTimerCallback;
-            }
-            else if(ulIntType == TIMER_INT_UEV)
-            {
-                g_pfnTimerHandlerCallbacks[1] = xtTimerCallback;
-            }
-            else if(ulIntType == TIMER_INT_TEV)
-            {
-                g_pfnTimerHandlerCallbacks[2] = xtTimerCallback;
-            }
-            else if(ulIntType == TIMER_INT_COM)
-            {
-                g_pfnTimerHandlerCallbacks[3] = xtTimerCallback;
-            }
-            else
-            {
-                g_pfnTimerHandlerCallbacks[4] = xtTimerCallback;
-            }
-            break;
-        case TIM2_BASE:
-            g_pfnTimerHandlerCallbacks[5] = xtTimerCallback;
-            break;
-        case TIM3_BASE:
-            g_pfnTimerHandlerCallbacks[6] = xtTimerCallback;
-            break;
-        case TIM4_BASE:
-            g_pfnTimerHandlerCallbacks[7] = xtTimerCallback;
-            break;
-        case TIM5_BASE:
-            g_pfnTimerHandlerCallbacks[8] = xtTimerCallback;
-            break;
-        case TIM6_BASE:
-            g_pfnTimerHandlerCallbacks[9] = xtTimerCallback;
-            break;
-        case TIM7_BASE:
-            g_pfnTimerHandlerCallbacks[10] = xtTimerCallback;
-            break;
-        case TIM8_BASE:
-            if(ulIntType == TIMER_INT_BRK)
-            {
-                g_pfnTimerHandlerCallbacks[11] = xtTimerCallback;
-            }
-            else if(ulIntType == TIMER_INT_UEV)
-            {
-                g_pfnTimerHandlerCallbacks[12] = xtTimerCallback;
-            }
-            else if(ulIntType == TIMER_INT_TEV)
-            {
-                g_pfnTimerHandlerCallbacks[13] = xtTimerCallback;
-            }
-            else if(ulIntType == TIMER_INT_COM)
-            {
-                g_pfnTimerHandlerCallbacks[14] = xtTimerCallback;
-            }
-            else
-            {
-                g_pfnTimerHandlerCallbacks[15] = xtTimerCallback;
-            }
-            break;
-        case TIM9_BASE:
-            g_pfnTimerHandlerCallbacks[16] = xtTimerCallback;
-            break;
-        case TIM10_BASE:
-            g_pfnTimerHandlerCallbacks[17] = xtTimerCallback;
-            break;
-        case TIM11_BASE:
-            g_pfnTimerHandlerCallbacks[18] = xtTimerCallback;
-            break;
-        case TIM12_BASE:
-            g_pfnTimerHandlerCallbacks[19] = xtTimerCallback;
-            break;
-        case TIM13_BASE:
-            g_pfnTimerHandlerCallbacks[20] = xtTimerCallback;
-            break;
-        case TIM14_BASE:
-            g_pfnTimerHandlerCallbacks[21] = xtTimerCallback;
-            break;
+        psRes->ucOwner[i] = TIMER_OWNER_TIMEBASE;
+    }
+    psRes->pvCBData[i] = 0;
+    psRes->pfnCallback[i] = xtTimerCallback;
+    if(!ulPrimask)
+    {
+        xCPUcpsie();
     }
 }
 
@@ -6044,3 +5980,179 @@ TimerIntClear(unsigned long ulBase, unsigned long ulIntFlags)
     xHWREG(ulBase + TIMER_SR) &= ~ulIntFlags;
 
 }
+
+//*****************************************************************************
+//
+//! \brief Claims interrupt sources of a timer for a user.
+//!
+//! \param ulBase is the base address of the Timer port.
+//! \param ulSources is the sources to claim.
+//! \param ulOwner is the user of the sources.
+//! \param pfnCallback is the callback of the sources, or 0.
+//! \param pvCBData is the data passed to the callback.
+//!
+//! The users of a timer share its counter and interrupt vectors, each one
+//! claims the channels and events it uses. A time base, a PWM output and a
+//! capture input can run on one timer at once this way. The interrupt
+//! handler calls the callback of each pending source as
+//! pfnCallback(pvCBData, ulSource, ulValue, 0), where \e ulValue is the
+//! CCRx value for a channel and 0 for the other sources. The sources claimed
+//! with no callback go to the xTimerIntCallbackInit() callback.
+//!
+//! The \e ulSources parameter is the logical OR of any of the following:
+//! \b TIMER_INT_UEV, \b TIMER_INT_CH1CC, \b TIMER_INT_CH2CC,
+//! \b TIMER_INT_CH3CC, \b TIMER_INT_CH4CC, \b TIMER_INT_COM,
+//! \b TIMER_INT_TEV, \b TIMER_INT_BRK.
+//!
+//! The \e ulOwner parameter can be one of the following values:
+//! \b TIMER_OWNER_TIMEBASE, \b TIMER_OWNER_CAPTURE, \b TIMER_OWNER_PWM,
+//! \b TIMER_OWNER_ENCODER, \b TIMER_OWNER_ONEPULSE.
+//!
+//! \note A source the owner already has is claimed again with the new
+//! callback. Nothing is claimed if one of the sources has another owner.
+//!
+//! \return \b xtrue if the sources are claimed, \b xfalse if one of them
+//! is used by another owner.
+//
+//*****************************************************************************
+xtBoolean
+TimerResClaim(unsigned long ulBase, unsigned long ulSources,
+              unsigned long ulOwner, xtEventCallback pfnCallback,
+              void *pvCBData)
+{
+    tTimerRes *psRes;
+    unsigned long i, ulPrimask;
+
+    //
+    // Check the arguments.
+    //
+    xASSERT((ulBase == TIM1_BASE) || (ulBase == TIM2_BASE) || 
+            (ulBase == TIM3_BASE) || (ulBase == TIM4_BASE) || 
+            (ulBase == TIM6_BASE) || (ulBase == TIM7_BASE) || 
+            (ulBase == TIM5_BASE) || (ulBase == TIM8_BASE) || 
+            (ulBase == TIM9_BASE) || (ulBase == TIM10_BASE) || 
+            (ulBase == TIM11_BASE) || (ulBase == TIM12_BASE) || 
+            (ulBase == TIM13_BASE) || (ulBase == TIM14_BASE)); 
+    xASSERT((ulSources != 0) && ((ulSources & ~0xFF) == 0));
+    xASSERT((ulOwner >= TIMER_OWNER_TIMEBASE) &&
+            (ulOwner <= TIMER_OWNER_ONEPULSE));
+
+    psRes = &g_psTimerRes[TimerIndexGet(ulBase)];
+
+    ulPrimask = xCPUcpsid();
+    for(i = 0; i < 8; i++)
+    {
+        if((ulSources & (1 << i)) &&
+           (psRes->ucOwner[i] != TIMER_OWNER_NONE) &&
+           (psRes->ucOwner[i] != ulOwner))
+        {
+            if(!ulPrimask)
+            {
+                xCPUcpsie();
+            }
+            return xfalse;
+        }
+    }
+
+    for(i = 0; i < 8; i++)
+    {
+        if(ulSources & (1 << i))
+        {
+            psRes->ucOwner[i] = (unsigned char)ulOwner;
+            psRes->pvCBData[i] = pvCBData;
+            psRes->pfnCallback[i] = pfnCallback;
+        }
+    }
+    if(!ulPrimask)
+    {
+        xCPUcpsie();
+    }
+
+    return xtrue;
+}
+
+//*****************************************************************************
+//
+//! \brief Gives back interrupt sources of a timer.
+//!
+//! \param ulBase is the base address of the Timer port.
+//! \param ulSources is the sources to give back.
+//! \param ulOwner is the user of the sources.
+//!
+//! Only the sources that \e ulOwner has are given back, the others are left
+//! alone. The interrupts of the sources are not disabled, the user disables
+//! them before.
+//!
+//! The \e ulSources and \e ulOwner parameters are the same as in
+//! TimerResClaim().
+//!
+//! \return None.
+//
+//*****************************************************************************
+void
+TimerResRelease(unsigned long ulBase, unsigned long ulSources,
+                unsigned long ulOwner)
+{
+    tTimerRes *psRes;
+    unsigned long i, ulPrimask;
+
+    //
+    // Check the arguments.
+    //
+    xASSERT((ulBase == TIM1_BASE) || (ulBase == TIM2_BASE) || 
+            (ulBase == TIM3_BASE) || (ulBase == TIM4_BASE) || 
+            (ulBase == TIM6_BASE) || (ulBase == TIM7_BASE) || 
+            (ulBase == TIM5_BASE) || (ulBase == TIM8_BASE) || 
+            (ulBase == TIM9_BASE) || (ulBase == TIM10_BASE) || 
+            (ulBase == TIM11_BASE) || (ulBase == TIM12_BASE) || 
+            (ulBase == TIM13_BASE) || (ulBase == TIM14_BASE)); 
+    xASSERT((ulOwner >= TIMER_OWNER_TIMEBASE) &&
+            (ulOwner <= TIMER_OWNER_ONEPULSE));
+
+    psRes = &g_psTimerRes[TimerIndexGet(ulBase)];
+
+    ulPrimask = xCPUcpsid();
+    for(i = 0; i < 8; i++)
+    {
+        if((ulSources & (1 << i)) && (psRes->ucOwner[i] == ulOwner))
+        {
+            psRes->pfnCallback[i] = 0;
+            psRes->pvCBData[i] = 0;
+            psRes->ucOwner[i] = TIMER_OWNER_NONE;
+        }
+    }
+    if(!ulPrimask)
+    {
+        xCPUcpsie();
+    }
+}
+
+//*****************************************************************************
+//
+//! \brief Gets the owner of an interrupt source of a timer.
+//!
+//! \param ulBase is the base address of the Timer port.
+//! \param ulSource is one of the sources of TimerResClaim().
+//!
+//! \return The owner, \b TIMER_OWNER_NONE if the source is free.
+//
+//*****************************************************************************
+unsigned long
+TimerResOwnerGet(unsigned long ulBase, unsigned long ulSource)
+{
+    unsigned long i;
+
+    //
+    // Check the arguments.
+    //
+    xASSERT((ulSource == TIMER_INT_CH1CC) || (ulSource == TIMER_INT_CH2CC) ||
+            (ulSource == TIMER_INT_CH3CC) || (ulSource == TIMER_INT_CH4CC) ||
+            (ulSource == TIMER_INT_UEV) || (ulSource == TIMER_INT_TEV) ||
+            (ulSource == TIMER_INT_COM) || (ulSource == TIMER_INT_BRK));
+
+    for(i = 0; (ulSource >> i) != 1; i++)
+    {
+    }
+
+    return g_psTimerRes[TimerIndexGet(ulBase)].ucOwner[i];
+}
@@ -2164,7 +2164,8 @@ extern void xTimerCaptureEdgeSelect(unsigned long ulBase, unsigned long ulChanne
 //*****************************************************************************
 //
 //! \addtogroup TIMER_Int_Definition Timer Int Definition.
-//! Values that can be passed to TimerIntEnable(), TimerIntDisable().
+//! Values that can be passed to TimerIntEnable(), TimerIntDisable(),
+//! TimerResClaim() and TimerResRelease().
 //! @{
 //
 //*****************************************************************************
@@ -2343,6 +2344,55 @@ extern void xTimerCaptureEdgeSelect(unsigned long ulBase, unsigned long ulChanne
 //
 //*****************************************************************************  
   
+//*****************************************************************************
+//
+//! \addtogroup TIMER_Resource_Owner Timer Resource Owner.
+//! Values that can be passed to TimerResClaim(), TimerResRelease() and
+//! returned by TimerResOwnerGet(). The timer interrupt handlers are in
+//! xtimer.c, the PWM driver and the other users of a timer claim its
+//! sources there. A source with no owner callback goes to the
+//! xTimerIntCallbackInit() callback. It gets the TIMER_SR value read on
+//! entry in \e ulMsgParam, the flags are already cleared in TIMER_SR.
+//! @{
+//
+//*****************************************************************************
+
+//
+//! The source is free
+//
+#define TIMER_OWNER_NONE        0
+
+//
+//! Time base, periodic or toggle mode of xTimerInitConfig()
+//
+#define TIMER_OWNER_TIMEBASE    1
+
+//
+//! Input capture
+//
+#define TIMER_OWNER_CAPTURE     2
+
+//
+//! PWM output of xpwm.c
+//
+#define TIMER_OWNER_PWM         3
+
+//
+//! Encoder interface
+//
+#define TIMER_OWNER_ENCODER     4
+
+//
+//! One pulse mode
+//
+#define TIMER_OWNER_ONEPULSE    5
+
+//*****************************************************************************
+//
+//! @}
+//
+//*****************************************************************************
+
 //*****************************************************************************
 //
 //! \addtogroup STM32F1xx_TIMER_Exported_APIs STM32F1xx TIMER API
@@ -2472,6 +2522,14 @@ extern void TimerIntDisable(unsigned long ulBase, unsigned long ulIntFlags);
 extern xtBoolean TimerIntStatus(unsigned long ulBase, unsigned long ulIntFlags);
 extern void TimerIntClear(unsigned long ulBase, unsigned long ulIntFlags);
 
+extern xtBoolean TimerResClaim(unsigned long ulBase, unsigned long ulSources,
+                               unsigned long ulOwner,
+                               xtEventCallback pfnCallback, void *pvCBData);
+extern void TimerResRelease(unsigned long ulBase, unsigned long ulSources,
+                            unsigned long ulOwner);
+extern unsigned long TimerResOwnerGet(unsigned long ulBase,
+                                      unsigned long ulSource);
+
 //*****************************************************************************
 //
 //! @}
@@ -0,0 +1,254 @@
+//*****************************************************************************
+//
+//! \file xtrace.c
+//! \brief Event trace recorder with DWT cycle timestamps.
+//! \version V2.2.1.0
+//! \date 10/19/2026
+//! \author CooCox
+//! \copy
+//!
+//! Copyright (c)  2013, CooCox
+//! All rights reserved.
+//! 
+//! Redistribution and use in source and binary forms, with or without 
+//! modification, are permitted provided that the following conditions 
+//! are met: 
+//! 
+//!     * Redistributions of source code must retain the above copyright 
+//! notice, this list of conditions and the following disclaimer. 
+//!     * Redistributions in binary form must reproduce the above copyright
+//! notice, this list of conditions and the following disclaimer in the
+//! documentation and/or other materials provided with the distribution. 
+//!     * Neither the name of the <ORGANIZATION> nor the names of its 
+//! contributors may be used to endorse or promote products derived 
+//! from this software without specific prior written permission. 
+//! 
+//! THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+//! AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE 
+//! IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+//! ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE 
+//! LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR 
+//! CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF 
+//! SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+//! INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN 
+//! CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) 
+//! ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF 
+//! THE POSSIBILITY OF SUCH DAMAGE.
+//
+//*****************************************************************************
+
+#include "xhw_types.h"
+#include "xhw_ints.h"
+#include "xhw_memmap.h"
+#include "xhw_config.h"
+#include "xhw_nvic.h"
+#include "xdebug.h"
+#include "xcore.h"
+#include "xtrace.h"
+
+#ifdef xTRACE
+
+#if defined(ewarm)
+#include <intrinsics.h>
+#endif
+
+//
+// Data watchpoint and trace unit registers.
+//
+#define DWT_CTRL                0xE0001000
+#define DWT_CYCCNT              0xE0001004
+
+//
+// Cycle counter enable bit of DWT_CTRL.
+//
+#define DWT_CTRL_CYCCNTENA      0x00000001
+
+//
+// Trace enable bit of NVIC_DBG_INT (DEMCR), DWT is off until it is set.
+//
+#define NVIC_DBG_INT_TRCENA     0x01000000
+
+//*****************************************************************************
+//
+// The trace RAM, keep it global so the debugger can find it by name.
+//
+//*****************************************************************************
+tTraceBuffer g_sxTrace;
+
+//*****************************************************************************
+//
+// Events are recorded while it is xtrue.
+//
+//*****************************************************************************
+static volatile xtBoolean g_bTraceRun = xfalse;
+
+//*****************************************************************************
+//
+// Take one slot of the ring, returns the event count before the take. The
+// store-exclusive fails when an interrupt claimed a slot in between, the
+// loop then reads the head again.
+//
+//*****************************************************************************
+#if defined(gcc) || defined(__GNUC__)
+static unsigned long __attribute__((naked))
+xTraceClaim(volatile unsigned long *pulHead)
+{
+    unsigned long ulRet;
+
+    __asm("1:  ldrex   r1, [r0]\n"
+          "    adds    r2, r1, #1\n"
+          "    strex   r3, r2, [r0]\n"
+          "    cmp     r3, #0\n"
+          "    bne     1b\n"
+          "    mov     r0, r1\n"
+          "    bx      lr\n"
+          : "=r" (ulRet));
+
+    //
+    // The return is handled in the inline assembly, but the compiler will
+    // still complain if there is not an explicit return here (despite the fact
+    // that this does not result in any code being produced because of the
+    // naked attribute).
+    //
+    return(ulRet);
+}
+#endif
+#if defined(ewarm)
+static unsigned long
+xTraceClaim(volatile unsigned long *pulHead)
+{
+    unsigned long ulRet;
+
+    do
+    {
+        ulRet = __LDREX((unsigned long *)pulHead);
+    }
+    while(__STREX(ulRet + 1, (unsigned long *)pulHead));
+
+    return(ulRet);
+}
+#endif
+#if defined(rvmdk) || defined(__ARMCC_VERSION)
+static unsigned long
+xTraceClaim(volatile unsigned long *pulHead)
+{
+    unsigned long ulRet;
+
+    do
+    {
+        ulRet = __ldrex(pulHead);
+    }
+    while(__strex(ulRet + 1, pulHead));
+
+    return(ulRet);
+}
+#endif
+
+//*****************************************************************************
+//
+//! \brief Start the event recorder.
+//!
+//! \param ulClock is the core clock in Hz.
+//!
+//! It turns on the DWT cycle counter, clears the ring and starts recording.
+//! Call it again after the core clock is changed.
+//!
+//! \return None.
+//
+//*****************************************************************************
+void
+xTraceInit(unsigned long ulClock)
+{
+    xASSERT(ulClock != 0);
+    xASSERT((TRACE_BUF_SIZE & (TRACE_BUF_SIZE - 1)) == 0);
+
+    xHWREG(NVIC_DBG_INT) |= NVIC_DBG_INT_TRCENA;
+    xHWREG(DWT_CYCCNT) = 0;
+    xHWREG(DWT_CTRL) |= DWT_CTRL_CYCCNTENA;
+
+    g_sxTrace.ulMagic = xTRACE_MAGIC;
+    g_sxTrace.ulClock = ulClock;
+    g_sxTrace.ulSize = TRACE_BUF_SIZE;
+    g_sxTrace.ulHead = 0;
+    g_bTraceRun = xtrue;
+}
+
+//*****************************************************************************
+//
+//! \brief Record one event.
+//!
+//! \param ulInfo is the event info word, see \ref xTRACE_INFO.
+//!
+//! It may be called from any context, usually through the xTRACE_XXX
+//! macros.
+//!
+//! \return None.
+//
+//*****************************************************************************
+void
+xTraceEvent(unsigned long ulInfo)
+{
+    unsigned long ulTime;
+    tTraceEvent *psEvent;
+
+    if(!g_bTraceRun)
+    {
+        return;
+    }
+
+    ulTime = xHWREG(DWT_CYCCNT);
+    psEvent = &g_sxTrace.psEvent[xTraceClaim(&g_sxTrace.ulHead) &
+                                 (TRACE_BUF_SIZE - 1)];
+    psEvent->ulTime = ulTime;
+    psEvent->ulInfo = ulInfo;
+}
+
+//*****************************************************************************
+//
+//! \brief Record the entry of the running interrupt handler.
+//!
+//! The event id is the active exception number, 16 + IRQ number for the
+//! peripheral interrupts.
+//!
+//! \return None.
+//
+//*****************************************************************************
+void
+xTraceISREnter(void)
+{
+    xTraceEvent(xTRACE_INFO(xTRACE_ISR_ENTER_EVENT,
+                            xHWREG(NVIC_INT_CTRL) & NVIC_INT_CTRL_VEC_ACT_M,
+                            0));
+}
+
+//*****************************************************************************
+//
+//! \brief Stop the event recorder and send out the trace image.
+//!
+//! \param pfnPut is the function that sends one byte, e.g. a wrapper of
+//! UARTCharPut().
+//!
+//! The image is the \ref tTraceBuffer header and the event slots, in memory
+//! order. Recording stays stopped until xTraceInit() is called again.
+//!
+//! \return None.
+//
+//*****************************************************************************
+void
+xTraceDump(void (*pfnPut)(unsigned char ucByte))
+{
+    unsigned char *pucData;
+    unsigned long ulCount;
+
+    xASSERT(pfnPut != 0);
+
+    g_bTraceRun = xfalse;
+
+    pucData = (unsigned char *)&g_sxTrace;
+    for(ulCount = 0; ulCount < sizeof(g_sxTrace); ulCount++)
+    {
+        pfnPut(pucData[ulCount]);
+    }
+}
+
+#endif // xTRACE
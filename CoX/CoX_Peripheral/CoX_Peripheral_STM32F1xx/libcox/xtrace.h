@@ -0,0 +1,324 @@
+//*****************************************************************************
+//
+//! \file xtrace.h
+//! \brief Macros and prototypes for the event trace recorder.
+//! \version V2.2.1.0
+//! \date 10/19/2026
+//! \author CooCox
+//! \copy
+//!
+//! Copyright (c)  2013, CooCox
+//! All rights reserved.
+//! 
+//! Redistribution and use in source and binary forms, with or without 
+//! modification, are permitted provided that the following conditions 
+//! are met: 
+//! 
+//!     * Redistributions of source code must retain the above copyright 
+//! notice, this list of conditions and the following disclaimer. 
+//!     * Redistributions in binary form must reproduce the above copyright
+//! notice, this list of conditions and the following disclaimer in the
+//! documentation and/or other materials provided with the distribution. 
+//!     * Neither the name of the <ORGANIZATION> nor the names of its 
+//! contributors may be used to endorse or promote products derived 
+//! from this software without specific prior written permission. 
+//! 
+//! THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+//! AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE 
+//! IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+//! ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE 
+//! LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR 
+//! CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF 
+//! SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+//! INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN 
+//! CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) 
+//! ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF 
+//! THE POSSIBILITY OF SUCH DAMAGE.
+//
+//*****************************************************************************
+
+#ifndef __xTRACE_H__
+#define __xTRACE_H__
+
+//*****************************************************************************
+//
+// If building with a C++ compiler, make all of the definitions in this header
+// have a C binding.
+//
+//*****************************************************************************
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+//*****************************************************************************
+//
+//! \addtogroup CoX_Peripheral_Lib
+//! @{
+//
+//*****************************************************************************
+
+//*****************************************************************************
+//
+//! \addtogroup xTrace xTrace
+//! \brief Records interrupt and driver events with cycle timestamps.
+//!
+//! Every event is one 8-byte record, the DWT cycle counter and an info word,
+//! stored in a RAM ring. A slot is claimed with LDREX/STREX, so interrupts
+//! of any priority may record without masking each other. When the ring is
+//! full the oldest records are overwritten.
+//!
+//! \section xTrace_How How to use the Trace Feature?
+//! -# Enable the trace feature by doing a \b xTRACE build.
+//! -# Call \ref xTRACE_INIT once after the system clock is set.
+//! -# Add \ref xTRACE_MARK or \ref xTRACE_API_BEGIN / \ref xTRACE_API_END
+//! where you want, the libcox interrupt handlers are already marked.
+//! -# Halt the target and save \b g_sxTrace with the debugger, or send it
+//! out with \ref xTRACE_DUMP.
+//! -# Decode the image on the PC with resource/tools/xtracedec.
+//! .
+//!
+//! Without the \b xTRACE build all of the macros are empty, the recorder
+//! takes no code, RAM or cycles.
+//!
+//! @{
+//
+//*****************************************************************************
+
+//*****************************************************************************
+//
+//! \addtogroup xTrace_Event_Type xTrace Event Type
+//! \brief The type field of an event info word.
+//! @{
+//
+//*****************************************************************************
+
+//
+//! An interrupt handler is entered, the id is the active exception number.
+//
+#define xTRACE_ISR_ENTER_EVENT  0
+
+//
+//! An interrupt handler returns.
+//
+#define xTRACE_ISR_EXIT_EVENT   1
+
+//
+//! A driver API is called.
+//
+#define xTRACE_API_BEGIN_EVENT  2
+
+//
+//! A driver API returns.
+//
+#define xTRACE_API_END_EVENT    3
+
+//
+//! A user marker with a 16-bit argument.
+//
+#define xTRACE_MARK_EVENT       4
+
+//*****************************************************************************
+//
+//! @}
+//
+//*****************************************************************************
+
+//*****************************************************************************
+//
+//! \addtogroup xTrace_API_ID xTrace API ID
+//! \brief The ids of the marked driver APIs, user ids start at
+//! \ref xTRACE_ID_USER.
+//! @{
+//
+//*****************************************************************************
+
+//
+//! UARTBufferWrite().
+//
+#define xTRACE_ID_UART_BUFFER_WRITE     0x001
+
+//
+//! SPIDataRead().
+//
+#define xTRACE_ID_SPI_DATA_READ         0x010
+
+//
+//! SPIDataWrite().
+//
+#define xTRACE_ID_SPI_DATA_WRITE        0x011
+
+//
+//! The first id free for the application (ids are 12 bits).
+//
+#define xTRACE_ID_USER                  0x800
+
+//*****************************************************************************
+//
+//! @}
+//
+//*****************************************************************************
+
+//*****************************************************************************
+//
+//! \addtogroup xTrace_Image xTrace Image
+//! \brief The layout of the trace RAM, which is also the dump format.
+//!
+//! All fields are little endian 32-bit words. \b ulHead counts every event
+//! ever recorded, the newest event is at (ulHead - 1) & (ulSize - 1).
+//! @{
+//
+//*****************************************************************************
+
+//
+//! Value of \b ulMagic, "XTRC".
+//
+#define xTRACE_MAGIC            0x43525458
+
+//
+//! Build an event info word.
+//
+#define xTRACE_INFO(type, id, arg)                                            \
+                                (((unsigned long)(type) << 28) |              \
+                                 (((unsigned long)(id) & 0xFFF) << 16) |      \
+                                 ((unsigned long)(arg) & 0xFFFF))
+
+typedef struct
+{
+    //
+    //! DWT cycle counter when the event happened.
+    //
+    unsigned long ulTime;
+
+    //
+    //! Type (bit 31:28), id (bit 27:16) and argument (bit 15:0).
+    //
+    unsigned long ulInfo;
+}
+tTraceEvent;
+
+typedef struct
+{
+    unsigned long ulMagic;
+
+    //
+    //! Core clock in Hz, the decoder turns cycles into time with it.
+    //
+    unsigned long ulClock;
+
+    //
+    //! Number of event slots.
+    //
+    unsigned long ulSize;
+
+    //
+    //! Number of events recorded since xTraceInit().
+    //
+    volatile unsigned long ulHead;
+
+    tTraceEvent psEvent[TRACE_BUF_SIZE];
+}
+tTraceBuffer;
+
+//*****************************************************************************
+//
+//! @}
+//
+//*****************************************************************************
+
+//*****************************************************************************
+//
+//! \addtogroup xTrace_Exported_APIs xTrace API
+//! \brief xTrace API Reference.
+//! @{
+//
+//*****************************************************************************
+
+#ifdef xTRACE
+
+extern tTraceBuffer g_sxTrace;
+
+extern void xTraceInit(unsigned long ulClock);
+extern void xTraceEvent(unsigned long ulInfo);
+extern void xTraceISREnter(void);
+extern void xTraceDump(void (*pfnPut)(unsigned char ucByte));
+
+//
+//! Start recording, \e ulClock is the core clock in Hz.
+//
+#define xTRACE_INIT(ulClock)    xTraceInit(ulClock)
+
+//
+//! Record the entry of the running interrupt handler.
+//
+#define xTRACE_ISR_ENTER()      xTraceISREnter()
+
+//
+//! Record the return of the running interrupt handler.
+//
+#define xTRACE_ISR_EXIT()       xTraceEvent(xTRACE_INFO(xTRACE_ISR_EXIT_EVENT,\
+                                                        0, 0))
+
+//
+//! Record the call of the API \e id.
+//
+#define xTRACE_API_BEGIN(id)    xTraceEvent(xTRACE_INFO(xTRACE_API_BEGIN_EVENT,\
+                                                        id, 0))
+
+//
+//! Record the return of the API \e id.
+//
+#define xTRACE_API_END(id)      xTraceEvent(xTRACE_INFO(xTRACE_API_END_EVENT, \
+                                                        id, 0))
+
+//
+//! Record the user marker \e id with the argument \e arg.
+//
+#define xTRACE_MARK(id, arg)    xTraceEvent(xTRACE_INFO(xTRACE_MARK_EVENT,    \
+                                                        id, arg))
+
+//
+//! Stop recording and send the trace image byte by byte to \e pfnPut.
+//
+#define xTRACE_DUMP(pfnPut)     xTraceDump(pfnPut)
+
+#else
+
+#define xTRACE_INIT(ulClock)
+#define xTRACE_ISR_ENTER()
+#define xTRACE_ISR_EXIT()
+#define xTRACE_API_BEGIN(id)
+#define xTRACE_API_END(id)
+#define xTRACE_MARK(id, arg)
+#define xTRACE_DUMP(pfnPut)
+
+#endif
+
+//*****************************************************************************
+//
+//! @}
+//
+//*****************************************************************************
+
+//*****************************************************************************
+//
+//! @}
+//
+//*****************************************************************************
+
+//*****************************************************************************
+//
+//! @}
+//
+//*****************************************************************************
+
+//*****************************************************************************
+//
+// Mark the end of the C bindings section for C++ compilers.
+//
+//*****************************************************************************
+#ifdef __cplusplus
+}
+#endif
+
+#endif // __xTRACE_H__
@@ -44,6 +44,7 @@
 #include "xhw_sysctl.h"
 #include "xhw_uart.h"
 #include "xdebug.h"
+#include "xtrace.h"
 #include "xsysctl.h"
 #include "xuart.h"
 
@@ -64,6 +65,23 @@
 //*****************************************************************************
 static xtEventCallback g_pfnUARTHandlerCallbacks[5]={0};
 
+//*****************************************************************************
+//
+// The UART bases, in the order of g_ulUARTBaud
+//
+//*****************************************************************************
+static const unsigned long g_ulUARTBase[5] =
+{
+    USART1_BASE, USART2_BASE, USART3_BASE, USART4_BASE, USART5_BASE
+};
+
+//*****************************************************************************
+//
+// The baud rate set by UARTConfigSet() on each UART, 0 if it is not set
+//
+//*****************************************************************************
+static unsigned long g_ulUARTBaud[5] = {0};
+
 //*****************************************************************************
 //
 //! \internal
@@ -105,6 +123,8 @@ USART1IntHandler(void)
 {
     unsigned long ulUART1IntStatus;
 
+    xTRACE_ISR_ENTER();
+
     ulUART1IntStatus = xHWREG(USART1_BASE + USART_SR);
     //
     // Clear Interrupt Flag
@@ -115,6 +135,8 @@ USART1IntHandler(void)
     {
         g_pfnUARTHandlerCallbacks[0](0, 0, ulUART1IntStatus, 0);
     }
+
+    xTRACE_ISR_EXIT();
 }
 
 //*****************************************************************************
@@ -134,6 +156,8 @@ USART2IntHandler(void)
 {
     unsigned long ulUART2IntStatus;
 
+    xTRACE_ISR_ENTER();
+
     ulUART2IntStatus = xHWREG(USART2_BASE + USART_SR);
     //
     // Clear Interrupt Flag
@@ -144,6 +168,8 @@ USART2IntHandler(void)
     {
         g_pfnUARTHandlerCallbacks[1](0, 0, ulUART2IntStatus, 0);
     }
+
+    xTRACE_ISR_EXIT();
 }
 
 //*****************************************************************************
@@ -163,6 +189,8 @@ USART3IntHandler(void)
 {
     unsigned long ulUART3IntStatus;
 
+    xTRACE_ISR_ENTER();
+
     ulUART3IntStatus = xHWREG(USART3_BASE + USART_SR);
     //
     // Clear Interrupt Flag
@@ -173,6 +201,8 @@ USART3IntHandler(void)
     {
         g_pfnUARTHandlerCallbacks[2](0, 0, ulUART3IntStatus, 0);
     }
+
+    xTRACE_ISR_EXIT();
 }
 
 //*****************************************************************************
@@ -192,6 +222,8 @@ UART4IntHandler(void)
 {
     unsigned long ulUART4IntStatus;
 
+    xTRACE_ISR_ENTER();
+
     ulUART4IntStatus = xHWREG(USART4_BASE + USART_SR);
     //
     // Clear Interrupt Flag
@@ -202,6 +234,8 @@ UART4IntHandler(void)
     {
         g_pfnUARTHandlerCallbacks[3](0, 0, ulUART4IntStatus, 0);
     }
+
+    xTRACE_ISR_EXIT();
 }
 
 //*****************************************************************************
@@ -221,6 +255,8 @@ UART5IntHandler(void)
 {
     unsigned long ulUART5IntStatus;
 
+    xTRACE_ISR_ENTER();
+
     ulUART5IntStatus = xHWREG(USART5_BASE + USART_SR);
     //
     // Clear Interrupt Flag
@@ -231,6 +267,8 @@ UART5IntHandler(void)
     {
         g_pfnUARTHandlerCallbacks[4](0, 0, ulUART5IntStatus, 0);
     }
+
+    xTRACE_ISR_EXIT();
 }
 
 //*****************************************************************************
@@ -294,6 +332,115 @@ UARTParityModeGet(unsigned long ulBase)
     return(xHWREG(ulBase + USART_CR1) & (USART_CR1_PCE | USART_CR1_PS));
 }
 
+//*****************************************************************************
+//
+//! \internal
+//! \brief Sets the baud rate of a UART from its current APB clock.
+//!
+//! \param ulBase is the base address of the UART port.
+//! \param ulBaud is the desired baud rate.
+//!
+//! \return None.
+//
+//*****************************************************************************
+static void
+UARTBaudSet(unsigned long ulBase, unsigned long ulBaud)
+{
+    unsigned long ulExtClk,ultemp,uldiv;
+
+    if(ulBase == USART1_BASE)
+    {
+        ulExtClk = SysCtlAPB2ClockGet();
+    }
+    else
+    {
+        ulExtClk = SysCtlAPB1ClockGet();
+    }
+
+    //
+    // Determine the integer part.
+    // 
+    if ((xHWREG(ulBase + USART_CR1) & 0) != 0)
+    {
+        //
+        // Integer part computing in case Oversampling mode is 8 Samples.
+        // 
+        ultemp = ((25 * ulExtClk) / (2 * (ulBaud)));    
+    }
+    else 
+    {
+        //
+        // Integer part computing in case Oversampling mode is 16 Samples.
+        //
+        ultemp = ((25 * ulExtClk) / (4 * (ulBaud)));    
+    }
+    uldiv = (ultemp / 100) << 4;
+    
+    //
+    // Determine the fractional part
+    // 
+    ultemp = ultemp - (100 * (uldiv >> 4));
+
+    //
+    // Implement the fractional part in the register
+    //
+    if ((xHWREG(ulBase + USART_CR1) & 0) != 0)
+    {
+        uldiv |= ((((ultemp * 8) + 50) / 100)) & ((unsigned char)0x07);
+    }
+    else 
+    {
+        uldiv |= ((((ultemp * 16) + 50) / 100)) & ((unsigned char)0x0F);
+    }
+    //
+    // Write to USART BRR
+    //
+    xHWREG(ulBase + USART_BRR) = uldiv;
+}
+
+//*****************************************************************************
+//
+//! \internal
+//! \brief Keeps the baud rates of the UARTs over a system clock change.
+//!
+//! Before the change it waits for the UARTs that transmit to send the last
+//! frame, after the change it sets the baud rates again from the new APB
+//! clocks. A frame received during the change can be lost.
+//!
+//! \return 0.
+//
+//*****************************************************************************
+static unsigned long
+UARTClockNotify(void *pvCBData, unsigned long ulEvent,
+                unsigned long ulMsgParam, void *pvMsgData)
+{
+    unsigned long i, ulBase;
+
+    for(i = 0; i < 5; i++)
+    {
+        ulBase = g_ulUARTBase[i];
+        if(g_ulUARTBaud[i] == 0)
+        {
+            continue;
+        }
+
+        if(ulEvent == SYSCTL_CLOCK_PRE_CHANGE)
+        {
+            if((xHWREG(ulBase + USART_CR1) & (USART_CR1_UE | USART_CR1_TE)) ==
+               (USART_CR1_UE | USART_CR1_TE))
+            {
+                while(!(xHWREG(ulBase + USART_SR) & USART_SR_TC));
+            }
+        }
+        else
+        {
+            UARTBaudSet(ulBase, g_ulUARTBaud[i]);
+        }
+    }
+
+    return 0;
+}
+
 //*****************************************************************************
 //
 //! \brief Sets the configuration of a UART.
@@ -318,6 +465,8 @@ UARTParityModeGet(unsigned long ulBase)
 //! select the parity mode (no parity bit, even parity bit, odd parity bit,
 //! parity bit always one, and parity bit always zero, respectively).
 //!
+//! The baud rate is set again from the new APB clock when SysCtlClockSet()
+//! changes the system clock.
 //!
 //! \return None.
 //
@@ -326,7 +475,7 @@ void
 UARTConfigSet(unsigned long ulBase, unsigned long ulBaud, 
               unsigned long ulConfig)
 {
-    unsigned long ulExtClk,ultemp,uldiv;
+    unsigned long i;
 
     //
     // Check the arguments.
@@ -381,54 +530,19 @@ UARTConfigSet(unsigned long ulBase, unsigned long ulBaud,
     xHWREG(ulBase + USART_CR1) = ulConfig & (UART_CONFIG_WLEN_MASK | 
                                              UART_CONFIG_PAR_MASK);
     
-    if(ulBase == USART1_BASE)
-    {
-        ulExtClk = SysCtlAPB2ClockGet();
-    }
-    else
-    {
-        ulExtClk = SysCtlAPB1ClockGet();
-    }
-
-    //
-    // Determine the integer part.
-    // 
-    if ((xHWREG(ulBase + USART_CR1) & 0) != 0)
-    {
-        //
-        // Integer part computing in case Oversampling mode is 8 Samples.
-        // 
-        ultemp = ((25 * ulExtClk) / (2 * (ulBaud)));    
-    }
-    else 
-    {
-        //
-        // Integer part computing in case Oversampling mode is 16 Samples.
-        //
-        ultemp = ((25 * ulExtClk) / (4 * (ulBaud)));    
-    }
-    uldiv = (ultemp / 100) << 4;
-    
-    //
-    // Determine the fractional part
-    // 
-    ultemp = ultemp - (100 * (uldiv >> 4));
+    UARTBaudSet(ulBase, ulBaud);
 
     //
-    // Implement the fractional part in the register
+    // Keep the baud rate for the clock changes.
     //
-    if ((xHWREG(ulBase + USART_CR1) & 0) != 0)
-    {
-        uldiv |= ((((ultemp * 8) + 50) / 100)) & ((unsigned char)0x07);
-    }
-    else 
+    for(i = 0; i < 5; i++)
     {
-        uldiv |= ((((ultemp * 16) + 50) / 100)) & ((unsigned char)0x0F);
+        if(g_ulUARTBase[i] == ulBase)
+        {
+            g_ulUARTBaud[i] = ulBaud;
+        }
     }
-    //
-    // Write to USART BRR
-    //
-    xHWREG(ulBase + USART_BRR) = uldiv;
+    SysCtlClockNotifyRegister(UARTClockNotify, 0);
 }
 
 //*****************************************************************************
@@ -1021,6 +1135,8 @@ UARTBufferWrite(unsigned long ulBase, unsigned char *ucBuffer,
     //
     xASSERT(UARTBaseValid(ulBase));
 
+    xTRACE_API_BEGIN(xTRACE_ID_UART_BUFFER_WRITE);
+
     //
     // Wait until a char is available.
     //
@@ -1028,6 +1144,8 @@ UARTBufferWrite(unsigned long ulBase, unsigned char *ucBuffer,
     {
         UARTCharPut(ulBase, ucBuffer[ulCount]);
     }
+
+    xTRACE_API_END(xTRACE_ID_UART_BUFFER_WRITE);
 }
 //*****************************************************************************
 //
@@ -0,0 +1,268 @@
+//*****************************************************************************
+//
+//! @page xsysctl_testcase xcore register test
+//!
+//! File: @ref xsysctltest07.c
+//!
+//! <h2>Description</h2>
+//! This module implements the test sequence for the xsysctl sub component.<br><br>
+//! - \p Board: MCBSTM32<br><br>
+//! - \p Last-Time(about): 0.5s <br><br>
+//! - \p Phenomenon: Success or failure information will be printed on the UART. <br><br>
+//! .
+//!
+//! <h2>Preconditions</h2>
+//! The module requires the following options:<br><br>
+//! - \p Option-define:
+//! <br>(1)None.<br><br>
+//! - \p Option-hardware:
+//! <br>(1)8MHz crystal on the main oscillator.<br><br>
+//! - \p Option-OtherModule:
+//! <br>Connect an COM cable to the development board.<br>
+//! .
+//! In case some of the required options are not enabled then some or all tests
+//! may be skipped or result FAILED.<br>
+//!
+//! <h2>Test Cases</h2>
+//! The module contain those sub tests:<br><br>
+//! - \subpage test_xsysctl_register
+//! .
+//! \file xsysctltest07.c
+//! \brief xsysctl test source file
+//! \brief xsysctl test header file <br>
+//
+//*****************************************************************************
+
+#include "test.h"
+#include "xhw_memmap.h"
+
+//
+// Events seen by the test callback, in the order they came.
+//
+static unsigned long ulEvents[4];
+static unsigned long ulEventClk[4];
+static unsigned long ulEventCount = 0;
+
+//*****************************************************************************
+//
+//! \brief Clock change callback of the test, records the events.
+//!
+//! \return 0.
+//
+//*****************************************************************************
+static unsigned long ClockTestCallback(void *pvCBData, unsigned long ulEvent,
+                                       unsigned long ulMsgParam,
+                                       void *pvMsgData)
+{
+    if(ulEventCount < 4)
+    {
+        ulEvents[ulEventCount] = ulEvent;
+        ulEventClk[ulEventCount] = ulMsgParam;
+    }
+    ulEventCount++;
+    (*(unsigned long *)pvCBData)++;
+
+    return 0;
+}
+
+//*****************************************************************************
+//
+//! \brief Measure SysCtlDelayUs() with SysTick.
+//!
+//! \return the delay in microseconds.
+//
+//*****************************************************************************
+static unsigned long DelayUsMeasure(unsigned long ulUs)
+{
+    unsigned long ulStart, ulEnd;
+
+    xHWREG(NVIC_ST_CTRL) = 0;
+    xHWREG(NVIC_ST_RELOAD) = NVIC_ST_RELOAD_M;
+    xHWREG(NVIC_ST_CURRENT) = 0;
+    xHWREG(NVIC_ST_CTRL) = NVIC_ST_CTRL_CLK_SRC | NVIC_ST_CTRL_ENABLE;
+
+    ulStart = xHWREG(NVIC_ST_CURRENT);
+    SysCtlDelayUs(ulUs);
+    ulEnd = xHWREG(NVIC_ST_CURRENT);
+    xHWREG(NVIC_ST_CTRL) = 0;
+
+    return ((ulStart - ulEnd) & NVIC_ST_RELOAD_M) /
+           (SysCtlHClockGet() / 1000000);
+}
+
+//*****************************************************************************
+//
+//! \brief Get the Test description of xsysctl0701 register test.
+//!
+//! \return the desccription of the xcore0701 test.
+//
+//*****************************************************************************
+static char* xSysctl0701GetTest(void)
+{
+    return "xsysctl, 0701, SysCtlClockNotifyRegister function test";
+}
+
+//*****************************************************************************
+//
+//! \brief something should do before the test execute of xsysctl0701 test.
+//!
+//! \return None.
+//
+//*****************************************************************************
+static void xSysctl0701Setup(void)
+{
+    ulEventCount = 0;
+}
+
+//*****************************************************************************
+//
+//! \brief something should do after the test execute of xsysctl0701 test.
+//!
+//! \return None.
+//
+//*****************************************************************************
+static void xSysctl0701TearDown(void)
+{
+    SysCtlClockNotifyUnregister(ClockTestCallback);
+    xSysCtlClockSet(72000000, xSYSCTL_OSC_MAIN | xSYSCTL_XTAL_8MHZ);
+}
+
+//*****************************************************************************
+//
+//! \brief xsysctl 0701 test execute main body.
+//!
+//! \return None.
+//
+//*****************************************************************************
+static void xSysctl0701Execute(void)
+{
+    unsigned long ulCalls = 0;
+
+    //
+    // Registering twice keeps one slot.
+    //
+    TestAssert(SysCtlClockNotifyRegister(ClockTestCallback, 0) == xtrue,
+               "xSysCtl test 0701: SysCtlClockNotifyRegister failed");
+    TestAssert(SysCtlClockNotifyRegister(ClockTestCallback, &ulCalls) == xtrue,
+               "xSysCtl test 0701: SysCtlClockNotifyRegister failed");
+
+    xSysCtlClockSet(8000000, xSYSCTL_OSC_MAIN | xSYSCTL_XTAL_8MHZ);
+    TestAssert((ulEventCount == 2) && (ulCalls == 2),
+               "xSysCtl test 0701: clock change events count error");
+    TestAssert((ulEvents[0] == SYSCTL_CLOCK_PRE_CHANGE) &&
+               (ulEventClk[0] == 72000000),
+               "xSysCtl test 0701: SYSCTL_CLOCK_PRE_CHANGE error");
+    TestAssert((ulEvents[1] == SYSCTL_CLOCK_POST_CHANGE) &&
+               (ulEventClk[1] == 8000000) &&
+               (SysCtlHClockGet() == 8000000),
+               "xSysCtl test 0701: SYSCTL_CLOCK_POST_CHANGE error");
+
+    //
+    // No more events once it is unregistered.
+    //
+    SysCtlClockNotifyUnregister(ClockTestCallback);
+    xSysCtlClockSet(72000000, xSYSCTL_OSC_MAIN | xSYSCTL_XTAL_8MHZ);
+    TestAssert(ulEventCount == 2,
+               "xSysCtl test 0701: SysCtlClockNotifyUnregister failed");
+}
+
+//
+// xsysctl register test case struct.
+//
+const tTestCase sTestXSysctl0701Register = {
+    xSysctl0701GetTest,
+    xSysctl0701Setup,
+    xSysctl0701TearDown,
+    xSysctl0701Execute,
+};
+
+//*****************************************************************************
+//
+//! \brief Get the Test description of xsysctl0702 register test.
+//!
+//! \return the desccription of the xcore0702 test.
+//
+//*****************************************************************************
+static char* xSysctl0702GetTest(void)
+{
+    return "xsysctl, 0702, UART and delay over SysCtlClockSet test";
+}
+
+//*****************************************************************************
+//
+//! \brief something should do before the test execute of xsysctl0702 test.
+//!
+//! \return None.
+//
+//*****************************************************************************
+static void xSysctl0702Setup(void)
+{
+}
+
+//*****************************************************************************
+//
+//! \brief something should do after the test execute of xsysctl0702 test.
+//!
+//! \return None.
+//
+//*****************************************************************************
+static void xSysctl0702TearDown(void)
+{
+    xSysCtlClockSet(72000000, xSYSCTL_OSC_MAIN | xSYSCTL_XTAL_8MHZ);
+}
+
+//*****************************************************************************
+//
+//! \brief xsysctl 0702 test execute main body.
+//!
+//! \return None.
+//
+//*****************************************************************************
+static void xSysctl0702Execute(void)
+{
+    unsigned long ulBRR, ulDiv, ulUs;
+
+    //
+    // The test port UART was set to 115200 at 72MHz, it must follow the
+    // clock down to 8MHz.
+    //
+    xSysCtlClockSet(8000000, xSYSCTL_OSC_MAIN | xSYSCTL_XTAL_8MHZ);
+    ulBRR = xHWREG(USART1_BASE + USART_BRR);
+    ulDiv = SysCtlAPB2ClockGet() / 115200;
+    TestAssert((ulBRR + 1 >= ulDiv) && (ulBRR <= ulDiv + 1),
+               "xSysCtl test 0702: UART baud rate not set again");
+
+    ulUs = DelayUsMeasure(1000);
+    TestAssert((ulUs >= 1000) && (ulUs < 2000),
+               "xSysCtl test 0702: SysCtlDelayUs at 8MHz error");
+
+    xSysCtlClockSet(72000000, xSYSCTL_OSC_MAIN | xSYSCTL_XTAL_8MHZ);
+    ulBRR = xHWREG(USART1_BASE + USART_BRR);
+    ulDiv = SysCtlAPB2ClockGet() / 115200;
+    TestAssert((ulBRR + 1 >= ulDiv) && (ulBRR <= ulDiv + 1),
+               "xSysCtl test 0702: UART baud rate not set again");
+
+    ulUs = DelayUsMeasure(1000);
+    TestAssert((ulUs >= 1000) && (ulUs < 2000),
+               "xSysCtl test 0702: SysCtlDelayUs at 72MHz error");
+}
+
+//
+// xsysctl register test case struct.
+//
+const tTestCase sTestXSysctl0702Register = {
+    xSysctl0702GetTest,
+    xSysctl0702Setup,
+    xSysctl0702TearDown,
+    xSysctl0702Execute,
+};
+
+//
+// Xsysctl test suits.
+//
+const tTestCase * const psPatternXsysctl07[] =
+{
+    &sTestXSysctl0701Register,
+    &sTestXSysctl0702Register,
+    0
+};
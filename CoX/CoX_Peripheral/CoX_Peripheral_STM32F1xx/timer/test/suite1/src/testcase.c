@@ -23,7 +23,7 @@ const tTestCase * const* g_psPatterns[] =  {
   
 //    psPatternXtimer001,
 //    psPatternXtimer002,
-//    psPatternXtimer003,
+    psPatternXtimer003,
     
     //
     // end
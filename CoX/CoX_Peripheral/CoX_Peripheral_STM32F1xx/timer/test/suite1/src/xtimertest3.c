@@ -0,0 +1,311 @@
+//*****************************************************************************
+//
+//! @page xtimer_testcase xtimer resource test
+//!
+//! File: @ref xtimertest3.c
+//!
+//! <h2>Description</h2>
+//! This module implements the test sequence for the xtimer sub component.<br><br>
+//! - \p Board: MCBSTM32<br><br>
+//! - \p Last-Time(about): 0.1s <br><br>
+//! - \p Phenomenon: Success or failure information will be printed on the UART. <br><br>
+//! .
+//!
+//! <h2>Preconditions</h2>
+//! The module requires the following options:<br><br>
+//! - \p Option-define:
+//! <br>(1)None.<br><br>
+//! - \p Option-hardware:
+//! <br>(1)None, the channels compare with no pins.<br><br>
+//! - \p Option-OtherModule:
+//! <br>Connect an COM cable to the development board.<br>
+//! .
+//! In case some of the required options are not enabled then some or all tests
+//! may be skipped or result FAILED.<br>
+//!
+//! <h2>Test Cases</h2>
+//! The module contain those sub tests:<br><br>
+//! - \subpage test_xtimer_resource
+//! .
+//! \file xtimertest3.c
+//! \brief xtimer test source file
+//! \brief xtimer test header file <br>
+//
+//*****************************************************************************
+
+#include "test.h"
+#include "xtimer.h"
+
+//*****************************************************************************
+//
+//!\page test_xtimer_resource test_xtimer_resource
+//!
+//!<h2>Description</h2>
+//!Test a time base and two channel users sharing TIM2. <br>
+//!
+//
+//*****************************************************************************
+
+//
+// Interrupts seen by each user of TIM2.
+//
+static unsigned long ulTickCount;
+static unsigned long ulCaptureCount;
+static unsigned long ulPWMCount;
+static unsigned long ulRestFlags;
+
+//
+// Sources with an owner callback, the others go to TickCallback().
+//
+static unsigned long ulOwnedFlags;
+
+//
+// Set when a callback got wrong arguments.
+//
+static unsigned long ulBadArgs;
+
+//*****************************************************************************
+//
+//! \brief Callback of xTimerIntCallbackInit(), gets TIMER_SR with the
+//! sources without an owner callback.
+//!
+//! \return 0.
+//
+//*****************************************************************************
+static unsigned long TickCallback(void *pvCBData, unsigned long ulEvent,
+                                  unsigned long ulMsgParam, void *pvMsgData)
+{
+    unsigned long ulFlags;
+
+    ulFlags = ulMsgParam & xHWREG(TIM2_BASE + TIMER_DIER) & ~ulOwnedFlags;
+    if(xHWREG(TIM2_BASE + TIMER_SR) & ulFlags)
+    {
+        ulBadArgs = 1;
+    }
+
+    if(ulFlags & TIMER_INT_UEV)
+    {
+        ulTickCount++;
+    }
+    ulRestFlags |= ulFlags;
+
+    return 0;
+}
+
+//*****************************************************************************
+//
+//! \brief Callback of the channel 2 user.
+//!
+//! \return 0.
+//
+//*****************************************************************************
+static unsigned long CaptureCallback(void *pvCBData, unsigned long ulEvent,
+                                     unsigned long ulMsgParam, void *pvMsgData)
+{
+    if((ulEvent != TIMER_INT_CH2CC) ||
+       (ulMsgParam != xHWREG(TIM2_BASE + TIMER_CCR2)))
+    {
+        ulBadArgs = 1;
+    }
+    (*(unsigned long *)pvCBData)++;
+
+    return 0;
+}
+
+//*****************************************************************************
+//
+//! \brief Callback of the channel 3 user.
+//!
+//! \return 0.
+//
+//*****************************************************************************
+static unsigned long PWMCallback(void *pvCBData, unsigned long ulEvent,
+                                 unsigned long ulMsgParam, void *pvMsgData)
+{
+    if(ulEvent != TIMER_INT_CH3CC)
+    {
+        ulBadArgs = 1;
+    }
+    (*(unsigned long *)pvCBData)++;
+
+    return 0;
+}
+
+//*****************************************************************************
+//
+//! \brief Run TIM2 until the time base has counted ulTicks.
+//!
+//! \return None.
+//
+//*****************************************************************************
+static void TimerRun(unsigned long ulTicks)
+{
+    unsigned long ulTimeOut = 0xFFFFF;
+
+    xIntEnable(xINT_TIMER2);
+    TimerStart(TIM2_BASE);
+    while((ulTickCount < ulTicks) && (--ulTimeOut != 0))
+    {
+    }
+    TimerStop(TIM2_BASE);
+    xIntDisable(xINT_TIMER2);
+}
+
+//*****************************************************************************
+//
+//! \brief Get the Test description of xtimer003 resource test.
+//!
+//! \return the desccription of the xtimer003 test.
+//
+//*****************************************************************************
+static char* xTimer003GetTest(void)
+{
+    return "xTimer [003]: timer resource sharing test";
+}
+
+//*****************************************************************************
+//
+//! \brief something should do before the test execute of xtimer003 test.
+//!
+//! \return None.
+//
+//*****************************************************************************
+static void xTimer003Setup(void)
+{
+    xSysCtlPeripheralEnable(xSYSCTL_PERIPH_TIMER2);
+
+    ulTickCount = 0;
+    ulCaptureCount = 0;
+    ulPWMCount = 0;
+    ulRestFlags = 0;
+    ulOwnedFlags = TIMER_INT_CH2CC | TIMER_INT_CH3CC;
+    ulBadArgs = 0;
+}
+
+//*****************************************************************************
+//
+//! \brief something should do after the test execute of xtimer003 test.
+//!
+//! \return None.
+//
+//*****************************************************************************
+static void xTimer003TearDown(void)
+{
+    xHWREG(TIM2_BASE + TIMER_DIER) = 0;
+    TimerResRelease(TIM2_BASE, 0xFF, TIMER_OWNER_TIMEBASE);
+    TimerResRelease(TIM2_BASE, 0xFF, TIMER_OWNER_CAPTURE);
+    TimerResRelease(TIM2_BASE, 0xFF, TIMER_OWNER_PWM);
+    xTimerIntCallbackInit(TIM2_BASE, 0);
+    xSysCtlPeripheralDisable(xSYSCTL_PERIPH_TIMER2);
+}
+
+//*****************************************************************************
+//
+//! \brief xtimer 003 test execute main body.
+//!
+//! \return None.
+//
+//*****************************************************************************
+static void xTimer003Execute(void)
+{
+    unsigned long ulARR;
+
+    //
+    // The time base takes the update event and channel 1.
+    //
+    xTimerInitConfig(TIM2_BASE, xTIMER_CHANNEL0,
+                     xTIMER_MODE_PERIODIC | xTIMER_COUNT_UP, 1000);
+    xTimerIntCallbackInit(TIM2_BASE, TickCallback);
+    TestAssert((TimerResOwnerGet(TIM2_BASE, TIMER_INT_UEV) ==
+                TIMER_OWNER_TIMEBASE) &&
+               (TimerResOwnerGet(TIM2_BASE, TIMER_INT_CH1CC) ==
+                TIMER_OWNER_TIMEBASE),
+               "xtimer API \"xTimerInitConfig\" claim error");
+
+    //
+    // Channel 1 is taken, a claim with a taken channel claims nothing.
+    //
+    TestAssert(TimerResClaim(TIM2_BASE, TIMER_INT_CH1CC, TIMER_OWNER_PWM,
+                             PWMCallback, &ulPWMCount) == xfalse,
+               "xtimer API \"TimerResClaim\" error");
+    TestAssert(TimerResClaim(TIM2_BASE, TIMER_INT_CH2CC, TIMER_OWNER_CAPTURE,
+                             CaptureCallback, &ulCaptureCount) == xtrue,
+               "xtimer API \"TimerResClaim\" error");
+    TestAssert((TimerResClaim(TIM2_BASE, TIMER_INT_CH2CC | TIMER_INT_CH3CC,
+                              TIMER_OWNER_PWM, PWMCallback,
+                              &ulPWMCount) == xfalse) &&
+               (TimerResOwnerGet(TIM2_BASE, TIMER_INT_CH3CC) ==
+                TIMER_OWNER_NONE),
+               "xtimer API \"TimerResClaim\" error");
+    TestAssert(TimerResClaim(TIM2_BASE, TIMER_INT_CH3CC, TIMER_OWNER_PWM,
+                             PWMCallback, &ulPWMCount) == xtrue,
+               "xtimer API \"TimerResClaim\" error");
+
+    //
+    // Channels 2 and 3 compare in the middle of each period, standing in
+    // for a capture input and a PWM output so no signal is needed.
+    //
+    ulARR = TimerARRReloadGet(TIM2_BASE);
+    TimerOC2Configure(TIM2_BASE, TIMER_OCMODE_TIMING, ulARR / 2,
+                      TIMER_OP_STATE_DIS | TIMER_OP_POL_HIGH,
+                      TIMER_OP_N_STATE_DIS | TIMER_OP_N_POL_HIGH,
+                      TIMER_OCIDLESTATE_RESET | TIMER_OCNIDLESTATE_RESET);
+    TimerOC3Configure(TIM2_BASE, TIMER_OCMODE_TIMING, ulARR / 4,
+                      TIMER_OP_STATE_DIS | TIMER_OP_POL_HIGH,
+                      TIMER_OP_N_STATE_DIS | TIMER_OP_N_POL_HIGH,
+                      TIMER_OCIDLESTATE_RESET | TIMER_OCNIDLESTATE_RESET);
+    TimerIntEnable(TIM2_BASE, TIMER_INT_UEV);
+    TimerIntEnable(TIM2_BASE, TIMER_INT_CH2CC);
+    TimerIntEnable(TIM2_BASE, TIMER_INT_CH3CC);
+
+    //
+    // One interrupt vector, each user gets its own source.
+    //
+    TimerRun(10);
+    TestAssert(ulTickCount >= 10, "xtimer shared interrupt not happen");
+    TestAssert((ulCaptureCount + 1 >= ulTickCount) &&
+               (ulCaptureCount <= ulTickCount + 1) &&
+               (ulPWMCount + 1 >= ulTickCount) &&
+               (ulPWMCount <= ulTickCount + 1),
+               "xtimer shared interrupt dispatch error");
+    TestAssert((ulBadArgs == 0) && (ulRestFlags == TIMER_INT_UEV),
+               "xtimer shared interrupt callback arguments error");
+
+    //
+    // Only the owner gives a channel back, then its events go to the
+    // xTimerIntCallbackInit() callback.
+    //
+    TimerResRelease(TIM2_BASE, TIMER_INT_CH3CC, TIMER_OWNER_CAPTURE);
+    TestAssert(TimerResOwnerGet(TIM2_BASE, TIMER_INT_CH3CC) ==
+               TIMER_OWNER_PWM, "xtimer API \"TimerResRelease\" error");
+    TimerResRelease(TIM2_BASE, TIMER_INT_CH3CC, TIMER_OWNER_PWM);
+    ulOwnedFlags = TIMER_INT_CH2CC;
+    TestAssert(TimerResOwnerGet(TIM2_BASE, TIMER_INT_CH3CC) ==
+               TIMER_OWNER_NONE, "xtimer API \"TimerResRelease\" error");
+
+    ulTickCount = 0;
+    ulPWMCount = 0;
+    TimerRun(5);
+    TestAssert((ulTickCount >= 5) && (ulPWMCount == 0) &&
+               (ulRestFlags == (TIMER_INT_UEV | TIMER_INT_CH3CC)),
+               "xtimer API \"TimerResRelease\" error");
+}
+
+//
+// xtimer resource test case struct.
+//
+const tTestCase sTestxTimer003Resource = {
+    xTimer003GetTest,
+    xTimer003Setup,
+    xTimer003TearDown,
+    xTimer003Execute
+};
+
+//
+// xtimer test suits.
+//
+const tTestCase * const psPatternXtimer003[] =
+{
+    &sTestxTimer003Resource,
+    0
+};
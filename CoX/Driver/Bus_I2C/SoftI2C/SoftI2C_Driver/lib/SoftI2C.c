@@ -0,0 +1,930 @@
+//*****************************************************************************
+//
+//! \file SoftI2C.c
+//! \brief Software I2C master engine on open drain GPIO.
+//! \version V2.2.1.0
+//! \date 10/19/2026
+//! \author CooCox
+//! \copy
+//!
+//! Copyright (c)  2013, CooCox
+//! All rights reserved.
+//!
+//! Redistribution and use in source and binary forms, with or without
+//! modification, are permitted provided that the following conditions
+//! are met:
+//!
+//!     * Redistributions of source code must retain the above copyright
+//! notice, this list of conditions and the following disclaimer.
+//!     * Redistributions in binary form must reproduce the above copyright
+//! notice, this list of conditions and the following disclaimer in the
+//! documentation and/or other materials provided with the distribution.
+//!     * Neither the name of the <ORGANIZATION> nor the names of its
+//! contributors may be used to endorse or promote products derived
+//! from this software without specific prior written permission.
+//!
+//! THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+//! AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+//! IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+//! ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+//! LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+//! CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+//! SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+//! INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//! CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+//! ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+//! THE POSSIBILITY OF SUCH DAMAGE.
+//
+//*****************************************************************************
+
+#include "xhw_types.h"
+#include "xhw_memmap.h"
+#include "xhw_nvic.h"
+#include "xhw_gpio.h"
+#include "xcore.h"
+#include "xdebug.h"
+#include "xsysctl.h"
+#include "xgpio.h"
+#include "SoftI2C.h"
+
+//
+// Transfer states. Between calls SCL is held low unless the bus is idle.
+// After a read the ACK bit is sent by the next call, which knows whether
+// another byte follows.
+//
+#define SOFT_I2C_IDLE              0
+#define SOFT_I2C_OWNED             1
+#define SOFT_I2C_ACK_PENDING       2
+
+//
+// Bit rates above this are fast mode, which needs a longer low than high
+// time.
+//
+#define SOFT_I2C_STANDARD_MAX      100000
+
+#ifndef SOFT_I2C_PORT_EXTERNAL
+
+//*****************************************************************************
+//
+//! \brief Set both pins to open drain and start the timebase.
+//!
+//! \param psBus is the bus.
+//!
+//! SysTick is the timebase. It is started free running if the application
+//! does not use it, otherwise it is read as it is set up.
+//!
+//! \return The timebase frequency in Hz.
+//
+//*****************************************************************************
+unsigned long
+SoftI2CPortInit(tSoftI2C *psBus)
+{
+    xSysCtlPeripheralEnable2(psBus->ulSCLPort);
+    xSysCtlPeripheralEnable2(psBus->ulSDAPort);
+    SoftI2CPortSCL(psBus, 1);
+    SoftI2CPortSDA(psBus, 1);
+    xGPIODirModeSet(psBus->ulSCLPort, psBus->ulSCLPin, xGPIO_DIR_MODE_OD);
+    xGPIODirModeSet(psBus->ulSDAPort, psBus->ulSDAPin, xGPIO_DIR_MODE_OD);
+
+    if(!(xHWREG(NVIC_ST_CTRL) & NVIC_ST_CTRL_ENABLE))
+    {
+        xHWREG(NVIC_ST_RELOAD) = NVIC_ST_RELOAD_M;
+        xHWREG(NVIC_ST_CURRENT) = 0;
+        xHWREG(NVIC_ST_CTRL) = NVIC_ST_CTRL_CLK_SRC | NVIC_ST_CTRL_ENABLE;
+    }
+
+    //
+    // Without CLK_SRC SysTick runs from HCLK / 8.
+    //
+    if(xHWREG(NVIC_ST_CTRL) & NVIC_ST_CTRL_CLK_SRC)
+    {
+        return xSysCtlClockGet();
+    }
+
+    return xSysCtlClockGet() / 8;
+}
+
+//*****************************************************************************
+//
+//! \brief Drive SCL low or release it.
+//!
+//! \param psBus is the bus.
+//! \param ulLevel is 0 to drive the line low, 1 to release it.
+//!
+//! \return None.
+//
+//*****************************************************************************
+void
+SoftI2CPortSCL(tSoftI2C *psBus, unsigned long ulLevel)
+{
+    xHWREG(psBus->ulSCLPort + (ulLevel ? GPIO_BSRR : GPIO_BRR)) =
+        psBus->ulSCLPin;
+}
+
+//*****************************************************************************
+//
+//! \brief Drive SDA low or release it.
+//!
+//! \param psBus is the bus.
+//! \param ulLevel is 0 to drive the line low, 1 to release it.
+//!
+//! \return None.
+//
+//*****************************************************************************
+void
+SoftI2CPortSDA(tSoftI2C *psBus, unsigned long ulLevel)
+{
+    xHWREG(psBus->ulSDAPort + (ulLevel ? GPIO_BSRR : GPIO_BRR)) =
+        psBus->ulSDAPin;
+}
+
+//*****************************************************************************
+//
+//! \brief Read SCL.
+//!
+//! \param psBus is the bus.
+//!
+//! \return Non-zero if the line is high.
+//
+//*****************************************************************************
+unsigned long
+SoftI2CPortSCLGet(tSoftI2C *psBus)
+{
+    return xHWREG(psBus->ulSCLPort + GPIO_IDR) & psBus->ulSCLPin;
+}
+
+//*****************************************************************************
+//
+//! \brief Read SDA.
+//!
+//! \param psBus is the bus.
+//!
+//! \return Non-zero if the line is high.
+//
+//*****************************************************************************
+unsigned long
+SoftI2CPortSDAGet(tSoftI2C *psBus)
+{
+    return xHWREG(psBus->ulSDAPort + GPIO_IDR) & psBus->ulSDAPin;
+}
+
+//*****************************************************************************
+//
+//! \brief Get the ticks since a mark and move the mark to now.
+//!
+//! \param pulMark is the SysTick value of the mark.
+//!
+//! \return The ticks since the mark, less than a SysTick period.
+//
+//*****************************************************************************
+unsigned long
+SoftI2CPortTickElapsed(unsigned long *pulMark)
+{
+    unsigned long ulNow = xHWREG(NVIC_ST_CURRENT);
+    unsigned long ulTicks;
+
+    //
+    // SysTick counts down and reloads after 0.
+    //
+    if(ulNow <= *pulMark)
+    {
+        ulTicks = *pulMark - ulNow;
+    }
+    else
+    {
+        ulTicks = *pulMark + xHWREG(NVIC_ST_RELOAD) + 1 - ulNow;
+    }
+    *pulMark = ulNow;
+
+    return ulTicks;
+}
+
+#endif
+
+//*****************************************************************************
+//
+//! \brief Wait until some ticks have passed since the last edge.
+//!
+//! \param psBus is the bus.
+//! \param ulTicks is the time to wait from the last edge.
+//!
+//! The mark is moved to the end of the wait, which is the time of the edge
+//! the caller makes next.
+//!
+//! \return None.
+//
+//*****************************************************************************
+static void
+SoftI2CWait(tSoftI2C *psBus, unsigned long ulTicks)
+{
+    unsigned long ulSum = 0;
+
+    while(ulSum < ulTicks)
+    {
+        ulSum += SoftI2CPortTickElapsed(&psBus->ulMark);
+    }
+}
+
+//*****************************************************************************
+//
+//! \brief Give up the transfer after an error.
+//!
+//! \param psBus is the bus.
+//! \param ulError is the error.
+//!
+//! A missing ACK ends the transfer with a STOP. After a lost arbitration or
+//! a timeout the bus is not ours, so both lines are just released.
+//!
+//! \return None.
+//
+//*****************************************************************************
+static void
+SoftI2CFail(tSoftI2C *psBus, unsigned long ulError)
+{
+    psBus->ucError = (unsigned char)ulError;
+
+    if((ulError == SOFT_I2C_MASTER_ERR_ADDR_ACK) ||
+       (ulError == SOFT_I2C_MASTER_ERR_DATA_ACK))
+    {
+        SoftI2CMasterStop((unsigned long)psBus);
+    }
+    else
+    {
+        SoftI2CPortSDA(psBus, 1);
+        SoftI2CPortSCL(psBus, 1);
+        psBus->ucState = SOFT_I2C_IDLE;
+    }
+}
+
+//*****************************************************************************
+//
+//! \brief Release SCL and wait while a slave holds it low.
+//!
+//! \param psBus is the bus.
+//!
+//! The high time counts from when SCL is seen high.
+//!
+//! \return xtrue if SCL went high, xfalse on timeout.
+//
+//*****************************************************************************
+static xtBoolean
+SoftI2CClockRelease(tSoftI2C *psBus)
+{
+    unsigned long ulSum = 0;
+
+    SoftI2CPortSCL(psBus, 1);
+    SoftI2CPortTickElapsed(&psBus->ulMark);
+    while(!SoftI2CPortSCLGet(psBus))
+    {
+        ulSum += SoftI2CPortTickElapsed(&psBus->ulMark);
+        if(ulSum > psBus->ulStretch)
+        {
+            SoftI2CFail(psBus, SOFT_I2C_MASTER_ERR_TIMEOUT);
+            return xfalse;
+        }
+    }
+
+    return xtrue;
+}
+
+//*****************************************************************************
+//
+//! \brief Clock one bit out.
+//!
+//! \param psBus is the bus, SCL low.
+//! \param ulBit is the bit.
+//!
+//! \return xtrue on success, xfalse on timeout or lost arbitration.
+//
+//*****************************************************************************
+static xtBoolean
+SoftI2CBitWrite(tSoftI2C *psBus, unsigned long ulBit)
+{
+    SoftI2CPortSDA(psBus, ulBit);
+    SoftI2CWait(psBus, psBus->ulLow);
+    if(!SoftI2CClockRelease(psBus))
+    {
+        return xfalse;
+    }
+
+    if(ulBit && !SoftI2CPortSDAGet(psBus))
+    {
+        SoftI2CFail(psBus, SOFT_I2C_MASTER_ERR_ARB_LOST);
+        return xfalse;
+    }
+
+    SoftI2CWait(psBus, psBus->ulHigh);
+    SoftI2CPortSCL(psBus, 0);
+
+    return xtrue;
+}
+
+//*****************************************************************************
+//
+//! \brief Clock one bit in.
+//!
+//! \param psBus is the bus, SCL low.
+//! \param pulBit is where to store the bit, non-zero for 1.
+//!
+//! SDA is sampled at the end of the high time.
+//!
+//! \return xtrue on success, xfalse on timeout.
+//
+//*****************************************************************************
+static xtBoolean
+SoftI2CBitRead(tSoftI2C *psBus, unsigned long *pulBit)
+{
+    SoftI2CPortSDA(psBus, 1);
+    SoftI2CWait(psBus, psBus->ulLow);
+    if(!SoftI2CClockRelease(psBus))
+    {
+        return xfalse;
+    }
+
+    SoftI2CWait(psBus, psBus->ulHigh);
+    *pulBit = SoftI2CPortSDAGet(psBus);
+    SoftI2CPortSCL(psBus, 0);
+
+    return xtrue;
+}
+
+//*****************************************************************************
+//
+//! \brief Send a byte and read the ACK bit.
+//!
+//! \param psBus is the bus, SCL low.
+//! \param ucData is the byte.
+//! \param ulNack is the error to report if the byte is not acknowledged.
+//!
+//! \return xtrue if the byte was acknowledged.
+//
+//*****************************************************************************
+static xtBoolean
+SoftI2CByteWrite(tSoftI2C *psBus, unsigned char ucData, unsigned long ulNack)
+{
+    unsigned long ulBit;
+    unsigned long i;
+
+    for(i = 0; i < 8; i++)
+    {
+        if(!SoftI2CBitWrite(psBus, ucData & 0x80))
+        {
+            return xfalse;
+        }
+        ucData <<= 1;
+    }
+
+    if(!SoftI2CBitRead(psBus, &ulBit))
+    {
+        return xfalse;
+    }
+
+    if(ulBit)
+    {
+        SoftI2CFail(psBus, ulNack);
+        return xfalse;
+    }
+
+    return xtrue;
+}
+
+//*****************************************************************************
+//
+//! \brief Send the ACK bit of the byte read last, if not sent yet.
+//!
+//! \param psBus is the bus.
+//! \param ulNack is 1 for the last byte of a read, 0 if another follows.
+//!
+//! \return xtrue on success.
+//
+//*****************************************************************************
+static xtBoolean
+SoftI2CAckFlush(tSoftI2C *psBus, unsigned long ulNack)
+{
+    if(psBus->ucState != SOFT_I2C_ACK_PENDING)
+    {
+        return xtrue;
+    }
+
+    psBus->ucState = SOFT_I2C_OWNED;
+
+    return SoftI2CBitWrite(psBus, ulNack);
+}
+
+//*****************************************************************************
+//
+//! \brief Send a START, or a repeated START if the bus is ours, and the
+//! slave address.
+//!
+//! \param psBus is the bus.
+//! \param ucAddr is the address byte, the 7-bit address and the R/W bit.
+//!
+//! \return xtrue if the address was acknowledged.
+//
+//*****************************************************************************
+static xtBoolean
+SoftI2CStart(tSoftI2C *psBus, unsigned char ucAddr)
+{
+    psBus->ucError = SOFT_I2C_MASTER_ERR_NONE;
+
+    if(psBus->ucState == SOFT_I2C_IDLE)
+    {
+        //
+        // The bus free time after the last STOP.
+        //
+        SoftI2CWait(psBus, psBus->ulLow);
+        if(!SoftI2CPortSCLGet(psBus) || !SoftI2CPortSDAGet(psBus))
+        {
+            psBus->ucError = SOFT_I2C_MASTER_ERR_ARB_LOST;
+            return xfalse;
+        }
+    }
+    else
+    {
+        if(!SoftI2CAckFlush(psBus, 1))
+        {
+            return xfalse;
+        }
+        SoftI2CPortSDA(psBus, 1);
+        SoftI2CWait(psBus, psBus->ulLow);
+        if(!SoftI2CClockRelease(psBus))
+        {
+            return xfalse;
+        }
+        SoftI2CWait(psBus, psBus->ulHigh);
+    }
+
+    //
+    // SDA falls while SCL is high.
+    //
+    SoftI2CPortSDA(psBus, 0);
+    psBus->ucState = SOFT_I2C_OWNED;
+    SoftI2CWait(psBus, psBus->ulHigh);
+    SoftI2CPortSCL(psBus, 0);
+
+    return SoftI2CByteWrite(psBus, ucAddr, SOFT_I2C_MASTER_ERR_ADDR_ACK);
+}
+
+//*****************************************************************************
+//
+//! \brief Bind a bus state to its pins.
+//!
+//! \param psBus is the bus.
+//! \param ulSCLPort is the GPIO port base of SCL.
+//! \param ulSCLPin is the GPIO pin mask of SCL.
+//! \param ulSDAPort is the GPIO port base of SDA.
+//! \param ulSDAPin is the GPIO pin mask of SDA.
+//!
+//! The pins are usually given with xGPIOSPinToPort() and xGPIOSPinToPin().
+//! Both lines need pull-up resistors. Call SoftI2CMasterInit() next.
+//!
+//! \return None.
+//
+//*****************************************************************************
+void
+SoftI2CBusInit(tSoftI2C *psBus, unsigned long ulSCLPort,
+               unsigned long ulSCLPin, unsigned long ulSDAPort,
+               unsigned long ulSDAPin)
+{
+    xASSERT(psBus != 0);
+
+    psBus->ulSCLPort = ulSCLPort;
+    psBus->ulSCLPin = ulSCLPin;
+    psBus->ulSDAPort = ulSDAPort;
+    psBus->ulSDAPin = ulSDAPin;
+    psBus->ucState = SOFT_I2C_IDLE;
+    psBus->ucError = SOFT_I2C_MASTER_ERR_NONE;
+}
+
+//*****************************************************************************
+//
+//! \brief Set up the pins and the bit rate of a software I2C master.
+//!
+//! \param ulBase is the address of the tSoftI2C.
+//! \param ulI2CClk is the bit rate in Hz, at most 400000.
+//!
+//! The SCL times are computed from the timebase frequency, rounded so the
+//! bit rate is not above \e ulI2CClk. In fast mode 3/5 of a bit is low
+//! time. Call it again after the system clock changes.
+//!
+//! A slave left in the middle of a read after a reset may hold SDA low. It
+//! is clocked until it releases SDA, then a STOP is sent.
+//!
+//! \return None.
+//
+//*****************************************************************************
+void
+SoftI2CMasterInit(unsigned long ulBase, unsigned long ulI2CClk)
+{
+    tSoftI2C *psBus = (tSoftI2C *)ulBase;
+    unsigned long ulFreq;
+    unsigned long ulBit;
+    unsigned long i;
+
+    xASSERT(psBus != 0);
+    xASSERT((ulI2CClk != 0) && (ulI2CClk <= 400000));
+
+    ulFreq = SoftI2CPortInit(psBus);
+
+    ulBit = (ulFreq + ulI2CClk - 1) / ulI2CClk;
+    if(ulBit < 2)
+    {
+        ulBit = 2;
+    }
+    if(ulI2CClk > SOFT_I2C_STANDARD_MAX)
+    {
+        psBus->ulHigh = ulBit * 2 / 5;
+    }
+    else
+    {
+        psBus->ulHigh = ulBit / 2;
+    }
+    psBus->ulLow = ulBit - psBus->ulHigh;
+    psBus->ulStretch = (ulFreq / 1000) * SOFT_I2C_STRETCH_US / 1000;
+    psBus->ucState = SOFT_I2C_IDLE;
+    psBus->ucError = SOFT_I2C_MASTER_ERR_NONE;
+    SoftI2CPortTickElapsed(&psBus->ulMark);
+
+    //
+    // Free a bus left in a transfer.
+    //
+    for(i = 0; (i < 9) && !SoftI2CPortSDAGet(psBus); i++)
+    {
+        SoftI2CPortSCL(psBus, 0);
+        SoftI2CWait(psBus, psBus->ulLow);
+        if(!SoftI2CClockRelease(psBus))
+        {
+            return;
+        }
+        SoftI2CWait(psBus, psBus->ulHigh);
+    }
+    if(i != 0)
+    {
+        SoftI2CPortSCL(psBus, 0);
+        psBus->ucState = SOFT_I2C_OWNED;
+        SoftI2CMasterStop(ulBase);
+    }
+}
+
+//*****************************************************************************
+//
+//! \brief Check if the bus is in use.
+//!
+//! \param ulBase is the address of the tSoftI2C.
+//!
+//! \return xtrue if this master is in a transfer or a line is held low.
+//
+//*****************************************************************************
+xtBoolean
+SoftI2CMasterBusBusy(unsigned long ulBase)
+{
+    tSoftI2C *psBus = (tSoftI2C *)ulBase;
+
+    xASSERT(psBus != 0);
+
+    return ((psBus->ucState != SOFT_I2C_IDLE) ||
+            !SoftI2CPortSCLGet(psBus) || !SoftI2CPortSDAGet(psBus));
+}
+
+//*****************************************************************************
+//
+//! \brief Get the error of the last transfer.
+//!
+//! \param ulBase is the address of the tSoftI2C.
+//!
+//! \return One of the values in \ref SoftI2C_Master_Error.
+//
+//*****************************************************************************
+unsigned long
+SoftI2CMasterError(unsigned long ulBase)
+{
+    tSoftI2C *psBus = (tSoftI2C *)ulBase;
+
+    xASSERT(psBus != 0);
+
+    return psBus->ucError;
+}
+
+//*****************************************************************************
+//
+//! \brief Send a STOP and release the bus.
+//!
+//! \param ulBase is the address of the tSoftI2C.
+//!
+//! After a read the last byte is not acknowledged first, so the slave stops
+//! driving SDA.
+//!
+//! \return None.
+//
+//*****************************************************************************
+void
+SoftI2CMasterStop(unsigned long ulBase)
+{
+    tSoftI2C *psBus = (tSoftI2C *)ulBase;
+
+    xASSERT(psBus != 0);
+
+    if(psBus->ucState == SOFT_I2C_IDLE)
+    {
+        return;
+    }
+    if(!SoftI2CAckFlush(psBus, 1))
+    {
+        return;
+    }
+
+    //
+    // SDA rises while SCL is high.
+    //
+    SoftI2CPortSDA(psBus, 0);
+    SoftI2CWait(psBus, psBus->ulLow);
+    psBus->ucState = SOFT_I2C_IDLE;
+    if(!SoftI2CClockRelease(psBus))
+    {
+        return;
+    }
+    SoftI2CWait(psBus, psBus->ulHigh);
+    SoftI2CPortSDA(psBus, 1);
+}
+
+//*****************************************************************************
+//
+//! \brief Write a byte to a slave.(Write Step1)
+//!
+//! \param ulBase is the address of the tSoftI2C.
+//! \param ucSlaveAddr is the 7-bit slave address.
+//! \param ucData is the byte to transmit.
+//! \param bEndTransmition is xtrue to send a STOP after the byte.
+//!
+//! Sends a START, or a repeated START if the bus was kept by the last call,
+//! the slave address and the byte. Continue with SoftI2CMasterWriteS2(), or
+//! with a read step for a repeated START.
+//!
+//! \return Returns the master error status.
+//
+//*****************************************************************************
+unsigned long
+SoftI2CMasterWriteS1(unsigned long ulBase, unsigned char ucSlaveAddr,
+                     unsigned char ucData, xtBoolean bEndTransmition)
+{
+    tSoftI2C *psBus = (tSoftI2C *)ulBase;
+
+    xASSERT(psBus != 0);
+    xASSERT(ucSlaveAddr < 128);
+
+    if(!SoftI2CStart(psBus, ucSlaveAddr << 1))
+    {
+        return psBus->ucError;
+    }
+
+    return SoftI2CMasterWriteS2(ulBase, ucData, bEndTransmition);
+}
+
+//*****************************************************************************
+//
+//! \brief Write a byte to the slave of the current transfer.(Write Step2)
+//!
+//! \param ulBase is the address of the tSoftI2C.
+//! \param ucData is the byte to transmit.
+//! \param bEndTransmition is xtrue to send a STOP after the byte.
+//!
+//! \return Returns the master error status.
+//
+//*****************************************************************************
+unsigned long
+SoftI2CMasterWriteS2(unsigned long ulBase, unsigned char ucData,
+                     xtBoolean bEndTransmition)
+{
+    tSoftI2C *psBus = (tSoftI2C *)ulBase;
+
+    xASSERT(psBus != 0);
+    xASSERT(psBus->ucState == SOFT_I2C_OWNED);
+
+    if(!SoftI2CByteWrite(psBus, ucData, SOFT_I2C_MASTER_ERR_DATA_ACK))
+    {
+        return psBus->ucError;
+    }
+    if(bEndTransmition)
+    {
+        SoftI2CMasterStop(ulBase);
+    }
+
+    return psBus->ucError;
+}
+
+//*****************************************************************************
+//
+//! \brief Write a block to a slave.(Write Buffer Step1)
+//!
+//! \param ulBase is the address of the tSoftI2C.
+//! \param ucSlaveAddr is the 7-bit slave address.
+//! \param pucDataBuf is the data to transmit.
+//! \param ulLen is the number of bytes.
+//! \param bEndTransmition is xtrue to send a STOP after the last byte.
+//!
+//! The bytes go out in one burst after the address. The transfer stops at
+//! the first byte that is not acknowledged.
+//!
+//! \return Returns the number of bytes acknowledged.
+//
+//*****************************************************************************
+unsigned long
+SoftI2CMasterWriteBufS1(unsigned long ulBase, unsigned char ucSlaveAddr,
+                        const unsigned char *pucDataBuf, unsigned long ulLen,
+                        xtBoolean bEndTransmition)
+{
+    tSoftI2C *psBus = (tSoftI2C *)ulBase;
+
+    xASSERT(psBus != 0);
+    xASSERT(ucSlaveAddr < 128);
+
+    if(!SoftI2CStart(psBus, ucSlaveAddr << 1))
+    {
+        return 0;
+    }
+
+    return SoftI2CMasterWriteBufS2(ulBase, pucDataBuf, ulLen,
+                                   bEndTransmition);
+}
+
+//*****************************************************************************
+//
+//! \brief Write a block to the slave of the current transfer.(Write Buffer
+//! Step2)
+//!
+//! \param ulBase is the address of the tSoftI2C.
+//! \param pucDataBuf is the data to transmit.
+//! \param ulLen is the number of bytes.
+//! \param bEndTransmition is xtrue to send a STOP after the last byte.
+//!
+//! \return Returns the number of bytes acknowledged.
+//
+//*****************************************************************************
+unsigned long
+SoftI2CMasterWriteBufS2(unsigned long ulBase, const unsigned char *pucDataBuf,
+                        unsigned long ulLen, xtBoolean bEndTransmition)
+{
+    tSoftI2C *psBus = (tSoftI2C *)ulBase;
+    unsigned long i;
+
+    xASSERT(psBus != 0);
+    xASSERT(psBus->ucState == SOFT_I2C_OWNED);
+    xASSERT((pucDataBuf != 0) || (ulLen == 0));
+
+    for(i = 0; i < ulLen; i++)
+    {
+        if(!SoftI2CByteWrite(psBus, pucDataBuf[i],
+                             SOFT_I2C_MASTER_ERR_DATA_ACK))
+        {
+            return i;
+        }
+    }
+    if(bEndTransmition)
+    {
+        SoftI2CMasterStop(ulBase);
+    }
+
+    return i;
+}
+
+//*****************************************************************************
+//
+//! \brief Read a byte from a slave.(Read Step1)
+//!
+//! \param ulBase is the address of the tSoftI2C.
+//! \param ucSlaveAddr is the 7-bit slave address.
+//! \param pucData is where to store the byte.
+//! \param bEndTransmition is xtrue if this is the last byte, it is not
+//! acknowledged and a STOP follows.
+//!
+//! Sends a START, or a repeated START after a write step that kept the bus,
+//! the slave address and reads a byte. Continue with SoftI2CMasterReadS2().
+//!
+//! \return Returns the master error status.
+//
+//*****************************************************************************
+unsigned long
+SoftI2CMasterReadS1(unsigned long ulBase, unsigned char ucSlaveAddr,
+                    unsigned char *pucData, xtBoolean bEndTransmition)
+{
+    tSoftI2C *psBus = (tSoftI2C *)ulBase;
+
+    xASSERT(psBus != 0);
+    xASSERT(ucSlaveAddr < 128);
+
+    if(!SoftI2CStart(psBus, (ucSlaveAddr << 1) | 1))
+    {
+        return psBus->ucError;
+    }
+
+    return SoftI2CMasterReadS2(ulBase, pucData, bEndTransmition);
+}
+
+//*****************************************************************************
+//
+//! \brief Read a byte from the slave of the current transfer.(Read Step2)
+//!
+//! \param ulBase is the address of the tSoftI2C.
+//! \param pucData is where to store the byte.
+//! \param bEndTransmition is xtrue if this is the last byte.
+//!
+//! \return Returns the master error status.
+//
+//*****************************************************************************
+unsigned long
+SoftI2CMasterReadS2(unsigned long ulBase, unsigned char *pucData,
+                    xtBoolean bEndTransmition)
+{
+    return SoftI2CMasterReadBufS2(ulBase, pucData, 1, bEndTransmition) ?
+           SOFT_I2C_MASTER_ERR_NONE : ((tSoftI2C *)ulBase)->ucError;
+}
+
+//*****************************************************************************
+//
+//! \brief Read a block from a slave.(Read Buffer Step1)
+//!
+//! \param ulBase is the address of the tSoftI2C.
+//! \param ucSlaveAddr is the 7-bit slave address.
+//! \param pucDataBuf is where to store the data.
+//! \param ulLen is the number of bytes.
+//! \param bEndTransmition is xtrue if the block ends the read, the last byte
+//! is not acknowledged and a STOP follows.
+//!
+//! \return Returns the number of bytes received.
+//
+//*****************************************************************************
+unsigned long
+SoftI2CMasterReadBufS1(unsigned long ulBase, unsigned char ucSlaveAddr,
+                       unsigned char *pucDataBuf, unsigned long ulLen,
+                       xtBoolean bEndTransmition)
+{
+    tSoftI2C *psBus = (tSoftI2C *)ulBase;
+
+    xASSERT(psBus != 0);
+    xASSERT(ucSlaveAddr < 128);
+
+    if(!SoftI2CStart(psBus, (ucSlaveAddr << 1) | 1))
+    {
+        return 0;
+    }
+
+    return SoftI2CMasterReadBufS2(ulBase, pucDataBuf, ulLen,
+                                  bEndTransmition);
+}
+
+//*****************************************************************************
+//
+//! \brief Read a block from the slave of the current transfer.(Read Buffer
+//! Step2)
+//!
+//! \param ulBase is the address of the tSoftI2C.
+//! \param pucDataBuf is where to store the data.
+//! \param ulLen is the number of bytes.
+//! \param bEndTransmition is xtrue if the block ends the read.
+//!
+//! The ACK bit of each byte is sent when the next byte is read, so a read
+//! without \e bEndTransmition can be continued or ended with
+//! SoftI2CMasterStop() or a repeated START.
+//!
+//! \return Returns the number of bytes received.
+//
+//*****************************************************************************
+unsigned long
+SoftI2CMasterReadBufS2(unsigned long ulBase, unsigned char *pucDataBuf,
+                       unsigned long ulLen, xtBoolean bEndTransmition)
+{
+    tSoftI2C *psBus = (tSoftI2C *)ulBase;
+    unsigned long ulBit;
+    unsigned long i, j;
+    unsigned char ucData;
+
+    xASSERT(psBus != 0);
+    xASSERT(psBus->ucState != SOFT_I2C_IDLE);
+    xASSERT((pucDataBuf != 0) || (ulLen == 0));
+
+    for(i = 0; i < ulLen; i++)
+    {
+        if(!SoftI2CAckFlush(psBus, 0))
+        {
+            return i;
+        }
+
+        ucData = 0;
+        for(j = 0; j < 8; j++)
+        {
+            if(!SoftI2CBitRead(psBus, &ulBit))
+            {
+                return i;
+            }
+            ucData = (ucData << 1) | (ulBit ? 1 : 0);
+        }
+        pucDataBuf[i] = ucData;
+        psBus->ucState = SOFT_I2C_ACK_PENDING;
+    }
+    if(bEndTransmition)
+    {
+        SoftI2CMasterStop(ulBase);
+    }
+
+    return i;
+}
@@ -0,0 +1,311 @@
+//*****************************************************************************
+//
+//! \file SoftI2C.h
+//! \brief Prototypes for the software I2C master engine.
+//! \version V2.2.1.0
+//! \date 10/19/2026
+//! \author CooCox
+//! \copy
+//!
+//! Copyright (c)  2013, CooCox
+//! All rights reserved.
+//!
+//! Redistribution and use in source and binary forms, with or without
+//! modification, are permitted provided that the following conditions
+//! are met:
+//!
+//!     * Redistributions of source code must retain the above copyright
+//! notice, this list of conditions and the following disclaimer.
+//!     * Redistributions in binary form must reproduce the above copyright
+//! notice, this list of conditions and the following disclaimer in the
+//! documentation and/or other materials provided with the distribution.
+//!     * Neither the name of the <ORGANIZATION> nor the names of its
+//! contributors may be used to endorse or promote products derived
+//! from this software without specific prior written permission.
+//!
+//! THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+//! AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+//! IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+//! ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+//! LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+//! CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+//! SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+//! INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//! CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+//! ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+//! THE POSSIBILITY OF SUCH DAMAGE.
+//
+//*****************************************************************************
+#ifndef __SOFTI2C_H__
+#define __SOFTI2C_H__
+
+//*****************************************************************************
+//
+// If building with a C++ compiler, make all of the definitions in this header
+// have a C binding.
+//
+//*****************************************************************************
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+//*****************************************************************************
+//
+//! \addtogroup CoX_Driver_Lib
+//! @{
+//
+//! \addtogroup I2C_Bus
+//! @{
+//
+//! \addtogroup SoftI2C
+//! \brief An I2C master on two open drain GPIO pins. The lines are driven with
+//! the atomic set/reset registers, and each half bit waits on the SysTick
+//! counter from the previous edge instead of running a fixed delay loop, so
+//! the bit rate follows the clock the bus was set up with and does not
+//! change with the compiler or the code between the edges. A slave that
+//! holds SCL low is waited for, up to a timeout.
+//!
+//! The transfer calls take the same arguments and follow the same S1/S2
+//! steps as the xI2CMaster ones, with the address of a tSoftI2C in place of
+//! the I2C base address. A driver can therefore select the hardware or the
+//! software bus with one define.
+//! @{
+//
+//*****************************************************************************
+
+//*****************************************************************************
+//! \addtogroup SoftI2C_User_Config
+//! @{
+//
+//*****************************************************************************
+
+//
+//! Longest time in us a slave may hold SCL low before the transfer is given
+//! up with SOFT_I2C_MASTER_ERR_TIMEOUT.
+//
+#define SOFT_I2C_STRETCH_US        10000
+
+//
+//! Define this to build the engine without its GPIO and timebase functions,
+//! which are then given by the application (e.g. a simulated bus).
+//
+//#define SOFT_I2C_PORT_EXTERNAL
+
+//*****************************************************************************
+//
+//! @}
+//
+//*****************************************************************************
+
+//*****************************************************************************
+//! \addtogroup SoftI2C_Master_Error SoftI2C Master Error
+//! \brief Values returned by SoftI2CMasterError(). They are the values of
+//! the STM32F1xx xI2C_MASTER_ERR_*, so driver code checks either bus alike.
+//! @{
+//
+//*****************************************************************************
+
+//
+//! No error.
+//
+#define SOFT_I2C_MASTER_ERR_NONE   0
+
+//
+//! The slave address was not acknowledged.
+//
+#define SOFT_I2C_MASTER_ERR_ADDR_ACK                                          \
+                                   0x00000004
+
+//
+//! A data byte was not acknowledged.
+//
+#define SOFT_I2C_MASTER_ERR_DATA_ACK                                          \
+                                   0x00000008
+
+//
+//! Another master drove SDA low while this one released it.
+//
+#define SOFT_I2C_MASTER_ERR_ARB_LOST                                          \
+                                   0x00000010
+
+//
+//! A slave held SCL low longer than SOFT_I2C_STRETCH_US.
+//
+#define SOFT_I2C_MASTER_ERR_TIMEOUT                                           \
+                                   0x00000020
+
+//*****************************************************************************
+//
+//! @}
+//
+//*****************************************************************************
+
+//*****************************************************************************
+//! \addtogroup SoftI2C_Types
+//! @{
+//
+//*****************************************************************************
+
+//
+//! Bus state. Set up with SoftI2CBusInit() and SoftI2CMasterInit(), then pass
+//! its address as \e ulBase of the transfer calls.
+//
+typedef struct
+{
+    //
+    //! GPIO port base and pin mask of SCL.
+    //
+    unsigned long ulSCLPort;
+    unsigned long ulSCLPin;
+
+    //
+    //! GPIO port base and pin mask of SDA.
+    //
+    unsigned long ulSDAPort;
+    unsigned long ulSDAPin;
+
+    //
+    //! SCL low and high time and the clock stretch timeout, in timebase
+    //! ticks.
+    //
+    unsigned long ulLow;
+    unsigned long ulHigh;
+    unsigned long ulStretch;
+
+    //
+    //! Timebase value at the last SCL edge.
+    //
+    unsigned long ulMark;
+
+    //
+    //! Transfer state and the error of the last transfer.
+    //
+    unsigned char ucState;
+    unsigned char ucError;
+}
+tSoftI2C;
+
+//*****************************************************************************
+//
+//! @}
+//
+//*****************************************************************************
+
+//*****************************************************************************
+//! \addtogroup SoftI2C_Export_APIs
+//! @{
+//
+//*****************************************************************************
+extern void SoftI2CBusInit(tSoftI2C *psBus, unsigned long ulSCLPort,
+                           unsigned long ulSCLPin, unsigned long ulSDAPort,
+                           unsigned long ulSDAPin);
+extern void SoftI2CMasterInit(unsigned long ulBase, unsigned long ulI2CClk);
+extern xtBoolean SoftI2CMasterBusBusy(unsigned long ulBase);
+extern unsigned long SoftI2CMasterError(unsigned long ulBase);
+extern void SoftI2CMasterStop(unsigned long ulBase);
+extern unsigned long SoftI2CMasterWriteS1(unsigned long ulBase,
+                                          unsigned char ucSlaveAddr,
+                                          unsigned char ucData,
+                                          xtBoolean bEndTransmition);
+extern unsigned long SoftI2CMasterWriteS2(unsigned long ulBase,
+                                          unsigned char ucData,
+                                          xtBoolean bEndTransmition);
+extern unsigned long SoftI2CMasterWriteBufS1(unsigned long ulBase,
+                                             unsigned char ucSlaveAddr,
+                                             const unsigned char *pucDataBuf,
+                                             unsigned long ulLen,
+                                             xtBoolean bEndTransmition);
+extern unsigned long SoftI2CMasterWriteBufS2(unsigned long ulBase,
+                                             const unsigned char *pucDataBuf,
+                                             unsigned long ulLen,
+                                             xtBoolean bEndTransmition);
+extern unsigned long SoftI2CMasterReadS1(unsigned long ulBase,
+                                         unsigned char ucSlaveAddr,
+                                         unsigned char *pucData,
+                                         xtBoolean bEndTransmition);
+extern unsigned long SoftI2CMasterReadS2(unsigned long ulBase,
+                                         unsigned char *pucData,
+                                         xtBoolean bEndTransmition);
+extern unsigned long SoftI2CMasterReadBufS1(unsigned long ulBase,
+                                            unsigned char ucSlaveAddr,
+                                            unsigned char *pucDataBuf,
+                                            unsigned long ulLen,
+                                            xtBoolean bEndTransmition);
+extern unsigned long SoftI2CMasterReadBufS2(unsigned long ulBase,
+                                            unsigned char *pucDataBuf,
+                                            unsigned long ulLen,
+                                            xtBoolean bEndTransmition);
+
+//
+//! The software bus has no transfer in the background, the request calls
+//! return when the byte is on the bus.
+//
+#define SoftI2CMasterWriteRequestS1(ulBase, ucSlaveAddr, ucData,              \
+                                    bEndTransmition)                          \
+        SoftI2CMasterWriteS1(ulBase, ucSlaveAddr, ucData, bEndTransmition)
+
+#define SoftI2CMasterWriteRequestS2(ulBase, ucData, bEndTransmition)          \
+        SoftI2CMasterWriteS2(ulBase, ucData, bEndTransmition)
+
+//*****************************************************************************
+//
+//! @}
+//
+//*****************************************************************************
+
+//*****************************************************************************
+//! \addtogroup SoftI2C_Port_APIs
+//! \brief Pin and timebase access of the engine. Given by SoftI2C.c unless
+//! SOFT_I2C_PORT_EXTERNAL is defined.
+//! @{
+//
+//*****************************************************************************
+
+//
+//! Drive a line low (0) or release it (1).
+//
+extern void SoftI2CPortSCL(tSoftI2C *psBus, unsigned long ulLevel);
+extern void SoftI2CPortSDA(tSoftI2C *psBus, unsigned long ulLevel);
+
+//
+//! Read the level of a line.
+//
+extern unsigned long SoftI2CPortSCLGet(tSoftI2C *psBus);
+extern unsigned long SoftI2CPortSDAGet(tSoftI2C *psBus);
+
+//
+//! Set both pins to open drain and release them, start the timebase if
+//! needed and return its frequency in Hz.
+//
+extern unsigned long SoftI2CPortInit(tSoftI2C *psBus);
+
+//
+//! Return the ticks since *pulMark and set *pulMark to now.
+//
+extern unsigned long SoftI2CPortTickElapsed(unsigned long *pulMark);
+
+//*****************************************************************************
+//
+//! @}
+//
+//*****************************************************************************
+
+//*****************************************************************************
+//
+//! @}
+//! @}
+//! @}
+//
+//*****************************************************************************
+
+//*****************************************************************************
+//
+// Mark the end of the C bindings section for C++ compilers.
+//
+//*****************************************************************************
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,432 @@
+//*****************************************************************************
+//
+//! \file SoftI2CFake.c
+//! \brief Simulated bus and EEPROM for the port functions of SoftI2C.c.
+//! \version V2.2.1.0
+//! \date 10/19/2026
+//! \author CooCox
+//! \copy
+//!
+//! Copyright (c)  2013, CooCox
+//! All rights reserved.
+//!
+//! Both lines are the wired AND of the master and the slave. The slave is a
+//! 24C02 class EEPROM with an 8-bit word address. It decodes the edges of
+//! the lines, can hold SCL low after each ACK bit, and records the shortest
+//! SCL low and high time. Build SoftI2C.c with SOFT_I2C_PORT_EXTERNAL to
+//! use it.
+//
+//*****************************************************************************
+
+#include <string.h>
+#include "xhw_types.h"
+#include "SoftI2C.h"
+#include "SoftI2CFake.h"
+
+//
+// Slave modes.
+//
+#define FAKE_IDLE               0
+#define FAKE_ADDR               1
+#define FAKE_WORD               2
+#define FAKE_WRITE              3
+#define FAKE_READ               4
+
+static unsigned char ucMem[256];
+static unsigned char ucPtr;
+
+static unsigned char ucMode;
+static unsigned char ucNext;
+static unsigned char ucBit;
+static unsigned char ucShift;
+static unsigned char ucAcked;
+
+static unsigned char ucMasterSCL;
+static unsigned char ucMasterSDA;
+static unsigned char ucSlaveSCL;
+static unsigned char ucSlaveSDA;
+static unsigned char ucHoldSDA;
+static unsigned char ucBusSCL;
+static unsigned char ucBusSDA;
+
+static unsigned long ulStretchCfg;
+static unsigned long ulStretchLeft;
+
+static unsigned long ulNow;
+static unsigned long ulEdge;
+static unsigned long ulMinLow;
+static unsigned long ulMinHigh;
+static unsigned long ulStarts;
+static unsigned long ulStops;
+
+//*****************************************************************************
+//
+//! \brief SCL fell after clock \e ucBit of a byte, shift the slave side of
+//! the next bit.
+//!
+//! \return None.
+//
+//*****************************************************************************
+static void
+FakeClockFall(void)
+{
+    if(ucBit == 0)
+    {
+        return;
+    }
+
+    if(ucMode == FAKE_READ)
+    {
+        if(ucBit < 8)
+        {
+            ucSlaveSDA = (ucShift >> (7 - ucBit)) & 1;
+        }
+        else if(ucBit == 8)
+        {
+            ucSlaveSDA = 1;
+        }
+        else
+        {
+            ucBit = 0;
+            if(ucAcked)
+            {
+                ucShift = ucMem[ucPtr++];
+                ucSlaveSDA = (ucShift >> 7) & 1;
+            }
+            else
+            {
+                ucMode = FAKE_IDLE;
+            }
+        }
+    }
+    else if(ucMode != FAKE_IDLE)
+    {
+        if(ucBit == 8)
+        {
+            ucNext = ucMode;
+            if(ucMode == FAKE_ADDR)
+            {
+                if((ucShift >> 1) != SOFT_I2C_FAKE_ADDR)
+                {
+                    ucMode = FAKE_IDLE;
+                    return;
+                }
+                ucNext = (ucShift & 1) ? FAKE_READ : FAKE_WORD;
+            }
+            else if(ucMode == FAKE_WORD)
+            {
+                ucPtr = ucShift;
+                ucNext = FAKE_WRITE;
+            }
+            else
+            {
+                ucMem[ucPtr++] = ucShift;
+            }
+            ucSlaveSDA = 0;
+            return;
+        }
+        else if(ucBit == 9)
+        {
+            ucBit = 0;
+            ucSlaveSDA = 1;
+            ucMode = ucNext;
+            if(ucMode == FAKE_READ)
+            {
+                ucShift = ucMem[ucPtr++];
+                ucSlaveSDA = (ucShift >> 7) & 1;
+            }
+        }
+        else
+        {
+            return;
+        }
+    }
+    else
+    {
+        return;
+    }
+
+    //
+    // Hold SCL after each ACK bit.
+    //
+    if((ucBit == 0) && (ulStretchCfg != 0))
+    {
+        ulStretchLeft = ulStretchCfg;
+        ucSlaveSCL = 0;
+    }
+}
+
+//*****************************************************************************
+//
+//! \brief Work out the bus levels and run the slave on their edges.
+//!
+//! \return None.
+//
+//*****************************************************************************
+static void
+FakeBus(void)
+{
+    unsigned char ucSCL, ucSDA;
+
+    //
+    // The slave may change SDA on an SCL edge, so settle first.
+    //
+    while(1)
+    {
+        ucSCL = ucMasterSCL & ucSlaveSCL;
+        ucSDA = ucMasterSDA & ucSlaveSDA & !ucHoldSDA;
+        if((ucSCL == ucBusSCL) && (ucSDA == ucBusSDA))
+        {
+            return;
+        }
+
+        if(ucSCL != ucBusSCL)
+        {
+            if(ucSCL)
+            {
+                if(ulNow - ulEdge < ulMinLow)
+                {
+                    ulMinLow = ulNow - ulEdge;
+                }
+                ucBit++;
+                if(ucMode == FAKE_READ)
+                {
+                    ucAcked = (ucBit == 9) && !ucSDA;
+                }
+                else if(ucBit <= 8)
+                {
+                    ucShift = (ucShift << 1) | ucSDA;
+                }
+            }
+            else
+            {
+                if(ulNow - ulEdge < ulMinHigh)
+                {
+                    ulMinHigh = ulNow - ulEdge;
+                }
+            }
+            ulEdge = ulNow;
+            ucBusSCL = ucSCL;
+            if(!ucSCL)
+            {
+                FakeClockFall();
+            }
+            continue;
+        }
+
+        ucBusSDA = ucSDA;
+        if(ucSCL)
+        {
+            if(!ucSDA)
+            {
+                ulStarts++;
+                ucMode = FAKE_ADDR;
+                ucBit = 0;
+                ucShift = 0;
+            }
+            else
+            {
+                ulStops++;
+                ucMode = FAKE_IDLE;
+            }
+            ucSlaveSDA = 1;
+        }
+    }
+}
+
+//*****************************************************************************
+//
+//! \brief Clear the slave, the memory and the counters.
+//!
+//! \return None.
+//
+//*****************************************************************************
+void
+SoftI2CFakeReset(void)
+{
+    memset(ucMem, 0xFF, sizeof(ucMem));
+    ucPtr = 0;
+    ucMode = FAKE_IDLE;
+    ucMasterSCL = 1;
+    ucMasterSDA = 1;
+    ucSlaveSCL = 1;
+    ucSlaveSDA = 1;
+    ucHoldSDA = 0;
+    ucBusSCL = 1;
+    ucBusSDA = 1;
+    ulStretchCfg = 0;
+    ulStretchLeft = 0;
+    ulStarts = 0;
+    ulStops = 0;
+    ulMinLow = 0xFFFFFFFF;
+    ulMinHigh = 0xFFFFFFFF;
+}
+
+//*****************************************************************************
+//
+//! \brief Set how many SCL reads the slave holds SCL low after an ACK bit.
+//!
+//! \param ulPolls is the number of reads, 0 for none or
+//! SOFT_I2C_FAKE_STUCK.
+//!
+//! \return None.
+//
+//*****************************************************************************
+void
+SoftI2CFakeStretch(unsigned long ulPolls)
+{
+    ulStretchCfg = ulPolls;
+    if(ulPolls == 0)
+    {
+        ulStretchLeft = 0;
+        ucSlaveSCL = 1;
+        FakeBus();
+    }
+}
+
+//*****************************************************************************
+//
+//! \brief Let another device hold SDA low.
+//!
+//! \param ulHold is non-zero to hold SDA.
+//!
+//! \return None.
+//
+//*****************************************************************************
+void
+SoftI2CFakeSDAHold(unsigned long ulHold)
+{
+    ucHoldSDA = (ulHold != 0);
+    FakeBus();
+}
+
+//*****************************************************************************
+//
+//! \brief Get the EEPROM memory.
+//!
+//! \return The 256 bytes of the memory.
+//
+//*****************************************************************************
+unsigned char *
+SoftI2CFakeMemory(void)
+{
+    return ucMem;
+}
+
+//*****************************************************************************
+//
+//! \brief Get the number of START and repeated START conditions.
+//!
+//! \return The count.
+//
+//*****************************************************************************
+unsigned long
+SoftI2CFakeStarts(void)
+{
+    return ulStarts;
+}
+
+//*****************************************************************************
+//
+//! \brief Get the number of STOP conditions.
+//!
+//! \return The count.
+//
+//*****************************************************************************
+unsigned long
+SoftI2CFakeStops(void)
+{
+    return ulStops;
+}
+
+//*****************************************************************************
+//
+//! \brief Get the shortest SCL low time and clear it.
+//!
+//! \return The time in ticks.
+//
+//*****************************************************************************
+unsigned long
+SoftI2CFakeMinLow(void)
+{
+    unsigned long ulMin = ulMinLow;
+
+    ulMinLow = 0xFFFFFFFF;
+    return ulMin;
+}
+
+//*****************************************************************************
+//
+//! \brief Get the shortest SCL high time and clear it.
+//!
+//! \return The time in ticks.
+//
+//*****************************************************************************
+unsigned long
+SoftI2CFakeMinHigh(void)
+{
+    unsigned long ulMin = ulMinHigh;
+
+    ulMinHigh = 0xFFFFFFFF;
+    return ulMin;
+}
+
+//*****************************************************************************
+//
+// Port functions of SoftI2C.c.
+//
+//*****************************************************************************
+unsigned long
+SoftI2CPortInit(tSoftI2C *psBus)
+{
+    ucMasterSCL = 1;
+    ucMasterSDA = 1;
+    FakeBus();
+
+    return SOFT_I2C_FAKE_FREQ;
+}
+
+void
+SoftI2CPortSCL(tSoftI2C *psBus, unsigned long ulLevel)
+{
+    ucMasterSCL = (ulLevel != 0);
+    FakeBus();
+}
+
+void
+SoftI2CPortSDA(tSoftI2C *psBus, unsigned long ulLevel)
+{
+    ucMasterSDA = (ulLevel != 0);
+    FakeBus();
+}
+
+unsigned long
+SoftI2CPortSCLGet(tSoftI2C *psBus)
+{
+    if(!ucSlaveSCL && (ulStretchLeft != SOFT_I2C_FAKE_STUCK) &&
+       (--ulStretchLeft == 0))
+    {
+        ucSlaveSCL = 1;
+        FakeBus();
+    }
+
+    return ucBusSCL;
+}
+
+unsigned long
+SoftI2CPortSDAGet(tSoftI2C *psBus)
+{
+    return ucBusSDA;
+}
+
+unsigned long
+SoftI2CPortTickElapsed(unsigned long *pulMark)
+{
+    unsigned long ulTicks;
+
+    ulNow++;
+    ulTicks = ulNow - *pulMark;
+    *pulMark = ulNow;
+
+    return ulTicks;
+}
@@ -0,0 +1,61 @@
+//*****************************************************************************
+//
+//! \file SoftI2CFake.h
+//! \brief Simulated bus and EEPROM for the port functions of SoftI2C.c.
+//! \version V2.2.1.0
+//! \date 10/19/2026
+//! \author CooCox
+//! \copy
+//!
+//! Copyright (c)  2013, CooCox
+//! All rights reserved.
+//
+//*****************************************************************************
+#ifndef __SOFTI2CFAKE_H__
+#define __SOFTI2CFAKE_H__
+
+//*****************************************************************************
+//
+// If building with a C++ compiler, make all of the definitions in this header
+// have a C binding.
+//
+//*****************************************************************************
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+//
+// 7-bit address of the simulated 24C02 class EEPROM.
+//
+#define SOFT_I2C_FAKE_ADDR         0x50
+
+//
+// Timebase frequency of the fake in Hz. A tick passes at each read of it.
+//
+#define SOFT_I2C_FAKE_FREQ         8000000
+
+//
+// Stretch value that holds SCL low for good.
+//
+#define SOFT_I2C_FAKE_STUCK        0xFFFFFFFF
+
+extern void SoftI2CFakeReset(void);
+extern void SoftI2CFakeStretch(unsigned long ulPolls);
+extern void SoftI2CFakeSDAHold(unsigned long ulHold);
+extern unsigned char *SoftI2CFakeMemory(void);
+extern unsigned long SoftI2CFakeStarts(void);
+extern unsigned long SoftI2CFakeStops(void);
+extern unsigned long SoftI2CFakeMinLow(void);
+extern unsigned long SoftI2CFakeMinHigh(void);
+
+//*****************************************************************************
+//
+// Mark the end of the C bindings section for C++ compilers.
+//
+//*****************************************************************************
+#ifdef __cplusplus
+}
+#endif
+
+#endif
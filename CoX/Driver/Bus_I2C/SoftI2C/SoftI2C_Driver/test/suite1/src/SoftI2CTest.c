@@ -0,0 +1,248 @@
+//*****************************************************************************
+//
+//! @page SoftI2C_testcase SoftI2C test
+//!
+//! File: @ref SoftI2C.c
+//!
+//! <h2>Description</h2>
+//! This module implements the test sequence for the software I2C master
+//! engine.<br><br>
+//! - \p Board: STM32 <br><br>
+//! - \p Last-Time(about): 0.1s <br><br>
+//! - \p Phenomenon: Success or failure information will be printed on the UART. <br><br>
+//! .
+//!
+//! <h2>Preconditions</h2>
+//! The module requires the following options:<br><br>
+//! - \p Option-define:
+//! <br>(1)SOFT_I2C_PORT_EXTERNAL, SoftI2C.c drives the simulated bus in
+//! SoftI2CFake.c.<br><br>
+//! - \p Option-hardware:
+//! <br>(1)None, the bus and the EEPROM are simulated.<br><br>
+//! - \p Option-OtherModule:
+//! <br>Connect an COM cable to the development board.<br>
+//! .
+//! In case some of the required options are not enabled then some or all tests
+//! may be skipped or result FAILED.<br>
+//!
+//! <h2>Test Cases</h2>
+//! The module contain those sub tests:<br><br>
+//! - \subpage test_SoftI2C_Master
+//! .
+//! \file SoftI2C.c
+//! \brief SoftI2C test source file
+//! \file SoftI2C.h
+//! \brief SoftI2C test header file <br>
+//
+//*****************************************************************************
+
+#include "test.h"
+#include "SoftI2C.h"
+#include "SoftI2CFake.h"
+
+#define SOFT_I2C_BUS            ((unsigned long)&sBus)
+
+static tSoftI2C sBus;
+static unsigned char ucData[17];
+static unsigned char ucRead[16];
+
+//*****************************************************************************
+//
+//! \brief Check the data read back against the data written.
+//!
+//! \return xtrue if the first \e ulLen bytes match.
+//
+//*****************************************************************************
+static xtBoolean SoftI2CTestMatch(unsigned long ulLen)
+{
+    unsigned long i;
+
+    for(i = 0; i < ulLen; i++)
+    {
+        if(ucRead[i] != ucData[i + 1])
+        {
+            return xfalse;
+        }
+    }
+
+    return xtrue;
+}
+
+//*****************************************************************************
+//
+//! \brief Get the Test description of SoftI2C test.
+//!
+//! \return the desccription of the SoftI2C test.
+//
+//*****************************************************************************
+static char* SoftI2CGetTest(void)
+{
+    return "SoftI2C master test";
+}
+
+//*****************************************************************************
+//
+//! \brief something should do before the test execute of SoftI2C test.
+//!
+//! \return None.
+//
+//*****************************************************************************
+static void SoftI2CSetup(void)
+{
+    unsigned long i;
+
+    SoftI2CFakeReset();
+    SoftI2CBusInit(&sBus, 0, 1, 0, 2);
+    SoftI2CMasterInit(SOFT_I2C_BUS, 100000);
+
+    ucData[0] = 0x20;
+    for(i = 1; i < sizeof(ucData); i++)
+    {
+        ucData[i] = (unsigned char)(i * 13);
+    }
+}
+
+//*****************************************************************************
+//
+//! \brief something should do after the test execute of SoftI2C test.
+//!
+//! \return None.
+//
+//*****************************************************************************
+static void SoftI2CTearDown(void)
+{
+    SoftI2CFakeStretch(0);
+    SoftI2CFakeSDAHold(0);
+}
+
+//*****************************************************************************
+//
+//! \brief SoftI2C test execute main body.
+//!
+//! \return None.
+//
+//*****************************************************************************
+static void SoftI2CExecute(void)
+{
+    unsigned char *pucMem = SoftI2CFakeMemory();
+    unsigned long ulLow, ulHigh;
+    unsigned long i;
+
+    //
+    // Burst write: word address and 16 bytes in one transfer.
+    //
+    SoftI2CFakeMinLow();
+    SoftI2CFakeMinHigh();
+    TestAssert(SoftI2CMasterWriteBufS1(SOFT_I2C_BUS, SOFT_I2C_FAKE_ADDR,
+                                       ucData, 17, xtrue) == 17,
+               "SoftI2C API \"SoftI2CMasterWriteBufS1()\"error!");
+    for(i = 0; i < 16; i++)
+    {
+        if(pucMem[0x20 + i] != ucData[i + 1])
+        {
+            break;
+        }
+    }
+    TestAssert((i == 16) && (SoftI2CFakeStarts() == 1) &&
+               (SoftI2CFakeStops() == 1) && !SoftI2CMasterBusBusy(SOFT_I2C_BUS),
+               "SoftI2C API \"SoftI2CMasterWriteBufS1()\"error!");
+
+    //
+    // 8 MHz timebase at 100 kHz: 40 ticks low and high.
+    //
+    ulLow = SoftI2CFakeMinLow();
+    ulHigh = SoftI2CFakeMinHigh();
+    TestAssert((ulLow >= 40) && (ulLow <= 42) &&
+               (ulHigh >= 40) && (ulHigh <= 42),
+               "SoftI2C API \"SoftI2CMasterInit()\"error!");
+
+    //
+    // Random read: the word address, then a repeated START to read.
+    //
+    TestAssert(SoftI2CMasterWriteS1(SOFT_I2C_BUS, SOFT_I2C_FAKE_ADDR, 0x20,
+                                    xfalse) == SOFT_I2C_MASTER_ERR_NONE,
+               "SoftI2C API \"SoftI2CMasterWriteS1()\"error!");
+    TestAssert((SoftI2CMasterReadBufS1(SOFT_I2C_BUS, SOFT_I2C_FAKE_ADDR,
+                                       ucRead, 16, xtrue) == 16) &&
+               SoftI2CTestMatch(16) && (SoftI2CFakeStarts() == 3) &&
+               (SoftI2CFakeStops() == 2),
+               "SoftI2C API \"SoftI2CMasterReadBufS1()\"error!");
+
+    //
+    // Byte steps, at fast mode with a longer low time, and a slave that
+    // holds SCL after each byte.
+    //
+    SoftI2CMasterInit(SOFT_I2C_BUS, 400000);
+    SoftI2CFakeStretch(100);
+    SoftI2CFakeMinLow();
+    SoftI2CFakeMinHigh();
+    SoftI2CMasterWriteS1(SOFT_I2C_BUS, SOFT_I2C_FAKE_ADDR, 0x20, xfalse);
+    SoftI2CMasterReadS1(SOFT_I2C_BUS, SOFT_I2C_FAKE_ADDR, &ucRead[0], xfalse);
+    SoftI2CMasterReadS2(SOFT_I2C_BUS, &ucRead[1], xfalse);
+    TestAssert((SoftI2CMasterReadS2(SOFT_I2C_BUS, &ucRead[2], xtrue) ==
+                SOFT_I2C_MASTER_ERR_NONE) && SoftI2CTestMatch(3),
+               "SoftI2C API \"SoftI2CMasterReadS2()\"error!");
+    ulLow = SoftI2CFakeMinLow();
+    ulHigh = SoftI2CFakeMinHigh();
+    TestAssert((ulLow >= 12) && (ulLow <= 14) &&
+               (ulHigh >= 8) && (ulHigh <= 10),
+               "SoftI2C API \"SoftI2CMasterInit()\"error!");
+
+    //
+    // A read ended by a STOP does not acknowledge its last byte.
+    //
+    SoftI2CMasterWriteS1(SOFT_I2C_BUS, SOFT_I2C_FAKE_ADDR, 0x21, xfalse);
+    SoftI2CMasterReadBufS1(SOFT_I2C_BUS, SOFT_I2C_FAKE_ADDR, ucRead, 2,
+                           xfalse);
+    SoftI2CMasterStop(SOFT_I2C_BUS);
+    TestAssert((ucRead[0] == ucData[2]) && (ucRead[1] == ucData[3]) &&
+               !SoftI2CMasterBusBusy(SOFT_I2C_BUS),
+               "SoftI2C API \"SoftI2CMasterStop()\"error!");
+
+    //
+    // No slave at the address.
+    //
+    TestAssert((SoftI2CMasterWriteS1(SOFT_I2C_BUS, SOFT_I2C_FAKE_ADDR + 1, 0,
+                                     xtrue) == SOFT_I2C_MASTER_ERR_ADDR_ACK) &&
+               !SoftI2CMasterBusBusy(SOFT_I2C_BUS),
+               "SoftI2C API \"SoftI2CMasterWriteS1()\"error!");
+
+    //
+    // A slave that never releases SCL.
+    //
+    SoftI2CFakeStretch(SOFT_I2C_FAKE_STUCK);
+    TestAssert((SoftI2CMasterWriteBufS1(SOFT_I2C_BUS, SOFT_I2C_FAKE_ADDR,
+                                        ucData, 3, xtrue) == 0) &&
+               (SoftI2CMasterError(SOFT_I2C_BUS) ==
+                SOFT_I2C_MASTER_ERR_TIMEOUT),
+               "SoftI2C API \"SoftI2CMasterError()\"error!");
+    SoftI2CFakeStretch(0);
+
+    //
+    // Another device holds SDA.
+    //
+    SoftI2CFakeSDAHold(1);
+    TestAssert((SoftI2CMasterWriteS1(SOFT_I2C_BUS, SOFT_I2C_FAKE_ADDR, 0,
+                                     xtrue) == SOFT_I2C_MASTER_ERR_ARB_LOST) &&
+               SoftI2CMasterBusBusy(SOFT_I2C_BUS),
+               "SoftI2C API \"SoftI2CMasterBusBusy()\"error!");
+}
+
+//
+// SoftI2C test case struct.
+//
+const tTestCase sTestSoftI2CMaster = {
+        SoftI2CGetTest,
+        SoftI2CSetup,
+        SoftI2CTearDown,
+        SoftI2CExecute
+};
+
+//
+// SoftI2C test suits.
+//
+const tTestCase * const psPatternSoftI2CTest[] =
+{
+    &sTestSoftI2CMaster,
+    0
+};
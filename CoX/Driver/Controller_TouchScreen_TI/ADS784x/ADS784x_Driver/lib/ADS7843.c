@@ -47,11 +47,23 @@
 #include "xsysctl.h"
 #include "xgpio.h"
 #include "xspi.h"
+#ifdef ADS7843_TOUCH_SERVICE
+#include "xhw_timer.h"
+#include "xtimer.h"
+#endif
 #include "ADS7843.h"
 #include "stdio.h"
 
 TouchInfo tTouchData;
 
+#if defined(ADS7843_TOUCH_SERVICE) && defined(ADS7843_ENABLE_TOUCH_INT)
+#error "ADS7843_TOUCH_SERVICE and ADS7843_ENABLE_TOUCH_INT both use the pen interrupt"
+#endif
+
+#ifdef ADS7843_TOUCH_SERVICE
+static tTouchService *psTouchService = 0;
+#endif
+
 #ifdef ADS7843_ENABLE_TOUCH_INT
 unsigned long TouchIntSvr(void *pvCBData,  unsigned long ulEvent,
                       unsigned long ulMsgParam, void *pvMsgData);
@@ -545,3 +557,119 @@ unsigned long TouchIntSvr(void *pvCBData,  unsigned long ulEvent,
     return 0;
 }
 #endif
+
+#ifdef ADS7843_TOUCH_SERVICE
+//*****************************************************************************
+//
+//! \brief ADS7843 sample timer callback function.
+//!
+//! \param pvCBData Not used.
+//! \param ulEvent Not used.
+//! \param ulMsgParam Not used.
+//! \param pvMsgData Not used.
+//!
+//! This function reads one raw sample each tick while the pen is down. When
+//! the pen goes up the timer is stopped and the pen interrupt is armed again,
+//! so nothing is converted while the screen is not touched.
+//!
+//! \return 0.
+//
+//*****************************************************************************
+static unsigned long ADS7843SampleSvr(void *pvCBData,  unsigned long ulEvent,
+                                      unsigned long ulMsgParam, void *pvMsgData)
+{
+    unsigned short x, y;
+
+    if(xGPIOSPinRead(ADS7843_PIN_INT))
+    {
+        xTimerStop(ADS7843_SAMPLE_TIMER, ADS7843_SAMPLE_CHANNEL);
+        TouchServicePenUp(psTouchService);
+        xGPIOSPinIntEnable(ADS7843_PIN_INT, xGPIO_FALLING_EDGE);
+    }
+    else
+    {
+        ADS7843ReadADXYRaw(&x, &y);
+        TouchServiceSamplePut(psTouchService, x, y);
+    }
+    return 0;
+}
+
+//*****************************************************************************
+//
+//! \brief ADS7843 pen down callback function.
+//!
+//! \param pvCBData Not used.
+//! \param ulEvent Not used.
+//! \param ulMsgParam Not used.
+//! \param pvMsgData Not used.
+//!
+//! This function starts the sample timer when the screen is touched.
+//!
+//! \return 0.
+//
+//*****************************************************************************
+static unsigned long ADS7843PenSvr(void *pvCBData,  unsigned long ulEvent,
+                                   unsigned long ulMsgParam, void *pvMsgData)
+{
+    xGPIOSPinIntDisable(ADS7843_PIN_INT);
+    TouchServicePenDown(psTouchService);
+    xTimerStart(ADS7843_SAMPLE_TIMER, ADS7843_SAMPLE_CHANNEL);
+    return 0;
+}
+
+//*****************************************************************************
+//
+//! \brief Sample in the background and send the touches to a TouchService.
+//!
+//! \param psService is the service, initialized by TouchServiceInit().
+//!
+//! This function maps the edges in tTouchData, the defaults or the result of
+//! ADS7843Calibration(), to the screen by the calibration matrix of the
+//! service. Then the pen interrupt starts a timer that samples at
+//! ADS7843_SAMPLE_FREQ until the pen goes up. The median and IIR filtering
+//! are done by the service, one sample per tick, instead of the
+//! TOUCH_SMAPLE_LEN conversions and the sort of ADS7843ReadADXY(). The
+//! application takes the events with TouchServiceEventGet().
+//!
+//! \return None.
+//
+//*****************************************************************************
+void ADS7843ServiceStart(tTouchService *psService)
+{
+    unsigned short usRaw[6];
+    unsigned short usScreen[6];
+
+    xASSERT(psService != 0);
+
+    psTouchService = psService;
+
+    //
+    // Top left, top right and bottom left corner.
+    //
+    usRaw[0] = tTouchData.th_ad_left;
+    usRaw[1] = tTouchData.th_ad_up;
+    usRaw[2] = tTouchData.th_ad_right;
+    usRaw[3] = tTouchData.th_ad_up;
+    usRaw[4] = tTouchData.th_ad_left;
+    usRaw[5] = tTouchData.th_ad_down;
+    usScreen[0] = 0;
+    usScreen[1] = 0;
+    usScreen[2] = TOUCH_SCREEN_WIDTH;
+    usScreen[3] = 0;
+    usScreen[4] = 0;
+    usScreen[5] = TOUCH_SCREEN_HEIGHT;
+    TouchServiceCalibrate(psService, usRaw, usScreen);
+
+    xSysCtlPeripheralEnable2(ADS7843_SAMPLE_TIMER);
+    xTimerInitConfig(ADS7843_SAMPLE_TIMER, ADS7843_SAMPLE_CHANNEL,
+                     xTIMER_MODE_PERIODIC, ADS7843_SAMPLE_FREQ);
+    xTimerIntEnable(ADS7843_SAMPLE_TIMER, ADS7843_SAMPLE_CHANNEL,
+                    xTIMER_INT_MATCH);
+    xTimerIntCallbackInit(ADS7843_SAMPLE_TIMER, ADS7843SampleSvr);
+    xIntEnable(ADS7843_SAMPLE_TIMER_INT);
+
+    xGPIOSPinIntCallbackInit(ADS7843_PIN_INT, ADS7843PenSvr);
+    xGPIOSPinIntEnable(ADS7843_PIN_INT, xGPIO_FALLING_EDGE);
+    xIntEnable(xINT_GPIOC);
+}
+#endif
@@ -111,6 +111,21 @@ extern "C"
 //
 //#define ADS7843_ENABLE_TOUCH_INT
 
+//
+// Sample from a timer and feed a TouchService, see ADS7843ServiceStart().
+// It takes the pen interrupt, so don't use it with ADS7843_ENABLE_TOUCH_INT.
+//
+//#define ADS7843_TOUCH_SERVICE
+
+#ifdef ADS7843_TOUCH_SERVICE
+#include "TouchService.h"
+
+#define ADS7843_SAMPLE_TIMER       xTIMER2_BASE
+#define ADS7843_SAMPLE_CHANNEL     xTIMER_CHANNEL0
+#define ADS7843_SAMPLE_TIMER_INT   xINT_TIMER2
+#define ADS7843_SAMPLE_FREQ        500
+#endif
+
 #define TOUCH_SCREEN_WIDTH         240
 #define TOUCH_SCREEN_HEIGHT        320
 
@@ -222,6 +237,13 @@ extern unsigned char ADS7843Calibration(void);
 //
 extern unsigned short ADS7843ReadInputChannel(unsigned char ucChannel);
 
+#ifdef ADS7843_TOUCH_SERVICE
+//
+//! Sample in the background and send the touches to a TouchService.
+//
+extern void ADS7843ServiceStart(tTouchService *psService);
+#endif
+
 //*****************************************************************************
 //
 //! @}
@@ -0,0 +1,411 @@
+//*****************************************************************************
+//
+//! \file CharLCD.c
+//! \brief Shadow buffered character LCD refresher.
+//! \version V2.2.1.0
+//! \date 10/19/2026
+//! \author CooCox
+//! \copy
+//!
+//! Copyright (c)  2013, CooCox
+//! All rights reserved.
+//!
+//! Redistribution and use in source and binary forms, with or without
+//! modification, are permitted provided that the following conditions
+//! are met:
+//!
+//!     * Redistributions of source code must retain the above copyright
+//! notice, this list of conditions and the following disclaimer.
+//!     * Redistributions in binary form must reproduce the above copyright
+//! notice, this list of conditions and the following disclaimer in the
+//! documentation and/or other materials provided with the distribution.
+//!     * Neither the name of the <ORGANIZATION> nor the names of its
+//! contributors may be used to endorse or promote products derived
+//! from this software without specific prior written permission.
+//!
+//! THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+//! AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+//! IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+//! ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+//! LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+//! CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+//! SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+//! INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//! CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+//! ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+//! THE POSSIBILITY OF SUCH DAMAGE.
+//
+//*****************************************************************************
+
+#include "xhw_types.h"
+#include "xdebug.h"
+#include "CharLCD.h"
+
+//
+// ucAddr value when the address counter of the controller is not known.
+//
+#define CHAR_LCD_ADDR_UNKNOWN      0xFF
+
+//
+// Set DDRAM address instruction.
+//
+#define CHAR_LCD_CMD_DDRAM_ADDR    0x80
+
+//*****************************************************************************
+//
+//! \brief Mark the line of a changed cell.
+//!
+//! \param psLCD is the refresher.
+//! \param ulCell is the cell index.
+//! \param c is the new character.
+//!
+//! \return None.
+//
+//*****************************************************************************
+static void
+CharLCDCellSet(tCharLCD *psLCD, unsigned long ulCell, char c)
+{
+    if(psLCD->ucShadow[ulCell] != (unsigned char)c)
+    {
+        psLCD->ucShadow[ulCell] = (unsigned char)c;
+        psLCD->ucRowDirty[ulCell / psLCD->ucCols] = 1;
+    }
+}
+
+//*****************************************************************************
+//
+//! \brief Send one instruction or character for the next changed cell.
+//!
+//! \param psLCD is the refresher.
+//!
+//! Lines are scanned from the last position on, so a run of changed cells
+//! costs one address instruction. The panel copy is updated with the value
+//! that was sent, a cell changed again meanwhile stays different and is sent
+//! on a later tick.
+//!
+//! \return xtrue if something was sent, xfalse if the panel is up to date.
+//
+//*****************************************************************************
+static xtBoolean
+CharLCDStep(tCharLCD *psLCD)
+{
+    unsigned long ulRow, ulCol, ulCell, ulAddr, ulPass;
+    unsigned char ucChar;
+
+    for(ulPass = 0; ulPass <= psLCD->ucRows; ulPass++)
+    {
+        ulRow = psLCD->ucScanRow;
+        ulCol = psLCD->ucScanCol;
+
+        if(psLCD->ucRowDirty[ulRow])
+        {
+            //
+            // Clear the flag before a full scan, a later write sets it again.
+            //
+            if(ulCol == 0)
+            {
+                psLCD->ucRowDirty[ulRow] = 0;
+            }
+
+            for(; ulCol < psLCD->ucCols; ulCol++)
+            {
+                ulCell = ulRow * psLCD->ucCols + ulCol;
+                ucChar = psLCD->ucShadow[ulCell];
+                if(ucChar == psLCD->ucPanel[ulCell])
+                {
+                    continue;
+                }
+
+                //
+                // The rest of the line is scanned on the next step.
+                //
+                psLCD->ucRowDirty[ulRow] = 1;
+                psLCD->ucScanCol = ulCol;
+                psLCD->ulWrites++;
+
+                //
+                // Line 1 and 3 start at 0x40, line 2 and 3 follow line 0
+                // and 1 in DDRAM.
+                //
+                ulAddr = (ulRow & 1) * 0x40 + (ulRow >> 1) * psLCD->ucCols +
+                         ulCol;
+                if(ulAddr != psLCD->ucAddr)
+                {
+                    psLCD->psPort->pfnCmd(CHAR_LCD_CMD_DDRAM_ADDR | ulAddr);
+                    psLCD->ucAddr = ulAddr;
+                    return xtrue;
+                }
+
+                psLCD->psPort->pfnData(ucChar);
+                psLCD->ucPanel[ulCell] = ucChar;
+                psLCD->ucAddr++;
+                psLCD->ucScanCol = ulCol + 1;
+                return xtrue;
+            }
+        }
+
+        psLCD->ucScanCol = 0;
+        psLCD->ucScanRow = (ulRow + 1 < psLCD->ucRows) ? ulRow + 1 : 0;
+    }
+
+    return xfalse;
+}
+
+//*****************************************************************************
+//
+//! \brief Init a refresher.
+//!
+//! \param psLCD is the refresher.
+//! \param psPort is the controller access of the LCD driver.
+//! \param ucCols is the number of characters per line.
+//! \param ucRows is the number of lines.
+//!
+//! The LCD must be initialized and cleared by its driver before, the shadow
+//! starts blank. Call CharLCDTick() from a timer after this.
+//!
+//! \return None.
+//
+//*****************************************************************************
+void
+CharLCDInit(tCharLCD *psLCD, const tCharLCDPort *psPort,
+            unsigned char ucCols, unsigned char ucRows)
+{
+    unsigned long i;
+
+    xASSERT(psLCD != 0);
+    xASSERT((psPort != 0) && (psPort->pfnCmd != 0) && (psPort->pfnData != 0));
+    xASSERT((ucCols != 0) && (ucCols <= CHAR_LCD_COLS_MAX));
+    xASSERT((ucRows != 0) && (ucRows <= CHAR_LCD_ROWS_MAX));
+
+    psLCD->psPort = psPort;
+    psLCD->ucCols = ucCols;
+    psLCD->ucRows = ucRows;
+    psLCD->ucCursor = 0;
+    psLCD->ucAddr = CHAR_LCD_ADDR_UNKNOWN;
+    psLCD->ucScanRow = 0;
+    psLCD->ucScanCol = 0;
+    psLCD->ulWrites = 0;
+
+    for(i = 0; i < CHAR_LCD_ROWS_MAX; i++)
+    {
+        psLCD->ucRowDirty[i] = 0;
+    }
+    for(i = 0; i < CHAR_LCD_ROWS_MAX * CHAR_LCD_COLS_MAX; i++)
+    {
+        psLCD->ucShadow[i] = ' ';
+        psLCD->ucPanel[i] = ' ';
+    }
+}
+
+//*****************************************************************************
+//
+//! \brief Rewrite the whole panel on the next ticks.
+//!
+//! \param psLCD is the refresher.
+//!
+//! Call it after the LCD was written around the refresher, e.g. by the LCD
+//! driver APIs, or reset.
+//!
+//! \return None.
+//
+//*****************************************************************************
+void
+CharLCDInvalidate(tCharLCD *psLCD)
+{
+    unsigned long i;
+
+    xASSERT(psLCD != 0);
+
+    psLCD->ucAddr = CHAR_LCD_ADDR_UNKNOWN;
+    for(i = 0; i < CHAR_LCD_ROWS_MAX * CHAR_LCD_COLS_MAX; i++)
+    {
+        psLCD->ucPanel[i] = 0;
+    }
+    for(i = 0; i < psLCD->ucRows; i++)
+    {
+        psLCD->ucRowDirty[i] = 1;
+    }
+}
+
+//*****************************************************************************
+//
+//! \brief Blank the shadow and set the write position to (0, 0).
+//!
+//! \param psLCD is the refresher.
+//!
+//! Unlike the clear instruction of the LCD, only the cells that are not
+//! blank are written on the next ticks.
+//!
+//! \return None.
+//
+//*****************************************************************************
+void
+CharLCDClear(tCharLCD *psLCD)
+{
+    unsigned long i;
+
+    xASSERT(psLCD != 0);
+
+    for(i = 0; i < (unsigned long)psLCD->ucCols * psLCD->ucRows; i++)
+    {
+        CharLCDCellSet(psLCD, i, ' ');
+    }
+    psLCD->ucCursor = 0;
+}
+
+//*****************************************************************************
+//
+//! \brief Set the write position.
+//!
+//! \param psLCD is the refresher.
+//! \param x is the character index.
+//! \param y is the line number.
+//!
+//! \return None.
+//
+//*****************************************************************************
+void
+CharLCDLocationSet(tCharLCD *psLCD, unsigned char x, unsigned char y)
+{
+    xASSERT(psLCD != 0);
+    xASSERT((x < psLCD->ucCols) && (y < psLCD->ucRows));
+
+    psLCD->ucCursor = y * psLCD->ucCols + x;
+}
+
+//*****************************************************************************
+//
+//! \brief Write a character at the write position.
+//!
+//! \param psLCD is the refresher.
+//! \param c is the character.
+//!
+//! The position moves to the right, at the end of a line to the next line
+//! and at the end of the screen back to (0, 0).
+//!
+//! \return None.
+//
+//*****************************************************************************
+void
+CharLCDPutChar(tCharLCD *psLCD, char c)
+{
+    xASSERT(psLCD != 0);
+
+    CharLCDCellSet(psLCD, psLCD->ucCursor, c);
+    psLCD->ucCursor++;
+    if(psLCD->ucCursor == psLCD->ucCols * psLCD->ucRows)
+    {
+        psLCD->ucCursor = 0;
+    }
+}
+
+//*****************************************************************************
+//
+//! \brief Write a string at the write position.
+//!
+//! \param psLCD is the refresher.
+//! \param pcString is a zero terminated string.
+//!
+//! \return None.
+//
+//*****************************************************************************
+void
+CharLCDDisplayString(tCharLCD *psLCD, const char *pcString)
+{
+    xASSERT(pcString != 0);
+
+    while(*pcString != 0)
+    {
+        CharLCDPutChar(psLCD, *pcString++);
+    }
+}
+
+//*****************************************************************************
+//
+//! \brief Write a decimal number at the write position.
+//!
+//! \param psLCD is the refresher.
+//! \param n is the number.
+//!
+//! \return None.
+//
+//*****************************************************************************
+void
+CharLCDDisplayN(tCharLCD *psLCD, unsigned long n)
+{
+    char pcBuf[16], *p;
+
+    p = pcBuf;
+    do
+    {
+        *p++ = (n % 10) + '0';
+        n /= 10;
+    }
+    while(n != 0);
+
+    while(p > pcBuf)
+    {
+        CharLCDPutChar(psLCD, *--p);
+    }
+}
+
+//*****************************************************************************
+//
+//! \brief Send the changed cells to the LCD.
+//!
+//! \param psLCD is the refresher.
+//!
+//! Call it from a periodic timer interrupt. With a busy flag it sends up to
+//! CHAR_LCD_TICK_OPS writes, each as soon as the controller is ready. Without
+//! it sends one write, so the tick period must cover its execution time.
+//!
+//! \return None.
+//
+//*****************************************************************************
+void
+CharLCDTick(tCharLCD *psLCD)
+{
+    unsigned long ulOps;
+
+    xASSERT(psLCD != 0);
+
+    ulOps = (psLCD->psPort->pfnBusy != 0) ? CHAR_LCD_TICK_OPS : 1;
+    while(ulOps--)
+    {
+        if((psLCD->psPort->pfnBusy != 0) && psLCD->psPort->pfnBusy())
+        {
+            break;
+        }
+        if(!CharLCDStep(psLCD))
+        {
+            break;
+        }
+    }
+}
+
+//*****************************************************************************
+//
+//! \brief Check if the panel shows the shadow.
+//!
+//! \param psLCD is the refresher.
+//!
+//! \return xtrue if nothing is left to send.
+//
+//*****************************************************************************
+xtBoolean
+CharLCDIdle(tCharLCD *psLCD)
+{
+    unsigned long i;
+
+    xASSERT(psLCD != 0);
+
+    for(i = 0; i < psLCD->ucRows; i++)
+    {
+        if(psLCD->ucRowDirty[i])
+        {
+            return xfalse;
+        }
+    }
+
+    return xtrue;
+}
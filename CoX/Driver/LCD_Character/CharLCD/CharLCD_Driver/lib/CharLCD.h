@@ -0,0 +1,215 @@
+//*****************************************************************************
+//
+//! \file CharLCD.h
+//! \brief Prototypes for the shadow buffered character LCD refresher.
+//! \version V2.2.1.0
+//! \date 10/19/2026
+//! \author CooCox
+//! \copy
+//!
+//! Copyright (c)  2013, CooCox
+//! All rights reserved.
+//!
+//! Redistribution and use in source and binary forms, with or without
+//! modification, are permitted provided that the following conditions
+//! are met:
+//!
+//!     * Redistributions of source code must retain the above copyright
+//! notice, this list of conditions and the following disclaimer.
+//!     * Redistributions in binary form must reproduce the above copyright
+//! notice, this list of conditions and the following disclaimer in the
+//! documentation and/or other materials provided with the distribution.
+//!     * Neither the name of the <ORGANIZATION> nor the names of its
+//! contributors may be used to endorse or promote products derived
+//! from this software without specific prior written permission.
+//!
+//! THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+//! AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+//! IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+//! ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+//! LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+//! CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+//! SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+//! INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//! CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+//! ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+//! THE POSSIBILITY OF SUCH DAMAGE.
+//
+//*****************************************************************************
+#ifndef __CHARLCD_H__
+#define __CHARLCD_H__
+
+//*****************************************************************************
+//
+// If building with a C++ compiler, make all of the definitions in this header
+// have a C binding.
+//
+//*****************************************************************************
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+//*****************************************************************************
+//
+//! \addtogroup CoX_Driver_Lib
+//! @{
+//
+//! \addtogroup LCD
+//! @{
+//
+//! \addtogroup CharLCD
+//! \brief The application writes text into a RAM copy of the DDRAM, which
+//! costs a compare per character and no bus traffic. A periodic tick sends
+//! only the cells that differ from what is on the panel, with one address
+//! command per run of changed cells. With a busy flag several writes go out
+//! per tick as soon as the controller is ready, without it one write goes
+//! out per tick and the tick period gives the execution time.
+//! @{
+//
+//*****************************************************************************
+
+//*****************************************************************************
+//! \addtogroup CharLCD_User_Config
+//! @{
+//
+//*****************************************************************************
+
+//
+//! Largest number of characters per line.
+//
+#define CHAR_LCD_COLS_MAX          20
+
+//
+//! Largest number of lines.
+//
+#define CHAR_LCD_ROWS_MAX          4
+
+//
+//! Most bus writes per tick when the busy flag can be read.
+//
+#define CHAR_LCD_TICK_OPS          8
+
+//*****************************************************************************
+//
+//! @}
+//
+//*****************************************************************************
+
+//*****************************************************************************
+//! \addtogroup CharLCD_Types
+//! @{
+//
+//*****************************************************************************
+
+//
+//! Controller access, given by the LCD driver.
+//
+typedef struct
+{
+    //
+    //! Write an instruction, without waiting for the busy flag.
+    //
+    void (*pfnCmd)(unsigned char ucCmd);
+
+    //
+    //! Write a character to DDRAM, without waiting for the busy flag.
+    //
+    void (*pfnData)(unsigned char ucData);
+
+    //
+    //! Return xtrue while the controller is busy. 0 if RW is not wired, then
+    //! one write is sent per tick and the tick period must be longer than
+    //! the execution time (about 40us for HD44780).
+    //
+    xtBoolean (*pfnBusy)(void);
+}
+tCharLCDPort;
+
+//
+//! Refresher state. The shadow is written only by the application and the
+//! panel copy only by CharLCDTick(). A line flag is set after each shadow
+//! change and cleared by the tick before it scans the line, so the two sides
+//! need no lock.
+//
+typedef struct
+{
+    const tCharLCDPort *psPort;
+    unsigned char ucCols;
+    unsigned char ucRows;
+
+    //
+    // Write position of the application, a cell index.
+    //
+    unsigned char ucCursor;
+
+    //
+    // DDRAM address counter of the controller, CHAR_LCD_ADDR_UNKNOWN after
+    // an instruction the refresher did not send.
+    //
+    unsigned char ucAddr;
+
+    //
+    // Next cell the tick looks at.
+    //
+    unsigned char ucScanRow;
+    unsigned char ucScanCol;
+
+    volatile unsigned char ucRowDirty[CHAR_LCD_ROWS_MAX];
+    volatile unsigned char ucShadow[CHAR_LCD_ROWS_MAX * CHAR_LCD_COLS_MAX];
+    unsigned char ucPanel[CHAR_LCD_ROWS_MAX * CHAR_LCD_COLS_MAX];
+
+    //
+    //! Number of instructions and characters sent.
+    //
+    unsigned long ulWrites;
+}
+tCharLCD;
+
+//*****************************************************************************
+//
+//! @}
+//
+//*****************************************************************************
+
+//*****************************************************************************
+//! \addtogroup CharLCD_Export_APIs
+//! @{
+//
+//*****************************************************************************
+extern void CharLCDInit(tCharLCD *psLCD, const tCharLCDPort *psPort,
+                        unsigned char ucCols, unsigned char ucRows);
+extern void CharLCDInvalidate(tCharLCD *psLCD);
+extern void CharLCDClear(tCharLCD *psLCD);
+extern void CharLCDLocationSet(tCharLCD *psLCD, unsigned char x,
+                               unsigned char y);
+extern void CharLCDPutChar(tCharLCD *psLCD, char c);
+extern void CharLCDDisplayString(tCharLCD *psLCD, const char *pcString);
+extern void CharLCDDisplayN(tCharLCD *psLCD, unsigned long n);
+extern void CharLCDTick(tCharLCD *psLCD);
+extern xtBoolean CharLCDIdle(tCharLCD *psLCD);
+
+//*****************************************************************************
+//
+//! @}
+//
+//*****************************************************************************
+
+//*****************************************************************************
+//
+//! @}
+//! @}
+//! @}
+//
+//*****************************************************************************
+
+//*****************************************************************************
+//
+// Mark the end of the C bindings section for C++ compilers.
+//
+//*****************************************************************************
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,311 @@
+//*****************************************************************************
+//
+//! @page CharLCD_testcase CharLCD test
+//!
+//! File: @ref CharLCD.c
+//!
+//! <h2>Description</h2>
+//! This module implements the test sequence for the shadow buffered
+//! character LCD refresher.<br><br>
+//! - \p Board: STM32 <br><br>
+//! - \p Last-Time(about): 0.1s <br><br>
+//! - \p Phenomenon: Success or failure information will be printed on the UART. <br><br>
+//! .
+//!
+//! <h2>Preconditions</h2>
+//! The module requires the following options:<br><br>
+//! - \p Option-define:
+//! <br>(1)None.<br><br>
+//! - \p Option-hardware:
+//! <br>(1)None, the test writes to a fake controller that keeps the DDRAM
+//! and the address counter.<br><br>
+//! - \p Option-OtherModule:
+//! <br>Connect an COM cable to the development board.<br>
+//! .
+//! In case some of the required options are not enabled then some or all tests
+//! may be skipped or result FAILED.<br>
+//!
+//! <h2>Test Cases</h2>
+//! The module contain those sub tests:<br><br>
+//! - \subpage test_CharLCD_Refresh
+//! .
+//! \file CharLCD.c
+//! \brief CharLCD test source file
+//! \file CharLCD.h
+//! \brief CharLCD test header file <br>
+//
+//*****************************************************************************
+
+#include "test.h"
+#include "CharLCD.h"
+
+static tCharLCD sLCD;
+
+//
+// Fake controller.
+//
+static unsigned char ucDDRAM[0x80];
+static unsigned char ucAC;
+static unsigned long ulCmds;
+static unsigned long ulDatas;
+static unsigned long ulBusyLeft;
+
+static void CharLCDTestCmd(unsigned char ucCmd)
+{
+    ucAC = ucCmd & 0x7F;
+    ulCmds++;
+}
+
+static void CharLCDTestData(unsigned char ucData)
+{
+    ucDDRAM[ucAC] = ucData;
+    ucAC = (ucAC + 1) & 0x7F;
+    ulDatas++;
+}
+
+static xtBoolean CharLCDTestBusy(void)
+{
+    if(ulBusyLeft != 0)
+    {
+        ulBusyLeft--;
+        return xtrue;
+    }
+
+    return xfalse;
+}
+
+static const tCharLCDPort sPortTimed =
+{
+    CharLCDTestCmd,
+    CharLCDTestData,
+    0,
+};
+
+static const tCharLCDPort sPortBusy =
+{
+    CharLCDTestCmd,
+    CharLCDTestData,
+    CharLCDTestBusy,
+};
+
+//*****************************************************************************
+//
+//! \brief Clear the bus counters.
+//!
+//! \return None.
+//
+//*****************************************************************************
+static void CharLCDTestCountReset(void)
+{
+    ulCmds = 0;
+    ulDatas = 0;
+}
+
+//*****************************************************************************
+//
+//! \brief Tick until the panel is up to date.
+//!
+//! \return the number of ticks.
+//
+//*****************************************************************************
+static unsigned long CharLCDTestFlush(void)
+{
+    unsigned long ulTicks = 0;
+
+    while(!CharLCDIdle(&sLCD) && (ulTicks < 1000))
+    {
+        CharLCDTick(&sLCD);
+        ulTicks++;
+    }
+
+    return ulTicks;
+}
+
+//*****************************************************************************
+//
+//! \brief Check a line of the fake DDRAM.
+//!
+//! \return xtrue if the line starts with \e pcText.
+//
+//*****************************************************************************
+static xtBoolean CharLCDTestLine(unsigned long ulRow, const char *pcText)
+{
+    unsigned char *pucLine = &ucDDRAM[(ulRow & 1) * 0x40];
+
+    while(*pcText != 0)
+    {
+        if(*pucLine++ != (unsigned char)*pcText++)
+        {
+            return xfalse;
+        }
+    }
+
+    return xtrue;
+}
+
+//*****************************************************************************
+//
+//! \brief Get the Test description of CharLCD test.
+//!
+//! \return the desccription of the CharLCD test.
+//
+//*****************************************************************************
+static char* CharLCDGetTest(void)
+{
+    return "CharLCD refresh test";
+}
+
+//*****************************************************************************
+//
+//! \brief something should do before the test execute of CharLCD test.
+//!
+//! \return None.
+//
+//*****************************************************************************
+static void CharLCDSetup(void)
+{
+    unsigned long i;
+
+    for(i = 0; i < sizeof(ucDDRAM); i++)
+    {
+        ucDDRAM[i] = ' ';
+    }
+    ucAC = 0;
+    ulBusyLeft = 0;
+    CharLCDTestCountReset();
+    CharLCDInit(&sLCD, &sPortTimed, 16, 2);
+}
+
+//*****************************************************************************
+//
+//! \brief something should do after the test execute of CharLCD test.
+//!
+//! \return None.
+//
+//*****************************************************************************
+static void CharLCDTearDown(void)
+{
+
+}
+
+//*****************************************************************************
+//
+//! \brief CharLCD test execute main body.
+//!
+//! \return None.
+//
+//*****************************************************************************
+static void CharLCDExecute(void)
+{
+    //
+    // Writing costs no bus access, the tick sends one address and the run.
+    //
+    CharLCDDisplayString(&sLCD, "Hello");
+    TestAssert((ulCmds == 0) && (ulDatas == 0) && !CharLCDIdle(&sLCD),
+               "CharLCD API \"CharLCDDisplayString()\"error!");
+    CharLCDTick(&sLCD);
+    TestAssert((ulCmds == 1) && (ulDatas == 0),
+               "CharLCD API \"CharLCDTick()\"error!");
+    CharLCDTestFlush();
+    TestAssert((ulCmds == 1) && (ulDatas == 5) &&
+               CharLCDTestLine(0, "Hello      "),
+               "CharLCD API \"CharLCDTick()\"error!");
+
+    //
+    // The same text again is not sent, one changed cell costs two writes.
+    //
+    CharLCDTestCountReset();
+    CharLCDLocationSet(&sLCD, 0, 0);
+    CharLCDDisplayString(&sLCD, "Hello");
+    TestAssert(CharLCDIdle(&sLCD),
+               "CharLCD API \"CharLCDDisplayString()\"error!");
+    CharLCDLocationSet(&sLCD, 0, 0);
+    CharLCDDisplayString(&sLCD, "Hallo");
+    CharLCDTestFlush();
+    TestAssert((ulCmds == 1) && (ulDatas == 1) &&
+               CharLCDTestLine(0, "Hallo"),
+               "CharLCD API \"CharLCDTick()\"error!");
+
+    //
+    // Runs on both lines, the cursor wraps to the second line.
+    //
+    CharLCDTestCountReset();
+    CharLCDLocationSet(&sLCD, 14, 0);
+    CharLCDDisplayString(&sLCD, "ab");
+    CharLCDDisplayN(&sLCD, 1234);
+    CharLCDTestFlush();
+    TestAssert((ulCmds == 2) && (ulDatas == 6) &&
+               CharLCDTestLine(0, "Hallo         ab") &&
+               CharLCDTestLine(1, "1234 "),
+               "CharLCD API \"CharLCDDisplayN()\"error!");
+
+    //
+    // Only the cells that are not blank are cleared.
+    //
+    CharLCDTestCountReset();
+    CharLCDClear(&sLCD);
+    CharLCDTestFlush();
+    TestAssert((ulCmds == 3) && (ulDatas == 11) &&
+               CharLCDTestLine(0, "                ") &&
+               CharLCDTestLine(1, "    "),
+               "CharLCD API \"CharLCDClear()\"error!");
+
+    //
+    // With a busy flag a tick sends a burst and stops while it is set.
+    //
+    CharLCDInit(&sLCD, &sPortBusy, 16, 2);
+    CharLCDTestCountReset();
+    CharLCDDisplayString(&sLCD, "0123456789ABCDEF");
+    ulBusyLeft = 1;
+    CharLCDTick(&sLCD);
+    TestAssert((ulCmds == 0) && (ulDatas == 0),
+               "CharLCD API \"CharLCDTick()\"error!");
+    CharLCDTick(&sLCD);
+    TestAssert((ulCmds == 1) && (ulDatas == CHAR_LCD_TICK_OPS - 1),
+               "CharLCD API \"CharLCDTick()\"error!");
+    CharLCDTestFlush();
+    TestAssert((ulCmds == 1) && (ulDatas == 16) &&
+               CharLCDTestLine(0, "0123456789ABCDEF"),
+               "CharLCD API \"CharLCDTick()\"error!");
+
+    //
+    // A write while a line is sent is not lost.
+    //
+    CharLCDTestCountReset();
+    CharLCDLocationSet(&sLCD, 0, 0);
+    CharLCDDisplayString(&sLCD, "abcdefghijklmnop");
+    CharLCDTick(&sLCD);
+    CharLCDLocationSet(&sLCD, 1, 0);
+    CharLCDPutChar(&sLCD, 'X');
+    CharLCDTestFlush();
+    TestAssert((ulDatas == 17) && CharLCDTestLine(0, "aXcdefghijklmnop"),
+               "CharLCD API \"CharLCDTick()\"error!");
+
+    //
+    // After an invalidate the whole panel is written again.
+    //
+    CharLCDTestCountReset();
+    CharLCDInvalidate(&sLCD);
+    CharLCDTestFlush();
+    TestAssert((ulCmds == 2) && (ulDatas == 32),
+               "CharLCD API \"CharLCDInvalidate()\"error!");
+}
+
+//
+// CharLCD test case struct.
+//
+const tTestCase sTestCharLCDRefresh = {
+        CharLCDGetTest,
+        CharLCDSetup,
+        CharLCDTearDown,
+        CharLCDExecute
+};
+
+//
+// CharLCD test suits.
+//
+const tTestCase * const psPatternCharLCDTest[] =
+{
+    &sTestCharLCDRefresh,
+    0
+};
@@ -265,12 +265,13 @@ HD44780ReadState(void)
 xtBoolean 
 HD44780Busy(void)
 {
-    unsigned ucState;
-
-    //ucState = HD44780ReadState();
-	  xSysCtlDelay(1000);
+#ifdef HD44780_BUSY_FLAG
+    return (HD44780ReadState() & HD44780_READ_STATE_BUSY) ? xtrue : xfalse;
+#else
+    xSysCtlDelay(1000);
 
     return xfalse;
+#endif
 }
 
 //*****************************************************************************
@@ -764,3 +765,42 @@ HD44780DisplayRightShift(unsigned char n)
                                         HD44780_CURSOR_DISPLAY_SHIFT_RL_R));
     }    
 }
+
+#ifdef HD44780_CHAR_LCD
+
+//
+// Controller access for the refresher.
+//
+static const tCharLCDPort g_sHD44780CharLCDPort =
+{
+    HD44780WriteCmd,
+    HD44780WriteData,
+#ifdef HD44780_BUSY_FLAG
+    HD44780Busy,
+#else
+    0,
+#endif
+};
+
+//*****************************************************************************
+//
+//! \brief Init a shadow buffered refresher for the HD44780.
+//!
+//! \param psLCD is the refresher.
+//!
+//! HD44780Init() must be called before. Write the text with the CharLCD APIs
+//! and call CharLCDTick() from a periodic timer. Without \ref
+//! HD44780_BUSY_FLAG the timer period must be longer than the execution
+//! time of one write.
+//!
+//! \return None.
+//
+//*****************************************************************************
+void
+HD44780CharLCDInit(tCharLCD *psLCD)
+{
+    CharLCDInit(psLCD, &g_sHD44780CharLCDPort, HD44780_DISPLAY_CHARACTER,
+                HD44780_DISPLAY_LINE);
+}
+
+#endif
@@ -175,6 +175,22 @@ extern "C"
 #define HD44780_INTERFACE_DATA_LEN                                            \
                                 HD44780_INTERFACE_DATA_LEN_4
 
+//
+//! Read the busy flag in HD44780Busy() instead of waiting a fixed time. RW
+//! must be wired to the MCU.
+//
+//#define HD44780_BUSY_FLAG
+
+//
+//! Export HD44780CharLCDInit(), the LCD is written by the shadow buffered
+//! refresher in CharLCD.c.
+//
+//#define HD44780_CHAR_LCD
+
+#ifdef HD44780_CHAR_LCD
+#include "CharLCD.h"
+#endif
+
 //*****************************************************************************
 //
 //! @}
@@ -303,6 +319,10 @@ extern void HD44780WriteData(unsigned char ucData);
 extern unsigned long HD44780ReadState(void);
 extern unsigned long HD44780ReadData(void);
 
+#ifdef HD44780_CHAR_LCD
+extern void HD44780CharLCDInit(tCharLCD *psLCD);
+#endif
+
 //*****************************************************************************
 //
 //! @}
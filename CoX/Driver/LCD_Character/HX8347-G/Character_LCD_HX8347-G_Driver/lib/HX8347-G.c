@@ -1062,6 +1062,73 @@ HX8347SetBackColor(unsigned short usColor)
     BackColor = usColor;
 }
 
+//*****************************************************************************
+//
+//! \brief Write one color many times in a started data write.
+//!
+//! \param usColor is the pixel color.
+//! \param ulCount is the number of pixels.
+//!
+//! \return None.
+//
+//*****************************************************************************
+static void
+HX8347ColorRunWrite(unsigned short usColor, unsigned long ulCount)
+{
+    unsigned char ucHigh = usColor >> 8;
+    unsigned char ucLow = usColor & 0xFF;
+
+    while(ulCount--)
+    {
+        xSPISingleDataReadWrite(HX8347_PIN_SPI_PORT, ucHigh);
+        xSPISingleDataReadWrite(HX8347_PIN_SPI_PORT, ucLow);
+    }
+}
+
+//*****************************************************************************
+//
+//! \brief Write 16 pixel wide glyph rows as color runs.
+//!
+//! \param pusRows is the glyph, one row per short, bit 15 first.
+//! \param ulRows is the number of rows.
+//!
+//! Pixels of the same color, also across row ends, are written as one run,
+//! so the color test is done once per run instead of once per pixel.
+//!
+//! \return None.
+//
+//*****************************************************************************
+static void
+HX8347GlyphWrite(const unsigned short *pusRows, unsigned long ulRows)
+{
+    unsigned long ulRun = 0;
+    unsigned short usBits;
+    unsigned char ucBit, ucFg = 0;
+
+    while(ulRows--)
+    {
+        usBits = *pusRows++;
+        if(usBits == (ucFg ? 0xFFFF : 0x0000))
+        {
+            ulRun += 16;
+            continue;
+        }
+
+        for(ucBit = 0; ucBit < 16; ucBit++)
+        {
+            if(((usBits & 0x8000) ? 1 : 0) != ucFg)
+            {
+                HX8347ColorRunWrite(ucFg ? TextColor : BackColor, ulRun);
+                ucFg ^= 1;
+                ulRun = 0;
+            }
+            ulRun++;
+            usBits <<= 1;
+        }
+    }
+    HX8347ColorRunWrite(ucFg ? TextColor : BackColor, ulRun);
+}
+
 //*****************************************************************************
 //
 //! \brief draw character on given position.
@@ -1078,29 +1145,12 @@ HX8347SetBackColor(unsigned short usColor)
 void
 HX8347DrawChar(unsigned long ulX, unsigned long ulY, unsigned short *psC)
 {
-    unsigned long ulIDx = 0;
-    long lI,lJ;
-    
     ulX = HX8347_DISPLAY_WIDTH - ulX - CHAR_W;
     HX8347SetWindow(ulX, ulY, CHAR_W, CHAR_H);
     
     HX8347WriteCmd(HX8347_READ_DATA);
     HX8347WriteDataStart();
-    for(lJ = 0; lJ < CHAR_H; lJ++)
-    {
-       for(lI = CHAR_W - 1; lI >= 0; lI--)
-       {
-         if((psC[ulIDx] & (1 << lI)) == 0x00)
-         {
-            HX8347WriteDataOnly(BackColor);
-         }
-         else
-         {
-            HX8347WriteDataOnly(TextColor);
-         }
-       }
-       psC++;
-    }   
+    HX8347GlyphWrite(psC, CHAR_H);
     HX8347WriteDataStop();
 }
 
@@ -1282,30 +1332,13 @@ HX8347DisplayOff(void)
 void
 HX8347DrawChinese(unsigned long ulX, unsigned long ulY, unsigned char *pcC)
 {   
-    unsigned long ulIDx = 0;
-    long lI, lJ;
     unsigned short *pusC = (unsigned short *)pcC;
     
     ulX = HX8347_DISPLAY_WIDTH - ulX - 16;
     HX8347SetWindow(ulX, ulY, 16 , 16);
     HX8347WriteCmd(HX8347_READ_DATA);
     HX8347WriteDataStart();
-    
-    for(lJ = 0; lJ < 16; lJ++)
-    {
-       for(lI = CHAR_W - 1; lI >= 0; lI--)
-       {
-         if((pusC[ulIDx] & (1 << lI)) == 0x00)
-         {
-            HX8347WriteDataOnly(BackColor);
-         }
-         else
-         {
-            HX8347WriteDataOnly(TextColor);
-         }
-       }
-       pusC++;
-    }
+    HX8347GlyphWrite(pusC, 16);
     HX8347WriteDataStop();
 }
 
@@ -218,6 +218,82 @@ ILI9341WriteData(unsigned long ulData)
     ILI9341Write(ILI9341_RS_DATA, ulData);
 }
 
+//*****************************************************************************
+//
+//! \brief Put one byte on the data bus and strobe WR.
+//!
+//! \param ucData is the byte to write.
+//!
+//! CS and RS must already be set by the caller.
+//!
+//! \return None.
+//
+//*****************************************************************************
+static void 
+ILI9341BusWrite(unsigned char ucData)
+{
+    xGPIOSPinWrite(ILI9341_PIN_D7, (ucData >> 7) & 0x01);
+    xGPIOSPinWrite(ILI9341_PIN_D6, (ucData >> 6) & 0x01);
+    xGPIOSPinWrite(ILI9341_PIN_D5, (ucData >> 5) & 0x01);
+    xGPIOSPinWrite(ILI9341_PIN_D4, (ucData >> 4) & 0x01);
+    xGPIOSPinWrite(ILI9341_PIN_D3, (ucData >> 3) & 0x01);
+    xGPIOSPinWrite(ILI9341_PIN_D2, (ucData >> 2) & 0x01);
+    xGPIOSPinWrite(ILI9341_PIN_D1, (ucData >> 1) & 0x01);
+    xGPIOSPinWrite(ILI9341_PIN_D0, ucData & 0x01);
+    xGPIOSPinWrite(ILI9341_PIN_WR, ILI9341_WR_LOW);
+    xGPIOSPinWrite(ILI9341_PIN_WR, ILI9341_WR_HIGH);
+}
+
+//*****************************************************************************
+//
+//! \brief Write the same pixel color many times into the open window.
+//!
+//! \param ulColor is the pixel color.
+//! \param ulCount is the number of pixels.
+//!
+//! CS and RS are set once for the whole run. When both bytes of the color
+//! are equal the bus is set up once and only WR is strobed.
+//!
+//! \return None.
+//
+//*****************************************************************************
+void 
+ILI9341ColorRunWrite(unsigned long ulColor, unsigned long ulCount)
+{
+    unsigned char ucHigh = (ulColor >> 8) & 0xFF;
+    unsigned char ucLow = ulColor & 0xFF;
+
+    if(ulCount == 0)
+    {
+        return;
+    }
+
+    xGPIOSPinWrite(ILI9341_PIN_CS, ILI9341_CS_ENABLE);
+    xGPIOSPinWrite(ILI9341_PIN_RS, ILI9341_RS_DATA);
+    xGPIOSPinWrite(ILI9341_PIN_RD, ILI9341_RD_WRITE);
+
+    if(ucHigh == ucLow)
+    {
+        ILI9341BusWrite(ucLow);
+        ulCount = ulCount * 2 - 1;
+        while(ulCount--)
+        {
+            xGPIOSPinWrite(ILI9341_PIN_WR, ILI9341_WR_LOW);
+            xGPIOSPinWrite(ILI9341_PIN_WR, ILI9341_WR_HIGH);
+        }
+    }
+    else
+    {
+        while(ulCount--)
+        {
+            ILI9341BusWrite(ucHigh);
+            ILI9341BusWrite(ucLow);
+        }
+    }
+
+    xGPIOSPinWrite(ILI9341_PIN_CS, ILI9341_CS_DISABLE);
+}
+
 //*****************************************************************************
 //
 //! \brief Set the cursor location.
@@ -238,7 +314,7 @@ ILI9341SetCurPos(unsigned long ulStartX, unsigned long ulEndX,
     //
     // Check Arguments.
     //
-    xASSERT((ulStartX < ulEndX) && (ulStartY < ulEndY));
+    xASSERT((ulStartX <= ulEndX) && (ulStartY <= ulEndY));
     xASSERT((ulEndX < LCD_HORIZONTAL_MAX) && (ulEndY < LCD_VERTICAL_MAX));
   
     //
@@ -487,8 +563,6 @@ void
 ILI9341DisplayRectFill(unsigned short usStartX, unsigned short usEndX, 
                         unsigned short usStartY, unsigned short usEndY, unsigned long ulColor)
 {
-    unsigned long ulTemp;
-	
     //
     // Check Arguments.
     //
@@ -502,10 +576,8 @@ ILI9341DisplayRectFill(unsigned short usStartX, unsigned short usEndX,
     //
     ILI9341SetCurPos(usStartX, usEndX, usStartY, usEndY); 
 	
-    for(ulTemp = 0; ulTemp <= (usEndX - usStartX + 1) * (usEndY - usStartY + 1); ulTemp++)
-    {
-        ILI9341WriteData(ulColor);
-    }
+    ILI9341ColorRunWrite(ulColor, (unsigned long)(usEndX - usStartX + 1) *
+                                 (usEndY - usStartY + 1));
 }
 
 //*****************************************************************************
@@ -658,12 +730,10 @@ void
 ILI9341DrawHorizontalLine(unsigned short usStartX, unsigned short usEndX,
                           unsigned short usY, unsigned long ulColor)
 {
-    xASSERT((usStartX <= usEndX) && (usEndX <= LCD_HORIZONTAL_MAX) && (usStartX >= 0));
+    xASSERT((usStartX <= usEndX) && (usEndX < LCD_HORIZONTAL_MAX));
     
-    while(usStartX++ <= usEndX)
-    {
-        ILI9341DrawOnePixel(usStartX, usY, ulColor);
-    }
+    ILI9341SetCurPos(usStartX, usEndX, usY, usY);
+    ILI9341ColorRunWrite(ulColor, usEndX - usStartX + 1);
 }
 
 //*****************************************************************************
@@ -685,13 +755,65 @@ void
 ILI9341DrawVerticalLine(unsigned short usX, unsigned short usStartY,
                         unsigned short usEndY, unsigned long ulColor)
 {
-    xASSERT((usStartY <= usEndY) && (usEndY <= LCD_VERTICAL_MAX) && (usStartY >= 0));
+    xASSERT((usStartY <= usEndY) && (usEndY < LCD_VERTICAL_MAX));
     
-    while(usStartY++ <= usEndY)
+    ILI9341SetCurPos(usX, usX, usStartY, usEndY);
+    ILI9341ColorRunWrite(ulColor, usEndY - usStartY + 1);
+}
+
+//*****************************************************************************
+//
+//! \brief Write a 1 bpp glyph into the open window as color runs.
+//!
+//! \param pucBits is the glyph bitmap, MSB is the left pixel.
+//! \param ulBytes is the bitmap size in bytes.
+//! \param fColor is the foreground color.
+//! \param bColor is the background color.
+//!
+//! The glyph rows must be whole bytes wide. Pixels of the same color, also
+//! across row ends, are written with one ILI9341ColorRunWrite() call.
+//!
+//! \return None.
+//
+//*****************************************************************************
+#if ((defined ILI9341_CHARACTER_FONT_8X16) || \
+     (defined ILI9341_CHINESE_FONT_16X16) || \
+     (defined ILI9341_CHINESE_FONT_32X32))
+static void
+ILI9341GlyphWrite(const unsigned char *pucBits, unsigned long ulBytes,
+                  unsigned long fColor, unsigned long bColor)
+{
+    unsigned long ulRun = 0;
+    unsigned char ucBits, ucBit, ucFg = 0;
+
+    while(ulBytes--)
     {
-        ILI9341DrawOnePixel(usX, usStartY, ulColor);
+        ucBits = *pucBits++;
+
+        //
+        // A whole byte of the current color just makes the run longer.
+        //
+        if(ucBits == (ucFg ? 0xFF : 0x00))
+        {
+            ulRun += 8;
+            continue;
+        }
+
+        for(ucBit = 0; ucBit < 8; ucBit++)
+        {
+            if(((ucBits & 0x80) ? 1 : 0) != ucFg)
+            {
+                ILI9341ColorRunWrite(ucFg ? fColor : bColor, ulRun);
+                ucFg ^= 1;
+                ulRun = 0;
+            }
+            ulRun++;
+            ucBits <<= 1;
+        }
     }
+    ILI9341ColorRunWrite(ucFg ? fColor : bColor, ulRun);
 }
+#endif
 
 //*****************************************************************************
 //
@@ -709,28 +831,11 @@ ILI9341DrawVerticalLine(unsigned short usX, unsigned short usStartY,
 void ILI9341PutChar8x16(unsigned short usX, unsigned short usY, char c, 
                          unsigned long fColor, unsigned long bColor)
 {
-    unsigned int i, j;
-    
     xASSERT((usX <= LCD_HORIZONTAL_MAX) && (usY <= LCD_VERTICAL_MAX));
+    xASSERT((c >= 0x20) && (c < 0x80));
     
     ILI9341SetCurPos(usX, usX + 8 - 1, usY, usY + 16 - 1);
-	
-    for(i = 0; i < 16; i++) 
-    {
-        unsigned char m = Font8x16[(c - 0x20) * 16 + i];
-        for(j = 0; j < 8; j++) 
-        {
-            if((m & 0x80) == 0x80) 
-            {
-                ILI9341WriteData(fColor);
-            }
-            else 
-            {
-                ILI9341WriteData(bColor);
-            }
-            m <<= 1;
-        }
-    }
+    ILI9341GlyphWrite(&Font8x16[(c - 0x20) * 16], 16, fColor, bColor);
 }
 #endif
 
@@ -750,32 +855,17 @@ void ILI9341PutChar8x16(unsigned short usX, unsigned short usY, char c,
 void ILI9341PutGB1616(unsigned short usX, unsigned short usY, unsigned char ucChinese[2], 
                        unsigned long fColor,unsigned long bColor)
 {
-    unsigned char i,j,k;
+    unsigned char k;
     
     xASSERT((usX <= LCD_HORIZONTAL_MAX) && (usY <= LCD_VERTICAL_MAX));
     
-    ILI9341SetCurPos(usX,  usX + 16 - 1, usY, usY + 16 - 1);
-	
-    for (k = 0; k < 64; k++) 
+    for (k = 0; k < sizeof(codeGB_16) / sizeof(codeGB_16[0]); k++) 
     { 
         if ((codeGB_16[k].Index[0] == ucChinese[0])&&(codeGB_16[k].Index[1] == ucChinese[1]))
         { 
-            for(i = 0; i < 32; i++) 
-            {
-                unsigned short m = codeGB_16[k].Msk[i];
-                for(j = 0; j < 8; j++) 
-                {
-                    if((m & 0x80) == 0x80) 
-                    {
-                        ILI9341WriteData(fColor);
-                    }
-                    else 
-                    {
-                        ILI9341WriteData(bColor);
-                    }
-                    m <<= 1;
-                } 
-            }
+            ILI9341SetCurPos(usX,  usX + 16 - 1, usY, usY + 16 - 1);
+            ILI9341GlyphWrite(codeGB_16[k].Msk, 32, fColor, bColor);
+            break;
         }  
     }	
 }
@@ -797,32 +887,17 @@ void ILI9341PutGB1616(unsigned short usX, unsigned short usY, unsigned char ucCh
 void ILI9341PutGB3232(unsigned short usX, unsigned short  usY, unsigned char ucChinese[2], 
                        unsigned long fColor,unsigned long bColor)
 {
-    unsigned char i, j, k;
-
+    unsigned char k;
+    
     xASSERT((usX < LCD_HORIZONTAL_MAX) && (usY < LCD_VERTICAL_MAX));
     
-    ILI9341SetCurPos(usX,  usX + 32 - 1, usY, usY + 32 - 1);
-	
-    for (k = 0; k < 5; k++) 
+    for (k = 0; k < sizeof(codeGB_32) / sizeof(codeGB_32[0]); k++) 
     { 
         if ((codeGB_32[k].Index[0] == ucChinese[0])&&(codeGB_32[k].Index[1] == ucChinese[1]))
         { 
-            for(i = 0; i < 128; i++) 
-            {
-                unsigned short m = codeGB_32[k].Msk[i];
-                for(j = 0; j < 8; j++) 
-                {
-                    if((m & 0x80) == 0x80) 
-                    {
-                        ILI9341WriteData(fColor);
-                    }
-                    else 
-                    {
-                        ILI9341WriteData(bColor);
-                    }
-                    m <<= 1;
-                } 
-            }
+            ILI9341SetCurPos(usX,  usX + 32 - 1, usY, usY + 32 - 1);
+            ILI9341GlyphWrite(codeGB_32[k].Msk, 128, fColor, bColor);
+            break;
         }  
     }	
 }
@@ -210,6 +210,27 @@ extern "C"
 //
 //*****************************************************************************
 
+//*****************************************************************************
+//
+//! \addtogroup ILI9341_Gfx2D ILI9341 Gfx2D Operations
+//! \brief Initializer of a tGfx2DDisplayOps, to draw on this controller with
+//! the shared Gfx2D core.
+//! \code
+//! const tGfx2DDisplayOps sOps = ILI9341_GFX2D_OPS;
+//! Gfx2DInit(&sCtx, &sOps, LCD_HORIZONTAL_MAX, LCD_VERTICAL_MAX);
+//! \endcode
+//! @{
+//
+//*****************************************************************************
+
+#define ILI9341_GFX2D_OPS       {ILI9341SetCurPos, ILI9341ColorRunWrite, 0}
+
+//*****************************************************************************
+//
+//! @}
+//
+//*****************************************************************************
+
 //*****************************************************************************
 //
 //! \addtogroup ILI9341S_Exported_APIs  ILI9341S Driver APIs
@@ -259,6 +280,7 @@ extern void ILI9341WriteData(unsigned long ucData);
 extern void ILI9341Write8Bit(unsigned char ucData);
 extern void ILI9341WritePixelData(unsigned long ulData);
 extern unsigned long ILI9341Read(unsigned char ucRS);
+extern void ILI9341ColorRunWrite(unsigned long ulColor, unsigned long ulCount);
 extern void ILI9341SetCurPos(unsigned long ulStartX, unsigned long ulEndX, 
                   unsigned long ulStartY, unsigned long ulEndY);
 
@@ -49,22 +49,25 @@
 #ifdef USE_HARDWARE_IIC
 #include "xhw_i2c.h"
 #include "xi2c.h"
+#else
+#include "SoftI2C.h"
 #endif
 
 
 //**************************************************************
 //
 //! \internal
-//! \brief software IIC SCL and SDA I/O control define
+//! \brief The IIC bus and the transfer calls. The software bus takes the
+//! same calls as the hardware one.
 //
 //***************************************************************
-#ifdef USE_SOFTWARE_IIC
-#define IIC_SDA_SET     xGPIOSPinWrite(LCD1602_IIC_PIN_SDA,1)
-#define IIC_SDA_CLR     xGPIOSPinWrite(LCD1602_IIC_PIN_SDA,0)
-#define IIC_SCL_SET     xGPIOSPinWrite(LCD1602_IIC_PIN_SCL,1)
-#define IIC_SCL_CLR     xGPIOSPinWrite(LCD1602_IIC_PIN_SCL,0)
-#define IIC_SDA_DDR_OUT xGPIOSDirModeSet(LCD1602_IIC_PIN_SDA, xGPIO_DIR_MODE_OD);
-#define IIC_SDA_DDR_IN  xGPIOSDirModeSet(LCD1602_IIC_PIN_SDA, xGPIO_DIR_MODE_IN);
+#ifdef USE_HARDWARE_IIC
+#define LCD1602_IIC_BUS LCD1602_IIC_PORT
+#define LCD1602IIC(api) xI2C##api
+#else
+static tSoftI2C sLCD1602IIC;
+#define LCD1602_IIC_BUS ((unsigned long)&sLCD1602IIC)
+#define LCD1602IIC(api) SoftI2C##api
 #endif
 
 //**************************************************************
@@ -78,14 +81,13 @@ static LCD1602Conf LCD1602Dev;
 //*****************************************************************************
 //
 //! \internal
-//! \brief IIC delay for software IIC communication.
+//! \brief Delay for the LCD1602 execution times.
 //!
 //! \param t specifies the time to delay.
 //!
-//! This function is to delay some time to reduce IIC clock, and other needed delay.
-//! The exact delay time is affected by MCU system clock. Most IIC bus can only work
-//! at lower than 400kHz. This program is tested at 72MHz system clock. It's important
-//! to modify the delay time in your application if your system clock is faster.
+//! The exact delay time is affected by MCU system clock. This program is
+//! tested at 72MHz system clock. It's important to modify the delay time in
+//! your application if your system clock is faster.
 //!
 //! \return None.
 //
@@ -96,209 +98,6 @@ void IICDelay(unsigned long t)
     xSysCtlDelay(t);
 }
 
-#ifdef USE_SOFTWARE_IIC
-
-//*****************************************************************************
-//
-//! \internal
-//! \brief Generate a start condition on I2C bus.
-//!
-//! \param None.
-//!
-//! \return None.
-//
-//*****************************************************************************
-static
-void IICStart(void)
-{
-    IIC_SDA_SET;
-    IIC_SCL_SET;
-    IICDelay(100);
-    //
-    //Start condition:when SCL is high,SDA change form high to low
-    //
-    IIC_SDA_CLR;
-    IICDelay(100);
-    IIC_SCL_CLR;
-    IICDelay(100);
-}
-//*****************************************************************************
-//
-//! \internal
-//! \brief Generate a stop condition on I2C bus.
-//!
-//! \param None.
-//!
-//! \return None.
-//
-//*****************************************************************************
-static
-void IICStop(void)
-{
-    IIC_SCL_CLR;
-    IIC_SDA_CLR;
-    //
-    //Stop Condition:when SCL is high SDA change form low to high
-    //
-    IICDelay(100);
-    IIC_SCL_SET;
-    IICDelay(100);
-    IIC_SDA_SET;
-    IICDelay(100);
-}
-
-//*****************************************************************************
-//
-//! \internal
-//! \brief Wait acknowledge signal.
-//!
-//! \param None
-//!
-//! Wait acknowledge signal from slave device after write data or address.
-//!
-//! \return 1:if not receive ack;  0:if receive ack.
-//
-//*****************************************************************************
-static
-unsigned char IICWaitAck(void)
-{
-    unsigned char ucOverTime = 0;
-    IIC_SCL_SET;
-    IICDelay(500);
-    IIC_SDA_DDR_IN;
-    IIC_SDA_SET;
-    IICDelay(500);
-
-    while(xGPIOSPinRead(LCD1602_IIC_PIN_SDA))
-    {
-        ucOverTime++;
-        if(ucOverTime > 250)
-        {
-            IICStop();
-            IIC_SDA_DDR_OUT;
-            return 1;
-        }
-    }
-    IIC_SCL_CLR;
-    IIC_SDA_DDR_OUT;
-    return 0;
-}
-
-//*****************************************************************************
-//
-//! \internal
-//! \brief Send acknowledge signal.
-//!
-//! \param None
-//!
-//! Generate an acknowledge signal after read data through IIC Bus.
-//!
-//! \return None.
-//
-//*****************************************************************************
-static
-void IICAck(void)
-{
-    IIC_SCL_CLR;
-    IIC_SDA_CLR;
-    IICDelay(100);
-    IIC_SCL_SET;
-    IICDelay(100);
-    IIC_SCL_CLR;
-}
-
-//*****************************************************************************
-//
-//! \internal
-//! \brief No acknowledge signal.
-//!
-//! \param None
-//!
-//! Do not generate an acknowledge signal after read data through IIC Bus.
-//!
-//! \return None.
-//
-//*****************************************************************************
-static
-void IICNAck(void)
-{
-    IIC_SCL_CLR;
-    IIC_SDA_SET;
-    IICDelay(100);
-    IIC_SCL_SET;
-    IICDelay(100);
-    IIC_SCL_CLR;
-}
-
-//*****************************************************************************
-//
-//! \internal
-//! \brief Send a byte through IIC.
-//!
-//! \param ucSendData The data to be sent.
-//!
-//! This function is to send a byte of data through I2C BUS.
-//!
-//! \return None.
-//
-//*****************************************************************************
-static
-void IICSendByte(unsigned char ucSendData)
-{
-    unsigned char i, tmp;
-
-    IIC_SCL_CLR;
-    tmp = ucSendData;
-    for(i = 0; i < 8; i++)
-    {
-        (tmp & 0x80) ? IIC_SDA_SET : IIC_SDA_CLR;
-        tmp <<= 1;
-        IICDelay(100);
-        IIC_SCL_SET;
-        IICDelay(100);
-        IIC_SCL_CLR;
-        IICDelay(100);
-    }
-}
-
-//*****************************************************************************
-//
-//! \internal
-//! \brief Read a byte through IIC.
-//!
-//! \param ucAck specifies whether to send an acknowledge signal.
-//!
-//! This function is to read a byte of data from I2C BUS.
-//!
-//! \return Read out data.
-//
-//*****************************************************************************
-static
-unsigned char IICReadByte(unsigned char ucAck)
-{
-    unsigned char i, ucRecDat = 0;
-    IIC_SDA_DDR_IN;
-    for(i = 0; i < 8; i++ )
-    {
-        IIC_SCL_CLR;
-        IICDelay(100);
-        IIC_SCL_SET;
-        ucRecDat <<= 1;
-        if(xGPIOSPinRead(LCD1602_IIC_PIN_SDA))
-        {
-            ucRecDat++;
-        }
-        IICDelay(100);
-    }
-    if (!ucAck)
-        IICNAck();
-    else
-        IICAck();
-    IIC_SDA_DDR_OUT;
-    return ucRecDat;
-}
-#endif  //end of #ifdef USE_SOFTWARE_IIC
-
 //*****************************************************************************
 //
 //! \internal
@@ -315,18 +114,8 @@ unsigned char IICReadByte(unsigned char ucAck)
 static
 void LCD1602IICExpandWrite(unsigned char ucValue)
 {
-#ifdef USE_HARDWARE_IIC
-    xI2CMasterWriteRequestS1(LCD1602_IIC_PORT, LCD1602Dev.ucDevAddr,
+    LCD1602IIC(MasterWriteRequestS1)(LCD1602_IIC_BUS, LCD1602Dev.ucDevAddr,
             (ucValue | LCD1602Dev.ucBackLightEn), xtrue);
-#else
-    IICStop();
-    IICStart();
-    IICSendByte(LCD1602Dev.ucDevAddr<<1);
-    IICWaitAck();
-    IICSendByte(ucValue | LCD1602Dev.ucBackLightEn);
-    IICWaitAck();
-    IICStop();
-#endif
 }
 
 //*****************************************************************************
@@ -729,7 +518,7 @@ void LCD1602PrintString(unsigned char ucRow, unsigned char ucCol, char *pStr)
 //
 //! \brief IIC interface initialization.
 //!
-//! \param ulCLK specify the IIC clock frequency, only effective in hardware IIC mode.
+//! \param ulCLK specify the IIC clock frequency.
 //!
 //! \return None.
 //
@@ -747,10 +536,12 @@ void IICInit(unsigned long ulCLK)
     I2CMasterInit(LCD1602_IIC_PORT, xSysCtlClockGet()/2, xfalse, xtrue);
     xI2CMasterEnable(LCD1602_IIC_PORT);
 #else
-    xGPIOSDirModeSet(LCD1602_IIC_PIN_SCL, xGPIO_DIR_MODE_OD);
-    xGPIOSDirModeSet(LCD1602_IIC_PIN_SDA, xGPIO_DIR_MODE_OD);
-    xGPIOSPinWrite(LCD1602_IIC_PIN_SDA,1);
-    xGPIOSPinWrite(LCD1602_IIC_PIN_SCL,1);
+    SoftI2CBusInit(&sLCD1602IIC,
+                   xGPIOSPinToPort(LCD1602_IIC_PIN_SCL),
+                   xGPIOSPinToPin(LCD1602_IIC_PIN_SCL),
+                   xGPIOSPinToPort(LCD1602_IIC_PIN_SDA),
+                   xGPIOSPinToPin(LCD1602_IIC_PIN_SDA));
+    SoftI2CMasterInit(LCD1602_IIC_BUS, ulCLK);
 #endif
 }
 
@@ -758,7 +549,7 @@ void IICInit(unsigned long ulCLK)
 //
 //! \brief LCD1602 initialization.
 //!
-//! \param ulCLK specify the IIC clock frequency, only effective in hardware IIC mode.
+//! \param ulCLK specify the IIC clock frequency.
 //!
 //! The LCD1602 will be initialized as follows:
 //! Device address(write) 0x20, 4bit data line, display on, back light on, cursor on,
@@ -102,7 +102,7 @@ extern "C"
 //*****************************************************************************
 
 //
-//! Select hardware IIC or software IIC
+//! Select hardware IIC or software IIC (SoftI2C on the pins below)
 //
 #define USE_SOFTWARE_IIC
 //#define USE_HARDWARE_IIC
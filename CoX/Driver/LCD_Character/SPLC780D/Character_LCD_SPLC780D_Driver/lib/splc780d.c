@@ -681,3 +681,37 @@ SPLC780DisplayRightShift(unsigned char n)
                                         SPLC780_CURSOR_DISPLAY_SHIFT_RL_R));
     }    
 }
+
+#ifdef SPLC780_CHAR_LCD
+
+//
+// Controller access for the refresher.
+//
+static const tCharLCDPort g_sSPLC780CharLCDPort =
+{
+    SPLC780WriteCmd,
+    SPLC780WriteData,
+    SPLC780Busy,
+};
+
+//*****************************************************************************
+//
+//! \brief Init a shadow buffered refresher for the SPLC780D.
+//!
+//! \param psLCD is the refresher.
+//!
+//! SPLC780Init() must be called before. Write the text with the CharLCD APIs
+//! and call CharLCDTick() from a periodic timer. CHAR_LCD_COLS_MAX must not
+//! be less than SPLC780_DISPLAY_CHARACTER.
+//!
+//! \return None.
+//
+//*****************************************************************************
+void
+SPLC780CharLCDInit(tCharLCD *psLCD)
+{
+    CharLCDInit(psLCD, &g_sSPLC780CharLCDPort, SPLC780_DISPLAY_CHARACTER,
+                SPLC780_DISPLAY_LINE);
+}
+
+#endif
@@ -205,6 +205,16 @@ extern "C"
 #define SPLC780_INTERFACE_DATA_LEN                                            \
                                 SPLC780_INTERFACE_DATA_LEN_4
 
+//
+//! Export SPLC780CharLCDInit(), the LCD is written by the shadow buffered
+//! refresher in CharLCD.c.
+//
+//#define SPLC780_CHAR_LCD
+
+#ifdef SPLC780_CHAR_LCD
+#include "CharLCD.h"
+#endif
+
 //*****************************************************************************
 //
 //! @}
@@ -334,6 +344,10 @@ extern void SPLC780WriteData(unsigned char ucData);
 extern unsigned long SPLC780ReadState(void);
 extern unsigned long SPLC780ReadData(void);
 
+#ifdef SPLC780_CHAR_LCD
+extern void SPLC780CharLCDInit(tCharLCD *psLCD);
+#endif
+
 //*****************************************************************************
 //
 //! @}
@@ -684,6 +684,25 @@ SSD2119WritePixelData(unsigned long ulData)
     SSD2119Write(SSD2119_DC_DATA, ulData, SSD2119_GRAM_REG);
 }
 
+//*****************************************************************************
+//
+//! \brief Write the same pixel color many times into the open window.
+//!
+//! \param ulColor is the pixel color.
+//! \param ulCount is the number of pixels.
+//!
+//! \return None.
+//
+//*****************************************************************************
+void
+SSD2119ColorRunWrite(unsigned long ulColor, unsigned long ulCount)
+{
+    while(ulCount--)
+    {
+        SSD2119WritePixelData(ulColor);
+    }
+}
+
 //*****************************************************************************
 //
 //! \brief Set the cursor location.
@@ -1173,8 +1192,6 @@ void
 SSD2119DisplayRectFill(unsigned short usStartX, unsigned short usEndX, 
                         unsigned short usStartY, unsigned short usEndY, unsigned long ulColor)
 {
-    unsigned short usTemp;
-	
     //
     // Check Arguments.
     //
@@ -1188,10 +1205,8 @@ SSD2119DisplayRectFill(unsigned short usStartX, unsigned short usEndX,
     //
     SSD2119SetCurPos(usStartX, usEndX, usStartY, usEndY); 
     
-    for(usTemp = 0; usTemp <= (usEndX - usStartX + 1) * (usEndY - usStartY + 1); usTemp++)
-    {
-        SSD2119WriteData(ulColor);
-    }
+    SSD2119ColorRunWrite(ulColor, (unsigned long)(usEndX - usStartX + 1) *
+                                  (usEndY - usStartY + 1));
 }
 
 //*****************************************************************************
@@ -1530,12 +1545,10 @@ void
 SSD2119DrawHorizontalLine(unsigned short usStartX, unsigned short usEndX,
                           unsigned short usY, unsigned long ulColor)
 {
-    xASSERT((usStartX <= usEndX) && (usEndX <= LCD_HORIZONTAL_MAX) && (usStartX >= 0));
+    xASSERT((usStartX <= usEndX) && (usEndX < LCD_HORIZONTAL_MAX));
     
-    while(usStartX++ <= usEndX)
-    {
-        SSD2119DrawOnePixel(usStartX, usY, ulColor);
-    }
+    SSD2119SetCurPos(usStartX, usEndX, usY, usY);
+    SSD2119ColorRunWrite(ulColor, usEndX - usStartX + 1);
 }
 
 //*****************************************************************************
@@ -1557,13 +1570,65 @@ void
 SSD2119DrawVerticalLine(unsigned short usX, unsigned short usStartY,
                         unsigned short usEndY, unsigned long ulColor)
 {
-    xASSERT((usStartY <= usEndY) && (usEndY <= LCD_VERTICAL_MAX) && (usStartY >= 0));
+    xASSERT((usStartY <= usEndY) && (usEndY < LCD_VERTICAL_MAX));
     
-    while(usStartY++ <= usEndY)
+    SSD2119SetCurPos(usX, usX, usStartY, usEndY);
+    SSD2119ColorRunWrite(ulColor, usEndY - usStartY + 1);
+}
+
+//*****************************************************************************
+//
+//! \brief Write a 1 bpp glyph into the open window as color runs.
+//!
+//! \param pucBits is the glyph bitmap, MSB is the left pixel.
+//! \param ulBytes is the bitmap size in bytes.
+//! \param fColor is the foreground color.
+//! \param bColor is the background color.
+//!
+//! The glyph rows must be whole bytes wide. Pixels of the same color, also
+//! across row ends, are written with one SSD2119ColorRunWrite() call.
+//!
+//! \return None.
+//
+//*****************************************************************************
+#if ((defined SSD2119_CHARACTER_FONT_8X16) || \
+     (defined SSD2119_CHINESE_FONT_16X16) || \
+     (defined SSD2119_CHINESE_FONT_32X32))
+static void
+SSD2119GlyphWrite(const unsigned char *pucBits, unsigned long ulBytes,
+                  unsigned long fColor, unsigned long bColor)
+{
+    unsigned long ulRun = 0;
+    unsigned char ucBits, ucBit, ucFg = 0;
+
+    while(ulBytes--)
     {
-        SSD2119DrawOnePixel(usX, usStartY, ulColor);
+        ucBits = *pucBits++;
+
+        //
+        // A whole byte of the current color just makes the run longer.
+        //
+        if(ucBits == (ucFg ? 0xFF : 0x00))
+        {
+            ulRun += 8;
+            continue;
+        }
+
+        for(ucBit = 0; ucBit < 8; ucBit++)
+        {
+            if(((ucBits & 0x80) ? 1 : 0) != ucFg)
+            {
+                SSD2119ColorRunWrite(ucFg ? fColor : bColor, ulRun);
+                ucFg ^= 1;
+                ulRun = 0;
+            }
+            ulRun++;
+            ucBits <<= 1;
+        }
     }
+    SSD2119ColorRunWrite(ucFg ? fColor : bColor, ulRun);
 }
+#endif
 
 //*****************************************************************************
 //
@@ -1581,27 +1646,11 @@ SSD2119DrawVerticalLine(unsigned short usX, unsigned short usStartY,
 void SSD2119PutChar8x16(unsigned short usX, unsigned short usY, char c, 
                          unsigned long fColor, unsigned long bColor)
 {
-    unsigned int i, j;
-    
     xASSERT((usX <= LCD_HORIZONTAL_MAX) && (usY <= LCD_VERTICAL_MAX));
+    xASSERT((c >= 0x20) && (c < 0x80));
     
     SSD2119SetCurPos(usX, usX + 8 - 1, usY, usY + 16 - 1);
-    for(i = 0; i < 16; i++) 
-    {
-        unsigned char m = Font8x16[(c - 0x20) * 16 + i];
-	for(j = 0; j < 8; j++) 
-        {
-            if((m & 0x80) == 0x80) 
-            {
-                SSD2119WritePixelData(fColor);
-            }
-            else 
-            {
-                SSD2119WritePixelData(bColor);
-            }
-            m <<= 1;
-        }
-    }
+    SSD2119GlyphWrite(&Font8x16[(c - 0x20) * 16], 16, fColor, bColor);
 }
 #endif
 
@@ -1621,32 +1670,17 @@ void SSD2119PutChar8x16(unsigned short usX, unsigned short usY, char c,
 void SSD2119PutGB1616(unsigned short usX, unsigned short usY, unsigned char ucChinese[2], 
                        unsigned long fColor,unsigned long bColor)
 {
-    unsigned char i,j,k;
+    unsigned char k;
     
     xASSERT((usX <= LCD_HORIZONTAL_MAX) && (usY <= LCD_VERTICAL_MAX));
     
-    SSD2119SetCurPos(usX,  usX + 16 - 1, usY, usY + 16 - 1);
-
-    for (k = 0; k < 64; k++) 
+    for (k = 0; k < sizeof(codeGB_16) / sizeof(codeGB_16[0]); k++) 
     { 
         if ((codeGB_16[k].Index[0] == ucChinese[0])&&(codeGB_16[k].Index[1] == ucChinese[1]))
         { 
-            for(i = 0; i < 32; i++) 
-            {
-                unsigned short m = codeGB_16[k].Msk[i];
-                for(j = 0; j < 8; j++) 
-                {
-                    if((m & 0x80) == 0x80) 
-                    {
-                        SSD2119WritePixelData(fColor);
-                    }
-                    else 
-                    {
-                        SSD2119WritePixelData(bColor);
-                    }
-                    m <<= 1;
-                } 
-            }
+            SSD2119SetCurPos(usX,  usX + 16 - 1, usY, usY + 16 - 1);
+            SSD2119GlyphWrite(codeGB_16[k].Msk, 32, fColor, bColor);
+            break;
         }  
     }	
 }
@@ -1668,32 +1702,17 @@ void SSD2119PutGB1616(unsigned short usX, unsigned short usY, unsigned char ucCh
 void SSD2119PutGB3232(unsigned short usX, unsigned short  usY, unsigned char ucChinese[2], 
                        unsigned long fColor,unsigned long bColor)
 {
-    unsigned char i, j, k;
-
+    unsigned char k;
+    
     xASSERT((usX <= LCD_HORIZONTAL_MAX) && (usY <= LCD_VERTICAL_MAX));
     
-    SSD2119SetCurPos(usX,  usX + 32 - 1, usY, usY + 32 - 1);
-
-    for (k = 0; k < 5; k++) 
+    for (k = 0; k < sizeof(codeGB_32) / sizeof(codeGB_32[0]); k++) 
     { 
         if ((codeGB_32[k].Index[0] == ucChinese[0])&&(codeGB_32[k].Index[1] == ucChinese[1]))
         { 
-            for(i = 0; i < 128; i++) 
-            {
-                unsigned short m = codeGB_32[k].Msk[i];
-                for(j = 0; j < 8; j++) 
-                {
-                    if((m & 0x80) == 0x80) 
-                    {
-                        SSD2119WriteData(fColor);
-                    }
-                    else 
-                    {
-                        SSD2119WriteData(bColor);
-                    }
-                    m <<= 1;
-                } 
-            }
+            SSD2119SetCurPos(usX,  usX + 32 - 1, usY, usY + 32 - 1);
+            SSD2119GlyphWrite(codeGB_32[k].Msk, 128, fColor, bColor);
+            break;
         }  
     }	
 }
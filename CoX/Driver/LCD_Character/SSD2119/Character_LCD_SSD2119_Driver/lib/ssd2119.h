@@ -513,6 +513,27 @@ extern "C"
 //
 //*****************************************************************************
 
+//*****************************************************************************
+//
+//! \addtogroup SSD2119_Gfx2D SSD2119 Gfx2D Operations
+//! \brief Initializer of a tGfx2DDisplayOps, to draw on this controller with
+//! the shared Gfx2D core.
+//! \code
+//! const tGfx2DDisplayOps sOps = SSD2119_GFX2D_OPS;
+//! Gfx2DInit(&sCtx, &sOps, LCD_HORIZONTAL_MAX, LCD_VERTICAL_MAX);
+//! \endcode
+//! @{
+//
+//*****************************************************************************
+
+#define SSD2119_GFX2D_OPS       {SSD2119SetCurPos, SSD2119ColorRunWrite, 0}
+
+//*****************************************************************************
+//
+//! @}
+//
+//*****************************************************************************
+
 //*****************************************************************************
 //
 //! \addtogroup SSD2119_Exported_APIs  SSD2119 Driver APIs
@@ -563,6 +584,7 @@ extern void SSD2119WriteCmd(unsigned char ucCmd);
 extern void SSD2119WriteData(unsigned long ucData);
 extern void SSD2119WritePixelData(unsigned long ulData);
 extern unsigned long SSD2119Read(unsigned char ucDC);
+extern void SSD2119ColorRunWrite(unsigned long ulColor, unsigned long ulCount);
 extern void SSD2119SetCurPos(unsigned long ulStartX, unsigned long ulEndX, 
                   unsigned long ulStartY, unsigned long ulEndY);
 
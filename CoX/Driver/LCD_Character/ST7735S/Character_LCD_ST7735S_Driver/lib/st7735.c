@@ -209,6 +209,82 @@ ST7735WriteData(unsigned long ulData)
     ST7735Write(ST7735_RS_DATA, ulData);
 }
 
+//*****************************************************************************
+//
+//! \brief Put one byte on the data bus and strobe WR.
+//!
+//! \param ucData is the byte to write.
+//!
+//! CS and RS must already be set by the caller.
+//!
+//! \return None.
+//
+//*****************************************************************************
+static void 
+ST7735BusWrite(unsigned char ucData)
+{
+    xGPIOSPinWrite(ST7735_PIN_D7, (ucData >> 7) & 0x01);
+    xGPIOSPinWrite(ST7735_PIN_D6, (ucData >> 6) & 0x01);
+    xGPIOSPinWrite(ST7735_PIN_D5, (ucData >> 5) & 0x01);
+    xGPIOSPinWrite(ST7735_PIN_D4, (ucData >> 4) & 0x01);
+    xGPIOSPinWrite(ST7735_PIN_D3, (ucData >> 3) & 0x01);
+    xGPIOSPinWrite(ST7735_PIN_D2, (ucData >> 2) & 0x01);
+    xGPIOSPinWrite(ST7735_PIN_D1, (ucData >> 1) & 0x01);
+    xGPIOSPinWrite(ST7735_PIN_D0, ucData & 0x01);
+    xGPIOSPinWrite(ST7735_PIN_WR, ST7735_WR_LOW);
+    xGPIOSPinWrite(ST7735_PIN_WR, ST7735_WR_HIGH);
+}
+
+//*****************************************************************************
+//
+//! \brief Write the same pixel color many times into the open window.
+//!
+//! \param ulColor is the pixel color.
+//! \param ulCount is the number of pixels.
+//!
+//! CS and RS are set once for the whole run. When both bytes of the color
+//! are equal the bus is set up once and only WR is strobed.
+//!
+//! \return None.
+//
+//*****************************************************************************
+void 
+ST7735ColorRunWrite(unsigned long ulColor, unsigned long ulCount)
+{
+    unsigned char ucHigh = (ulColor >> 8) & 0xFF;
+    unsigned char ucLow = ulColor & 0xFF;
+
+    if(ulCount == 0)
+    {
+        return;
+    }
+
+    xGPIOSPinWrite(ST7735_PIN_CS, ST7735_CS_ENABLE);
+    xGPIOSPinWrite(ST7735_PIN_RS, ST7735_RS_DATA);
+    xGPIOSPinWrite(ST7735_PIN_RD, ST7735_RD_WRITE);
+
+    if(ucHigh == ucLow)
+    {
+        ST7735BusWrite(ucLow);
+        ulCount = ulCount * 2 - 1;
+        while(ulCount--)
+        {
+            xGPIOSPinWrite(ST7735_PIN_WR, ST7735_WR_LOW);
+            xGPIOSPinWrite(ST7735_PIN_WR, ST7735_WR_HIGH);
+        }
+    }
+    else
+    {
+        while(ulCount--)
+        {
+            ST7735BusWrite(ucHigh);
+            ST7735BusWrite(ucLow);
+        }
+    }
+
+    xGPIOSPinWrite(ST7735_PIN_CS, ST7735_CS_DISABLE);
+}
+
 //*****************************************************************************
 //
 //! \brief Set the cursor location.
@@ -229,7 +305,7 @@ ST7735SetCurPos(unsigned long ulStartX, unsigned long ulEndX,
     //
     // Check Arguments.
     //
-    xASSERT((ulStartX < ulEndX) && (ulStartY < ulEndY));
+    xASSERT((ulStartX <= ulEndX) && (ulStartY <= ulEndY));
     xASSERT((ulEndX < LCD_HORIZONTAL_MAX) && (ulEndY < LCD_VERTICAL_MAX));
   
     //
@@ -468,8 +544,6 @@ void
 ST7735DisplayRectFill(unsigned short usStartX, unsigned short usEndX, 
                         unsigned short usStartY, unsigned short usEndY, unsigned long ulColor)
 {
-    unsigned short usTemp;
-	
     //
     // Check Arguments.
     //
@@ -483,10 +557,8 @@ ST7735DisplayRectFill(unsigned short usStartX, unsigned short usEndX,
     //
     ST7735SetCurPos(usStartX, usEndX, usStartY, usEndY); 
 	
-    for(usTemp = 0; usTemp <= (usEndX - usStartX + 1) * (usEndY - usStartY + 1); usTemp++)
-    {
-        ST7735WriteData(ulColor);
-    }
+    ST7735ColorRunWrite(ulColor, (unsigned long)(usEndX - usStartX + 1) *
+                                 (usEndY - usStartY + 1));
 }
 
 //*****************************************************************************
@@ -639,12 +711,10 @@ void
 ST7735DrawHorizontalLine(unsigned short usStartX, unsigned short usEndX,
                           unsigned short usY, unsigned long ulColor)
 {
-    xASSERT((usStartX <= usEndX) && (usEndX <= LCD_HORIZONTAL_MAX) && (usStartX >= 0));
+    xASSERT((usStartX <= usEndX) && (usEndX < LCD_HORIZONTAL_MAX));
     
-    while(usStartX++ <= usEndX)
-    {
-        ST7735DrawOnePixel(usStartX, usY, ulColor);
-    }
+    ST7735SetCurPos(usStartX, usEndX, usY, usY);
+    ST7735ColorRunWrite(ulColor, usEndX - usStartX + 1);
 }
 
 //*****************************************************************************
@@ -666,13 +736,65 @@ void
 ST7735DrawVerticalLine(unsigned short usX, unsigned short usStartY,
                         unsigned short usEndY, unsigned long ulColor)
 {
-    xASSERT((usStartY <= usEndY) && (usEndY <= LCD_VERTICAL_MAX) && (usStartY >= 0));
+    xASSERT((usStartY <= usEndY) && (usEndY < LCD_VERTICAL_MAX));
     
-    while(usStartY++ <= usEndY)
+    ST7735SetCurPos(usX, usX, usStartY, usEndY);
+    ST7735ColorRunWrite(ulColor, usEndY - usStartY + 1);
+}
+
+//*****************************************************************************
+//
+//! \brief Write a 1 bpp glyph into the open window as color runs.
+//!
+//! \param pucBits is the glyph bitmap, MSB is the left pixel.
+//! \param ulBytes is the bitmap size in bytes.
+//! \param fColor is the foreground color.
+//! \param bColor is the background color.
+//!
+//! The glyph rows must be whole bytes wide. Pixels of the same color, also
+//! across row ends, are written with one ST7735ColorRunWrite() call.
+//!
+//! \return None.
+//
+//*****************************************************************************
+#if ((defined ST7735_CHARACTER_FONT_8X16) || \
+     (defined ST7735_CHINESE_FONT_16X16) || \
+     (defined ST7735_CHINESE_FONT_32X32))
+static void
+ST7735GlyphWrite(const unsigned char *pucBits, unsigned long ulBytes,
+                 unsigned long fColor, unsigned long bColor)
+{
+    unsigned long ulRun = 0;
+    unsigned char ucBits, ucBit, ucFg = 0;
+
+    while(ulBytes--)
     {
-        ST7735DrawOnePixel(usX, usStartY, ulColor);
+        ucBits = *pucBits++;
+
+        //
+        // A whole byte of the current color just makes the run longer.
+        //
+        if(ucBits == (ucFg ? 0xFF : 0x00))
+        {
+            ulRun += 8;
+            continue;
+        }
+
+        for(ucBit = 0; ucBit < 8; ucBit++)
+        {
+            if(((ucBits & 0x80) ? 1 : 0) != ucFg)
+            {
+                ST7735ColorRunWrite(ucFg ? fColor : bColor, ulRun);
+                ucFg ^= 1;
+                ulRun = 0;
+            }
+            ulRun++;
+            ucBits <<= 1;
+        }
     }
+    ST7735ColorRunWrite(ucFg ? fColor : bColor, ulRun);
 }
+#endif
 
 //*****************************************************************************
 //
@@ -690,28 +812,11 @@ ST7735DrawVerticalLine(unsigned short usX, unsigned short usStartY,
 void ST7735PutChar8x16(unsigned short usX, unsigned short usY, char c, 
                          unsigned long fColor, unsigned long bColor)
 {
-    unsigned int i, j;
-    
     xASSERT((usX <= LCD_HORIZONTAL_MAX) && (usY <= LCD_VERTICAL_MAX));
+    xASSERT((c >= 0x20) && (c < 0x80));
     
     ST7735SetCurPos(usX, usX + 8 - 1, usY, usY + 16 - 1);
-	
-    for(i = 0; i < 16; i++) 
-    {
-        unsigned char m = Font8x16[(c - 0x20) * 16 + i];
-        for(j = 0; j < 8; j++) 
-        {
-            if((m & 0x80) == 0x80) 
-            {
-                ST7735WriteData(fColor);
-            }
-            else 
-            {
-                ST7735WriteData(bColor);
-            }
-            m <<= 1;
-        }
-    }
+    ST7735GlyphWrite(&Font8x16[(c - 0x20) * 16], 16, fColor, bColor);
 }
 #endif
 
@@ -731,32 +836,17 @@ void ST7735PutChar8x16(unsigned short usX, unsigned short usY, char c,
 void ST7735PutGB1616(unsigned short usX, unsigned short usY, unsigned char ucChinese[2], 
                        unsigned long fColor,unsigned long bColor)
 {
-    unsigned char i,j,k;
+    unsigned char k;
     
     xASSERT((usX <= LCD_HORIZONTAL_MAX) && (usY <= LCD_VERTICAL_MAX));
     
-    ST7735SetCurPos(usX,  usX + 16 - 1, usY, usY + 16 - 1);
-	
-    for (k = 0; k < 64; k++) 
+    for (k = 0; k < sizeof(codeGB_16) / sizeof(codeGB_16[0]); k++) 
     { 
         if ((codeGB_16[k].Index[0] == ucChinese[0])&&(codeGB_16[k].Index[1] == ucChinese[1]))
         { 
-            for(i = 0; i < 32; i++) 
-            {
-                unsigned short m = codeGB_16[k].Msk[i];
-                for(j = 0; j < 8; j++) 
-                {
-                    if((m & 0x80) == 0x80) 
-                    {
-                        ST7735WriteData(fColor);
-                    }
-                    else 
-                    {
-                        ST7735WriteData(bColor);
-                    }
-                    m <<= 1;
-                } 
-            }
+            ST7735SetCurPos(usX,  usX + 16 - 1, usY, usY + 16 - 1);
+            ST7735GlyphWrite(codeGB_16[k].Msk, 32, fColor, bColor);
+            break;
         }  
     }	
 }
@@ -778,32 +868,17 @@ void ST7735PutGB1616(unsigned short usX, unsigned short usY, unsigned char ucChi
 void ST7735PutGB3232(unsigned short usX, unsigned short  usY, unsigned char ucChinese[2], 
                        unsigned long fColor,unsigned long bColor)
 {
-    unsigned char i, j, k;
-
+    unsigned char k;
+    
     xASSERT((usX < LCD_HORIZONTAL_MAX) && (usY < LCD_VERTICAL_MAX));
     
-    ST7735SetCurPos(usX,  usX + 32 - 1, usY, usY + 32 - 1);
-	
-    for (k = 0; k < 5; k++) 
+    for (k = 0; k < sizeof(codeGB_32) / sizeof(codeGB_32[0]); k++) 
     { 
         if ((codeGB_32[k].Index[0] == ucChinese[0])&&(codeGB_32[k].Index[1] == ucChinese[1]))
         { 
-            for(i = 0; i < 128; i++) 
-            {
-                unsigned short m = codeGB_32[k].Msk[i];
-                for(j = 0; j < 8; j++) 
-                {
-                    if((m & 0x80) == 0x80) 
-                    {
-                        ST7735WriteData(fColor);
-                    }
-                    else 
-                    {
-                        ST7735WriteData(bColor);
-                    }
-                    m <<= 1;
-                } 
-            }
+            ST7735SetCurPos(usX,  usX + 32 - 1, usY, usY + 32 - 1);
+            ST7735GlyphWrite(codeGB_32[k].Msk, 128, fColor, bColor);
+            break;
         }  
     }	
 }
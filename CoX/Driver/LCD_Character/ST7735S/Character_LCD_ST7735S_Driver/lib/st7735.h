@@ -210,6 +210,27 @@ extern "C"
 //
 //*****************************************************************************
 
+//*****************************************************************************
+//
+//! \addtogroup ST7735_Gfx2D ST7735 Gfx2D Operations
+//! \brief Initializer of a tGfx2DDisplayOps, to draw on this controller with
+//! the shared Gfx2D core.
+//! \code
+//! const tGfx2DDisplayOps sOps = ST7735_GFX2D_OPS;
+//! Gfx2DInit(&sCtx, &sOps, LCD_HORIZONTAL_MAX, LCD_VERTICAL_MAX);
+//! \endcode
+//! @{
+//
+//*****************************************************************************
+
+#define ST7735_GFX2D_OPS       {ST7735SetCurPos, ST7735ColorRunWrite, 0}
+
+//*****************************************************************************
+//
+//! @}
+//
+//*****************************************************************************
+
 //*****************************************************************************
 //
 //! \addtogroup ST7735S_Exported_APIs  ST7735S Driver APIs
@@ -258,6 +279,7 @@ extern void ST7735WriteCmd(unsigned char ucCmd);
 extern void ST7735WriteData(unsigned long ucData);
 extern void ST7735WritePixelData(unsigned long ulData);
 extern unsigned long ST7735Read(unsigned char ucRS);
+extern void ST7735ColorRunWrite(unsigned long ulColor, unsigned long ulCount);
 extern void ST7735SetCurPos(unsigned long ulStartX, unsigned long ulEndX, 
                   unsigned long ulStartY, unsigned long ulEndY);
 
@@ -48,11 +48,56 @@
 unsigned char data_pins[] = {xGPIO_PIN_0, xGPIO_PIN_1, xGPIO_PIN_2, xGPIO_PIN_3,
                         xGPIO_PIN_4, xGPIO_PIN_5, xGPIO_PIN_6, xGPIO_PIN_7};
 
+#ifdef T6963C_DATA_GPIO_BUS
+//
+// The data pins are a GPIO bus, one store writes the byte.
+//
+#define LCD_DATA_MASK  (LCD_D0 | LCD_D1 | LCD_D2 | LCD_D3 |                   \
+                        LCD_D4 | LCD_D5 | LCD_D6 | LCD_D7)
+
+static tGPIOBus lcd_data_bus;
+#endif
+
 
 extern unsigned char CGTAB[64];
 
 unsigned char gph_clr_byte[][32]={ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0};
 
+#if (T6963C_SHADOW_FB == 1)
+//
+// RAM copy of the graphic area and the changed byte range of each row. A
+// row is clean when its low bound is above its high bound.
+//
+static unsigned char gph_shadow[T6963C_GRH_ROWS][LCD_GRH_WID_NUM];
+static unsigned char gph_dirty_lo[T6963C_GRH_ROWS];
+static unsigned char gph_dirty_hi[T6963C_GRH_ROWS];
+
+//
+// Write one byte of the RAM copy, offset from GRSTART, and mark its row
+// dirty if the byte changed.
+//
+static void gph_shadow_write(unsigned int offset, unsigned char data)
+{
+    unsigned char row = offset / LCD_GRH_WID_NUM;
+    unsigned char col = offset % LCD_GRH_WID_NUM;
+
+    xASSERT(row < T6963C_GRH_ROWS);
+
+    if(gph_shadow[row][col] != data)
+    {
+        gph_shadow[row][col] = data;
+        if(col < gph_dirty_lo[row])
+        {
+            gph_dirty_lo[row] = col;
+        }
+        if(col > gph_dirty_hi[row])
+        {
+            gph_dirty_hi[row] = col;
+        }
+    }
+}
+#endif
+
 static void delay(int n)
 {
     int i;
@@ -104,12 +149,17 @@ static void setPinMode_Input()
 static void setData(unsigned char data)
 {
 
+#ifdef T6963C_DATA_GPIO_BUS
+    setPinMode_Output();
+    GPIOBusWrite(&lcd_data_bus, data);
+#else
     int i;
     setPinMode_Output();
     for(i=7;i>=0;i--)
     {
         GPIOPinWrite(LCD_DATA_PORT, data_pins[i], (data>>i)&1);
     }
+#endif
 }
 
 //*****************************************************************************
@@ -127,7 +177,11 @@ static unsigned char getData()
     GPIOPinWrite(LCD_DATA_PORT, LCD_CS, 0);
     GPIOPinWrite(LCD_DATA_PORT, LCD_RD, 0);
     delay(2);
+#ifdef T6963C_DATA_GPIO_BUS
+    data = GPIOBusRead(&lcd_data_bus);
+#else
     data = xHWREG(LCD_DATA_PORT + GPIO_PIN);
+#endif
     GPIOPinWrite(LCD_DATA_PORT, LCD_RD, 1);
     GPIOPinWrite(LCD_DATA_PORT, LCD_CS, 1);
     return data;
@@ -143,10 +197,17 @@ static unsigned char getData()
 //*****************************************************************************
 void T6963C_Init()
 {
+#if (T6963C_SHADOW_FB == 1)
+    int i;
+
+#endif
     //
     // Enable the GPIOx port which is connected with T6963C
     //
     xSysCtlPeripheralEnable(LCD_DATA_PORT);
+#ifdef T6963C_DATA_GPIO_BUS
+    GPIOBusInit(&lcd_data_bus, LCD_DATA_PORT, LCD_DATA_MASK);
+#endif
 
 
     xGPIODirModeSet(LCD_DATA_PORT, LCD_FS, xGPIO_DIR_MODE_OUT);
@@ -181,6 +242,18 @@ void T6963C_Init()
     T6963C_WriteCMD(LCD_DIS_SW|0x08);
     // cursor with 7 lines
     T6963C_WriteCMD(LCD_CUR_SHP|0x07);
+
+#if (T6963C_SHADOW_FB == 1)
+    //
+    // The graphic area at GRSTART was never cleared, every row goes out on
+    // the first T6963C_Flush().
+    //
+    for(i = 0; i < T6963C_GRH_ROWS; i++)
+    {
+        gph_dirty_lo[i] = 0;
+        gph_dirty_hi[i] = LCD_GRH_WID_NUM - 1;
+    }
+#endif
 }
 
 //*****************************************************************************
@@ -424,9 +497,14 @@ void T6963C_Gph_Display_Chinese(unsigned char row, unsigned char col,
         addr = row*16*LCD_GRH_WID_NUM + col*2 + GRSTART;
         for(j=0; j<32; j+=2)
         {
+#if (T6963C_SHADOW_FB == 1)
+			gph_shadow_write(addr - GRSTART, data[i][j]);
+			gph_shadow_write(addr - GRSTART + 1, data[i][j+1]);
+#else
 			T6963C_WriteDoublePara(addr, addr>>8, LCD_ADR_POS);
 			T6963C_WriteOnePara(data[i][j], LCD_INC_WR);
 			T6963C_WriteOnePara(data[i][j+1], LCD_INC_WR);
+#endif
 
 			addr += LCD_GRH_WID_NUM;
 
@@ -452,12 +530,19 @@ void T6963C_Gph_Display_Chinese(unsigned char row, unsigned char col,
 void T6963C_Gph_Display_BMP(unsigned char data[])
 {
 	int i;
+#if (T6963C_SHADOW_FB == 1)
+    for(i=0; i<T6963C_GRH_ROWS*LCD_GRH_WID_NUM; i++)
+    {
+        gph_shadow_write(i, data[i]);
+    }
+#else
     T6963C_WriteDoublePara(GRSTART, GRSTART>>8, LCD_ADR_POS);
     for(i=0; i<64*16; i++)
     {
 			T6963C_WriteOnePara(data[i], LCD_INC_WR);
     }
     T6963C_WriteDoublePara(0, 0, LCD_ADR_POS);
+#endif
 }
 
 //*****************************************************************************
@@ -476,11 +561,21 @@ void T6963C_Pixel(unsigned char row,unsigned char col,
 {
     unsigned int addr;
     unsigned char dat;
+#if (T6963C_SHADOW_FB == 1)
+    xASSERT((row < T6963C_GRH_ROWS) && (col/8 < LCD_GRH_WID_NUM));
+
+    addr=row*LCD_GRH_WID_NUM + col/8;
+    dat=gph_shadow[row][col/8];
+    if(Mode) dat|=0x80>>(col%8);
+    else dat&=~(0x80>>(col%8));
+    gph_shadow_write(addr, dat);
+#else
     addr=row*LCD_GRH_WID_NUM + col/8 + GRSTART;
     dat=LCD_BIT_OP+7-col%8;
     if(Mode) dat=dat|0x08;
     T6963C_WriteDoublePara(addr, addr>>8, LCD_ADR_POS);
     T6963C_WriteCMD(dat);
+#endif
 }
 
 //*****************************************************************************
@@ -563,6 +658,79 @@ void T6963C_Clear_RAM()
     }
     T6963C_WriteCMD( LCD_AUT_OVR);  // stop auto write
     T6963C_WriteDoublePara(0, 0, LCD_ADR_POS);
+
+#if (T6963C_SHADOW_FB == 1)
+    for(i=0; i<T6963C_GRH_ROWS*LCD_GRH_WID_NUM; i++)
+    {
+        gph_shadow[i/LCD_GRH_WID_NUM][i%LCD_GRH_WID_NUM] = 0;
+    }
+    for(i=0; i<T6963C_GRH_ROWS; i++)
+    {
+        gph_dirty_lo[i] = LCD_GRH_WID_NUM;
+        gph_dirty_hi[i] = 0;
+    }
+#endif
+}
+
+//*****************************************************************************
+//
+//! \brief Send the changed part of the graphic RAM copy to the LCD.
+//!
+//! The dirty ranges of the rows are sent in linear address order. Ranges
+//! closer than T6963C_FLUSH_GAP bytes are merged, and each merged range
+//! costs one address set and one auto write burst. Does nothing unless
+//! T6963C_SHADOW_FB is 1.
+//!
+//! \return None.
+//
+//*****************************************************************************
+void T6963C_Flush()
+{
+#if (T6963C_SHADOW_FB == 1)
+    unsigned char *shadow = &gph_shadow[0][0];
+    int row, lo, hi, start = -1, end = -1;
+
+    for(row=0; row<=T6963C_GRH_ROWS; row++)
+    {
+        if(row < T6963C_GRH_ROWS)
+        {
+            if(gph_dirty_lo[row] > gph_dirty_hi[row])
+            {
+                continue;
+            }
+            lo = row*LCD_GRH_WID_NUM + gph_dirty_lo[row];
+            hi = row*LCD_GRH_WID_NUM + gph_dirty_hi[row];
+            gph_dirty_lo[row] = LCD_GRH_WID_NUM;
+            gph_dirty_hi[row] = 0;
+
+            if((start >= 0) && (lo - end - 1 <= T6963C_FLUSH_GAP))
+            {
+                end = hi;
+                continue;
+            }
+        }
+
+        //
+        // Send the pending range before starting the next one.
+        //
+        if(start >= 0)
+        {
+            T6963C_WriteDoublePara((start + GRSTART), (start + GRSTART)>>8,
+                                   LCD_ADR_POS);
+            T6963C_WriteCMD(LCD_AUT_WR);
+            for(; start<=end; start++)
+            {
+                T6963C_AutoWriteData(shadow[start]);
+            }
+            T6963C_WriteCMD(LCD_AUT_OVR);
+        }
+        if(row < T6963C_GRH_ROWS)
+        {
+            start = lo;
+            end = hi;
+        }
+    }
+#endif
 }
 
 void T6963C_Graphic_Clear_CN_Word(unsigned char row, unsigned char col)
@@ -83,6 +83,31 @@ extern "C"
 //
 //*****************************************************************************
 
+//*****************************************************************************
+//! \addtogroup T6963C_User_Config T6963C User Config
+//! @{
+//
+//*****************************************************************************
+
+//
+//! Set to 1 to draw the graphic area into a RAM copy. The graphic functions
+//! then only update RAM, and T6963C_Flush() sends the changed bytes with
+//! auto write bursts. Needs T6963C_GRH_ROWS * LCD_GRH_WID_NUM bytes of RAM.
+//
+#define T6963C_SHADOW_FB        0
+
+//
+//! Clean bytes between two dirty ranges up to this count are sent with the
+//! ranges, which is cheaper than a new address set and auto write.
+//
+#define T6963C_FLUSH_GAP        4
+
+//*****************************************************************************
+//
+//! @}
+//
+//*****************************************************************************
+
 //*****************************************************************************
 //! \addtogroup T6963C_Hardware_Config T6963C Hardware Config
 //! @{
@@ -111,6 +136,13 @@ extern "C"
 #define LCD_CD         xGPIO_PIN_12
 #define LCD_RESET         xGPIO_PIN_13
 
+//
+//! On LPC17xx, write the data pins through the GPIO bus writer
+//! (GPIOBusWrite), one store per byte. LCD_D0 ~ LCD_D7 must be a run of
+//! pins of LCD_DATA_PORT, D0 on the lowest.
+//
+//#define T6963C_DATA_GPIO_BUS
+
 //*****************************************************************************
 //
 //! @}
@@ -243,6 +275,11 @@ extern "C"
 //
 #define  LCD_GRH_WID_NUM	16
 
+//
+//! the rows of the graphic area
+//
+#define  T6963C_GRH_ROWS	64
+
 //*****************************************************************************
 //
 //! @}
@@ -277,6 +314,7 @@ extern void T6963C_Line(unsigned char y1,unsigned char x1,
 extern void T6963C_Pixel(unsigned char row,unsigned char col,
 		unsigned char Mode);
 extern void T6963C_Gph_Display_BMP(unsigned char data[]);
+extern void T6963C_Flush(void);
 
 //*****************************************************************************
 //
@@ -306,6 +306,16 @@
 //
 #define UC1601_6800             4
 
+//
+//! Number of display RAM pages written by UC1601Clear().
+//
+#define UC1601_PAGES            8
+
+//
+//! Number of display RAM columns.
+//
+#define UC1601_COLUMNS          132
+
 
 //*****************************************************************************
 //
@@ -288,6 +288,16 @@ unsigned char Ascii[]={
 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC0,0x20,0x20,0x60,0xC0,0x80,0x80,0x60
 };
 
+#if (UC1601_SHADOW_FB == 1)
+//
+// RAM copy of the display and the changed column range of each page. A
+// page is clean when its low bound is above its high bound.
+//
+static unsigned char s_ucUC1601Shadow[UC1601_PAGES][UC1601_COLUMNS];
+static unsigned char s_ucUC1601DirtyLo[UC1601_PAGES];
+static unsigned char s_ucUC1601DirtyHi[UC1601_PAGES];
+#endif
+
 
 //*****************************************************************************
 //
@@ -302,6 +312,10 @@ unsigned char Ascii[]={
 //*****************************************************************************
 void UC1601Init(unsigned long ulSpiClock)
 {
+#if (UC1601_SHADOW_FB == 1)
+    unsigned char i;
+
+#endif
 #if (UC1601_INTERFACE == UC1601_SPI_9BIT)
     //
     // Enable the GPIOx port which is connected with UC1601 
@@ -481,6 +495,18 @@ void UC1601Init(unsigned long ulSpiClock)
     //Step 4 Set Display Enable
     //    
     UC1601CmdWrite(UC1601_SET_DC2_EN);
+
+#if (UC1601_SHADOW_FB == 1)
+    //
+    // Nothing has been written to the UC1601 yet, so every page goes out on
+    // the first UC1601Flush().
+    //
+    for(i = 0; i < UC1601_PAGES; i++)
+    {
+        s_ucUC1601DirtyLo[i] = 0;
+        s_ucUC1601DirtyHi[i] = UC1601_COLUMNS - 1;
+    }
+#endif
      
 }
 
@@ -821,6 +847,150 @@ void UC1601AddressSet(unsigned char ucPA, unsigned char ucCA)
     UC1601CmdWrite(((ucCA) & UC1601_SET_CA_MASK) | UC1601_SET_CA_LSB); 
 }
 
+//*****************************************************************************
+//
+//! \brief Send a run of data bytes with one chip select.
+//!
+//! \param pucData The data to send.
+//! \param ulLen The number of bytes.
+//!
+//! The column address auto-increments, so the bytes fill the page from the
+//! current address on.
+//!
+//! \return None.
+//
+//*****************************************************************************
+#if (UC1601_SHADOW_FB == 1)
+static void UC1601DataBurstWrite(unsigned char *pucData, unsigned long ulLen)
+{
+#if (UC1601_INTERFACE == UC1601_SPI_9BIT)
+    unsigned long ulTemp;
+
+    xGPIOSPinWrite(LCD_PIN_SPI_CS, 0);
+    while(ulLen--)
+    {
+        ulTemp = *pucData++ | 0x100;
+        xSPIDataWrite(LCD_PIN_SPI_PORT, &ulTemp, 1);
+    }
+    xGPIOSPinWrite(LCD_PIN_SPI_CS, 1);
+#elif (UC1601_INTERFACE == UC1601_SPI_8BIT)
+    xGPIOSPinWrite(LCD_PIN_SPI_CS, 0);
+    xGPIOSPinWrite(LCD_PIN_CD, 1);
+    xSPIDataWrite(LCD_PIN_SPI_PORT, pucData, ulLen);
+    xGPIOSPinWrite(LCD_PIN_SPI_CS, 1);
+#elif (UC1601_INTERFACE == UC1601_I2C)
+    xtI2CMasterTransferCfg cfg;
+    cfg.ulSlave = UC1601DataAddr;
+    cfg.pvWBuf = pucData;
+    cfg.ulWLen = ulLen;
+    cfg.ulRLen = 0;
+    cfg.pvRBuf = 0; 
+    xI2CMasterTransfer(LCD_PIN_I2C_PORT, &cfg, I2C_TRANSFER_POLLING);
+#elif (UC1601_INTERFACE == UC1601_8080)
+    unsigned long ulTemp;
+
+    xGPIOSPinWrite(LCD_PIN_CS, 0);
+    xGPIOSPinWrite(LCD_PIN_CD, 1);
+    xGPIOSPinWrite(LCD_PIN_RD, 1);
+    while(ulLen--)
+    {
+        ulTemp = *pucData++;
+        xGPIOSPinWrite(LCD_PIN_WR, 0);
+        LCD_DATA_OUT(ulTemp);
+        xGPIOSPinWrite(LCD_PIN_WR, 1);
+        xSysCtlDelay(10);
+    }
+    xGPIOSPinWrite(LCD_PIN_CS, 1);
+#elif (UC1601_INTERFACE == UC1601_6800)
+    unsigned long ulTemp;
+
+    xGPIOSPinWrite(LCD_PIN_CS, 0);
+    xGPIOSPinWrite(LCD_PIN_CD, 1);
+    while(ulLen--)
+    {
+        ulTemp = *pucData++;
+        xGPIOSPinWrite(LCD_PIN_RW, 0);
+        xGPIOSPinWrite(LCD_PIN_E, 1);
+        LCD_DATA_OUT(ulTemp);
+        xGPIOSPinWrite(LCD_PIN_RW, 1);
+        xSysCtlDelay(10);
+        xGPIOSPinWrite(LCD_PIN_E, 0);
+    }
+    xGPIOSPinWrite(LCD_PIN_CS, 1);
+#endif
+}
+#endif
+
+//*****************************************************************************
+//
+//! \brief Write one byte of display RAM.
+//!
+//! \param ucPA The page address.
+//! \param ucCA The column address.
+//! \param ucData The data to write.
+//!
+//! With UC1601_SHADOW_FB the byte only goes to the RAM copy, and the page
+//! is marked dirty if the byte changed.
+//!
+//! \return None.
+//
+//*****************************************************************************
+static void UC1601ByteWrite(unsigned char ucPA, unsigned char ucCA,
+                            unsigned char ucData)
+{
+#if (UC1601_SHADOW_FB == 1)
+    xASSERT((ucPA < UC1601_PAGES) && (ucCA < UC1601_COLUMNS));
+
+    if(s_ucUC1601Shadow[ucPA][ucCA] != ucData)
+    {
+        s_ucUC1601Shadow[ucPA][ucCA] = ucData;
+        if(ucCA < s_ucUC1601DirtyLo[ucPA])
+        {
+            s_ucUC1601DirtyLo[ucPA] = ucCA;
+        }
+        if(ucCA > s_ucUC1601DirtyHi[ucPA])
+        {
+            s_ucUC1601DirtyHi[ucPA] = ucCA;
+        }
+    }
+#else
+    UC1601AddressSet(ucPA, ucCA);
+    UC1601DataWrite(ucData);
+#endif
+}
+
+//*****************************************************************************
+//
+//! \brief Send the changed part of the RAM copy to the display.
+//!
+//! \param None
+//!
+//! Each dirty page costs one address set and one burst of its changed
+//! column range. Does nothing unless UC1601_SHADOW_FB is 1.
+//!
+//! \return None.
+//
+//*****************************************************************************
+void UC1601Flush(void)
+{
+#if (UC1601_SHADOW_FB == 1)
+    unsigned char i;
+
+    for(i = 0; i < UC1601_PAGES; i++)
+    {
+        if(s_ucUC1601DirtyLo[i] <= s_ucUC1601DirtyHi[i])
+        {
+            UC1601AddressSet(i, s_ucUC1601DirtyLo[i]);
+            UC1601DataBurstWrite(&s_ucUC1601Shadow[i][s_ucUC1601DirtyLo[i]],
+                                 s_ucUC1601DirtyHi[i] -
+                                 s_ucUC1601DirtyLo[i] + 1);
+            s_ucUC1601DirtyLo[i] = UC1601_COLUMNS;
+            s_ucUC1601DirtyHi[i] = 0;
+        }
+    }
+#endif
+}
+
 
 //*****************************************************************************
 //
@@ -839,20 +1009,17 @@ void UC1601Dispaly(unsigned char ucLine, unsigned char ucRow,
                    unsigned char ucAsciiWord)
 {
     int i=0,k=0;
-    unsigned char uctemp;
     k=(ucAsciiWord-32)*16;
     
     for(i=0;i<8;i++)
     {
-        UC1601AddressSet((ucLine*2),(129-(ucRow*8)-i));
-        uctemp=Ascii[k+i];
-        UC1601DataWrite(uctemp);
+        UC1601ByteWrite((ucLine*2),(129-(ucRow*8)-i),
+                        Ascii[k+i]);
     }  
     for(i=0;i<8;i++)
     {
-        UC1601AddressSet((ucLine*2)+1,(129-(ucRow*8)-i));
-        uctemp=Ascii[k+i+8];
-        UC1601DataWrite(uctemp);
+        UC1601ByteWrite((ucLine*2)+1,(129-(ucRow*8)-i),
+                        Ascii[k+i+8]);
     }  
 }
 
@@ -873,20 +1040,17 @@ void UC1601InverseDispaly(unsigned char ucLine, unsigned char ucRow,
                           unsigned char ucAsciiWord)
 {
     int i=0,k=0;
-    unsigned char uctemp;
     k=(ucAsciiWord-32)*16;
     
     for(i=0;i<8;i++)
     {
-        UC1601AddressSet((ucLine*2),(129-(ucRow*8)-i));
-        uctemp=~Ascii[k+i];
-        UC1601DataWrite(uctemp);
+        UC1601ByteWrite((ucLine*2),(129-(ucRow*8)-i),
+                        ~Ascii[k+i]);
     }  
     for(i=0;i<8;i++)
     {
-        UC1601AddressSet((ucLine*2)+1,(129-(ucRow*8)-i));
-        uctemp=~Ascii[k+i+8];
-        UC1601DataWrite(uctemp);
+        UC1601ByteWrite((ucLine*2)+1,(129-(ucRow*8)-i),
+                        ~Ascii[k+i+8]);
     } 
 }
 
@@ -947,13 +1111,13 @@ void UC1601ChineseDispaly(unsigned char ucLine, unsigned char ucRow,
     {
         for(i=0;i<16;i++)
         {
-            UC1601AddressSet((ucLine*2),(129-(ucRow*8)-i));
-            UC1601DataWrite(pcChar[j*32+i]);
+            UC1601ByteWrite((ucLine*2),(129-(ucRow*8)-i),
+                            pcChar[j*32+i]);
         }  
         for(i=0;i<16;i++)
         {
-            UC1601AddressSet((ucLine*2)+1,(129-(ucRow*8)-i));
-            UC1601DataWrite(pcChar[j*32+16+i]);
+            UC1601ByteWrite((ucLine*2)+1,(129-(ucRow*8)-i),
+                            pcChar[j*32+16+i]);
         }  
         ucRow = ucRow +2;
         if (ucRow > 14)
@@ -1025,7 +1189,21 @@ void HD44780DisplayN(unsigned char ucLine, unsigned char ucRow,
 void UC1601Clear(void)
 {
     int i=0;
+#if (UC1601_SHADOW_FB == 1)
+    int j;
 
+    for (i = 0; i < UC1601_PAGES; i++)
+    {
+        for (j = 0; j < UC1601_COLUMNS; j++)
+        {
+            s_ucUC1601Shadow[i][j] = 0x00;
+        }
+        s_ucUC1601DirtyLo[i] = UC1601_COLUMNS;
+        s_ucUC1601DirtyHi[i] = 0;
+        UC1601AddressSet(i, 0);
+        UC1601DataBurstWrite(s_ucUC1601Shadow[i], UC1601_COLUMNS);
+    }
+#else
     UC1601AddressSet(0x0, 0x0);  /*CLEAR ALL PANNAL*/
 
     for (i = 0; i < 132 *8; i++)
@@ -1034,6 +1212,7 @@ void UC1601Clear(void)
     }
 
     UC1601DataWrite(0x0f); 
+#endif
 }
 
 //*****************************************************************************
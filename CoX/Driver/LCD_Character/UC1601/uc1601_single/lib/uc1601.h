@@ -96,6 +96,13 @@ extern "C"
 //
 #define UC1601_INTERFACE        UC1601_SPI_9BIT 
 
+//
+//! Set to 1 to draw into a RAM copy of the display. The drawing functions
+//! then only update RAM, and UC1601Flush() sends the changed columns of
+//! each page as one burst. Needs UC1601_PAGES * UC1601_COLUMNS bytes of RAM.
+//
+#define UC1601_SHADOW_FB        0
+
 //*****************************************************************************
 //
 //! @}
@@ -308,6 +315,7 @@ extern void UC1601ChineseDispaly(unsigned char ucLine, unsigned char ucRow,
 extern void HD44780DisplayN(unsigned char ucLine, unsigned char ucRow, 
                             unsigned long n);
 extern void UC1601Clear(void);
+extern void UC1601Flush(void);
 extern void UC1601InverseEnable(void);
 extern void UC1601InverseDisable(void);
 extern void UC1601AllPixelOnEnable(void);
@@ -214,6 +214,16 @@
 //
 #define UC1701_SPI_8BIT         0
 
+//
+//! Number of display RAM pages, 8 rows each plus the icon row.
+//
+#define UC1701_PAGES            9
+
+//
+//! Number of display RAM columns.
+//
+#define UC1701_COLUMNS          132
+
 //*****************************************************************************
 //
 //! @}
@@ -40,7 +40,7 @@
 #include "xdebug.h"
 #include "xhw_memmap.h"
 #include "xspi.h"
-#include "Xhw_spi.h"
+#include "xhw_spi.h"
 #include "xgpio.h"
 #include "uc1701.h"
 #include "hw_uc1701.h"
@@ -288,6 +288,17 @@ unsigned char Ascii[]={
 };
 
 
+#if (UC1701_SHADOW_FB == 1)
+//
+// RAM copy of the display and the changed column range of each page. A
+// page is clean when its low bound is above its high bound.
+//
+static unsigned char s_ucUC1701Shadow[UC1701_PAGES][UC1701_COLUMNS];
+static unsigned char s_ucUC1701DirtyLo[UC1701_PAGES];
+static unsigned char s_ucUC1701DirtyHi[UC1701_PAGES];
+#endif
+
+
 static void delay_ms(long ms)
 {
 	long freq = SysCtlHClockGet();
@@ -311,6 +322,10 @@ static void delay_ms(long ms)
 //*****************************************************************************
 void UC1701Init(unsigned long ulSpiClock)
 {
+#if (UC1701_SHADOW_FB == 1)
+    unsigned char i;
+
+#endif
     //
     // Enable the GPIOx port which is connected with UC1701
     //
@@ -377,6 +392,18 @@ void UC1701Init(unsigned long ulSpiClock)
 	UC1701CmdWrite(0x40);//Set Scroll Line: the first line
 	UC1701CmdWrite(0xaf);//Display Enable
 
+#if (UC1701_SHADOW_FB == 1)
+    //
+    // Mark all 9 pages dirty, the first UC1701Flush() then overwrites the
+    // whole 132 x 65 display RAM.
+    //
+    for(i = 0; i < UC1701_PAGES; i++)
+    {
+        s_ucUC1701DirtyLo[i] = 0;
+        s_ucUC1701DirtyHi[i] = UC1701_COLUMNS - 1;
+    }
+#endif
+
 }
 
 
@@ -507,6 +534,99 @@ void UC1701AddressSet(unsigned char ucPA, unsigned char ucCA)
 }
 
 
+//*****************************************************************************
+//
+//! \brief Send a run of data bytes with one chip select.
+//!
+//! \param pucData The data to send.
+//! \param ulLen The number of bytes.
+//!
+//! The column address auto-increments, so the bytes fill the page from the
+//! current address on.
+//!
+//! \return None.
+//
+//*****************************************************************************
+#if (UC1701_SHADOW_FB == 1)
+static void UC1701DataBurstWrite(unsigned char *pucData, unsigned long ulLen)
+{
+    xGPIOSPinWrite(LCD_PIN_SPI_CS, 0);
+    xGPIOSPinWrite(LCD_PIN_CD, 1);
+    xSPIDataWrite(LCD_PIN_SPI_PORT, pucData, ulLen);
+    xGPIOSPinWrite(LCD_PIN_SPI_CS, 1);
+}
+#endif
+
+//*****************************************************************************
+//
+//! \brief Write one byte of display RAM.
+//!
+//! \param ucPA The page address.
+//! \param ucCA The column address.
+//! \param ucData The data to write.
+//!
+//! With UC1701_SHADOW_FB the byte only goes to the RAM copy, and the page
+//! is marked dirty if the byte changed.
+//!
+//! \return None.
+//
+//*****************************************************************************
+static void UC1701ByteWrite(unsigned char ucPA, unsigned char ucCA,
+                            unsigned char ucData)
+{
+#if (UC1701_SHADOW_FB == 1)
+    xASSERT((ucPA < UC1701_PAGES) && (ucCA < UC1701_COLUMNS));
+
+    if(s_ucUC1701Shadow[ucPA][ucCA] != ucData)
+    {
+        s_ucUC1701Shadow[ucPA][ucCA] = ucData;
+        if(ucCA < s_ucUC1701DirtyLo[ucPA])
+        {
+            s_ucUC1701DirtyLo[ucPA] = ucCA;
+        }
+        if(ucCA > s_ucUC1701DirtyHi[ucPA])
+        {
+            s_ucUC1701DirtyHi[ucPA] = ucCA;
+        }
+    }
+#else
+    UC1701AddressSet(ucPA, ucCA);
+    UC1701DataWrite(ucData);
+#endif
+}
+
+//*****************************************************************************
+//
+//! \brief Send the changed part of the RAM copy to the display.
+//!
+//! \param None
+//!
+//! Each dirty page costs one address set and one burst of its changed
+//! column range. Does nothing unless UC1701_SHADOW_FB is 1.
+//!
+//! \return None.
+//
+//*****************************************************************************
+void UC1701Flush(void)
+{
+#if (UC1701_SHADOW_FB == 1)
+    unsigned char i;
+
+    for(i = 0; i < UC1701_PAGES; i++)
+    {
+        if(s_ucUC1701DirtyLo[i] <= s_ucUC1701DirtyHi[i])
+        {
+            UC1701AddressSet(i, s_ucUC1701DirtyLo[i]);
+            UC1701DataBurstWrite(&s_ucUC1701Shadow[i][s_ucUC1701DirtyLo[i]],
+                                 s_ucUC1701DirtyHi[i] -
+                                 s_ucUC1701DirtyLo[i] + 1);
+            s_ucUC1701DirtyLo[i] = UC1701_COLUMNS;
+            s_ucUC1701DirtyHi[i] = 0;
+        }
+    }
+#endif
+}
+
 //*****************************************************************************
 //
 //! \brief Send the data to the address.
@@ -524,20 +644,17 @@ void UC1701Dispaly(unsigned char ucLine, unsigned char ucRow,
                    unsigned char ucAsciiWord)
 {
     int i=0,k=0;
-    unsigned char uctemp;
     k=(ucAsciiWord-32)*16;
     
     for(i=0;i<8;i++)
     {
-        UC1701AddressSet((ucLine*2),(129-(ucRow*8)-i));
-        uctemp=Ascii[k+i];
-        UC1701DataWrite(uctemp);
+        UC1701ByteWrite((ucLine*2),(129-(ucRow*8)-i),
+                        Ascii[k+i]);
     }  
     for(i=0;i<8;i++)
     {
-        UC1701AddressSet((ucLine*2)+1,(129-(ucRow*8)-i));
-        uctemp=Ascii[k+i+8];
-        UC1701DataWrite(uctemp);
+        UC1701ByteWrite((ucLine*2)+1,(129-(ucRow*8)-i),
+                        Ascii[k+i+8]);
     }  
 }
 
@@ -558,20 +675,17 @@ void UC1701InverseDispaly(unsigned char ucLine, unsigned char ucRow,
                           unsigned char ucAsciiWord)
 {
     int i=0,k=0;
-    unsigned char uctemp;
     k=(ucAsciiWord-32)*16;
     
     for(i=0;i<8;i++)
     {
-        UC1701AddressSet((ucLine*2),(129-(ucRow*8)-i));
-        uctemp=~Ascii[k+i];
-        UC1701DataWrite(uctemp);
+        UC1701ByteWrite((ucLine*2),(129-(ucRow*8)-i),
+                        ~Ascii[k+i]);
     }  
     for(i=0;i<8;i++)
     {
-        UC1701AddressSet((ucLine*2)+1,(129-(ucRow*8)-i));
-        uctemp=~Ascii[k+i+8];
-        UC1701DataWrite(uctemp);
+        UC1701ByteWrite((ucLine*2)+1,(129-(ucRow*8)-i),
+                        ~Ascii[k+i+8]);
     } 
 }
 
@@ -631,13 +745,13 @@ void UC1701ChineseDispaly(unsigned char ucLine, unsigned char ucRow,
     {
         for(i=0;i<16;i++)
         {
-            UC1701AddressSet((ucLine*2),(129-(ucRow*8)-i));
-            UC1701DataWrite(pcChar[j*32+i]);
+            UC1701ByteWrite((ucLine*2),(129-(ucRow*8)-i),
+                            pcChar[j*32+i]);
         }  
         for(i=0;i<16;i++)
         {
-            UC1701AddressSet((ucLine*2)+1,(129-(ucRow*8)-i));
-            UC1701DataWrite(pcChar[j*32+16+i]);
+            UC1701ByteWrite((ucLine*2)+1,(129-(ucRow*8)-i),
+                            pcChar[j*32+16+i]);
         }  
         ucRow = ucRow +2;
         if (ucRow > 14)
@@ -712,6 +826,16 @@ void UC1701Clear(void)
 
 	for(i=0;i<9;i++)
 	{
+#if (UC1701_SHADOW_FB == 1)
+		for(j=0;j<132;j++)
+		{
+			s_ucUC1701Shadow[i][j] = 0x00;
+		}
+		s_ucUC1701DirtyLo[i] = UC1701_COLUMNS;
+		s_ucUC1701DirtyHi[i] = 0;
+		UC1701AddressSet(i, 0);
+		UC1701DataBurstWrite(s_ucUC1701Shadow[i], UC1701_COLUMNS);
+#else
 		xGPIOSPinWrite(LCD_PIN_SPI_CS, 0);
 		UC1701CmdWrite(0xb0+i);
 		UC1701CmdWrite(0x10);
@@ -720,6 +844,7 @@ void UC1701Clear(void)
 		{
 			UC1701DataWrite(0x00);
 		}
+#endif
 	}
 }
 
@@ -96,6 +96,15 @@ extern "C"
 //
 #define UC1701_INTERFACE        UC1701_SPI_8BIT
 
+//
+//! Set to 1 to draw into a RAM copy of the display. The drawing functions
+//! then only update RAM, and UC1701Flush() sends the changed columns of
+//! each page as one burst. Needs UC1701_PAGES * UC1701_COLUMNS bytes of RAM.
+//
+#ifndef UC1701_SHADOW_FB
+#define UC1701_SHADOW_FB        0
+#endif
+
 //*****************************************************************************
 //
 //! @}
@@ -154,6 +163,7 @@ extern void UC1701ChineseDispaly(unsigned char ucLine, unsigned char ucRow,
 extern void UC1701DisplayN(unsigned char ucLine, unsigned char ucRow,
                             unsigned long n);
 extern void UC1701Clear(void);
+extern void UC1701Flush(void);
 extern void UC1701InverseEnable(void);
 extern void UC1701InverseDisable(void);
 extern void UC1701AllPixelOnEnable(void);
@@ -0,0 +1,190 @@
+//*****************************************************************************
+//
+//! \file uc1701shadowtest.c
+//! \brief Host test of the UC1701 shadow framebuffer.
+//! \version 1.0.0
+//! \date 19/10/2026
+//! \author CooCox
+//! \copy
+//!
+//! Copyright (c)  2011, CooCox
+//! All rights reserved.
+//!
+//! Builds uc1701.c with UC1701_SHADOW_FB on the NUC1xx headers and fakes the
+//! GPIO and SPI functions, so the bytes UC1701Flush() sends can be counted
+//! on the PC. From this directory:
+//!
+//!   gcc -DUC1701_SHADOW_FB=1 -I../../lib
+//!       -I../../../../../../CoX_Peripheral/CoX_Peripheral_NUC1xx/libcox
+//!       uc1701shadowtest.c ../../lib/uc1701.c -o uc1701shadowtest
+//!   ./uc1701shadowtest
+//
+//*****************************************************************************
+
+#include <stdio.h>
+#include "xhw_types.h"
+#include "xhw_memmap.h"
+#include "xgpio.h"
+#include "xspi.h"
+#include "uc1701.h"
+#include "hw_uc1701.h"
+
+//
+// Bytes sent with CD high (display data) and low (commands).
+//
+static unsigned long ulDataBytes;
+static unsigned long ulCmdBytes;
+static unsigned char ucCD;
+
+static unsigned long ulFails;
+
+//*****************************************************************************
+//
+// Fake GPIO and SPI functions used by uc1701.c.
+//
+//*****************************************************************************
+void GPIOPinWrite(unsigned long ulPort, unsigned long ulPins,
+                  unsigned char ucVal)
+{
+    if((ulPort == GPIO_PORTD_BASE) && (ulPins == GPIO_PIN_10))
+    {
+        ucCD = ucVal;
+    }
+}
+
+void SPIDataWrite(unsigned long ulBase, void *pulWData, unsigned long ulLen)
+{
+    if(ucCD)
+    {
+        ulDataBytes += ulLen;
+    }
+    else
+    {
+        ulCmdBytes += ulLen;
+    }
+}
+
+unsigned long GPIOPinToPort(unsigned long ulPort, unsigned long ulPin)
+{
+    return ulPort;
+}
+
+void GPIOPinConfigure(unsigned long ulPinConfig)
+{
+}
+
+void GPIOPinFunctionSet(unsigned long ulFunction, unsigned long ulPort,
+                        unsigned long ulPins)
+{
+}
+
+void xGPIODirModeSet(unsigned long ulPort, unsigned long ulPins,
+                     unsigned long ulPinIO)
+{
+}
+
+void SPIConfig(unsigned long ulBase, unsigned long ulBitRate,
+               unsigned long ulConfig)
+{
+}
+
+void SPISSConfig(unsigned long ulBase, unsigned long ulSSTriggerMode,
+                 unsigned long ulSSActType)
+{
+}
+
+unsigned long SysCtlHClockGet(void)
+{
+    return 0;
+}
+
+void SysCtlPeripheralEnable(unsigned long ulPeripheral)
+{
+}
+
+void xSysCtlPeripheralEnable2(unsigned long ulPeripheralBase)
+{
+}
+
+void xSysCtlPeripheralReset2(unsigned long ulPeripheralBase)
+{
+}
+
+//*****************************************************************************
+//
+//! \brief Flush and check the bytes sent.
+//!
+//! \return None.
+//
+//*****************************************************************************
+static void FlushCheck(const char *pcName, unsigned long ulData,
+                       unsigned long ulPages)
+{
+    ulDataBytes = 0;
+    ulCmdBytes = 0;
+    UC1701Flush();
+
+    //
+    // Each dirty page costs one address set, 3 commands.
+    //
+    if((ulDataBytes != ulData) || (ulCmdBytes != ulPages * 3))
+    {
+        printf("FAIL %s: %lu data %lu command bytes, expected %lu %lu\n",
+               pcName, ulDataBytes, ulCmdBytes, ulData, ulPages * 3);
+        ulFails++;
+    }
+    else
+    {
+        printf("ok   %s\n", pcName);
+    }
+}
+
+int main(void)
+{
+    //
+    // After init all the pages are dirty.
+    //
+    UC1701Init(1000000);
+    FlushCheck("first flush sends the whole RAM",
+               UC1701_PAGES * UC1701_COLUMNS, UC1701_PAGES);
+    FlushCheck("clean flush sends nothing", 0, 0);
+
+    //
+    // UC1701Clear() writes the display itself and leaves it clean.
+    //
+    UC1701Clear();
+    FlushCheck("flush after clear sends nothing", 0, 0);
+
+    //
+    // A character is 8 columns on 2 pages. Over its inverse every byte
+    // changes.
+    //
+    UC1701InverseDispaly(0, 0, 'A');
+    UC1701Flush();
+    UC1701Dispaly(0, 0, 'A');
+    FlushCheck("one character", 16, 2);
+
+    UC1701Dispaly(0, 0, 'A');
+    FlushCheck("same character again", 0, 0);
+
+    //
+    // Columns 122-129 and 2-9 of pages 2 and 3, each page sends the range
+    // between them.
+    //
+    UC1701InverseDispaly(1, 0, 'B');
+    UC1701InverseDispaly(1, 15, 'C');
+    UC1701Flush();
+    UC1701Dispaly(1, 0, 'B');
+    UC1701Dispaly(1, 15, 'C');
+    FlushCheck("two characters on a row", 2 * 128, 2);
+
+    //
+    // A space over a space changes nothing.
+    //
+    UC1701Dispaly(3, 5, ' ');
+    FlushCheck("unchanged bytes", 0, 0);
+
+    printf("%s\n", ulFails ? "FAILED" : "PASSED");
+
+    return ulFails ? 1 : 0;
+}
@@ -0,0 +1,529 @@
+//*****************************************************************************
+//
+//! \file Gfx2D.c
+//! \brief Span based 2D drawing core shared by the TFT drivers.
+//! \version V2.2.1.0
+//! \date 10/19/2026
+//! \author CooCox
+//! \copy
+//!
+//! Copyright (c)  2013, CooCox
+//! All rights reserved.
+//!
+//! Redistribution and use in source and binary forms, with or without
+//! modification, are permitted provided that the following conditions
+//! are met:
+//!
+//!     * Redistributions of source code must retain the above copyright
+//! notice, this list of conditions and the following disclaimer.
+//!     * Redistributions in binary form must reproduce the above copyright
+//! notice, this list of conditions and the following disclaimer in the
+//! documentation and/or other materials provided with the distribution.
+//!     * Neither the name of the <ORGANIZATION> nor the names of its
+//! contributors may be used to endorse or promote products derived
+//! from this software without specific prior written permission.
+//!
+//! THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+//! AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+//! IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+//! ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+//! LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+//! CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+//! SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+//! INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//! CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+//! ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+//! THE POSSIBILITY OF SUCH DAMAGE.
+//
+//*****************************************************************************
+
+#include "xhw_types.h"
+#include "xdebug.h"
+#include "Gfx2D.h"
+
+//*****************************************************************************
+//
+//! \brief Fill a rectangle after clipping it, the base of every shape.
+//!
+//! \param psCtx is the drawing context.
+//! \param lX0 is the left edge, \e lX0 <= \e lX1.
+//! \param lX1 is the right edge.
+//! \param lY0 is the top edge, \e lY0 <= \e lY1.
+//! \param lY1 is the bottom edge.
+//! \param ulColor is the pixel color.
+//!
+//! \return None.
+//
+//*****************************************************************************
+static void
+Gfx2DSpanFill(tGfx2DContext *psCtx, long lX0, long lX1, long lY0, long lY1,
+              unsigned long ulColor)
+{
+    if(lX0 < psCtx->sClipX0) lX0 = psCtx->sClipX0;
+    if(lX1 > psCtx->sClipX1) lX1 = psCtx->sClipX1;
+    if(lY0 < psCtx->sClipY0) lY0 = psCtx->sClipY0;
+    if(lY1 > psCtx->sClipY1) lY1 = psCtx->sClipY1;
+    if((lX0 > lX1) || (lY0 > lY1))
+    {
+        return;
+    }
+
+    if((lX0 == lX1) && (lY0 == lY1) && psCtx->psOps->pfnPixelDraw)
+    {
+        psCtx->psOps->pfnPixelDraw((unsigned short)lX0, (unsigned short)lY0,
+                                   ulColor);
+        return;
+    }
+
+    psCtx->psOps->pfnWindowSet(lX0, lX1, lY0, lY1);
+    psCtx->psOps->pfnRunWrite(ulColor, (lX1 - lX0 + 1) * (lY1 - lY0 + 1));
+}
+
+//*****************************************************************************
+//
+//! \brief Initialize a drawing context.
+//!
+//! \param psCtx is the context to initialize.
+//! \param psOps is the controller operations, e.g. a table initialized with
+//! ILI9341_GFX2D_OPS.
+//! \param usWidth is the screen width in pixels.
+//! \param usHeight is the screen height in pixels.
+//!
+//! The clip rectangle is set to the whole screen.
+//!
+//! \return None.
+//
+//*****************************************************************************
+void
+Gfx2DInit(tGfx2DContext *psCtx, const tGfx2DDisplayOps *psOps,
+          unsigned short usWidth, unsigned short usHeight)
+{
+    xASSERT((psCtx != 0) && (psOps != 0));
+    xASSERT((psOps->pfnWindowSet != 0) && (psOps->pfnRunWrite != 0));
+    xASSERT((usWidth != 0) && (usHeight != 0));
+
+    psCtx->psOps = psOps;
+    psCtx->usWidth = usWidth;
+    psCtx->usHeight = usHeight;
+    psCtx->sClipX0 = 0;
+    psCtx->sClipY0 = 0;
+    psCtx->sClipX1 = usWidth - 1;
+    psCtx->sClipY1 = usHeight - 1;
+}
+
+//*****************************************************************************
+//
+//! \brief Set the clip rectangle.
+//!
+//! \param psCtx is the drawing context.
+//! \param sX0 is the left edge.
+//! \param sY0 is the top edge.
+//! \param sX1 is the right edge.
+//! \param sY1 is the bottom edge.
+//!
+//! Nothing is drawn outside the rectangle. The rectangle is trimmed to the
+//! screen, an empty result disables drawing.
+//!
+//! \return None.
+//
+//*****************************************************************************
+void
+Gfx2DClipSet(tGfx2DContext *psCtx, short sX0, short sY0, short sX1, short sY1)
+{
+    xASSERT(psCtx != 0);
+
+    if(sX0 < 0) sX0 = 0;
+    if(sY0 < 0) sY0 = 0;
+    if(sX1 >= (short)psCtx->usWidth) sX1 = psCtx->usWidth - 1;
+    if(sY1 >= (short)psCtx->usHeight) sY1 = psCtx->usHeight - 1;
+
+    psCtx->sClipX0 = sX0;
+    psCtx->sClipY0 = sY0;
+    psCtx->sClipX1 = sX1;
+    psCtx->sClipY1 = sY1;
+}
+
+//*****************************************************************************
+//
+//! \brief Draw a pixel.
+//!
+//! \param psCtx is the drawing context.
+//! \param sX is the X coordinate.
+//! \param sY is the Y coordinate.
+//! \param ulColor is the pixel color.
+//!
+//! \return None.
+//
+//*****************************************************************************
+void
+Gfx2DPixelDraw(tGfx2DContext *psCtx, short sX, short sY, unsigned long ulColor)
+{
+    Gfx2DSpanFill(psCtx, sX, sX, sY, sY, ulColor);
+}
+
+//*****************************************************************************
+//
+//! \brief Draw a horizontal line as a single run.
+//!
+//! \param psCtx is the drawing context.
+//! \param sX0 is the X coordinate of one end.
+//! \param sX1 is the X coordinate of the other end.
+//! \param sY is the Y coordinate.
+//! \param ulColor is the line color.
+//!
+//! \return None.
+//
+//*****************************************************************************
+void
+Gfx2DHLineDraw(tGfx2DContext *psCtx, short sX0, short sX1, short sY,
+               unsigned long ulColor)
+{
+    if(sX0 > sX1)
+    {
+        Gfx2DSpanFill(psCtx, sX1, sX0, sY, sY, ulColor);
+    }
+    else
+    {
+        Gfx2DSpanFill(psCtx, sX0, sX1, sY, sY, ulColor);
+    }
+}
+
+//*****************************************************************************
+//
+//! \brief Draw a vertical line as a single run.
+//!
+//! \param psCtx is the drawing context.
+//! \param sX is the X coordinate.
+//! \param sY0 is the Y coordinate of one end.
+//! \param sY1 is the Y coordinate of the other end.
+//! \param ulColor is the line color.
+//!
+//! \return None.
+//
+//*****************************************************************************
+void
+Gfx2DVLineDraw(tGfx2DContext *psCtx, short sX, short sY0, short sY1,
+               unsigned long ulColor)
+{
+    if(sY0 > sY1)
+    {
+        Gfx2DSpanFill(psCtx, sX, sX, sY1, sY0, ulColor);
+    }
+    else
+    {
+        Gfx2DSpanFill(psCtx, sX, sX, sY0, sY1, ulColor);
+    }
+}
+
+//*****************************************************************************
+//
+//! \brief Draw a line.
+//!
+//! \param psCtx is the drawing context.
+//! \param sX0 is the X coordinate of the start point.
+//! \param sY0 is the Y coordinate of the start point.
+//! \param sX1 is the X coordinate of the end point.
+//! \param sY1 is the Y coordinate of the end point.
+//! \param ulColor is the line color.
+//!
+//! The pixels are those of the Bresenham line. Pixels that share a row (or a
+//! column for steep lines) are drawn as one run.
+//!
+//! \return None.
+//
+//*****************************************************************************
+void
+Gfx2DLineDraw(tGfx2DContext *psCtx, short sX0, short sY0, short sX1, short sY1,
+              unsigned long ulColor)
+{
+    long lDx, lDy, lSx, lSy, lErr, lX, lY, lStart, i;
+
+    lDx = (sX1 > sX0) ? (sX1 - sX0) : (sX0 - sX1);
+    lDy = (sY1 > sY0) ? (sY1 - sY0) : (sY0 - sY1);
+    lSx = (sX1 >= sX0) ? 1 : -1;
+    lSy = (sY1 >= sY0) ? 1 : -1;
+    lX = sX0;
+    lY = sY0;
+
+    if(lDx >= lDy)
+    {
+        //
+        // X major, a run ends each time Y steps.
+        //
+        lErr = 2 * lDy - lDx;
+        lStart = lX;
+        for(i = 0; i < lDx; i++)
+        {
+            if(lErr > 0)
+            {
+                if(lSx > 0)
+                {
+                    Gfx2DSpanFill(psCtx, lStart, lX, lY, lY, ulColor);
+                }
+                else
+                {
+                    Gfx2DSpanFill(psCtx, lX, lStart, lY, lY, ulColor);
+                }
+                lY += lSy;
+                lErr -= 2 * lDx;
+                lStart = lX + lSx;
+            }
+            lErr += 2 * lDy;
+            lX += lSx;
+        }
+        if(lSx > 0)
+        {
+            Gfx2DSpanFill(psCtx, lStart, lX, lY, lY, ulColor);
+        }
+        else
+        {
+            Gfx2DSpanFill(psCtx, lX, lStart, lY, lY, ulColor);
+        }
+    }
+    else
+    {
+        //
+        // Y major, a run ends each time X steps.
+        //
+        lErr = 2 * lDx - lDy;
+        lStart = lY;
+        for(i = 0; i < lDy; i++)
+        {
+            if(lErr > 0)
+            {
+                if(lSy > 0)
+                {
+                    Gfx2DSpanFill(psCtx, lX, lX, lStart, lY, ulColor);
+                }
+                else
+                {
+                    Gfx2DSpanFill(psCtx, lX, lX, lY, lStart, ulColor);
+                }
+                lX += lSx;
+                lErr -= 2 * lDy;
+                lStart = lY + lSy;
+            }
+            lErr += 2 * lDx;
+            lY += lSy;
+        }
+        if(lSy > 0)
+        {
+            Gfx2DSpanFill(psCtx, lX, lX, lStart, lY, ulColor);
+        }
+        else
+        {
+            Gfx2DSpanFill(psCtx, lX, lX, lY, lStart, ulColor);
+        }
+    }
+}
+
+//*****************************************************************************
+//
+//! \brief Draw a rectangle outline.
+//!
+//! \param psCtx is the drawing context.
+//! \param sX0 is the X coordinate of one corner.
+//! \param sY0 is the Y coordinate of one corner.
+//! \param sX1 is the X coordinate of the opposite corner.
+//! \param sY1 is the Y coordinate of the opposite corner.
+//! \param ulColor is the line color.
+//!
+//! \return None.
+//
+//*****************************************************************************
+void
+Gfx2DRectDraw(tGfx2DContext *psCtx, short sX0, short sY0, short sX1, short sY1,
+              unsigned long ulColor)
+{
+    short sTmp;
+
+    if(sX0 > sX1)
+    {
+        sTmp = sX0; sX0 = sX1; sX1 = sTmp;
+    }
+    if(sY0 > sY1)
+    {
+        sTmp = sY0; sY0 = sY1; sY1 = sTmp;
+    }
+
+    Gfx2DSpanFill(psCtx, sX0, sX1, sY0, sY0, ulColor);
+    if(sY1 > sY0)
+    {
+        Gfx2DSpanFill(psCtx, sX0, sX1, sY1, sY1, ulColor);
+    }
+    if(sY1 - sY0 > 1)
+    {
+        Gfx2DSpanFill(psCtx, sX0, sX0, sY0 + 1, sY1 - 1, ulColor);
+        if(sX1 > sX0)
+        {
+            Gfx2DSpanFill(psCtx, sX1, sX1, sY0 + 1, sY1 - 1, ulColor);
+        }
+    }
+}
+
+//*****************************************************************************
+//
+//! \brief Fill a rectangle with one window and one run.
+//!
+//! \param psCtx is the drawing context.
+//! \param sX0 is the X coordinate of one corner.
+//! \param sY0 is the Y coordinate of one corner.
+//! \param sX1 is the X coordinate of the opposite corner.
+//! \param sY1 is the Y coordinate of the opposite corner.
+//! \param ulColor is the fill color.
+//!
+//! \return None.
+//
+//*****************************************************************************
+void
+Gfx2DRectFill(tGfx2DContext *psCtx, short sX0, short sY0, short sX1, short sY1,
+              unsigned long ulColor)
+{
+    short sTmp;
+
+    if(sX0 > sX1)
+    {
+        sTmp = sX0; sX0 = sX1; sX1 = sTmp;
+    }
+    if(sY0 > sY1)
+    {
+        sTmp = sY0; sY0 = sY1; sY1 = sTmp;
+    }
+
+    Gfx2DSpanFill(psCtx, sX0, sX1, sY0, sY1, ulColor);
+}
+
+//*****************************************************************************
+//
+//! \brief Walk one octant of a circle and hand out its runs.
+//!
+//! \param psCtx is the drawing context.
+//! \param sX is the X coordinate of the center.
+//! \param sY is the Y coordinate of the center.
+//! \param usRadius is the radius.
+//! \param ulColor is the color.
+//! \param bFill selects a filled disc instead of the outline.
+//!
+//! The octant points (a, b), a from 0 up to b, come from the same decision
+//! variable as the SSD1298 driver used. Points sharing a b form a run
+//! [a0, a1]; the other seven octants are its mirrors, so every run gives
+//! four horizontal and four vertical spans for the outline, or two rows
+//! plus one row per a for the disc.
+//!
+//! \return None.
+//
+//*****************************************************************************
+static void
+Gfx2DCircleRuns(tGfx2DContext *psCtx, short sX, short sY,
+                unsigned short usRadius, unsigned long ulColor,
+                xtBoolean bFill)
+{
+    long lA, lB, lD, lA0, lA1, lB0, i;
+
+    lA = 0;
+    lB = usRadius;
+    lD = 3 - 2 * (long)usRadius;
+    lA0 = 0;
+
+    while(lA <= lB)
+    {
+        lA1 = lA;
+        lB0 = lB;
+        lA++;
+        if(lD < 0)
+        {
+            lD += 4 * lA + 6;
+        }
+        else
+        {
+            lD += 10 + 4 * (lA - lB);
+            lB--;
+        }
+
+        if((lB == lB0) && (lA <= lB))
+        {
+            continue;
+        }
+
+        //
+        // Run [lA0, lA1] at distance lB0 is complete.
+        //
+        if(bFill)
+        {
+            Gfx2DSpanFill(psCtx, sX - lA1, sX + lA1, sY - lB0, sY - lB0,
+                          ulColor);
+            Gfx2DSpanFill(psCtx, sX - lA1, sX + lA1, sY + lB0, sY + lB0,
+                          ulColor);
+            for(i = lA0; i <= lA1; i++)
+            {
+                Gfx2DSpanFill(psCtx, sX - lB0, sX + lB0, sY + i, sY + i,
+                              ulColor);
+                if(i != 0)
+                {
+                    Gfx2DSpanFill(psCtx, sX - lB0, sX + lB0, sY - i, sY - i,
+                                  ulColor);
+                }
+            }
+        }
+        else
+        {
+            Gfx2DSpanFill(psCtx, sX + lA0, sX + lA1, sY - lB0, sY - lB0,
+                          ulColor);
+            Gfx2DSpanFill(psCtx, sX - lA1, sX - lA0, sY - lB0, sY - lB0,
+                          ulColor);
+            Gfx2DSpanFill(psCtx, sX + lA0, sX + lA1, sY + lB0, sY + lB0,
+                          ulColor);
+            Gfx2DSpanFill(psCtx, sX - lA1, sX - lA0, sY + lB0, sY + lB0,
+                          ulColor);
+            Gfx2DSpanFill(psCtx, sX + lB0, sX + lB0, sY + lA0, sY + lA1,
+                          ulColor);
+            Gfx2DSpanFill(psCtx, sX + lB0, sX + lB0, sY - lA1, sY - lA0,
+                          ulColor);
+            Gfx2DSpanFill(psCtx, sX - lB0, sX - lB0, sY + lA0, sY + lA1,
+                          ulColor);
+            Gfx2DSpanFill(psCtx, sX - lB0, sX - lB0, sY - lA1, sY - lA0,
+                          ulColor);
+        }
+        lA0 = lA;
+    }
+}
+
+//*****************************************************************************
+//
+//! \brief Draw a circle outline.
+//!
+//! \param psCtx is the drawing context.
+//! \param sX is the X coordinate of the center.
+//! \param sY is the Y coordinate of the center.
+//! \param usRadius is the radius.
+//! \param ulColor is the line color.
+//!
+//! \return None.
+//
+//*****************************************************************************
+void
+Gfx2DCircleDraw(tGfx2DContext *psCtx, short sX, short sY,
+                unsigned short usRadius, unsigned long ulColor)
+{
+    Gfx2DCircleRuns(psCtx, sX, sY, usRadius, ulColor, xfalse);
+}
+
+//*****************************************************************************
+//
+//! \brief Draw a filled circle.
+//!
+//! \param psCtx is the drawing context.
+//! \param sX is the X coordinate of the center.
+//! \param sY is the Y coordinate of the center.
+//! \param usRadius is the radius.
+//! \param ulColor is the fill color.
+//!
+//! \return None.
+//
+//*****************************************************************************
+void
+Gfx2DCircleFill(tGfx2DContext *psCtx, short sX, short sY,
+                unsigned short usRadius, unsigned long ulColor)
+{
+    Gfx2DCircleRuns(psCtx, sX, sY, usRadius, ulColor, xtrue);
+}
@@ -0,0 +1,183 @@
+//*****************************************************************************
+//
+//! \file Gfx2D.h
+//! \brief Prototypes for the span based 2D drawing core shared by TFT drivers.
+//! \version V2.2.1.0
+//! \date 10/19/2026
+//! \author CooCox
+//! \copy
+//!
+//! Copyright (c)  2013, CooCox
+//! All rights reserved.
+//!
+//! Redistribution and use in source and binary forms, with or without
+//! modification, are permitted provided that the following conditions
+//! are met:
+//!
+//!     * Redistributions of source code must retain the above copyright
+//! notice, this list of conditions and the following disclaimer.
+//!     * Redistributions in binary form must reproduce the above copyright
+//! notice, this list of conditions and the following disclaimer in the
+//! documentation and/or other materials provided with the distribution.
+//!     * Neither the name of the <ORGANIZATION> nor the names of its
+//! contributors may be used to endorse or promote products derived
+//! from this software without specific prior written permission.
+//!
+//! THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+//! AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+//! IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+//! ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+//! LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+//! CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+//! SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+//! INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//! CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+//! ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+//! THE POSSIBILITY OF SUCH DAMAGE.
+//
+//*****************************************************************************
+#ifndef __GFX2D_H__
+#define __GFX2D_H__
+
+//*****************************************************************************
+//
+// If building with a C++ compiler, make all of the definitions in this header
+// have a C binding.
+//
+//*****************************************************************************
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+//*****************************************************************************
+//
+//! \addtogroup CoX_Driver_Lib
+//! @{
+//
+//! \addtogroup LCD
+//! @{
+//
+//! \addtogroup Gfx2D
+//! \brief Shapes are split into horizontal and vertical spans. Each span is
+//! drawn as one controller window plus one streamed run of pixels, instead of
+//! a cursor set and a write for every pixel.
+//! @{
+//
+//*****************************************************************************
+
+//*****************************************************************************
+//
+//! \addtogroup Gfx2D_Types
+//! @{
+//
+//*****************************************************************************
+
+//
+//! Open a write window on the controller and start a RAM write. Same
+//! argument order as the drivers' SetCurPos() functions.
+//
+typedef void (*tGfx2DWindowSet)(unsigned long ulStartX, unsigned long ulEndX,
+                                unsigned long ulStartY, unsigned long ulEndY);
+
+//
+//! Write \e ulCount pixels of \e ulColor into the open window.
+//
+typedef void (*tGfx2DRunWrite)(unsigned long ulColor, unsigned long ulCount);
+
+//
+//! Draw a single pixel. Optional, used for one pixel spans when cheaper than
+//! a window.
+//
+typedef void (*tGfx2DPixelDraw)(unsigned short usX, unsigned short usY,
+                                unsigned long ulColor);
+
+//
+//! Per-controller operations. Each driver header provides an initializer
+//! for it, e.g. ILI9341_GFX2D_OPS.
+//
+typedef struct
+{
+    tGfx2DWindowSet pfnWindowSet;
+    tGfx2DRunWrite pfnRunWrite;
+    tGfx2DPixelDraw pfnPixelDraw;
+}
+tGfx2DDisplayOps;
+
+//
+//! Drawing context, one per display.
+//
+typedef struct
+{
+    const tGfx2DDisplayOps *psOps;
+
+    //
+    // Clip rectangle, inclusive, always inside the screen.
+    //
+    short sClipX0;
+    short sClipY0;
+    short sClipX1;
+    short sClipY1;
+
+    unsigned short usWidth;
+    unsigned short usHeight;
+}
+tGfx2DContext;
+
+//*****************************************************************************
+//
+//! @}
+//
+//*****************************************************************************
+
+//*****************************************************************************
+//
+//! \addtogroup Gfx2D_Exported_APIs
+//! @{
+//
+//*****************************************************************************
+extern void Gfx2DInit(tGfx2DContext *psCtx, const tGfx2DDisplayOps *psOps,
+                      unsigned short usWidth, unsigned short usHeight);
+extern void Gfx2DClipSet(tGfx2DContext *psCtx, short sX0, short sY0,
+                         short sX1, short sY1);
+extern void Gfx2DPixelDraw(tGfx2DContext *psCtx, short sX, short sY,
+                           unsigned long ulColor);
+extern void Gfx2DHLineDraw(tGfx2DContext *psCtx, short sX0, short sX1,
+                           short sY, unsigned long ulColor);
+extern void Gfx2DVLineDraw(tGfx2DContext *psCtx, short sX, short sY0,
+                           short sY1, unsigned long ulColor);
+extern void Gfx2DLineDraw(tGfx2DContext *psCtx, short sX0, short sY0,
+                          short sX1, short sY1, unsigned long ulColor);
+extern void Gfx2DRectDraw(tGfx2DContext *psCtx, short sX0, short sY0,
+                          short sX1, short sY1, unsigned long ulColor);
+extern void Gfx2DRectFill(tGfx2DContext *psCtx, short sX0, short sY0,
+                          short sX1, short sY1, unsigned long ulColor);
+extern void Gfx2DCircleDraw(tGfx2DContext *psCtx, short sX, short sY,
+                            unsigned short usRadius, unsigned long ulColor);
+extern void Gfx2DCircleFill(tGfx2DContext *psCtx, short sX, short sY,
+                            unsigned short usRadius, unsigned long ulColor);
+
+//*****************************************************************************
+//
+//! @}
+//
+//*****************************************************************************
+
+//*****************************************************************************
+//
+//! @}
+//! @}
+//! @}
+//
+//*****************************************************************************
+
+//*****************************************************************************
+//
+// Mark the end of the C bindings section for C++ compilers.
+//
+//*****************************************************************************
+#ifdef __cplusplus
+}
+#endif
+
+#endif
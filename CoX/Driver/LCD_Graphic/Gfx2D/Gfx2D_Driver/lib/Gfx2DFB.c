@@ -0,0 +1,243 @@
+//*****************************************************************************
+//
+//! \file Gfx2DFB.c
+//! \brief RAM framebuffer backend of the Gfx2D core, with bus transaction counters.
+//! \version V2.2.1.0
+//! \date 10/19/2026
+//! \author CooCox
+//! \copy
+//!
+//! Copyright (c)  2013, CooCox
+//! All rights reserved.
+//!
+//! Redistribution and use in source and binary forms, with or without
+//! modification, are permitted provided that the following conditions
+//! are met:
+//!
+//!     * Redistributions of source code must retain the above copyright
+//! notice, this list of conditions and the following disclaimer.
+//!     * Redistributions in binary form must reproduce the above copyright
+//! notice, this list of conditions and the following disclaimer in the
+//! documentation and/or other materials provided with the distribution.
+//!     * Neither the name of the <ORGANIZATION> nor the names of its
+//! contributors may be used to endorse or promote products derived
+//! from this software without specific prior written permission.
+//!
+//! THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+//! AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+//! IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+//! ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+//! LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+//! CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+//! SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+//! INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//! CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+//! ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+//! THE POSSIBILITY OF SUCH DAMAGE.
+//
+//*****************************************************************************
+
+#include "xhw_types.h"
+#include "xdebug.h"
+#include "Gfx2D.h"
+#include "Gfx2DFB.h"
+
+//
+// The framebuffer and its size.
+//
+static unsigned short *s_pusFB;
+static unsigned short s_usFBWidth;
+static unsigned short s_usFBHeight;
+
+//
+// Open window and the write cursor inside it.
+//
+static unsigned short s_usWinX0, s_usWinX1, s_usWinY0, s_usWinY1;
+static unsigned short s_usCurX, s_usCurY;
+
+//
+// Transaction counters, indexed by GFX2D_FB_STAT_*.
+//
+static unsigned long s_ulFBStat[4];
+
+const tGfx2DDisplayOps g_sGfx2DFBOps =
+{
+    Gfx2DFBWindowSet,
+    Gfx2DFBRunWrite,
+    0
+};
+
+const tGfx2DDisplayOps g_sGfx2DFBPixelOps =
+{
+    Gfx2DFBWindowSet,
+    Gfx2DFBRunWrite,
+    Gfx2DFBPixelDraw
+};
+
+//*****************************************************************************
+//
+//! \brief Initialize the framebuffer backend.
+//!
+//! \param pusBuffer is the pixel memory, \e usWidth * \e usHeight words.
+//! \param usWidth is the width in pixels.
+//! \param usHeight is the height in pixels.
+//!
+//! The window is set to the whole buffer and the counters are cleared. The
+//! pixel memory is left as is.
+//!
+//! \return None.
+//
+//*****************************************************************************
+void
+Gfx2DFBInit(unsigned short *pusBuffer, unsigned short usWidth,
+            unsigned short usHeight)
+{
+    xASSERT((pusBuffer != 0) && (usWidth != 0) && (usHeight != 0));
+
+    s_pusFB = pusBuffer;
+    s_usFBWidth = usWidth;
+    s_usFBHeight = usHeight;
+    s_usWinX0 = 0;
+    s_usWinX1 = usWidth - 1;
+    s_usWinY0 = 0;
+    s_usWinY1 = usHeight - 1;
+    s_usCurX = 0;
+    s_usCurY = 0;
+    Gfx2DFBStatClear();
+}
+
+//*****************************************************************************
+//
+//! \brief Open a write window and move the cursor to its top left corner.
+//!
+//! \param ulStartX is the left edge.
+//! \param ulEndX is the right edge.
+//! \param ulStartY is the top edge.
+//! \param ulEndY is the bottom edge.
+//!
+//! \return None.
+//
+//*****************************************************************************
+void
+Gfx2DFBWindowSet(unsigned long ulStartX, unsigned long ulEndX,
+                 unsigned long ulStartY, unsigned long ulEndY)
+{
+    xASSERT((ulStartX <= ulEndX) && (ulEndX < s_usFBWidth));
+    xASSERT((ulStartY <= ulEndY) && (ulEndY < s_usFBHeight));
+
+    s_usWinX0 = ulStartX;
+    s_usWinX1 = ulEndX;
+    s_usWinY0 = ulStartY;
+    s_usWinY1 = ulEndY;
+    s_usCurX = ulStartX;
+    s_usCurY = ulStartY;
+    s_ulFBStat[GFX2D_FB_STAT_WINDOW]++;
+}
+
+//*****************************************************************************
+//
+//! \brief Write a run of pixels at the cursor.
+//!
+//! \param ulColor is the pixel color.
+//! \param ulCount is the number of pixels.
+//!
+//! The cursor moves right and wraps to the next row of the window, and from
+//! the last row back to the first, as the controllers' address counters do.
+//!
+//! \return None.
+//
+//*****************************************************************************
+void
+Gfx2DFBRunWrite(unsigned long ulColor, unsigned long ulCount)
+{
+    s_ulFBStat[GFX2D_FB_STAT_RUN]++;
+    s_ulFBStat[GFX2D_FB_STAT_DATA] += ulCount;
+
+    while(ulCount--)
+    {
+        s_pusFB[(unsigned long)s_usCurY * s_usFBWidth + s_usCurX] =
+            (unsigned short)ulColor;
+        if(s_usCurX++ == s_usWinX1)
+        {
+            s_usCurX = s_usWinX0;
+            if(s_usCurY++ == s_usWinY1)
+            {
+                s_usCurY = s_usWinY0;
+            }
+        }
+    }
+}
+
+//*****************************************************************************
+//
+//! \brief Draw one pixel without touching the window.
+//!
+//! \param usX is the X coordinate.
+//! \param usY is the Y coordinate.
+//! \param ulColor is the pixel color.
+//!
+//! \return None.
+//
+//*****************************************************************************
+void
+Gfx2DFBPixelDraw(unsigned short usX, unsigned short usY, unsigned long ulColor)
+{
+    xASSERT((usX < s_usFBWidth) && (usY < s_usFBHeight));
+
+    s_pusFB[(unsigned long)usY * s_usFBWidth + usX] = (unsigned short)ulColor;
+    s_ulFBStat[GFX2D_FB_STAT_PIXEL]++;
+    s_ulFBStat[GFX2D_FB_STAT_DATA]++;
+}
+
+//*****************************************************************************
+//
+//! \brief Read back one pixel.
+//!
+//! \param usX is the X coordinate.
+//! \param usY is the Y coordinate.
+//!
+//! \return The pixel color.
+//
+//*****************************************************************************
+unsigned short
+Gfx2DFBPixelGet(unsigned short usX, unsigned short usY)
+{
+    xASSERT((usX < s_usFBWidth) && (usY < s_usFBHeight));
+
+    return s_pusFB[(unsigned long)usY * s_usFBWidth + usX];
+}
+
+//*****************************************************************************
+//
+//! \brief Get a transaction counter.
+//!
+//! \param ulStat is the counter, one of \ref Gfx2DFB_Stat.
+//!
+//! \return The counter value since the last Gfx2DFBStatClear().
+//
+//*****************************************************************************
+unsigned long
+Gfx2DFBStatGet(unsigned long ulStat)
+{
+    xASSERT(ulStat <= GFX2D_FB_STAT_DATA);
+
+    return s_ulFBStat[ulStat];
+}
+
+//*****************************************************************************
+//
+//! \brief Clear all transaction counters.
+//!
+//! \return None.
+//
+//*****************************************************************************
+void
+Gfx2DFBStatClear(void)
+{
+    unsigned long i;
+
+    for(i = 0; i < sizeof(s_ulFBStat) / sizeof(s_ulFBStat[0]); i++)
+    {
+        s_ulFBStat[i] = 0;
+    }
+}
@@ -0,0 +1,159 @@
+//*****************************************************************************
+//
+//! \file Gfx2DFB.h
+//! \brief Prototypes for the RAM framebuffer backend of the Gfx2D core.
+//! \version V2.2.1.0
+//! \date 10/19/2026
+//! \author CooCox
+//! \copy
+//!
+//! Copyright (c)  2013, CooCox
+//! All rights reserved.
+//!
+//! Redistribution and use in source and binary forms, with or without
+//! modification, are permitted provided that the following conditions
+//! are met:
+//!
+//!     * Redistributions of source code must retain the above copyright
+//! notice, this list of conditions and the following disclaimer.
+//!     * Redistributions in binary form must reproduce the above copyright
+//! notice, this list of conditions and the following disclaimer in the
+//! documentation and/or other materials provided with the distribution.
+//!     * Neither the name of the <ORGANIZATION> nor the names of its
+//! contributors may be used to endorse or promote products derived
+//! from this software without specific prior written permission.
+//!
+//! THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+//! AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+//! IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+//! ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+//! LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+//! CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+//! SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+//! INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//! CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+//! ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+//! THE POSSIBILITY OF SUCH DAMAGE.
+//
+//*****************************************************************************
+#ifndef __GFX2DFB_H__
+#define __GFX2DFB_H__
+
+//*****************************************************************************
+//
+// If building with a C++ compiler, make all of the definitions in this header
+// have a C binding.
+//
+//*****************************************************************************
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+//*****************************************************************************
+//
+//! \addtogroup CoX_Driver_Lib
+//! @{
+//
+//! \addtogroup LCD
+//! @{
+//
+//! \addtogroup Gfx2D
+//! @{
+//
+//! \addtogroup Gfx2DFB
+//! \brief A 16 bpp RAM framebuffer that behaves like a TFT controller
+//! (window, auto-increment write), and counts the bus transactions it was
+//! given. Used for pixel-exact tests on the host and for off-screen drawing.
+//! @{
+//
+//*****************************************************************************
+
+//*****************************************************************************
+//
+//! \addtogroup Gfx2DFB_Stat Gfx2DFB Statistics
+//! \brief Values that can be passed to Gfx2DFBStatGet().
+//! @{
+//
+//*****************************************************************************
+
+//
+//! Number of window set operations.
+//
+#define GFX2D_FB_STAT_WINDOW    0
+
+//
+//! Number of run write operations.
+//
+#define GFX2D_FB_STAT_RUN       1
+
+//
+//! Number of single pixel operations.
+//
+#define GFX2D_FB_STAT_PIXEL     2
+
+//
+//! Number of pixel data words written by runs and single pixels.
+//
+#define GFX2D_FB_STAT_DATA      3
+
+//*****************************************************************************
+//
+//! @}
+//
+//*****************************************************************************
+
+//*****************************************************************************
+//
+//! \addtogroup Gfx2DFB_Exported_APIs
+//! @{
+//
+//*****************************************************************************
+
+//
+//! Operations of the framebuffer without a pixel callback, so every span
+//! costs a window, like on ILI9341/ST7735.
+//
+extern const tGfx2DDisplayOps g_sGfx2DFBOps;
+
+//
+//! Operations of the framebuffer with a pixel callback, like on SSD1298.
+//
+extern const tGfx2DDisplayOps g_sGfx2DFBPixelOps;
+
+extern void Gfx2DFBInit(unsigned short *pusBuffer, unsigned short usWidth,
+                        unsigned short usHeight);
+extern void Gfx2DFBWindowSet(unsigned long ulStartX, unsigned long ulEndX,
+                             unsigned long ulStartY, unsigned long ulEndY);
+extern void Gfx2DFBRunWrite(unsigned long ulColor, unsigned long ulCount);
+extern void Gfx2DFBPixelDraw(unsigned short usX, unsigned short usY,
+                             unsigned long ulColor);
+extern unsigned short Gfx2DFBPixelGet(unsigned short usX, unsigned short usY);
+extern unsigned long Gfx2DFBStatGet(unsigned long ulStat);
+extern void Gfx2DFBStatClear(void);
+
+//*****************************************************************************
+//
+//! @}
+//
+//*****************************************************************************
+
+//*****************************************************************************
+//
+//! @}
+//! @}
+//! @}
+//! @}
+//
+//*****************************************************************************
+
+//*****************************************************************************
+//
+// Mark the end of the C bindings section for C++ compilers.
+//
+//*****************************************************************************
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,587 @@
+//*****************************************************************************
+//
+//! \file Gfx2DText.c
+//! \brief Font and text renderer on top of the Gfx2D drawing core.
+//! \version V2.2.1.0
+//! \date 10/19/2026
+//! \author CooCox
+//! \copy
+//!
+//! Copyright (c)  2013, CooCox
+//! All rights reserved.
+//!
+//! Redistribution and use in source and binary forms, with or without
+//! modification, are permitted provided that the following conditions
+//! are met:
+//!
+//!     * Redistributions of source code must retain the above copyright
+//! notice, this list of conditions and the following disclaimer.
+//!     * Redistributions in binary form must reproduce the above copyright
+//! notice, this list of conditions and the following disclaimer in the
+//! documentation and/or other materials provided with the distribution.
+//!     * Neither the name of the <ORGANIZATION> nor the names of its
+//! contributors may be used to endorse or promote products derived
+//! from this software without specific prior written permission.
+//!
+//! THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+//! AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+//! IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+//! ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+//! LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+//! CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+//! SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+//! INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//! CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+//! ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+//! THE POSSIBILITY OF SUCH DAMAGE.
+//
+//*****************************************************************************
+
+#include "xhw_types.h"
+#include "xdebug.h"
+#include "Gfx2D.h"
+#include "Gfx2DText.h"
+
+//
+// Where the runs of a glyph go. Runs of the same color are merged before
+// they are written.
+//
+typedef struct
+{
+    tGfx2DContext *psCtx;
+    unsigned long ulFgColor;
+    unsigned long ulBgColor;
+
+    //
+    // Pending run.
+    //
+    unsigned char ucFg;
+    unsigned long ulCount;
+
+    //
+    // Glyph box, used when the glyph is clipped and the runs have to be cut
+    // into spans.
+    //
+    xtBoolean bClipped;
+    short sX;
+    short sY;
+    unsigned char ucWidth;
+    unsigned long ulPos;
+}
+tGfx2DGlyphSink;
+
+//*****************************************************************************
+//
+//! \brief Write the pending run of a glyph.
+//!
+//! \param psSink is the glyph sink.
+//!
+//! \return None.
+//
+//*****************************************************************************
+static void
+Gfx2DGlyphFlush(tGfx2DGlyphSink *psSink)
+{
+    unsigned long ulColor, ulCount, ulX, ulN;
+    short sY;
+
+    ulCount = psSink->ulCount;
+    if(ulCount == 0)
+    {
+        return;
+    }
+    psSink->ulCount = 0;
+    ulColor = psSink->ucFg ? psSink->ulFgColor : psSink->ulBgColor;
+
+    if(!psSink->bClipped)
+    {
+        psSink->psCtx->psOps->pfnRunWrite(ulColor, ulCount);
+        return;
+    }
+
+    //
+    // Cut the run at the row ends and let the core clip each span.
+    //
+    while(ulCount)
+    {
+        ulX = psSink->ulPos % psSink->ucWidth;
+        sY = psSink->sY + (short)(psSink->ulPos / psSink->ucWidth);
+        ulN = psSink->ucWidth - ulX;
+        if(ulN > ulCount)
+        {
+            ulN = ulCount;
+        }
+        Gfx2DHLineDraw(psSink->psCtx, psSink->sX + (short)ulX,
+                       psSink->sX + (short)(ulX + ulN - 1), sY, ulColor);
+        psSink->ulPos += ulN;
+        ulCount -= ulN;
+    }
+}
+
+//*****************************************************************************
+//
+//! \brief Add a run to a glyph sink.
+//!
+//! \param psSink is the glyph sink.
+//! \param ucFg is 1 for a foreground run, 0 for background.
+//! \param ulCount is the run length.
+//!
+//! \return None.
+//
+//*****************************************************************************
+static void
+Gfx2DGlyphRun(tGfx2DGlyphSink *psSink, unsigned char ucFg,
+              unsigned long ulCount)
+{
+    if(psSink->ucFg != ucFg)
+    {
+        Gfx2DGlyphFlush(psSink);
+        psSink->ucFg = ucFg;
+    }
+    psSink->ulCount += ulCount;
+}
+
+//*****************************************************************************
+//
+//! \brief Decode a glyph into runs.
+//!
+//! \param psSink is the glyph sink.
+//! \param ucFormat is the font format.
+//! \param pucData is the glyph data.
+//! \param ucWidth is the glyph width.
+//! \param ucHeight is the glyph height.
+//!
+//! \return None.
+//
+//*****************************************************************************
+static void
+Gfx2DGlyphDecode(tGfx2DGlyphSink *psSink, unsigned char ucFormat,
+                 const unsigned char *pucData, unsigned char ucWidth,
+                 unsigned char ucHeight)
+{
+    unsigned long ulLeft = (unsigned long)ucWidth * ucHeight;
+    unsigned long ulRun, ulN;
+    unsigned char ucRow, ucCol, ucBits, ucFg, ucCur;
+
+    if(ucFormat == GFX2D_FONT_RLE)
+    {
+        while(ulLeft)
+        {
+            ucBits = *pucData++;
+
+            ulN = ucBits >> 4;
+            if(ulN > ulLeft) ulN = ulLeft;
+            if(ulN)
+            {
+                Gfx2DGlyphRun(psSink, 0, ulN);
+                ulLeft -= ulN;
+            }
+
+            ulN = ucBits & 0x0F;
+            if(ulN > ulLeft) ulN = ulLeft;
+            if(ulN)
+            {
+                Gfx2DGlyphRun(psSink, 1, ulN);
+                ulLeft -= ulN;
+            }
+        }
+        return;
+    }
+
+    //
+    // Bitmap, count equal bits locally and pass whole runs on.
+    //
+    ucCur = 0;
+    ulRun = 0;
+    ucBits = 0;
+    for(ucRow = 0; ucRow < ucHeight; ucRow++)
+    {
+        for(ucCol = 0; ucCol < ucWidth; ucCol++)
+        {
+            if((ucCol & 7) == 0)
+            {
+                ucBits = *pucData++;
+            }
+            ucFg = (ucBits & 0x80) ? 1 : 0;
+            ucBits <<= 1;
+
+            if(ucFg != ucCur)
+            {
+                if(ulRun)
+                {
+                    Gfx2DGlyphRun(psSink, ucCur, ulRun);
+                }
+                ucCur = ucFg;
+                ulRun = 0;
+            }
+            ulRun++;
+        }
+    }
+    if(ulRun)
+    {
+        Gfx2DGlyphRun(psSink, ucCur, ulRun);
+    }
+}
+
+//*****************************************************************************
+//
+//! \brief Find a glyph in a font.
+//!
+//! \param psFont is the font.
+//! \param usCode is the character code, ASCII or a two byte GB code with
+//! the first byte in the high half.
+//! \param pucWidth returns the glyph width, may be 0.
+//!
+//! Sparse fonts are searched with a binary search on the code table.
+//!
+//! \return The glyph data, or 0 if the font has no such glyph.
+//
+//*****************************************************************************
+const unsigned char *
+Gfx2DFontGlyphGet(const tGfx2DFont *psFont, unsigned short usCode,
+                  unsigned char *pucWidth)
+{
+    unsigned long ulIndex, ulLow, ulHigh;
+
+    xASSERT(psFont != 0);
+
+    if(psFont->pusCode)
+    {
+        ulLow = 0;
+        ulHigh = psFont->usCount;
+        while(ulLow < ulHigh)
+        {
+            ulIndex = (ulLow + ulHigh) / 2;
+            if(psFont->pusCode[ulIndex] < usCode)
+            {
+                ulLow = ulIndex + 1;
+            }
+            else
+            {
+                ulHigh = ulIndex;
+            }
+        }
+        if((ulLow >= psFont->usCount) || (psFont->pusCode[ulLow] != usCode))
+        {
+            return 0;
+        }
+        ulIndex = ulLow;
+    }
+    else
+    {
+        if((usCode < psFont->usFirst) ||
+           ((unsigned long)(usCode - psFont->usFirst) >= psFont->usCount))
+        {
+            return 0;
+        }
+        ulIndex = usCode - psFont->usFirst;
+    }
+
+    if(pucWidth)
+    {
+        *pucWidth = psFont->pucWidth ? psFont->pucWidth[ulIndex] :
+                                       psFont->ucWidth;
+    }
+
+    if(psFont->pulOffset)
+    {
+        return psFont->pucData + psFont->pulOffset[ulIndex];
+    }
+
+    xASSERT((psFont->ucFormat == GFX2D_FONT_BITMAP) && (psFont->pucWidth == 0));
+    return psFont->pucData +
+           ulIndex * ((psFont->ucWidth + 7) / 8) * psFont->ucHeight;
+}
+
+//*****************************************************************************
+//
+//! \brief Draw a character.
+//!
+//! \param psCtx is the drawing context.
+//! \param psFont is the font.
+//! \param sX is the left edge.
+//! \param sY is the top edge.
+//! \param usCode is the character code.
+//! \param ulFgColor is the text color.
+//! \param ulBgColor is the background color.
+//!
+//! A glyph inside the clip rectangle is written as one window and its
+//! color runs. A partly clipped glyph is written span by span.
+//!
+//! \return The glyph width, or 0 if the font has no such glyph.
+//
+//*****************************************************************************
+short
+Gfx2DCharDraw(tGfx2DContext *psCtx, const tGfx2DFont *psFont, short sX,
+              short sY, unsigned short usCode, unsigned long ulFgColor,
+              unsigned long ulBgColor)
+{
+    const unsigned char *pucData;
+    tGfx2DGlyphSink sSink;
+    unsigned char ucWidth;
+    long lX1, lY1;
+
+    xASSERT(psCtx != 0);
+
+    pucData = Gfx2DFontGlyphGet(psFont, usCode, &ucWidth);
+    if((pucData == 0) || (ucWidth == 0))
+    {
+        return 0;
+    }
+
+    lX1 = (long)sX + ucWidth - 1;
+    lY1 = (long)sY + psFont->ucHeight - 1;
+    if((lX1 < psCtx->sClipX0) || (sX > psCtx->sClipX1) ||
+       (lY1 < psCtx->sClipY0) || (sY > psCtx->sClipY1))
+    {
+        return ucWidth;
+    }
+
+    sSink.psCtx = psCtx;
+    sSink.ulFgColor = ulFgColor;
+    sSink.ulBgColor = ulBgColor;
+    sSink.ucFg = 0;
+    sSink.ulCount = 0;
+    sSink.sX = sX;
+    sSink.sY = sY;
+    sSink.ucWidth = ucWidth;
+    sSink.ulPos = 0;
+    sSink.bClipped = ((sX < psCtx->sClipX0) || (lX1 > psCtx->sClipX1) ||
+                      (sY < psCtx->sClipY0) || (lY1 > psCtx->sClipY1));
+
+    if(!sSink.bClipped)
+    {
+        psCtx->psOps->pfnWindowSet(sX, lX1, sY, lY1);
+    }
+    Gfx2DGlyphDecode(&sSink, psFont->ucFormat, pucData, ucWidth,
+                     psFont->ucHeight);
+    Gfx2DGlyphFlush(&sSink);
+
+    return ucWidth;
+}
+
+//*****************************************************************************
+//
+//! \brief Get the next character code of a string.
+//!
+//! \param ppcString is the string pointer, moved past the character.
+//!
+//! Bytes below 0x80 are ASCII, others start a two byte GB code.
+//!
+//! \return The character code.
+//
+//*****************************************************************************
+static unsigned short
+Gfx2DCodeNext(const char **ppcString)
+{
+    const unsigned char *pucStr = (const unsigned char *)*ppcString;
+    unsigned short usCode = pucStr[0];
+
+    if((usCode >= 0x80) && pucStr[1])
+    {
+        usCode = (usCode << 8) | pucStr[1];
+        *ppcString += 2;
+    }
+    else
+    {
+        *ppcString += 1;
+    }
+    return usCode;
+}
+
+//*****************************************************************************
+//
+//! \brief Draw a string.
+//!
+//! \param psCtx is the drawing context.
+//! \param psFont is the font for ASCII characters.
+//! \param psWideFont is the font for two byte GB characters, may be 0.
+//! \param sX is the left edge.
+//! \param sY is the top edge.
+//! \param pcString is the zero terminated string.
+//! \param ulFgColor is the text color.
+//! \param ulBgColor is the background color, also used for the spacing.
+//!
+//! Characters without a glyph are skipped.
+//!
+//! \return The X coordinate after the last character.
+//
+//*****************************************************************************
+short
+Gfx2DStringDraw(tGfx2DContext *psCtx, const tGfx2DFont *psFont,
+                const tGfx2DFont *psWideFont, short sX, short sY,
+                const char *pcString, unsigned long ulFgColor,
+                unsigned long ulBgColor)
+{
+    const tGfx2DFont *psUse;
+    unsigned short usCode;
+    short sWidth;
+
+    xASSERT((psFont != 0) && (pcString != 0));
+
+    while(*pcString)
+    {
+        usCode = Gfx2DCodeNext(&pcString);
+        psUse = (usCode < 0x100) ? psFont : psWideFont;
+        if(psUse == 0)
+        {
+            continue;
+        }
+
+        sWidth = Gfx2DCharDraw(psCtx, psUse, sX, sY, usCode, ulFgColor,
+                               ulBgColor);
+        if(sWidth == 0)
+        {
+            continue;
+        }
+        sX += sWidth;
+
+        if(psUse->ucSpacing)
+        {
+            Gfx2DRectFill(psCtx, sX, sY, sX + psUse->ucSpacing - 1,
+                          sY + psUse->ucHeight - 1, ulBgColor);
+            sX += psUse->ucSpacing;
+        }
+    }
+
+    return sX;
+}
+
+//*****************************************************************************
+//
+//! \brief Get the width of a string without drawing it.
+//!
+//! \param psFont is the font for ASCII characters.
+//! \param psWideFont is the font for two byte GB characters, may be 0.
+//! \param pcString is the zero terminated string.
+//!
+//! \return The width in pixels, as Gfx2DStringDraw() would advance.
+//
+//*****************************************************************************
+unsigned long
+Gfx2DStringWidth(const tGfx2DFont *psFont, const tGfx2DFont *psWideFont,
+                 const char *pcString)
+{
+    const tGfx2DFont *psUse;
+    unsigned long ulWidth = 0;
+    unsigned short usCode;
+    unsigned char ucWidth;
+
+    xASSERT((psFont != 0) && (pcString != 0));
+
+    while(*pcString)
+    {
+        usCode = Gfx2DCodeNext(&pcString);
+        psUse = (usCode < 0x100) ? psFont : psWideFont;
+        if(psUse && Gfx2DFontGlyphGet(psUse, usCode, &ucWidth) && ucWidth)
+        {
+            ulWidth += ucWidth + psUse->ucSpacing;
+        }
+    }
+
+    return ulWidth;
+}
+
+//*****************************************************************************
+//
+//! \brief Write a background/foreground pair in GFX2D_FONT_RLE format.
+//!
+//! \param ulBg is the background run.
+//! \param ulFg is the foreground run.
+//! \param pucOut is the output buffer.
+//! \param pulLen is the output length, updated.
+//! \param ulSize is the size of the output buffer.
+//!
+//! \return xtrue if the pair fits.
+//
+//*****************************************************************************
+static xtBoolean
+Gfx2DRLEPairPut(unsigned long ulBg, unsigned long ulFg, unsigned char *pucOut,
+                unsigned long *pulLen, unsigned long ulSize)
+{
+    unsigned long ulN;
+
+    do
+    {
+        if(*pulLen >= ulSize)
+        {
+            return xfalse;
+        }
+        if(ulBg > 15)
+        {
+            pucOut[(*pulLen)++] = 0xF0;
+            ulBg -= 15;
+            continue;
+        }
+        ulN = (ulFg > 15) ? 15 : ulFg;
+        pucOut[(*pulLen)++] = (unsigned char)((ulBg << 4) | ulN);
+        ulBg = 0;
+        ulFg -= ulN;
+    }
+    while(ulBg || ulFg);
+
+    return xtrue;
+}
+
+//*****************************************************************************
+//
+//! \brief Convert a bitmap glyph to the GFX2D_FONT_RLE format.
+//!
+//! \param pucBitmap is the glyph in GFX2D_FONT_BITMAP layout.
+//! \param ucWidth is the glyph width.
+//! \param ucHeight is the glyph height.
+//! \param pucOut is the output buffer.
+//! \param ulSize is the size of the output buffer.
+//!
+//! Meant for building compressed CJK tables, on the host or once at start
+//! up. Large glyphs compress best, a 32x32 glyph usually needs well under
+//! the 128 bytes of its bitmap.
+//!
+//! \return The number of bytes written, or 0 if \e pucOut is too small.
+//
+//*****************************************************************************
+unsigned long
+Gfx2DFontRLEEncode(const unsigned char *pucBitmap, unsigned char ucWidth,
+                   unsigned char ucHeight, unsigned char *pucOut,
+                   unsigned long ulSize)
+{
+    unsigned long ulLen = 0, ulBg = 0, ulFg = 0;
+    unsigned long ulStride = (ucWidth + 7) / 8;
+    unsigned long ulRow, ulCol;
+
+    xASSERT((pucBitmap != 0) && (pucOut != 0));
+
+    for(ulRow = 0; ulRow < ucHeight; ulRow++)
+    {
+        for(ulCol = 0; ulCol < ucWidth; ulCol++)
+        {
+            if(pucBitmap[ulRow * ulStride + ulCol / 8] & (0x80 >> (ulCol & 7)))
+            {
+                ulFg++;
+            }
+            else if(ulFg)
+            {
+                //
+                // Background after foreground ends a pair.
+                //
+                if(!Gfx2DRLEPairPut(ulBg, ulFg, pucOut, &ulLen, ulSize))
+                {
+                    return 0;
+                }
+                ulBg = 1;
+                ulFg = 0;
+            }
+            else
+            {
+                ulBg++;
+            }
+        }
+    }
+
+    if((ulBg || ulFg) && !Gfx2DRLEPairPut(ulBg, ulFg, pucOut, &ulLen, ulSize))
+    {
+        return 0;
+    }
+
+    return ulLen;
+}
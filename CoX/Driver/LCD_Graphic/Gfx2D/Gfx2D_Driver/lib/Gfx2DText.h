@@ -0,0 +1,224 @@
+//*****************************************************************************
+//
+//! \file Gfx2DText.h
+//! \brief Prototypes for the Gfx2D font and text renderer.
+//! \version V2.2.1.0
+//! \date 10/19/2026
+//! \author CooCox
+//! \copy
+//!
+//! Copyright (c)  2013, CooCox
+//! All rights reserved.
+//!
+//! Redistribution and use in source and binary forms, with or without
+//! modification, are permitted provided that the following conditions
+//! are met:
+//!
+//!     * Redistributions of source code must retain the above copyright
+//! notice, this list of conditions and the following disclaimer.
+//!     * Redistributions in binary form must reproduce the above copyright
+//! notice, this list of conditions and the following disclaimer in the
+//! documentation and/or other materials provided with the distribution.
+//!     * Neither the name of the <ORGANIZATION> nor the names of its
+//! contributors may be used to endorse or promote products derived
+//! from this software without specific prior written permission.
+//!
+//! THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+//! AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+//! IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+//! ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+//! LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+//! CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+//! SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+//! INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//! CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+//! ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+//! THE POSSIBILITY OF SUCH DAMAGE.
+//
+//*****************************************************************************
+#ifndef __GFX2DTEXT_H__
+#define __GFX2DTEXT_H__
+
+//*****************************************************************************
+//
+// If building with a C++ compiler, make all of the definitions in this header
+// have a C binding.
+//
+//*****************************************************************************
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+//*****************************************************************************
+//
+//! \addtogroup CoX_Driver_Lib
+//! @{
+//
+//! \addtogroup LCD
+//! @{
+//
+//! \addtogroup Gfx2D
+//! @{
+//
+//! \addtogroup Gfx2DText
+//! \brief Each glyph is drawn as one window covering the glyph, followed by
+//! the foreground and background runs of the glyph in window order. A run
+//! continues across row ends, so an 8x16 character needs about 30 run writes
+//! instead of 128 single pixel writes. Glyphs that are partly clipped are
+//! drawn as clipped horizontal spans instead.
+//! @{
+//
+//*****************************************************************************
+
+//*****************************************************************************
+//
+//! \addtogroup Gfx2DText_Format Gfx2D Font Format
+//! \brief Values of the ucFormat field of tGfx2DFont.
+//! @{
+//
+//*****************************************************************************
+
+//
+//! 1 bpp bitmap, rows from top to bottom, MSB is the left pixel, each row
+//! padded to a whole byte. This is the layout of 8X16.h and GB1616.h.
+//
+#define GFX2D_FONT_BITMAP       0
+
+//
+//! Run-length coded, see Gfx2DFontRLEEncode(). Each byte holds a background
+//! run in the high nibble and the foreground run that follows it in the low
+//! nibble, in window order. Runs longer than 15 are split as (15, 0) or
+//! (0, 15) bytes. A glyph ends when width * height pixels are decoded.
+//
+#define GFX2D_FONT_RLE          1
+
+//*****************************************************************************
+//
+//! @}
+//
+//*****************************************************************************
+
+//*****************************************************************************
+//
+//! \addtogroup Gfx2DText_Types
+//! @{
+//
+//*****************************************************************************
+
+//
+//! A font. Every table except pucData is optional.
+//
+typedef struct
+{
+    //
+    //! GFX2D_FONT_BITMAP or GFX2D_FONT_RLE.
+    //
+    unsigned char ucFormat;
+
+    //
+    //! Glyph width in pixels when pucWidth is 0.
+    //
+    unsigned char ucWidth;
+
+    //
+    //! Glyph height in pixels.
+    //
+    unsigned char ucHeight;
+
+    //
+    //! Blank columns added after each glyph when drawing a string.
+    //
+    unsigned char ucSpacing;
+
+    //
+    //! Code of the first glyph when pusCode is 0.
+    //
+    unsigned short usFirst;
+
+    //
+    //! Number of glyphs.
+    //
+    unsigned short usCount;
+
+    //
+    //! Sorted glyph codes, for sparse sets such as CJK. If 0 the glyphs are
+    //! the codes usFirst to usFirst + usCount - 1.
+    //
+    const unsigned short *pusCode;
+
+    //
+    //! Width of each glyph, for proportional fonts. If 0 every glyph is
+    //! ucWidth wide.
+    //
+    const unsigned char *pucWidth;
+
+    //
+    //! Offset of each glyph in pucData. If 0 the glyphs follow each other
+    //! with a fixed size, which needs GFX2D_FONT_BITMAP and no pucWidth.
+    //
+    const unsigned long *pulOffset;
+
+    //
+    //! Glyph data.
+    //
+    const unsigned char *pucData;
+}
+tGfx2DFont;
+
+//*****************************************************************************
+//
+//! @}
+//
+//*****************************************************************************
+
+//*****************************************************************************
+//
+//! \addtogroup Gfx2DText_Exported_APIs
+//! @{
+//
+//*****************************************************************************
+extern const unsigned char *Gfx2DFontGlyphGet(const tGfx2DFont *psFont,
+                                              unsigned short usCode,
+                                              unsigned char *pucWidth);
+extern short Gfx2DCharDraw(tGfx2DContext *psCtx, const tGfx2DFont *psFont,
+                           short sX, short sY, unsigned short usCode,
+                           unsigned long ulFgColor, unsigned long ulBgColor);
+extern short Gfx2DStringDraw(tGfx2DContext *psCtx, const tGfx2DFont *psFont,
+                             const tGfx2DFont *psWideFont, short sX, short sY,
+                             const char *pcString, unsigned long ulFgColor,
+                             unsigned long ulBgColor);
+extern unsigned long Gfx2DStringWidth(const tGfx2DFont *psFont,
+                                      const tGfx2DFont *psWideFont,
+                                      const char *pcString);
+extern unsigned long Gfx2DFontRLEEncode(const unsigned char *pucBitmap,
+                                        unsigned char ucWidth,
+                                        unsigned char ucHeight,
+                                        unsigned char *pucOut,
+                                        unsigned long ulSize);
+
+//*****************************************************************************
+//
+//! @}
+//
+//*****************************************************************************
+
+//*****************************************************************************
+//
+//! @}
+//! @}
+//! @}
+//! @}
+//
+//*****************************************************************************
+
+//*****************************************************************************
+//
+// Mark the end of the C bindings section for C++ compilers.
+//
+//*****************************************************************************
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,17 @@
+#include "test.h"
+
+//*****************************************************************************
+//
+//! \brief main
+//!
+//! \return None.
+//
+//*****************************************************************************
+int main(void)
+{
+    TestMain();
+    while(1)
+    {
+
+    }
+}
\ No newline at end of file
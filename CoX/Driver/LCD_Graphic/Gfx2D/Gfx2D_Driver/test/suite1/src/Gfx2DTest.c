@@ -0,0 +1,379 @@
+//*****************************************************************************
+//
+//! @page Gfx2D_testcase Gfx2D drawing core test
+//!
+//! File: @ref Gfx2DTest.c
+//!
+//! <h2>Description</h2>
+//! This module implements the test sequence for the Gfx2D drawing core. The
+//! shapes are drawn into the RAM framebuffer backend and compared pixel by
+//! pixel with a plain per-pixel reference, and the bus transactions are
+//! counted.<br><br>
+//! - \p Board: STM32 Fire Bull Develop Board <br><br>
+//! - \p Last-Time(about): 0.5s <br><br>
+//! - \p Phenomenon: Success or failure information will be printed on the UART. <br><br>
+//! .
+//!
+//! <h2>Preconditions</h2>
+//! The module requires the following options:<br><br>
+//! - \p Option-define:
+//! <br>(1)None.<br><br>
+//! - \p Option-hardware:
+//! <br>(1)None, no LCD is needed.<br><br>
+//! - \p Option-OtherModule:
+//! <br>Connect an COM cable to the development board.<br>
+//! .
+//! In case some of the required options are not enabled then some or all tests
+//! may be skipped or result FAILED.<br>
+//!
+//! <h2>Test Cases</h2>
+//! The module contain those sub tests:<br><br>
+//! - \subpage test_Gfx2D_Function
+//! .
+//! \file Gfx2DTest.c
+//! \brief Gfx2D test source file
+//! \brief Gfx2D test header file <br>
+//
+//*****************************************************************************
+
+#include "test.h"
+#include "Gfx2D.h"
+#include "Gfx2DFB.h"
+
+#define FB_WIDTH                64
+#define FB_HEIGHT               48
+
+#define COLOR_BG                0x0000
+#define COLOR_FG                0xF81F
+
+static unsigned short usFB[FB_WIDTH * FB_HEIGHT];
+static unsigned short usRef[FB_WIDTH * FB_HEIGHT];
+static tGfx2DContext sCtx;
+
+//
+// Reference clip rectangle.
+//
+static long lRefX0, lRefY0, lRefX1, lRefY1;
+
+//*****************************************************************************
+//
+//! \brief Clear both buffers and the counters.
+//!
+//! \return None.
+//
+//*****************************************************************************
+static void Gfx2DTestClear(void)
+{
+    unsigned long i;
+
+    for(i = 0; i < FB_WIDTH * FB_HEIGHT; i++)
+    {
+        usFB[i] = COLOR_BG;
+        usRef[i] = COLOR_BG;
+    }
+    Gfx2DFBStatClear();
+}
+
+//*****************************************************************************
+//
+//! \brief Reference pixel plot with clipping.
+//!
+//! \return None.
+//
+//*****************************************************************************
+static void RefPlot(long lX, long lY)
+{
+    if((lX >= lRefX0) && (lX <= lRefX1) && (lY >= lRefY0) && (lY <= lRefY1))
+    {
+        usRef[lY * FB_WIDTH + lX] = COLOR_FG;
+    }
+}
+
+static void RefHLine(long lX0, long lX1, long lY)
+{
+    for(; lX0 <= lX1; lX0++)
+    {
+        RefPlot(lX0, lY);
+    }
+}
+
+//*****************************************************************************
+//
+//! \brief Reference Bresenham line, one pixel at a time.
+//!
+//! \return None.
+//
+//*****************************************************************************
+static void RefLine(long lX0, long lY0, long lX1, long lY1)
+{
+    long lDx, lDy, lSx, lSy, lErr, i;
+
+    lDx = (lX1 > lX0) ? (lX1 - lX0) : (lX0 - lX1);
+    lDy = (lY1 > lY0) ? (lY1 - lY0) : (lY0 - lY1);
+    lSx = (lX1 >= lX0) ? 1 : -1;
+    lSy = (lY1 >= lY0) ? 1 : -1;
+
+    if(lDx >= lDy)
+    {
+        lErr = 2 * lDy - lDx;
+        for(i = 0; i <= lDx; i++)
+        {
+            RefPlot(lX0, lY0);
+            if(lErr > 0)
+            {
+                lY0 += lSy;
+                lErr -= 2 * lDx;
+            }
+            lErr += 2 * lDy;
+            lX0 += lSx;
+        }
+    }
+    else
+    {
+        lErr = 2 * lDx - lDy;
+        for(i = 0; i <= lDy; i++)
+        {
+            RefPlot(lX0, lY0);
+            if(lErr > 0)
+            {
+                lX0 += lSx;
+                lErr -= 2 * lDy;
+            }
+            lErr += 2 * lDx;
+            lY0 += lSy;
+        }
+    }
+}
+
+//*****************************************************************************
+//
+//! \brief Reference circle, the eight point loop of the SSD1298 driver.
+//!
+//! \return None.
+//
+//*****************************************************************************
+static void RefCircle(long lX, long lY, long lR, xtBoolean bFill)
+{
+    long lA = 0, lB = lR, lD = 3 - 2 * lR;
+
+    while(lA <= lB)
+    {
+        if(bFill)
+        {
+            RefHLine(lX - lA, lX + lA, lY - lB);
+            RefHLine(lX - lA, lX + lA, lY + lB);
+            RefHLine(lX - lB, lX + lB, lY - lA);
+            RefHLine(lX - lB, lX + lB, lY + lA);
+        }
+        else
+        {
+            RefPlot(lX + lB, lY - lA);
+            RefPlot(lX - lA, lY + lB);
+            RefPlot(lX - lB, lY - lA);
+            RefPlot(lX - lA, lY - lB);
+            RefPlot(lX + lB, lY + lA);
+            RefPlot(lX + lA, lY - lB);
+            RefPlot(lX + lA, lY + lB);
+            RefPlot(lX - lB, lY + lA);
+        }
+        lA++;
+        if(lD < 0)
+        {
+            lD += 4 * lA + 6;
+        }
+        else
+        {
+            lD += 10 + 4 * (lA - lB);
+            lB--;
+        }
+    }
+}
+
+//*****************************************************************************
+//
+//! \brief Compare the framebuffer with the reference.
+//!
+//! \return xtrue if they are the same.
+//
+//*****************************************************************************
+static xtBoolean Gfx2DTestSame(void)
+{
+    unsigned long i;
+
+    for(i = 0; i < FB_WIDTH * FB_HEIGHT; i++)
+    {
+        if(usFB[i] != usRef[i])
+        {
+            return xfalse;
+        }
+    }
+    return xtrue;
+}
+
+//*****************************************************************************
+//
+//! \brief Get the Test description of Gfx2D Function test.
+//!
+//! \return the description of the Gfx2D test.
+//
+//*****************************************************************************
+static char* Gfx2DGetTest(void)
+{
+    return "Gfx2D drawing core test";
+}
+
+//*****************************************************************************
+//
+//! \brief something should do before the test execute of Gfx2D test.
+//!
+//! \return None.
+//
+//*****************************************************************************
+static void Gfx2DSetup(void)
+{
+    Gfx2DFBInit(usFB, FB_WIDTH, FB_HEIGHT);
+    Gfx2DInit(&sCtx, &g_sGfx2DFBOps, FB_WIDTH, FB_HEIGHT);
+    lRefX0 = 0;
+    lRefY0 = 0;
+    lRefX1 = FB_WIDTH - 1;
+    lRefY1 = FB_HEIGHT - 1;
+}
+
+//*****************************************************************************
+//
+//! \brief something should do after the test execute of Gfx2D test.
+//!
+//! \return None.
+//
+//*****************************************************************************
+static void Gfx2DTearDown(void)
+{
+
+}
+
+//*****************************************************************************
+//
+//! \brief Gfx2D test execute main body.
+//!
+//! \return None.
+//
+//*****************************************************************************
+static void Gfx2DExecute(void)
+{
+    static const short sLines[][4] =
+    {
+        {5, 5, 60, 20},  {60, 20, 5, 5},   {5, 40, 60, 3},   {10, 2, 20, 45},
+        {20, 45, 10, 2}, {30, 30, 30, 30}, {0, 0, 63, 47},   {63, 0, 0, 47},
+        {3, 10, 40, 10}, {7, 44, 7, 1},    {-20, -5, 80, 60}, {50, -10, 10, 70},
+    };
+    unsigned long i;
+
+    //
+    // A filled rectangle is one window and one run, also when clipped.
+    //
+    Gfx2DTestClear();
+    Gfx2DRectFill(&sCtx, 50, 40, -5, 10, COLOR_FG);
+    for(i = 10; i <= 40; i++)
+    {
+        RefHLine(-5, 50, i);
+    }
+    TestAssert(Gfx2DTestSame(), "Gfx2D API \"Gfx2DRectFill()\" error!");
+    TestAssert((Gfx2DFBStatGet(GFX2D_FB_STAT_WINDOW) == 1) &&
+               (Gfx2DFBStatGet(GFX2D_FB_STAT_RUN) == 1) &&
+               (Gfx2DFBStatGet(GFX2D_FB_STAT_DATA) == 51 * 31),
+               "Gfx2D API \"Gfx2DRectFill()\" error!");
+
+    //
+    // Lines in all octants match Bresenham, one window per run.
+    //
+    for(i = 0; i < sizeof(sLines) / sizeof(sLines[0]); i++)
+    {
+        Gfx2DTestClear();
+        Gfx2DLineDraw(&sCtx, sLines[i][0], sLines[i][1], sLines[i][2],
+                      sLines[i][3], COLOR_FG);
+        RefLine(sLines[i][0], sLines[i][1], sLines[i][2], sLines[i][3]);
+        TestAssert(Gfx2DTestSame(), "Gfx2D API \"Gfx2DLineDraw()\" error!");
+    }
+
+    //
+    // A shallow line needs far fewer windows than pixels.
+    //
+    Gfx2DTestClear();
+    Gfx2DLineDraw(&sCtx, 0, 0, 63, 4, COLOR_FG);
+    TestAssert((Gfx2DFBStatGet(GFX2D_FB_STAT_WINDOW) == 5) &&
+               (Gfx2DFBStatGet(GFX2D_FB_STAT_DATA) == 64),
+               "Gfx2D API \"Gfx2DLineDraw()\" error!");
+
+    //
+    // Circles, whole and clipped by the screen edge.
+    //
+    for(i = 0; i < 16; i++)
+    {
+        Gfx2DTestClear();
+        Gfx2DCircleDraw(&sCtx, 30, 24, i, COLOR_FG);
+        RefCircle(30, 24, i, xfalse);
+        TestAssert(Gfx2DTestSame(), "Gfx2D API \"Gfx2DCircleDraw()\" error!");
+
+        Gfx2DTestClear();
+        Gfx2DCircleFill(&sCtx, 30, 24, i, COLOR_FG);
+        RefCircle(30, 24, i, xtrue);
+        TestAssert(Gfx2DTestSame(), "Gfx2D API \"Gfx2DCircleFill()\" error!");
+    }
+    Gfx2DTestClear();
+    Gfx2DCircleDraw(&sCtx, 2, 45, 20, COLOR_FG);
+    RefCircle(2, 45, 20, xfalse);
+    TestAssert(Gfx2DTestSame(), "Gfx2D API \"Gfx2DCircleDraw()\" error!");
+    TestAssert(Gfx2DFBStatGet(GFX2D_FB_STAT_WINDOW) <
+               Gfx2DFBStatGet(GFX2D_FB_STAT_DATA) / 2,
+               "Gfx2D API \"Gfx2DCircleDraw()\" error!");
+
+    //
+    // User clip rectangle.
+    //
+    Gfx2DTestClear();
+    Gfx2DClipSet(&sCtx, 10, 8, 40, 30);
+    lRefX0 = 10;
+    lRefY0 = 8;
+    lRefX1 = 40;
+    lRefY1 = 30;
+    Gfx2DCircleFill(&sCtx, 12, 12, 14, COLOR_FG);
+    Gfx2DRectDraw(&sCtx, 0, 0, 35, 25, COLOR_FG);
+    RefCircle(12, 12, 14, xtrue);
+    RefHLine(0, 35, 0);
+    RefHLine(0, 35, 25);
+    for(i = 1; i < 25; i++)
+    {
+        RefPlot(0, i);
+        RefPlot(35, i);
+    }
+    TestAssert(Gfx2DTestSame(), "Gfx2D API \"Gfx2DClipSet()\" error!");
+
+    //
+    // With a pixel callback single pixels skip the window.
+    //
+    Gfx2DInit(&sCtx, &g_sGfx2DFBPixelOps, FB_WIDTH, FB_HEIGHT);
+    Gfx2DTestClear();
+    Gfx2DLineDraw(&sCtx, 0, 0, 20, 20, COLOR_FG);
+    TestAssert((Gfx2DFBStatGet(GFX2D_FB_STAT_WINDOW) == 0) &&
+               (Gfx2DFBStatGet(GFX2D_FB_STAT_PIXEL) == 21),
+               "Gfx2D API \"Gfx2DLineDraw()\" error!");
+}
+
+//
+// Gfx2D Function test case struct.
+//
+const tTestCase sTestGfx2DFunction = {
+    Gfx2DGetTest,
+    Gfx2DSetup,
+    Gfx2DTearDown,
+    Gfx2DExecute
+};
+
+//
+// Gfx2D test suits.
+//
+const tTestCase * const psPatternGfx2DTest[] =
+{
+    &sTestGfx2DFunction,
+    0
+};
@@ -0,0 +1,369 @@
+//*****************************************************************************
+//
+//! @page Gfx2DText_testcase Gfx2D text renderer test
+//!
+//! File: @ref Gfx2DTextTest.c
+//!
+//! <h2>Description</h2>
+//! This module implements the test sequence for the Gfx2D text renderer.
+//! Fixed, proportional and run-length coded glyphs are drawn into the RAM
+//! framebuffer backend and compared pixel by pixel with a plain per-pixel
+//! reference, and the bus transactions are counted.<br><br>
+//! - \p Board: STM32 Fire Bull Develop Board <br><br>
+//! - \p Last-Time(about): 0.5s <br><br>
+//! - \p Phenomenon: Success or failure information will be printed on the UART. <br><br>
+//! .
+//!
+//! <h2>Preconditions</h2>
+//! The module requires the following options:<br><br>
+//! - \p Option-define:
+//! <br>(1)None.<br><br>
+//! - \p Option-hardware:
+//! <br>(1)None, no LCD is needed.<br><br>
+//! - \p Option-OtherModule:
+//! <br>Connect an COM cable to the development board.<br>
+//! .
+//! In case some of the required options are not enabled then some or all tests
+//! may be skipped or result FAILED.<br>
+//!
+//! <h2>Test Cases</h2>
+//! The module contain those sub tests:<br><br>
+//! - \subpage test_Gfx2DText_Function
+//! .
+//! \file Gfx2DTextTest.c
+//! \brief Gfx2D text test source file <br>
+//
+//*****************************************************************************
+
+#include "test.h"
+#include "Gfx2D.h"
+#include "Gfx2DFB.h"
+#include "Gfx2DText.h"
+
+#define FB_WIDTH                64
+#define FB_HEIGHT               48
+
+#define COLOR_BG                0x0000
+#define COLOR_TEXT              0xFFE0
+#define COLOR_BACK              0x001F
+
+#define GLYPH_H                 12
+
+static unsigned short usFB[FB_WIDTH * FB_HEIGHT];
+static unsigned short usRef[FB_WIDTH * FB_HEIGHT];
+static tGfx2DContext sCtx;
+
+//
+// Fixed 8x12 font 'a' to 'c', filled with random bits by the setup.
+//
+static unsigned char ucFixedData[3 * GLYPH_H];
+static const tGfx2DFont sFixedFont =
+{
+    GFX2D_FONT_BITMAP, 8, GLYPH_H, 0, 'a', 3, 0, 0, 0, ucFixedData
+};
+
+//
+// Proportional font '0' to '2', 3, 11 and 16 pixels wide.
+//
+static const unsigned char ucPropWidth[3] = {3, 11, 16};
+static const unsigned long ulPropOffset[3] = {0, GLYPH_H, 3 * GLYPH_H};
+static unsigned char ucPropData[5 * GLYPH_H];
+static const tGfx2DFont sPropFont =
+{
+    GFX2D_FONT_BITMAP, 0, GLYPH_H, 1, '0', 3, 0, ucPropWidth, ulPropOffset,
+    ucPropData
+};
+
+//
+// The proportional glyphs again, run-length coded under sparse GB codes.
+//
+static const unsigned short usWideCode[3] = {0xB0A1, 0xB0A2, 0xC4E3};
+static unsigned long ulWideOffset[3];
+static unsigned char ucWideData[3 * 2 * GLYPH_H * 2];
+static const tGfx2DFont sWideFont =
+{
+    GFX2D_FONT_RLE, 0, GLYPH_H, 0, 0, 3, usWideCode, ucPropWidth,
+    ulWideOffset, ucWideData
+};
+
+//
+// Reference clip rectangle.
+//
+static long lRefX0, lRefY0, lRefX1, lRefY1;
+
+//*****************************************************************************
+//
+//! \brief Clear both buffers and the counters.
+//!
+//! \return None.
+//
+//*****************************************************************************
+static void Gfx2DTextTestClear(void)
+{
+    unsigned long i;
+
+    for(i = 0; i < FB_WIDTH * FB_HEIGHT; i++)
+    {
+        usFB[i] = COLOR_BG;
+        usRef[i] = COLOR_BG;
+    }
+    Gfx2DFBStatClear();
+}
+
+//*****************************************************************************
+//
+//! \brief Reference glyph, one pixel at a time.
+//!
+//! \return The number of color runs in window order.
+//
+//*****************************************************************************
+static unsigned long RefGlyph(long lX, long lY, const unsigned char *pucBits,
+                              unsigned long ulWidth)
+{
+    unsigned long ulStride = (ulWidth + 7) / 8;
+    unsigned long ulRow, ulCol, ulRuns = 0;
+    unsigned short usColor, usLast = 1;
+    long lPX, lPY;
+
+    for(ulRow = 0; ulRow < GLYPH_H; ulRow++)
+    {
+        for(ulCol = 0; ulCol < ulWidth; ulCol++)
+        {
+            usColor = (pucBits[ulRow * ulStride + ulCol / 8] &
+                       (0x80 >> (ulCol & 7))) ? COLOR_TEXT : COLOR_BACK;
+            if(usColor != usLast)
+            {
+                ulRuns++;
+                usLast = usColor;
+            }
+
+            lPX = lX + ulCol;
+            lPY = lY + ulRow;
+            if((lPX >= lRefX0) && (lPX <= lRefX1) &&
+               (lPY >= lRefY0) && (lPY <= lRefY1))
+            {
+                usRef[lPY * FB_WIDTH + lPX] = usColor;
+            }
+        }
+    }
+    return ulRuns;
+}
+
+static void RefBack(long lX, long lY)
+{
+    long lRow;
+
+    for(lRow = lY; lRow < lY + GLYPH_H; lRow++)
+    {
+        usRef[lRow * FB_WIDTH + lX] = COLOR_BACK;
+    }
+}
+
+//*****************************************************************************
+//
+//! \brief Compare the framebuffer with the reference.
+//!
+//! \return xtrue if they are the same.
+//
+//*****************************************************************************
+static xtBoolean Gfx2DTextTestSame(void)
+{
+    unsigned long i;
+
+    for(i = 0; i < FB_WIDTH * FB_HEIGHT; i++)
+    {
+        if(usFB[i] != usRef[i])
+        {
+            return xfalse;
+        }
+    }
+    return xtrue;
+}
+
+//*****************************************************************************
+//
+//! \brief Get the Test description of Gfx2D text test.
+//!
+//! \return the description of the Gfx2D text test.
+//
+//*****************************************************************************
+static char* Gfx2DTextGetTest(void)
+{
+    return "Gfx2D text renderer test";
+}
+
+//*****************************************************************************
+//
+//! \brief something should do before the test execute of Gfx2D text test.
+//!
+//! \return None.
+//
+//*****************************************************************************
+static void Gfx2DTextSetup(void)
+{
+    unsigned long i, ulSeed = 12345;
+
+    Gfx2DFBInit(usFB, FB_WIDTH, FB_HEIGHT);
+    Gfx2DInit(&sCtx, &g_sGfx2DFBOps, FB_WIDTH, FB_HEIGHT);
+    lRefX0 = 0;
+    lRefY0 = 0;
+    lRefX1 = FB_WIDTH - 1;
+    lRefY1 = FB_HEIGHT - 1;
+
+    for(i = 0; i < sizeof(ucFixedData); i++)
+    {
+        ulSeed = ulSeed * 1103515245 + 12345;
+        ucFixedData[i] = (unsigned char)(ulSeed >> 16);
+    }
+    for(i = 0; i < sizeof(ucPropData); i++)
+    {
+        ulSeed = ulSeed * 1103515245 + 12345;
+        ucPropData[i] = (unsigned char)(ulSeed >> 16);
+    }
+
+    //
+    // Long runs in the top half of the widest glyph.
+    //
+    for(i = 0; i < 2 * GLYPH_H / 2; i++)
+    {
+        ucPropData[3 * GLYPH_H + i] = 0xFF;
+    }
+}
+
+//*****************************************************************************
+//
+//! \brief something should do after the test execute of Gfx2D text test.
+//!
+//! \return None.
+//
+//*****************************************************************************
+static void Gfx2DTextTearDown(void)
+{
+
+}
+
+//*****************************************************************************
+//
+//! \brief Gfx2D text test execute main body.
+//!
+//! \return None.
+//
+//*****************************************************************************
+static void Gfx2DTextExecute(void)
+{
+    unsigned long i, ulRuns, ulLen, ulSize;
+    unsigned char ucShort[2];
+    short sX;
+
+    //
+    // A whole glyph is one window and one run per color change.
+    //
+    Gfx2DTextTestClear();
+    sX = Gfx2DCharDraw(&sCtx, &sFixedFont, 4, 5, 'b', COLOR_TEXT, COLOR_BACK);
+    ulRuns = RefGlyph(4, 5, ucFixedData + GLYPH_H, 8);
+    TestAssert((sX == 8) && Gfx2DTextTestSame(),
+               "Gfx2D API \"Gfx2DCharDraw()\" error!");
+    TestAssert((Gfx2DFBStatGet(GFX2D_FB_STAT_WINDOW) == 1) &&
+               (Gfx2DFBStatGet(GFX2D_FB_STAT_RUN) == ulRuns) &&
+               (Gfx2DFBStatGet(GFX2D_FB_STAT_DATA) == 8 * GLYPH_H),
+               "Gfx2D API \"Gfx2DCharDraw()\" error!");
+
+    //
+    // Unknown characters are not drawn.
+    //
+    Gfx2DTextTestClear();
+    TestAssert((Gfx2DCharDraw(&sCtx, &sFixedFont, 0, 0, 'd', COLOR_TEXT,
+                              COLOR_BACK) == 0) &&
+               (Gfx2DCharDraw(&sCtx, &sFixedFont, 0, 0, '`', COLOR_TEXT,
+                              COLOR_BACK) == 0) &&
+               (Gfx2DFBStatGet(GFX2D_FB_STAT_DATA) == 0),
+               "Gfx2D API \"Gfx2DCharDraw()\" error!");
+
+    //
+    // Proportional string with one column of spacing.
+    //
+    Gfx2DTextTestClear();
+    sX = Gfx2DStringDraw(&sCtx, &sPropFont, 0, 2, 20, "201", COLOR_TEXT,
+                         COLOR_BACK);
+    RefGlyph(2, 20, ucPropData + 3 * GLYPH_H, 16);
+    RefBack(18, 20);
+    RefGlyph(19, 20, ucPropData, 3);
+    RefBack(22, 20);
+    RefGlyph(23, 20, ucPropData + GLYPH_H, 11);
+    RefBack(34, 20);
+    TestAssert((sX == 35) && Gfx2DTextTestSame(),
+               "Gfx2D API \"Gfx2DStringDraw()\" error!");
+    TestAssert(Gfx2DStringWidth(&sPropFont, 0, "201") == 33,
+               "Gfx2D API \"Gfx2DStringWidth()\" error!");
+
+    //
+    // Run-length coded copies of the same glyphs draw the same pixels.
+    //
+    ulLen = 0;
+    for(i = 0; i < 3; i++)
+    {
+        ulWideOffset[i] = ulLen;
+        ulSize = Gfx2DFontRLEEncode(ucPropData + ulPropOffset[i],
+                                    ucPropWidth[i], GLYPH_H,
+                                    ucWideData + ulLen,
+                                    sizeof(ucWideData) - ulLen);
+        TestAssert(ulSize != 0, "Gfx2D API \"Gfx2DFontRLEEncode()\" error!");
+        ulLen += ulSize;
+    }
+    TestAssert(Gfx2DFontRLEEncode(ucPropData + ulPropOffset[2], 16, GLYPH_H,
+                                  ucShort, sizeof(ucShort)) == 0,
+               "Gfx2D API \"Gfx2DFontRLEEncode()\" error!");
+
+    Gfx2DTextTestClear();
+    sX = Gfx2DStringDraw(&sCtx, &sFixedFont, &sWideFont, 1, 30,
+                         "\xC4\xE3" "a\xB0\xA1\xB0\xA3\xB0\xA2", COLOR_TEXT,
+                         COLOR_BACK);
+    RefGlyph(1, 30, ucPropData + 3 * GLYPH_H, 16);
+    RefGlyph(17, 30, ucFixedData, 8);
+    RefGlyph(25, 30, ucPropData, 3);
+    RefGlyph(28, 30, ucPropData + GLYPH_H, 11);
+    TestAssert((sX == 39) && Gfx2DTextTestSame(),
+               "Gfx2D API \"Gfx2DStringDraw()\" error!");
+    TestAssert(Gfx2DFBStatGet(GFX2D_FB_STAT_WINDOW) == 4,
+               "Gfx2D API \"Gfx2DStringDraw()\" error!");
+
+    //
+    // Glyphs across the screen edge and the clip rectangle.
+    //
+    Gfx2DTextTestClear();
+    Gfx2DCharDraw(&sCtx, &sPropFont, -5, 40, '2', COLOR_TEXT, COLOR_BACK);
+    Gfx2DCharDraw(&sCtx, &sWideFont, 55, -4, 0xB0A2, COLOR_TEXT, COLOR_BACK);
+    RefGlyph(-5, 40, ucPropData + 3 * GLYPH_H, 16);
+    RefGlyph(55, -4, ucPropData + GLYPH_H, 11);
+    TestAssert(Gfx2DTextTestSame(), "Gfx2D API \"Gfx2DCharDraw()\" error!");
+
+    Gfx2DTextTestClear();
+    Gfx2DClipSet(&sCtx, 10, 10, 20, 15);
+    lRefX0 = 10;
+    lRefY0 = 10;
+    lRefX1 = 20;
+    lRefY1 = 15;
+    Gfx2DCharDraw(&sCtx, &sWideFont, 6, 8, 0xC4E3, COLOR_TEXT, COLOR_BACK);
+    Gfx2DCharDraw(&sCtx, &sFixedFont, 30, 8, 'c', COLOR_TEXT, COLOR_BACK);
+    RefGlyph(6, 8, ucPropData + 3 * GLYPH_H, 16);
+    TestAssert(Gfx2DTextTestSame(), "Gfx2D API \"Gfx2DCharDraw()\" error!");
+}
+
+//
+// Gfx2D text test case struct.
+//
+const tTestCase sTestGfx2DTextFunction = {
+    Gfx2DTextGetTest,
+    Gfx2DTextSetup,
+    Gfx2DTextTearDown,
+    Gfx2DTextExecute
+};
+
+//
+// Gfx2D text test suits.
+//
+const tTestCase * const psPatternGfx2DTextTest[] =
+{
+    &sTestGfx2DTextFunction,
+    0
+};
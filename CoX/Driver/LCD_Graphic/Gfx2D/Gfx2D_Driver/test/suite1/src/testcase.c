@@ -0,0 +1,35 @@
+//*****************************************************************************
+//
+//! \file testcase.c
+//! \brief add new testcases.
+//! \version 1.0
+//! \date 12/21/2012
+//! \author CooCox
+//! \copy
+//!
+//! Copyright (c) 2009-2012 CooCox.  All rights reserved.
+//
+//*****************************************************************************
+
+#include "test.h"
+#include "testcase.h"
+
+//*****************************************************************************
+//
+// Array of all the test.
+//
+//*****************************************************************************
+const tTestCase * const* g_psPatterns[] =  {
+    //
+    // .... test
+    //
+    psPatternGfx2DTest,
+    psPatternGfx2DTextTest,
+
+    //
+    // end
+    //
+    0
+};
+
+
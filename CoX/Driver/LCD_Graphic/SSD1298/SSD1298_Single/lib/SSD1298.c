@@ -48,6 +48,7 @@
 #include "xcore.h"
 #include "xsysctl.h"
 #include "xgpio.h"
+#include "Gfx2D.h"
 
 //
 //! LCD structure
@@ -60,6 +61,16 @@ LCD_Info tLcd;
 unsigned short g_usPointColor = 0x0000;
 unsigned short g_usBackColor = 0xFFFF;
 
+//
+// Operations used by the Gfx2D core to draw on this controller
+//
+static const tGfx2DDisplayOps s_sLCDGfx2DOps = LCD_GFX2D_OPS;
+
+//
+// xfalse when a Gfx2D span left a partial window open
+//
+static xtBoolean s_bLCDWindowFull = xtrue;
+
 
 //*****************************************************************************
 //
@@ -363,6 +374,7 @@ void LCD_SetWindow(unsigned short usXsta, unsigned short usYsta, unsigned short
 //*****************************************************************************
 void LCD_DrawDot(unsigned short x, unsigned short y)
 {
+    LCD_WindowReset();
     LCD_SetCursor(x, y);
     LCD_WriteCMD(R22h);
     LCD_WriteData(g_usPointColor);
@@ -524,6 +536,100 @@ void LCD_Clear(unsigned short usColor)
     }
 }
 
+//*****************************************************************************
+//
+//! \brief Open a GRAM write window
+//!
+//! \param ulXsta the x coordinate of the left edge
+//! \param ulXend the x coordinate of the right edge
+//! \param ulYsta the y coordinate of the top edge
+//! \param ulYend the y coordinate of the bottom edge
+//!
+//! This function sets the window and the cursor to its first point and
+//! starts a GRAM write, so LCD_ColorRunWrite() can stream the pixels. The
+//! argument order is the one of tGfx2DWindowSet. Call LCD_WindowReset()
+//! before using LCD_DrawDot() again.
+//!
+//! \return None
+//
+//*****************************************************************************
+void LCD_WindowStart(unsigned long ulXsta, unsigned long ulXend,
+                     unsigned long ulYsta, unsigned long ulYend)
+{
+    LCD_SetWindow(ulXsta, ulYsta, ulXend, ulYend);
+    LCD_SetCursor(ulXsta, ulYsta);
+    LCD_WriteCMD(R22h);
+    s_bLCDWindowFull = xfalse;
+}
+
+//*****************************************************************************
+//
+//! \brief Restore the full screen window
+//!
+//! This function is a no-op when no partial window is open.
+//!
+//! \return None
+//
+//*****************************************************************************
+void LCD_WindowReset(void)
+{
+    if(!s_bLCDWindowFull)
+    {
+        LCD_WriteReg(R44h, 0 | (239 << 8));
+        LCD_WriteReg(R45h, 0);
+        LCD_WriteReg(R46h, 319);
+        s_bLCDWindowFull = xtrue;
+    }
+}
+
+//*****************************************************************************
+//
+//! \brief Write the same color many times into the open window
+//!
+//! \param ulColor the pixel color
+//! \param ulCount the number of pixels
+//!
+//! The data bus is set up once and only WR is strobed for each pixel.
+//!
+//! \return None
+//
+//*****************************************************************************
+void LCD_ColorRunWrite(unsigned long ulColor, unsigned long ulCount)
+{
+    if(ulCount == 0) return;
+
+    LCD_RS_SET;
+    LCD_CS_CLR;
+    LCD_DATAOUT((unsigned short)ulColor);
+    while(ulCount--)
+    {
+        LCD_WR_CLR;
+        LCD_WR_SET;
+    }
+    LCD_CS_SET;
+}
+
+//*****************************************************************************
+//
+//! \brief Draw one pixel for the Gfx2D core
+//!
+//! \param usX the x coordinate of the pixel
+//! \param usY the y coordinate of the pixel
+//! \param ulColor the pixel color
+//!
+//! A single pixel only needs the cursor, so this is cheaper than a window.
+//!
+//! \return None
+//
+//*****************************************************************************
+void LCD_PixelDraw(unsigned short usX, unsigned short usY, unsigned long ulColor)
+{
+    LCD_WindowReset();
+    LCD_SetCursor(usX, usY);
+    LCD_WriteCMD(R22h);
+    LCD_WriteData((unsigned short)ulColor);
+}
+
 //*****************************************************************************
 //
 //! \brief Fill a rectangular area with specified color
@@ -542,23 +648,14 @@ void LCD_Clear(unsigned short usColor)
 void LCD_Fill(unsigned short usXsta, unsigned short usYsta,
               unsigned short usXend, unsigned short usYend, unsigned short usColor)
 {
-    unsigned long ulTmp;
-
     if(usXend >= tLcd.usWidth) usXend = tLcd.usWidth - 1;
     if(usYend >= tLcd.usHeight) usYend = tLcd.usHeight - 1;
+    if((usXsta > usXend) || (usYsta > usYend)) return;
 
-    LCD_SetWindow(usXsta, usXsta, usXend, usYend);
-    LCD_SetCursor(usXsta, usYsta);
-    LCD_WriteCMD(R22h);
-    ulTmp = (unsigned long)(usYend - usYsta + 1) * (usXend - usXsta + 1);
-    while(ulTmp--)
-    {
-        LCD_WriteData(usColor);
-    }
-    LCD_WriteReg(R44h, 0x00EF);
-    LCD_WriteReg(R45h, 0);
-    LCD_WriteReg(R46h, 0x013F);
-    LCD_SetWindow(0, 0, tLcd.usWidth, tLcd.usHeight);
+    LCD_WindowStart(usXsta, usXend, usYsta, usYend);
+    LCD_ColorRunWrite(usColor, (unsigned long)(usYend - usYsta + 1) *
+                               (usXend - usXsta + 1));
+    LCD_WindowReset();
 }
 
 //*****************************************************************************
@@ -570,79 +667,25 @@ void LCD_Fill(unsigned short usXsta, unsigned short usYsta,
 //! \param x2 the x coordinate of the end point
 //! \param y2 the y coordinate of the end point
 //!
-//! This function is to draw a line between two specified points
+//! This function is to draw a line between two specified points. The line
+//! is drawn by the Gfx2D core, one window per run of pixels in a row or
+//! column instead of a cursor set per pixel.
 //!
 //! \return None
 //
 //*****************************************************************************
 void LCD_DrawLine(unsigned short x1, unsigned short y1, unsigned short x2, unsigned short y2)
 {
-    unsigned short i;
-    short sIncX, sIncY, sDeltaX, sDeltaY;
-    unsigned short usXerr = 0, usYerr = 0, usRow, usCol, usDistance;
-
-    sDeltaX = x2 - x1;
-    sDeltaY = y2 - y1;
-    usRow = x1;
-    usCol = y1;
-    if(sDeltaX > 0)
-    {
-        sIncX = 1;
-    }
-    else if(sDeltaX == 0)
-    {
-        sIncX = 0;
-    }
-    else
-    {
-        sIncX = -1;
-        sDeltaX = -sDeltaX;
-    }
+    tGfx2DContext sCtx;
 
-    if(sDeltaY > 0)
-    {
-        sIncY = 1;
-    }
-    else if(sDeltaY == 0)
-    {
-        sIncY = 0;
-    }
-    else
-    {
-        sIncY = -1;
-        sDeltaY = -sDeltaY;
-    }
-
-    if(sDeltaX > sDeltaY)
-    {
-        usDistance = sDeltaX;
-    }
-    else
-    {
-        usDistance = sDeltaY;
-    }
-
-    for(i = 0; i <= usDistance + 1; i++ )
-    {
-        LCD_DrawDot(usRow, usCol);
-        usXerr += sDeltaX;
-        usYerr += sDeltaY ;
-        if(usXerr > usDistance)
-        {
-            usXerr -= usDistance;
-            usRow += sIncX;
-        }
-        if(usYerr > usDistance)
-        {
-            usYerr -= usDistance;
-            usCol += sIncY;
-        }
-    }
+    Gfx2DInit(&sCtx, &s_sLCDGfx2DOps, tLcd.usWidth, tLcd.usHeight);
+    Gfx2DLineDraw(&sCtx, x1, y1, x2, y2, g_usPointColor);
+    LCD_WindowReset();
 }
 
 //*****************************************************************************
 //
-//! \brief Fill a rectangular area with specified color
+//! \brief Draw a circle on the screen
 //!
 //! \param x the x coordinate of the circle center
 //! \param y the y coordinate of the circle center
@@ -655,31 +698,11 @@ void LCD_DrawLine(unsigned short x1, unsigned short y1, unsigned short x2, unsig
 //*****************************************************************************
 void LCD_DrawCircle(unsigned short x, unsigned short y, unsigned short r)
 {
-    unsigned short a, b;
-    short di;
+    tGfx2DContext sCtx;
 
-    a = 0;
-    b = r;
-    di = 3 - (r << 1);
-    while(a <= b)
-    {
-        LCD_DrawDot(x + b, y - a);
-        LCD_DrawDot(x - a, y + b);
-        LCD_DrawDot(x - b, y - a);
-        LCD_DrawDot(x - a, y - b);
-        LCD_DrawDot(x + b, y + a);
-        LCD_DrawDot(x + a, y - b);
-        LCD_DrawDot(x + a, y + b);
-        LCD_DrawDot(x - b, y + a);
-        a++;
-        if(di < 0)di += 4 * a + 6;
-        else
-        {
-            di += 10 + 4 * (a - b);
-            b--;
-        }
-        LCD_DrawDot(x + a, y + b);
-    }
+    Gfx2DInit(&sCtx, &s_sLCDGfx2DOps, tLcd.usWidth, tLcd.usHeight);
+    Gfx2DCircleDraw(&sCtx, x, y, r, g_usPointColor);
+    LCD_WindowReset();
 }
 
 //*****************************************************************************
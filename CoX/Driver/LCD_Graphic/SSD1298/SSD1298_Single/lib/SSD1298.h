@@ -191,6 +191,12 @@ typedef struct
 } LCD_Info;
 
 
+//
+//! Initializer of a tGfx2DDisplayOps, to draw on SSD1298 with the shared
+//! Gfx2D core: const tGfx2DDisplayOps sOps = LCD_GFX2D_OPS;
+//
+#define LCD_GFX2D_OPS   {LCD_WindowStart, LCD_ColorRunWrite, LCD_PixelDraw}
+
 //*****************************************************************************
 //
 //! \addtogroup COX_SSD1298_Exported_APIs
@@ -212,6 +218,11 @@ extern void LCD_Fill(unsigned short usXsta, unsigned short usYsta,
 					 unsigned short usXend, unsigned short usYend, unsigned short usColor);
 extern void LCD_DrawLine(unsigned short x1, unsigned short y1, unsigned short x2, unsigned short y2);
 extern void LCD_DrawCircle(unsigned short x, unsigned short y, unsigned short r);
+extern void LCD_WindowStart(unsigned long ulXsta, unsigned long ulXend,
+                            unsigned long ulYsta, unsigned long ulYend);
+extern void LCD_WindowReset(void);
+extern void LCD_ColorRunWrite(unsigned long ulColor, unsigned long ulCount);
+extern void LCD_PixelDraw(unsigned short usX, unsigned short usY, unsigned long ulColor);
 extern void LCD_ShowChar(unsigned short x, unsigned short y, unsigned char ucChar,
 						 unsigned char ucFontSize, unsigned char ucMode);
 extern void LCD_ShowString(unsigned short x, unsigned short y,
@@ -39,8 +39,12 @@
 #include "xsysctl.h"
 #include "xdebug.h"
 #include "xhw_memmap.h"
+#include "xhw_ints.h"
+#include "xhw_spi.h"
+#include "xcore.h"
 #include "xspi.h"
 #include "xgpio.h"
+#include "xdma.h"
 #include "MAX7219.h"
 
 #define     SPI_Speed           200000
@@ -66,16 +70,15 @@ void MAX7219_Write(unsigned char addr, unsigned char ucdata)
 
 //*****************************************************************************
 //
-//! \brief Initialize  MAX7219 and SPI
+//! \brief Initialize the SPI to MAX7219.
 //!
 //! \param None
 //!
 //! \return None.
 //
 //*****************************************************************************
-void MAX7219_Init(void)
+static void MAX7219_PortInit(void)
 {
-
     //
 	// Enable Peripheral SPI0
 	//
@@ -94,6 +97,20 @@ void MAX7219_Init(void)
 
 	SPISSConfig(MAX7219_SPI_PORT, SPI_SS_LEVEL_TRIGGER,
 			SPI_SS_ACTIVE_LOW_FALLING);
+}
+
+//*****************************************************************************
+//
+//! \brief Initialize  MAX7219 and SPI
+//!
+//! \param None
+//!
+//! \return None.
+//
+//*****************************************************************************
+void MAX7219_Init(void)
+{
+    MAX7219_PortInit();
 
 	//
 	// decode for all number, d0~d7
@@ -120,3 +137,379 @@ void MAX7219_Init(void)
 	//
 	MAX7219_Write(MAX7219_TEST_ADDR, 0x00);
 }
+
+//
+// Number of cascaded devices.
+//
+static unsigned long g_ulChainDevices;
+
+//
+// Frame buffer, one byte per digit register and device. Device 0 is the one
+// connected to the MCU.
+//
+static unsigned char g_ucChainFrame[8][MAX7219_CHAIN_MAX];
+
+//
+// Set after a row changed, cleared before the row is copied to the burst.
+//
+static volatile unsigned char g_ucChainDirty[8];
+
+//
+// The words of one burst, the first one goes to the last device.
+//
+static unsigned short g_usChainBurst[MAX7219_CHAIN_MAX];
+
+#ifdef MAX7219_CHAIN_DMA
+static unsigned long g_ulChainChannel;
+static volatile xtBoolean g_bChainBusy;
+#endif
+
+//*****************************************************************************
+//
+//! \brief Fill the burst with the next changed row.
+//!
+//! \param None
+//!
+//! \return xtrue if a row was found, xfalse if every row is up to date.
+//
+//*****************************************************************************
+static xtBoolean MAX7219_ChainBurstNext(void)
+{
+    unsigned long ulRow, i;
+
+    for(ulRow = 0; ulRow < 8; ulRow++)
+    {
+        if(g_ucChainDirty[ulRow])
+        {
+            g_ucChainDirty[ulRow] = 0;
+            for(i = 0; i < g_ulChainDevices; i++)
+            {
+                g_usChainBurst[i] = ((MAX7219_DIGIT0_ADDR + ulRow) << 8) |
+                    g_ucChainFrame[ulRow][g_ulChainDevices - 1 - i];
+            }
+            return xtrue;
+        }
+    }
+
+    return xfalse;
+}
+
+//*****************************************************************************
+//
+//! \brief Send the burst, the devices latch it when SS goes high.
+//!
+//! \param None
+//!
+//! \return None.
+//
+//*****************************************************************************
+static void MAX7219_ChainSend(void)
+{
+    SPISSSet(MAX7219_SPI_PORT, SPI_SS0);
+    SPIDataWrite(MAX7219_SPI_PORT, g_usChainBurst, g_ulChainDevices);
+    SPISSClear(MAX7219_SPI_PORT, SPI_SS0);
+}
+
+#ifdef MAX7219_CHAIN_DMA
+
+//*****************************************************************************
+//
+//! \brief Start the burst by PDMA.
+//!
+//! \param None
+//!
+//! \return None.
+//
+//*****************************************************************************
+static void MAX7219_ChainDMAStart(void)
+{
+    SPISSSet(MAX7219_SPI_PORT, SPI_SS0);
+    xDMAChannelTransferSet(g_ulChainChannel, xDMA_MODE_BASIC, g_usChainBurst,
+                           (void *)(MAX7219_SPI_PORT + SPI_TX0),
+                           g_ulChainDevices * 2);
+    xSPIDMAEnable(MAX7219_SPI_PORT, xSPI_DMA_TX);
+}
+
+//*****************************************************************************
+//
+//! \brief End a burst and start the next changed row.
+//!
+//! The PDMA is done when the last word is in the SPI, so the handler waits
+//! for one word time before SS goes high.
+//!
+//! \return 0.
+//
+//*****************************************************************************
+static unsigned long
+MAX7219_ChainDMAHandler(void *pvCBData, unsigned long ulEvent,
+                        unsigned long ulMsgParam, void *pvMsgData)
+{
+    while(SPIIsBusy(MAX7219_SPI_PORT))
+    {
+    }
+    SPISSClear(MAX7219_SPI_PORT, SPI_SS0);
+
+    if(MAX7219_ChainBurstNext())
+    {
+        MAX7219_ChainDMAStart();
+    }
+    else
+    {
+        g_bChainBusy = xfalse;
+    }
+
+    return 0;
+}
+
+#endif
+
+//*****************************************************************************
+//
+//! \brief Initialize a chain of cascaded MAX7219 and SPI.
+//!
+//! \param ulDevices is the number of devices, 1 to MAX7219_CHAIN_MAX.
+//!
+//! The devices are set to no decode mode, so each digit register is a row
+//! of an 8x8 matrix, and cleared.
+//!
+//! \return None.
+//
+//*****************************************************************************
+void MAX7219_ChainInit(unsigned long ulDevices)
+{
+    xASSERT((ulDevices != 0) && (ulDevices <= MAX7219_CHAIN_MAX));
+
+    g_ulChainDevices = ulDevices;
+    MAX7219_PortInit();
+
+#ifdef MAX7219_CHAIN_DMA
+    g_bChainBusy = xfalse;
+    xSysCtlPeripheralEnable(xSYSCTL_PERIPH_DMA);
+    g_ulChainChannel = xDMAChannelDynamicAssign(xDMA_REQUEST_MEM,
+                                                MAX7219_SPI_DMA_REQUEST);
+    xASSERT(g_ulChainChannel != xDMA_CHANNEL_NOT_EXIST);
+    xDMAEnable(g_ulChainChannel);
+    xDMAChannelControlSet(g_ulChainChannel, xDMA_SRC_INC_16 |
+                          xDMA_DST_INC_NONE | xDMA_SRC_SIZE_16 |
+                          xDMA_DST_SIZE_16);
+    xDMAChannelIntCallbackInit(g_ulChainChannel, MAX7219_ChainDMAHandler);
+    xDMAChannelIntEnable(g_ulChainChannel, xDMA_INT_TC);
+    xIntEnable(xINT_DMA);
+#endif
+
+    MAX7219_ChainControl(MAX7219_DECODE_MODE_ADDR, 0x00);
+    MAX7219_ChainControl(MAX7219_INTENSITY_ADDR, 0x03);
+    MAX7219_ChainControl(MAX7219_SCAN_LIMIT_ADDR, 0x07);
+    MAX7219_ChainControl(MAX7219_SHUTDOWN_ADDR, 0x01);
+    MAX7219_ChainControl(MAX7219_TEST_ADDR, 0x00);
+
+    MAX7219_ChainClear();
+    MAX7219_ChainFlush();
+}
+
+//*****************************************************************************
+//
+//! \brief Write a control register of every device in the chain.
+//!
+//! \param addr specifies the address to write.
+//! \param ucdata specifies the data to write.
+//!
+//! The write waits for a running flush.
+//!
+//! \return None.
+//
+//*****************************************************************************
+void MAX7219_ChainControl(unsigned char addr, unsigned char ucdata)
+{
+    unsigned long i;
+
+    while(MAX7219_ChainBusy())
+    {
+    }
+
+    for(i = 0; i < g_ulChainDevices; i++)
+    {
+        g_usChainBurst[i] = (addr << 8) | ucdata;
+    }
+    MAX7219_ChainSend();
+}
+
+//*****************************************************************************
+//
+//! \brief Clear the frame buffer.
+//!
+//! \param None
+//!
+//! \return None.
+//
+//*****************************************************************************
+void MAX7219_ChainClear(void)
+{
+    unsigned long ulRow, i;
+
+    for(ulRow = 0; ulRow < 8; ulRow++)
+    {
+        for(i = 0; i < MAX7219_CHAIN_MAX; i++)
+        {
+            g_ucChainFrame[ulRow][i] = 0;
+        }
+        g_ucChainDirty[ulRow] = 1;
+    }
+}
+
+//*****************************************************************************
+//
+//! \brief Set a row of a device in the frame buffer.
+//!
+//! \param ulDevice is the device, 0 is the one connected to the MCU.
+//! \param ulRow is the row (digit register) 0 to 7.
+//! \param ucBits is the row, bit 7 is the left column.
+//!
+//! \return None.
+//
+//*****************************************************************************
+void MAX7219_ChainRowSet(unsigned long ulDevice, unsigned long ulRow,
+                         unsigned char ucBits)
+{
+    xASSERT((ulDevice < g_ulChainDevices) && (ulRow < 8));
+
+    if(g_ucChainFrame[ulRow][ulDevice] != ucBits)
+    {
+        g_ucChainFrame[ulRow][ulDevice] = ucBits;
+        g_ucChainDirty[ulRow] = 1;
+    }
+}
+
+//*****************************************************************************
+//
+//! \brief Get a row of a device from the frame buffer.
+//!
+//! \param ulDevice is the device, 0 is the one connected to the MCU.
+//! \param ulRow is the row (digit register) 0 to 7.
+//!
+//! \return the row, bit 7 is the left column.
+//
+//*****************************************************************************
+unsigned char MAX7219_ChainRowGet(unsigned long ulDevice, unsigned long ulRow)
+{
+    xASSERT((ulDevice < g_ulChainDevices) && (ulRow < 8));
+
+    return g_ucChainFrame[ulRow][ulDevice];
+}
+
+//*****************************************************************************
+//
+//! \brief Scroll the whole chain one column to the left.
+//!
+//! \param ucColumn is the new right column, bit n is the pixel of row n.
+//!
+//! The devices are side by side with device 0 on the right, the left column
+//! of a device moves into the right column of the next one.
+//!
+//! \return None.
+//
+//*****************************************************************************
+void MAX7219_ChainScrollLeft(unsigned char ucColumn)
+{
+    unsigned long ulRow, i;
+    unsigned char ucOld, ucNew, ucCarry;
+
+    for(ulRow = 0; ulRow < 8; ulRow++)
+    {
+        ucCarry = (ucColumn >> ulRow) & 1;
+        for(i = 0; i < g_ulChainDevices; i++)
+        {
+            ucOld = g_ucChainFrame[ulRow][i];
+            ucNew = (ucOld << 1) | ucCarry;
+            ucCarry = ucOld >> 7;
+            if(ucNew != ucOld)
+            {
+                g_ucChainFrame[ulRow][i] = ucNew;
+                g_ucChainDirty[ulRow] = 1;
+            }
+        }
+    }
+}
+
+//*****************************************************************************
+//
+//! \brief Scroll the whole chain one column to the right.
+//!
+//! \param ucColumn is the new left column, bit n is the pixel of row n.
+//!
+//! \return None.
+//
+//*****************************************************************************
+void MAX7219_ChainScrollRight(unsigned char ucColumn)
+{
+    unsigned long ulRow, i;
+    unsigned char ucOld, ucNew, ucCarry;
+
+    for(ulRow = 0; ulRow < 8; ulRow++)
+    {
+        ucCarry = (ucColumn >> ulRow) & 1;
+        for(i = g_ulChainDevices; i-- > 0; )
+        {
+            ucOld = g_ucChainFrame[ulRow][i];
+            ucNew = (ucOld >> 1) | (ucCarry << 7);
+            ucCarry = ucOld & 1;
+            if(ucNew != ucOld)
+            {
+                g_ucChainFrame[ulRow][i] = ucNew;
+                g_ucChainDirty[ulRow] = 1;
+            }
+        }
+    }
+}
+
+//*****************************************************************************
+//
+//! \brief Send the changed rows of the frame buffer.
+//!
+//! \param None
+//!
+//! Each changed row goes out as one burst of one word per device. With
+//! MAX7219_CHAIN_DMA the bursts are sent by PDMA and the function returns
+//! at once, rows changed while they are sent go out in the same flush.
+//!
+//! \return None.
+//
+//*****************************************************************************
+void MAX7219_ChainFlush(void)
+{
+#ifdef MAX7219_CHAIN_DMA
+    if(g_bChainBusy)
+    {
+        return;
+    }
+    if(MAX7219_ChainBurstNext())
+    {
+        g_bChainBusy = xtrue;
+        MAX7219_ChainDMAStart();
+    }
+#else
+    while(MAX7219_ChainBurstNext())
+    {
+        MAX7219_ChainSend();
+    }
+#endif
+}
+
+//*****************************************************************************
+//
+//! \brief Check if a flush is running.
+//!
+//! \param None
+//!
+//! \return xtrue while the PDMA sends rows, always xfalse without
+//! MAX7219_CHAIN_DMA.
+//
+//*****************************************************************************
+xtBoolean MAX7219_ChainBusy(void)
+{
+#ifdef MAX7219_CHAIN_DMA
+    return g_bChainBusy;
+#else
+    return xfalse;
+#endif
+}
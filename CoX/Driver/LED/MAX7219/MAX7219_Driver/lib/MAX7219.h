@@ -83,6 +83,21 @@ extern "C"
 #define MAX7219_SPI_PORT    		    SPI0_BASE
 #define MAX7219_SPI_GPIO     		    GPIO_PORTC_BASE
 
+//
+//! Largest number of cascaded MAX7219 driven by the MAX7219_Chain APIs.
+//
+#define MAX7219_CHAIN_MAX               8
+
+//
+//! Send the chain bursts by PDMA, MAX7219_ChainFlush() returns at once.
+//
+//#define MAX7219_CHAIN_DMA
+
+//
+//! PDMA request of the SPI transmit.
+//
+#define MAX7219_SPI_DMA_REQUEST         xDMA_REQUEST_SPI0_TX
+
 //*****************************************************************************
 //
 //! @}
@@ -94,6 +109,8 @@ extern "C"
 //! @{
 //
 //*****************************************************************************
+#define MAX7219_NOOP_ADDR               0x00
+#define MAX7219_DIGIT0_ADDR             0x01
 #define MAX7219_DECODE_MODE_ADDR        0x09
 #define MAX7219_INTENSITY_ADDR                 0x0A
 #define MAX7219_SCAN_LIMIT_ADDR              0x0B
@@ -115,6 +132,18 @@ extern "C"
 extern void MAX7219_Init(void);
 extern void MAX7219_Write(unsigned char ctlByte,
 										unsigned char ucdata);
+
+extern void MAX7219_ChainInit(unsigned long ulDevices);
+extern void MAX7219_ChainControl(unsigned char addr, unsigned char ucdata);
+extern void MAX7219_ChainClear(void);
+extern void MAX7219_ChainRowSet(unsigned long ulDevice, unsigned long ulRow,
+                                unsigned char ucBits);
+extern unsigned char MAX7219_ChainRowGet(unsigned long ulDevice,
+                                         unsigned long ulRow);
+extern void MAX7219_ChainScrollLeft(unsigned char ucColumn);
+extern void MAX7219_ChainScrollRight(unsigned char ucColumn);
+extern void MAX7219_ChainFlush(void);
+extern xtBoolean MAX7219_ChainBusy(void);
 //*****************************************************************************
 //
 //! @}
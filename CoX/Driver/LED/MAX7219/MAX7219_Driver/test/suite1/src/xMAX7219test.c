@@ -20,13 +20,107 @@
 #include "testcase.h"
 #include "MAX7219.h"
 
+//*****************************************************************************
+//
+//! \brief Get the Test description of MAX7219 chain test.
+//!
+//! \return the desccription of the MAX7219 chain test.
+//
+//*****************************************************************************
+static char* MAX7219ChainGetTest(void)
+{
+    return "MAX7219 chain test";
+}
 
+//*****************************************************************************
+//
+//! \brief something should do before the test execute of MAX7219 chain test.
+//!
+//! \return None.
+//
+//*****************************************************************************
+static void MAX7219ChainSetup(void)
+{
+    MAX7219_ChainInit(4);
+}
+
+//*****************************************************************************
+//
+//! \brief something should do after the test execute of MAX7219 chain test.
+//!
+//! \return None.
+//
+//*****************************************************************************
+static void MAX7219ChainTearDown(void)
+{
+    while(MAX7219_ChainBusy())
+    {
+    }
+}
+
+//*****************************************************************************
+//
+//! \brief MAX7219 chain test execute main body.
+//!
+//! \return None.
+//
+//*****************************************************************************
+static void MAX7219ChainExecute(void)
+{
+    unsigned long i;
+
+    MAX7219_ChainRowSet(0, 0, 0x81);
+    MAX7219_ChainRowSet(3, 7, 0x18);
+    TestAssert((MAX7219_ChainRowGet(0, 0) == 0x81) &&
+               (MAX7219_ChainRowGet(3, 7) == 0x18) &&
+               (MAX7219_ChainRowGet(1, 0) == 0),
+               "MAX7219 API \"MAX7219_ChainRowSet()\"error!");
+
+    //
+    // The left column of a device moves into the next device.
+    //
+    MAX7219_ChainScrollLeft(0x01);
+    TestAssert((MAX7219_ChainRowGet(0, 0) == 0x03) &&
+               (MAX7219_ChainRowGet(1, 0) == 0x01) &&
+               (MAX7219_ChainRowGet(3, 7) == 0x30),
+               "MAX7219 API \"MAX7219_ChainScrollLeft()\"error!");
+    MAX7219_ChainScrollRight(0x00);
+    TestAssert((MAX7219_ChainRowGet(0, 0) == 0x81) &&
+               (MAX7219_ChainRowGet(1, 0) == 0) &&
+               (MAX7219_ChainRowGet(3, 7) == 0x18),
+               "MAX7219 API \"MAX7219_ChainScrollRight()\"error!");
+
+    //
+    // A whole column runs through the chain.
+    //
+    MAX7219_ChainClear();
+    for(i = 0; i < 4 * 8; i++)
+    {
+        MAX7219_ChainScrollLeft((i == 0) ? 0xFF : 0x00);
+        MAX7219_ChainFlush();
+    }
+    TestAssert((MAX7219_ChainRowGet(3, 0) == 0x80) &&
+               (MAX7219_ChainRowGet(3, 7) == 0x80) &&
+               (MAX7219_ChainRowGet(0, 0) == 0),
+               "MAX7219 API \"MAX7219_ChainFlush()\"error!");
+}
+
+//
+// MAX7219 chain test case struct.
+//
+const tTestCase sTestMAX7219Chain = {
+    MAX7219ChainGetTest,
+    MAX7219ChainSetup,
+    MAX7219ChainTearDown,
+    MAX7219ChainExecute
+};
 
 //
 // MAX7219 test suits.
 //
 const tTestCase * const psPatternXmcp[] =
 {
+    &sTestMAX7219Chain,
     0
 };
 
@@ -82,9 +82,19 @@
 #define NF_DATA_DIR_IN      xGPIODirModeSet(NF_DATA_PORT, NF_DATA_MASK, xGPIO_DIR_MODE_IN)
 #define NF_DATA_DIR_OUT     xGPIODirModeSet(NF_DATA_PORT, NF_DATA_MASK, xGPIO_DIR_MODE_OUT)
 
+#ifdef NF_DATA_GPIO_BUS
+//
+// The data port is a GPIO bus, one store writes the byte.
+//
+static tGPIOBus g_sNFDataBus;
+
+#define NF_DATA_OUT(a)       GPIOBusWrite(&g_sNFDataBus, a)
+#define NF_DATA_IN()         GPIOBusRead(&g_sNFDataBus)
+#else
 #define NF_DATA_OUT(a)      {xGPIOPinWrite(NF_DATA_PORT, a, 1); \
                              xGPIOPinWrite(NF_DATA_PORT, ~(unsigned long)a&NF_DATA_MASK, 0);}
 #define NF_DATA_IN()         xGPIOPinRead(NF_DATA_PORT, NF_DATA_MASK)
+#endif
 
 #else
 //
@@ -174,6 +184,10 @@ void NFIOInit(void)
 	//
 	xGPIOSPinWrite(NF_RNB_PIN,1);
 
+#ifdef NF_DATA_GPIO_BUS
+	GPIOBusInit(&g_sNFDataBus, NF_DATA_PORT, NF_DATA_MASK);
+#endif
+
 	//
 	// Default data direction is input
 	//
@@ -92,6 +92,12 @@ extern "C"
 // one port from GPIO 0~7.  
 //
 #define NF_DATA_MASK	0x00FF
+
+//
+//! On LPC17xx, write the data port through the GPIO bus writer
+//! (GPIOBusWrite), one store per byte and no FIOMASK update.
+//
+//#define NF_DATA_GPIO_BUS
 #endif
 //*****************************************************************************
 //
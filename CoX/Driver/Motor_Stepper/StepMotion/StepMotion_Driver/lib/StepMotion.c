@@ -0,0 +1,508 @@
+//*****************************************************************************
+//
+//! \file StepMotion.c
+//! \brief Timer driven stepper motion engine with trapezoidal ramps.
+//! \version V2.2.1.0
+//! \date 10/19/2026
+//! \author CooCox
+//! \copy
+//!
+//! Copyright (c)  2013, CooCox
+//! All rights reserved.
+//!
+//! Redistribution and use in source and binary forms, with or without
+//! modification, are permitted provided that the following conditions
+//! are met:
+//!
+//!     * Redistributions of source code must retain the above copyright
+//! notice, this list of conditions and the following disclaimer.
+//!     * Redistributions in binary form must reproduce the above copyright
+//! notice, this list of conditions and the following disclaimer in the
+//! documentation and/or other materials provided with the distribution.
+//!     * Neither the name of the <ORGANIZATION> nor the names of its
+//! contributors may be used to endorse or promote products derived
+//! from this software without specific prior written permission.
+//!
+//! THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+//! AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+//! IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+//! ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+//! LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+//! CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+//! SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+//! INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//! CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+//! ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+//! THE POSSIBILITY OF SUCH DAMAGE.
+//
+//*****************************************************************************
+
+#include "xhw_types.h"
+#include "xhw_ints.h"
+#include "xhw_memmap.h"
+#include "xcore.h"
+#include "xdebug.h"
+#include "xsysctl.h"
+#include "xhw_timer.h"
+#include "xtimer.h"
+#include "StepMotion.h"
+
+//
+// One step in the accumulators' fixed point format.
+//
+#define STEP_MOTION_ONE            0x01000000UL
+#define STEP_MOTION_SHIFT          24
+
+//
+// Ramp phases of the active move.
+//
+#define STEP_MOTION_ACCEL          0
+#define STEP_MOTION_CRUISE         1
+#define STEP_MOTION_DECEL          2
+
+//
+// A queued move. Velocities are steps per tick and accelerations steps per
+// tick squared, both in 8.24 fixed point.
+//
+typedef struct
+{
+    unsigned long ulSteps;
+    unsigned long ulDir;
+    unsigned long ulVelMax;
+    unsigned long ulAccel;
+    tStepMotionDone pfnDone;
+    void *pvArg;
+}
+tStepMove;
+
+//
+// Axis state. The queue head is written by StepMotionMove() only and the
+// tail by StepMotionTick() only, so the queue needs no lock.
+//
+typedef struct
+{
+    tStepMove sMove[STEP_MOTION_QUEUE_SIZE];
+    volatile unsigned char ucHead;
+    volatile unsigned char ucTail;
+    volatile unsigned char ucActive;
+    volatile unsigned char ucAbort;
+    unsigned char ucPhase;
+
+    unsigned long ulDone;
+    unsigned long ulRampSteps;
+    unsigned long ulVel;
+    unsigned long ulAccum;
+    volatile long lPosition;
+}
+tStepAxis;
+
+static tStepAxis g_sStepAxis[STEP_MOTION_AXES];
+
+static tStepMotionStep g_pfnStepMotionStep = 0;
+static tStepMotionCommit g_pfnStepMotionCommit = 0;
+
+//
+// Set when the engine owns STEP_MOTION_TIMER, and while that timer runs.
+//
+static xtBoolean g_bStepMotionTimer = xfalse;
+static volatile xtBoolean g_bStepMotionRunning = xfalse;
+
+//*****************************************************************************
+//
+//! \brief Compute (ulNum << ulShift) / ulDen rounded, without overflowing
+//! 32 bits.
+//!
+//! \param ulNum is the numerator.
+//! \param ulDen is the denominator, less than 2^31.
+//! \param ulShift is the number of fraction bits of the result.
+//!
+//! \return The quotient.
+//
+//*****************************************************************************
+static unsigned long
+StepMotionFixedDiv(unsigned long ulNum, unsigned long ulDen,
+                   unsigned long ulShift)
+{
+    unsigned long ulQuot = ulNum / ulDen;
+    unsigned long ulRem = ulNum % ulDen;
+
+    //
+    // One more bit than asked for, to round on.
+    //
+    ulShift++;
+    while(ulShift--)
+    {
+        ulQuot <<= 1;
+        ulRem <<= 1;
+        if(ulRem >= ulDen)
+        {
+            ulQuot |= 1;
+            ulRem -= ulDen;
+        }
+    }
+
+    return (ulQuot + 1) >> 1;
+}
+
+//*****************************************************************************
+//
+//! \brief The engine timer interrupt handler.
+//!
+//! \return 0.
+//
+//*****************************************************************************
+static unsigned long
+StepMotionTimerHandler(void *pvCBData, unsigned long ulEvent,
+                       unsigned long ulMsgParam, void *pvMsgData)
+{
+    StepMotionTick();
+    return 0;
+}
+
+//*****************************************************************************
+//
+//! \brief Init the motion engine.
+//!
+//! \param pfnStep is called from the tick to issue one step.
+//! \param pfnCommit is called at the end of a tick in which any axis
+//! stepped, can be 0.
+//!
+//! The engine does not tick until StepMotionTimerInit() is called, or the
+//! application calls StepMotionTick() at STEP_MOTION_TICK_FREQ from its own
+//! interrupt.
+//!
+//! \return None.
+//
+//*****************************************************************************
+void
+StepMotionInit(tStepMotionStep pfnStep, tStepMotionCommit pfnCommit)
+{
+    unsigned long i;
+
+    xASSERT(pfnStep != 0);
+
+    for(i = 0; i < STEP_MOTION_AXES; i++)
+    {
+        g_sStepAxis[i].ucHead = 0;
+        g_sStepAxis[i].ucTail = 0;
+        g_sStepAxis[i].ucActive = 0;
+        g_sStepAxis[i].ucAbort = 0;
+        g_sStepAxis[i].lPosition = 0;
+    }
+
+    g_pfnStepMotionStep = pfnStep;
+    g_pfnStepMotionCommit = pfnCommit;
+}
+
+//*****************************************************************************
+//
+//! \brief Let the engine tick from STEP_MOTION_TIMER.
+//!
+//! The timer is configured for STEP_MOTION_TICK_FREQ. It is started by
+//! StepMotionMove() and stops by itself when every axis is idle.
+//!
+//! \return None.
+//
+//*****************************************************************************
+void
+StepMotionTimerInit(void)
+{
+    xSysCtlPeripheralEnable2(STEP_MOTION_TIMER);
+
+    xTimerInitConfig(STEP_MOTION_TIMER, STEP_MOTION_CHANNEL,
+                     xTIMER_MODE_PERIODIC, STEP_MOTION_TICK_FREQ);
+    xTimerIntEnable(STEP_MOTION_TIMER, STEP_MOTION_CHANNEL, xTIMER_INT_MATCH);
+    xTimerIntCallbackInit(STEP_MOTION_TIMER, StepMotionTimerHandler);
+    xIntEnable(STEP_MOTION_TIMER_INT);
+
+    g_bStepMotionTimer = xtrue;
+}
+
+//*****************************************************************************
+//
+//! \brief Queue a move on an axis.
+//!
+//! \param ulAxis is the axis, 0 to STEP_MOTION_AXES - 1.
+//! \param ulDir is STEP_MOTION_FORWARD or STEP_MOTION_BACKWARD.
+//! \param ulSteps is the number of steps.
+//! \param ulSpeed is the cruise speed in steps per second, at most
+//! STEP_MOTION_TICK_FREQ.
+//! \param ulAccel is the acceleration in steps per second squared, 0 runs
+//! the whole move at \e ulSpeed.
+//! \param pfnDone is called from the tick when the move ends, can be 0.
+//! \param pvArg is passed to \e pfnDone.
+//!
+//! The move starts when the moves queued before it on the axis are done.
+//! A move too short to reach \e ulSpeed decelerates from half way.
+//!
+//! \return xtrue if the move was queued, xfalse if the queue was full.
+//
+//*****************************************************************************
+xtBoolean
+StepMotionMove(unsigned long ulAxis, unsigned long ulDir,
+               unsigned long ulSteps, unsigned long ulSpeed,
+               unsigned long ulAccel, tStepMotionDone pfnDone, void *pvArg)
+{
+    tStepAxis *psAxis;
+    tStepMove *psMove;
+    unsigned char ucNext;
+
+    xASSERT(ulAxis < STEP_MOTION_AXES);
+    xASSERT((ulDir == STEP_MOTION_FORWARD) || (ulDir == STEP_MOTION_BACKWARD));
+    xASSERT((ulSpeed > 0) && (ulSpeed <= STEP_MOTION_TICK_FREQ));
+
+    psAxis = &g_sStepAxis[ulAxis];
+    ucNext = (psAxis->ucHead + 1) & (STEP_MOTION_QUEUE_SIZE - 1);
+    if(ucNext == psAxis->ucTail)
+    {
+        return xfalse;
+    }
+
+    psMove = &psAxis->sMove[psAxis->ucHead];
+    psMove->ulSteps = ulSteps;
+    psMove->ulDir = ulDir;
+    psMove->ulVelMax = StepMotionFixedDiv(ulSpeed, STEP_MOTION_TICK_FREQ,
+                                          STEP_MOTION_SHIFT);
+    psMove->ulAccel = StepMotionFixedDiv(ulAccel,
+                                         (unsigned long)STEP_MOTION_TICK_FREQ *
+                                         STEP_MOTION_TICK_FREQ,
+                                         STEP_MOTION_SHIFT);
+    if((ulAccel != 0) && (psMove->ulAccel == 0))
+    {
+        psMove->ulAccel = 1;
+    }
+    psMove->pfnDone = pfnDone;
+    psMove->pvArg = pvArg;
+    psAxis->ucHead = ucNext;
+
+    //
+    // Start the timer if it stopped on idle. Its interrupt is masked so the
+    // tick can not stop it between the test and the start.
+    //
+    if(g_bStepMotionTimer)
+    {
+        xIntDisable(STEP_MOTION_TIMER_INT);
+        if(!g_bStepMotionRunning)
+        {
+            g_bStepMotionRunning = xtrue;
+            xTimerStart(STEP_MOTION_TIMER, STEP_MOTION_CHANNEL);
+        }
+        xIntEnable(STEP_MOTION_TIMER_INT);
+    }
+
+    return xtrue;
+}
+
+//*****************************************************************************
+//
+//! \brief Stop an axis at once and drop its queued moves.
+//!
+//! \param ulAxis is the axis.
+//!
+//! The stop is done by the next tick. The dropped moves do not call their
+//! completion callbacks.
+//!
+//! \return None.
+//
+//*****************************************************************************
+void
+StepMotionStop(unsigned long ulAxis)
+{
+    xASSERT(ulAxis < STEP_MOTION_AXES);
+
+    if(!StepMotionIdle(ulAxis))
+    {
+        g_sStepAxis[ulAxis].ucAbort = 1;
+    }
+}
+
+//*****************************************************************************
+//
+//! \brief Check whether an axis has finished all of its moves.
+//!
+//! \param ulAxis is the axis.
+//!
+//! \return xtrue if the axis is idle.
+//
+//*****************************************************************************
+xtBoolean
+StepMotionIdle(unsigned long ulAxis)
+{
+    tStepAxis *psAxis;
+
+    xASSERT(ulAxis < STEP_MOTION_AXES);
+
+    psAxis = &g_sStepAxis[ulAxis];
+    return ((psAxis->ucActive == 0) && (psAxis->ucHead == psAxis->ucTail)) ?
+           xtrue : xfalse;
+}
+
+//*****************************************************************************
+//
+//! \brief Get the position of an axis in steps.
+//!
+//! \param ulAxis is the axis.
+//!
+//! \return The number of forward steps minus the backward steps since
+//! StepMotionInit().
+//
+//*****************************************************************************
+long
+StepMotionPositionGet(unsigned long ulAxis)
+{
+    xASSERT(ulAxis < STEP_MOTION_AXES);
+
+    return g_sStepAxis[ulAxis].lPosition;
+}
+
+//*****************************************************************************
+//
+//! \brief Advance every axis by one tick.
+//!
+//! Called by the engine timer at STEP_MOTION_TICK_FREQ, or by the
+//! application's own tick interrupt when StepMotionTimerInit() is not used.
+//!
+//! \return None.
+//
+//*****************************************************************************
+void
+StepMotionTick(void)
+{
+    tStepAxis *psAxis;
+    tStepMove *psMove;
+    unsigned long i, ulLeft;
+    xtBoolean bStepped = xfalse;
+    xtBoolean bBusy = xfalse;
+
+    for(i = 0; i < STEP_MOTION_AXES; i++)
+    {
+        psAxis = &g_sStepAxis[i];
+
+        if(psAxis->ucAbort)
+        {
+            psAxis->ucActive = 0;
+            psAxis->ucTail = psAxis->ucHead;
+            psAxis->ucAbort = 0;
+        }
+
+        //
+        // Load the next move.
+        //
+        while(!psAxis->ucActive)
+        {
+            if(psAxis->ucTail == psAxis->ucHead)
+            {
+                break;
+            }
+            psMove = &psAxis->sMove[psAxis->ucTail];
+            if(psMove->ulSteps == 0)
+            {
+                psAxis->ucTail = (psAxis->ucTail + 1) &
+                                 (STEP_MOTION_QUEUE_SIZE - 1);
+                if(psMove->pfnDone)
+                {
+                    psMove->pfnDone(psMove->pvArg, i);
+                }
+                continue;
+            }
+            psAxis->ulDone = 0;
+            psAxis->ulRampSteps = 0;
+            psAxis->ulAccum = 0;
+            if(psMove->ulAccel == 0)
+            {
+                psAxis->ulVel = psMove->ulVelMax;
+                psAxis->ucPhase = STEP_MOTION_CRUISE;
+            }
+            else
+            {
+                psAxis->ulVel = 0;
+                psAxis->ucPhase = STEP_MOTION_ACCEL;
+            }
+            psAxis->ucActive = 1;
+        }
+        if(!psAxis->ucActive)
+        {
+            continue;
+        }
+        bBusy = xtrue;
+        psMove = &psAxis->sMove[psAxis->ucTail];
+
+        //
+        // Ramp the velocity. Deceleration stops at one ramp increment so the
+        // last steps are always reached.
+        //
+        if(psAxis->ucPhase == STEP_MOTION_ACCEL)
+        {
+            psAxis->ulVel += psMove->ulAccel;
+            if(psAxis->ulVel >= psMove->ulVelMax)
+            {
+                psAxis->ulVel = psMove->ulVelMax;
+                psAxis->ucPhase = STEP_MOTION_CRUISE;
+            }
+        }
+        else if(psAxis->ucPhase == STEP_MOTION_DECEL)
+        {
+            if(psAxis->ulVel > 2 * psMove->ulAccel)
+            {
+                psAxis->ulVel -= psMove->ulAccel;
+            }
+        }
+
+        psAxis->ulAccum += psAxis->ulVel;
+        if(psAxis->ulAccum < STEP_MOTION_ONE)
+        {
+            continue;
+        }
+        psAxis->ulAccum -= STEP_MOTION_ONE;
+
+        g_pfnStepMotionStep(i, psMove->ulDir);
+        bStepped = xtrue;
+        if(psMove->ulDir == STEP_MOTION_FORWARD)
+        {
+            psAxis->lPosition++;
+        }
+        else
+        {
+            psAxis->lPosition--;
+        }
+
+        psAxis->ulDone++;
+        if(psAxis->ucPhase == STEP_MOTION_ACCEL)
+        {
+            psAxis->ulRampSteps = psAxis->ulDone;
+        }
+        ulLeft = psMove->ulSteps - psAxis->ulDone;
+
+        if(ulLeft == 0)
+        {
+            psAxis->ucActive = 0;
+            psAxis->ucTail = (psAxis->ucTail + 1) & (STEP_MOTION_QUEUE_SIZE - 1);
+            if(psMove->pfnDone)
+            {
+                psMove->pfnDone(psMove->pvArg, i);
+            }
+        }
+        else if((psAxis->ucPhase != STEP_MOTION_DECEL) &&
+                (ulLeft <= psAxis->ulRampSteps))
+        {
+            //
+            // As many steps are left as the ramp up took, ramp down now.
+            //
+            psAxis->ucPhase = STEP_MOTION_DECEL;
+        }
+    }
+
+    if(bStepped && g_pfnStepMotionCommit)
+    {
+        g_pfnStepMotionCommit();
+    }
+
+    //
+    // Stop the timer when there is nothing to do.
+    //
+    if(!bBusy && g_bStepMotionTimer && g_bStepMotionRunning)
+    {
+        xTimerStop(STEP_MOTION_TIMER, STEP_MOTION_CHANNEL);
+        g_bStepMotionRunning = xfalse;
+    }
+}
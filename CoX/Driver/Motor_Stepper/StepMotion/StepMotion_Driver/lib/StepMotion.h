@@ -0,0 +1,203 @@
+//*****************************************************************************
+//
+//! \file StepMotion.h
+//! \brief Prototypes for the timer driven stepper motion engine.
+//! \version V2.2.1.0
+//! \date 10/19/2026
+//! \author CooCox
+//! \copy
+//!
+//! Copyright (c)  2013, CooCox
+//! All rights reserved.
+//!
+//! Redistribution and use in source and binary forms, with or without
+//! modification, are permitted provided that the following conditions
+//! are met:
+//!
+//!     * Redistributions of source code must retain the above copyright
+//! notice, this list of conditions and the following disclaimer.
+//!     * Redistributions in binary form must reproduce the above copyright
+//! notice, this list of conditions and the following disclaimer in the
+//! documentation and/or other materials provided with the distribution.
+//!     * Neither the name of the <ORGANIZATION> nor the names of its
+//! contributors may be used to endorse or promote products derived
+//! from this software without specific prior written permission.
+//!
+//! THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+//! AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+//! IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+//! ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+//! LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+//! CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+//! SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+//! INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//! CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+//! ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+//! THE POSSIBILITY OF SUCH DAMAGE.
+//
+//*****************************************************************************
+#ifndef __STEPMOTION_H__
+#define __STEPMOTION_H__
+
+//*****************************************************************************
+//
+// If building with a C++ compiler, make all of the definitions in this header
+// have a C binding.
+//
+//*****************************************************************************
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+//*****************************************************************************
+//
+//! \addtogroup CoX_Driver_Lib
+//! @{
+//
+//! \addtogroup Motor
+//! @{
+//
+//! \addtogroup StepMotion
+//! \brief One periodic timer drives every axis. Each tick the velocity of an
+//! axis is ramped by a constant and added to a phase accumulator, and a step
+//! is issued when the accumulator wraps. The tick needs no division, so
+//! several axes can run trapezoidal moves at once from one interrupt.
+//! @{
+//
+//*****************************************************************************
+
+//*****************************************************************************
+//! \addtogroup StepMotion_User_Config
+//! @{
+//
+//*****************************************************************************
+
+//
+//! Number of axes driven by the engine.
+//
+#define STEP_MOTION_AXES           2
+
+//
+//! Number of moves that can wait per axis (must be a power of 2).
+//
+#define STEP_MOTION_QUEUE_SIZE     4
+
+//
+//! Timer tick frequency in Hz. It is also the highest step rate.
+//
+#define STEP_MOTION_TICK_FREQ      10000
+
+//
+//! The timer that runs the engine.
+//
+#define STEP_MOTION_TIMER          xTIMER1_BASE
+
+//
+//! The channel of the engine timer.
+//
+#define STEP_MOTION_CHANNEL        xTIMER_CHANNEL0
+
+//
+//! The interrupt number of the engine timer.
+//
+#define STEP_MOTION_TIMER_INT      xINT_TIMER1
+
+//*****************************************************************************
+//
+//! @}
+//
+//*****************************************************************************
+
+//*****************************************************************************
+//! \addtogroup StepMotion_Dir StepMotion Direction
+//! \brief Values that can be passed to StepMotionMove() as \e ulDir.
+//! @{
+//
+//*****************************************************************************
+
+//
+//! Step forward, the position increases.
+//
+#define STEP_MOTION_FORWARD        0
+
+//
+//! Step backward, the position decreases.
+//
+#define STEP_MOTION_BACKWARD       1
+
+//*****************************************************************************
+//
+//! @}
+//
+//*****************************************************************************
+
+//*****************************************************************************
+//! \addtogroup StepMotion_Types
+//! @{
+//
+//*****************************************************************************
+
+//
+//! Issue one step on \e ulAxis. Called from the timer interrupt.
+//
+typedef void (*tStepMotionStep)(unsigned long ulAxis, unsigned long ulDir);
+
+//
+//! Called once at the end of a tick in which any axis stepped, so outputs
+//! shared by several axes (e.g. a shift register) are written once.
+//
+typedef void (*tStepMotionCommit)(void);
+
+//
+//! Move completion callback. Called from the timer interrupt.
+//
+typedef void (*tStepMotionDone)(void *pvArg, unsigned long ulAxis);
+
+//*****************************************************************************
+//
+//! @}
+//
+//*****************************************************************************
+
+//*****************************************************************************
+//! \addtogroup StepMotion_Export_APIs
+//! @{
+//
+//*****************************************************************************
+extern void StepMotionInit(tStepMotionStep pfnStep,
+                           tStepMotionCommit pfnCommit);
+extern void StepMotionTimerInit(void);
+extern xtBoolean StepMotionMove(unsigned long ulAxis, unsigned long ulDir,
+                                unsigned long ulSteps, unsigned long ulSpeed,
+                                unsigned long ulAccel,
+                                tStepMotionDone pfnDone, void *pvArg);
+extern void StepMotionStop(unsigned long ulAxis);
+extern xtBoolean StepMotionIdle(unsigned long ulAxis);
+extern long StepMotionPositionGet(unsigned long ulAxis);
+extern void StepMotionTick(void);
+
+//*****************************************************************************
+//
+//! @}
+//
+//*****************************************************************************
+
+//*****************************************************************************
+//
+//! @}
+//! @}
+//! @}
+//
+//*****************************************************************************
+
+//*****************************************************************************
+//
+// Mark the end of the C bindings section for C++ compilers.
+//
+//*****************************************************************************
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,254 @@
+//*****************************************************************************
+//
+//! @page StepMotion_testcase StepMotion engine test
+//!
+//! File: @ref StepMotion.c
+//!
+//! <h2>Description</h2>
+//! This module implements the test sequence for the stepper motion engine.
+//! <br><br>
+//! - \p Board: STM32 <br><br>
+//! - \p Last-Time(about): 0.1s <br><br>
+//! - \p Phenomenon: Success or failure information will be printed on the UART. <br><br>
+//! .
+//!
+//! <h2>Preconditions</h2>
+//! The module requires the following options:<br><br>
+//! - \p Option-define:
+//! <br>(1)None.<br><br>
+//! - \p Option-hardware:
+//! <br>(1)None, the test calls StepMotionTick() itself and records the
+//! steps.<br><br>
+//! - \p Option-OtherModule:
+//! <br>Connect an COM cable to the development board.<br>
+//! .
+//! In case some of the required options are not enabled then some or all tests
+//! may be skipped or result FAILED.<br>
+//!
+//! <h2>Test Cases</h2>
+//! The module contain those sub tests:<br><br>
+//! - \subpage test_StepMotion_Engine
+//! .
+//! \file StepMotion.c
+//! \brief StepMotion test source file
+//! \file StepMotion.h
+//! \brief StepMotion test header file <br>
+//
+//*****************************************************************************
+
+#include "test.h"
+#include "StepMotion.h"
+
+//
+// Tick count of the test and the tick of each step of axis 0.
+//
+static unsigned long ulTicks;
+static unsigned long ulStepTick[128];
+static unsigned long ulStepCnt[STEP_MOTION_AXES];
+static unsigned long ulCommitCnt;
+static unsigned long ulDoneCnt[STEP_MOTION_AXES];
+
+static void StepMotionTestStep(unsigned long ulAxis, unsigned long ulDir)
+{
+    if((ulAxis == 0) && (ulStepCnt[0] < 128))
+    {
+        ulStepTick[ulStepCnt[0]] = ulTicks;
+    }
+    ulStepCnt[ulAxis]++;
+}
+
+static void StepMotionTestCommit(void)
+{
+    ulCommitCnt++;
+}
+
+static void StepMotionTestDone(void *pvArg, unsigned long ulAxis)
+{
+    ulDoneCnt[ulAxis]++;
+}
+
+//*****************************************************************************
+//
+//! \brief Run the engine for some ticks.
+//!
+//! \return None.
+//
+//*****************************************************************************
+static void StepMotionTestRun(unsigned long ulCount)
+{
+    while(ulCount--)
+    {
+        ulTicks++;
+        StepMotionTick();
+    }
+}
+
+static unsigned long StepMotionTestDiff(unsigned long ulA, unsigned long ulB)
+{
+    return (ulA > ulB) ? (ulA - ulB) : (ulB - ulA);
+}
+
+//*****************************************************************************
+//
+//! \brief Get the Test description of StepMotion engine test.
+//!
+//! \return the desccription of the StepMotion test.
+//
+//*****************************************************************************
+static char* StepMotionGetTest(void)
+{
+    return "StepMotion engine test";
+}
+
+//*****************************************************************************
+//
+//! \brief something should do before the test execute of StepMotion test.
+//!
+//! \return None.
+//
+//*****************************************************************************
+static void StepMotionSetup(void)
+{
+    unsigned long i;
+
+    StepMotionInit(StepMotionTestStep, StepMotionTestCommit);
+    ulTicks = 0;
+    ulCommitCnt = 0;
+    for(i = 0; i < STEP_MOTION_AXES; i++)
+    {
+        ulStepCnt[i] = 0;
+        ulDoneCnt[i] = 0;
+    }
+}
+
+//*****************************************************************************
+//
+//! \brief something should do after the test execute of StepMotion test.
+//!
+//! \return None.
+//
+//*****************************************************************************
+static void StepMotionTearDown(void)
+{
+
+}
+
+//*****************************************************************************
+//
+//! \brief StepMotion test execute main body.
+//!
+//! \return None.
+//
+//*****************************************************************************
+static void StepMotionExecute(void)
+{
+    unsigned long i;
+
+    //
+    // Constant speed, one step every 2 ticks.
+    //
+    TestAssert(StepMotionMove(0, STEP_MOTION_FORWARD, 10,
+                              STEP_MOTION_TICK_FREQ / 2, 0,
+                              StepMotionTestDone, 0),
+               "StepMotion API \"StepMotionMove()\"error!");
+    TestAssert(!StepMotionIdle(0), "StepMotion API \"StepMotionIdle()\"error!");
+    StepMotionTestRun(19);
+    TestAssert((ulStepCnt[0] == 9) && (ulDoneCnt[0] == 0),
+               "StepMotion API \"StepMotionTick()\"error!");
+    StepMotionTestRun(1);
+    TestAssert((ulStepCnt[0] == 10) && (ulDoneCnt[0] == 1) &&
+               (ulStepTick[9] - ulStepTick[8] == 2),
+               "StepMotion API \"StepMotionTick()\"error!");
+    TestAssert(StepMotionIdle(0) && (StepMotionPositionGet(0) == 10),
+               "StepMotion API \"StepMotionPositionGet()\"error!");
+
+    //
+    // Trapezoid: 1000 steps/s reached after 100 ticks, about 5 steps.
+    //
+    ulStepCnt[0] = 0;
+    StepMotionMove(0, STEP_MOTION_BACKWARD, 100, 1000, 100000,
+                   StepMotionTestDone, 0);
+    StepMotionTestRun(2000);
+    TestAssert((ulStepCnt[0] == 100) && (ulDoneCnt[0] == 2) &&
+               (StepMotionPositionGet(0) == -90),
+               "StepMotion API \"StepMotionTick()\"error!");
+
+    //
+    // Cruise at 10 ticks a step, slower at both ends.
+    //
+    TestAssert(ulStepTick[50] - ulStepTick[49] == 10,
+               "StepMotion API \"StepMotionTick()\"error!");
+    TestAssert((ulStepTick[1] - ulStepTick[0] > 10) &&
+               (ulStepTick[99] - ulStepTick[98] > 10),
+               "StepMotion API \"StepMotionTick()\"error!");
+
+    //
+    // The ramp down mirrors the ramp up. The move started after tick 20.
+    //
+    for(i = 1; i < 50; i++)
+    {
+        if(StepMotionTestDiff(ulStepTick[i] - ulStepTick[i - 1],
+                              ulStepTick[99 - i] - ulStepTick[98 - i]) > 1)
+        {
+            break;
+        }
+    }
+    TestAssert((i == 50) &&
+               (StepMotionTestDiff(ulStepTick[0] - 20,
+                                   ulStepTick[99] - ulStepTick[98]) <= 1),
+               "StepMotion API \"StepMotionTick()\"error!");
+
+    //
+    // Two axes at once, queued moves on axis 0.
+    //
+    ulStepCnt[0] = 0;
+    ulCommitCnt = 0;
+    StepMotionMove(0, STEP_MOTION_FORWARD, 20, 5000, 0, StepMotionTestDone, 0);
+    StepMotionMove(0, STEP_MOTION_FORWARD, 20, 5000, 0, StepMotionTestDone, 0);
+    StepMotionMove(0, STEP_MOTION_FORWARD, 1, 5000, 0, StepMotionTestDone, 0);
+    StepMotionMove(1, STEP_MOTION_BACKWARD, 40, 5000, 0, StepMotionTestDone, 0);
+    TestAssert(!StepMotionMove(0, STEP_MOTION_FORWARD, 1, 5000, 0, 0, 0) ||
+               (STEP_MOTION_QUEUE_SIZE != 4),
+               "StepMotion API \"StepMotionMove()\"error!");
+    StepMotionTestRun(90);
+    TestAssert((ulDoneCnt[0] == 5) && (ulDoneCnt[1] == 1) &&
+               (StepMotionPositionGet(0) == -49) &&
+               (StepMotionPositionGet(1) == -40),
+               "StepMotion API \"StepMotionTick()\"error!");
+
+    //
+    // Both axes step in the same ticks, each tick is committed once.
+    //
+    TestAssert(ulCommitCnt == 41, "StepMotion API \"StepMotionTick()\"error!");
+
+    //
+    // Stop drops the queue without callbacks.
+    //
+    StepMotionMove(1, STEP_MOTION_FORWARD, 100, 1000, 0, StepMotionTestDone, 0);
+    StepMotionMove(1, STEP_MOTION_FORWARD, 100, 1000, 0, StepMotionTestDone, 0);
+    StepMotionTestRun(50);
+    StepMotionStop(1);
+    StepMotionTestRun(1);
+    TestAssert(StepMotionIdle(1) && (ulDoneCnt[1] == 1) &&
+               (StepMotionPositionGet(1) == -35),
+               "StepMotion API \"StepMotionStop()\"error!");
+}
+
+//
+// StepMotion engine test case struct.
+//
+const tTestCase sTestStepMotionEngine = {
+        StepMotionGetTest,
+        StepMotionSetup,
+        StepMotionTearDown,
+        StepMotionExecute
+};
+
+//
+// StepMotion test suits.
+//
+const tTestCase * const psPatternStepMotionTest[] =
+{
+    &sTestStepMotionEngine,
+    0
+};
@@ -43,219 +43,139 @@
 #include "xcore.h"
 #include "xsysctl.h"
 #include "xgpio.h"
+#include "xhw_ints.h"
+#include "xhw_timer.h"
+#include "xtimer.h"
 #include "BMP085.h"
 #ifdef BMP085_USE_HARDWARE_I2C
 #include "xhw_i2c.h"
 #include "xi2c.h"
+#else
+#include "SoftI2C.h"
 #endif
 
 //**************************************************************
 //
 //! \internal
-//! \brief software I2C SCL and SDA I/O control define
+//! \brief The bus and the transfer calls. The software bus takes the same
+//! calls as the hardware one.
 //
 //***************************************************************
-#ifndef BMP085_USE_HARDWARE_I2C
-#define BMP085_SDA_SET()          xGPIOSPinWrite(BMP085_I2C_PIN_SDA,1)
-#define BMP085_SDA_CLR()          xGPIOSPinWrite(BMP085_I2C_PIN_SDA,0)
-#define BMP085_SCL_SET()          xGPIOSPinWrite(BMP085_I2C_PIN_SCL,1)
-#define BMP085_SCL_CLR()          xGPIOSPinWrite(BMP085_I2C_PIN_SCL,0)
-#define BMP085_SDA_DDR_OUT()      xGPIOSDirModeSet(BMP085_I2C_PIN_SDA, xGPIO_DIR_MODE_OD)
-#define BMP085_SDA_DDR_IN()       xGPIOSDirModeSet(BMP085_I2C_PIN_SDA, xGPIO_DIR_MODE_IN)
+#ifdef BMP085_USE_HARDWARE_I2C
+#define BMP085_I2C_BUS            BMP085_I2C_PORT
+#define BMP085I2C(api)            xI2C##api
+#else
+static tSoftI2C sBMP085I2C;
+#define BMP085_I2C_BUS            ((unsigned long)&sBMP085I2C)
+#define BMP085I2C(api)            SoftI2C##api
 #endif
 
 static BMP085CalibratationStruct BMP085CalibData;
 
-//*****************************************************************************
 //
-//! \brief Provides an approximately tms delay.
-//!
-//! \param t is the number of delay loop iterations to perform.
-//!
-//! This function provides a means of generating a constant length delay.
-//! It can not ensure the accuracy of delay since different system clock maybe used.
-//! Change the delay time as you need.
-//!
-//! \return None.
+// Compensation terms that only depend on the last temperature conversion.
 //
-//*****************************************************************************
-static void BMP085DelayMs(unsigned long t)
+static struct
 {
-	while(t--)
-	{
-		xSysCtlDelay(20000);
-	}
+    long lTemp;
+    long lB3;
+    unsigned long ulB4;
 }
+BMP085TempComp;
 
-#ifndef BMP085_USE_HARDWARE_I2C
-//*****************************************************************************
 //
-//! \brief Provides an short delay for I2C to slow down the clock rate.
-//!
-//! \param None.
-//!
-//! \return None.
+// Measurement states of BMP085MeasureTick().
 //
-//*****************************************************************************
-void BMP085I2CDelay()
-{
-	xSysCtlDelay(100);
-}
+#define BMP085_MEAS_IDLE               0
+#define BMP085_MEAS_TEMP               1
+#define BMP085_MEAS_PRES               2
 
-//*****************************************************************************
 //
-//! \brief Send start signal on I2C BUS.
-//!
-//! \param None.
-//!
-//! \return None.
+// Timer ticks to wait for a conversion of us microseconds. One tick is
+// added since the first tick can come right after the start.
 //
-//*****************************************************************************
-void BMP085I2CStart(void)
-{
-    BMP085_SDA_SET();
-    BMP085_SCL_SET();
-    BMP085I2CDelay();
-    BMP085_SDA_CLR();
-    BMP085I2CDelay();
-    BMP085_SCL_CLR();
-}
+#define BMP085_TICKS(us)                                                      \
+        ((((us) * (BMP085_TICK_FREQ / 100) + 9999) / 10000) + 1)
 
-//*****************************************************************************
-//
-//! \brief Send stop signal on I2C BUS.
-//!
-//! \param None.
-//!
-//! \return None.
-//
-//*****************************************************************************
-void BMP085I2CStop(void)
-{
-    BMP085_SDA_CLR();
-    BMP085_SCL_SET();
-    BMP085I2CDelay();
-    BMP085_SDA_SET();
-    BMP085I2CDelay();
-}
+static volatile unsigned char ucMeasState = BMP085_MEAS_IDLE;
+static unsigned char ucMeasOss;
+static xtBoolean bMeasContinuous;
+static unsigned long ulMeasWait;
+static unsigned long ulMeasCount;
+static long lMeasTemp;
+static long lMeasPres;
+static volatile xtBoolean bMeasNew;
 
-//*****************************************************************************
 //
-//! \brief Master Send ACK signal on I2C BUS.
-//!
-//! \param ack 1 stands for ACK, 0 stands for NACK.
-//!
-//! \return None.
+// Pressure conversion time of each over-sample level in us.
 //
-//*****************************************************************************
-void BMP085I2CSendACK(unsigned char ack)
-{
-	BMP085_SCL_CLR();
-    if(ack)
-    {
-    	BMP085_SDA_CLR();
-    }
-    else
-    {
-    	BMP085_SDA_SET();
-    }
-    BMP085I2CDelay();
-    BMP085_SCL_SET();
-    BMP085I2CDelay();
-    BMP085_SCL_CLR();
-    BMP085I2CDelay();
-    BMP085_SDA_CLR();
-}
+static const unsigned long ulPresConvUs[4] = {4500, 7500, 13500, 25500};
 
-//*****************************************************************************
 //
-//! \brief Send ACK signal on I2C BUS.
-//!
-//! \param ack 1 stands for ACK, 0 stands for NACK.
-//!
-//! \return None.
+// Altitude in 0.1 m at BMP085_ALT_TAB_MIN + n * 1024 Pa, from
+// h = 44330 * (1 - (p / 101325) ^ (1 / 5.255)). Linear interpolation between
+// the entries is within 0.2 m above 80 kPa.
 //
-//*****************************************************************************
-unsigned char BMP085_RecvACK(void)
+#define BMP085_ALT_TAB_MIN             30000
+#define BMP085_ALT_TAB_LEN             80
+
+static const long lAltTab[BMP085_ALT_TAB_LEN] =
 {
-	unsigned char res;
-
-	BMP085_SDA_DDR_IN();
-	xGPIOSPinWrite(BMP085_I2C_PIN_SDA,1);  //pull up
-    BMP085_SCL_SET();
-    BMP085I2CDelay();
-    res = xGPIOSPinRead(BMP085_I2C_PIN_SDA);
-    BMP085_SCL_CLR();
-    BMP085_SDA_DDR_OUT();
-    //BMP085I2CDelay();
-
-    return res;
-}
+     91652,  89398,  87205,  85067,  82982,  80948,  78960,  77018,
+     75119,  73261,  71441,  69659,  67912,  66198,  64518,  62868,
+     61249,  59658,  58095,  56558,  55047,  53560,  52097,  50658,
+     49240,  47843,  46468,  45112,  43775,  42458,  41158,  39877,
+     38612,  37364,  36132,  34915,  33714,  32528,  31356,  30198,
+     29054,  27923,  26805,  25699,  24606,  23525,  22456,  21398,
+     20351,  19315,  18290,  17276,  16271,  15276,  14291,  13316,
+     12350,  11393,  10445,   9506,   8575,   7653,   6739,   5833,
+      4935,   4045,   3162,   2287,   1419,    558,   -295,  -1142,
+     -1982,  -2815,  -3641,  -4462,  -5275,  -6083,  -6884,  -7680,
+};
 
 //*****************************************************************************
 //
-//! \brief Send data byte on I2C BUS.
+//! \brief Provides an approximately tms delay.
+//!
+//! \param t is the number of delay loop iterations to perform.
 //!
-//! \param dat The byte to be sent.
+//! This function provides a means of generating a constant length delay.
+//! It can not ensure the accuracy of delay since different system clock maybe used.
+//! Change the delay time as you need.
 //!
-//! \return result of the sending operation.
+//! \return None.
 //
 //*****************************************************************************
-unsigned char BMP085I2CSendByte(unsigned char dat)
+static void BMP085DelayMs(unsigned long t)
 {
-    unsigned char i;
-
-    BMP085_SCL_CLR();
-    for (i=0; i<8; i++)
-    {
-    	(dat&0x80) ? BMP085_SDA_SET():BMP085_SDA_CLR();
-        dat <<= 1;
-        BMP085_SCL_SET();
-        BMP085I2CDelay();
-        BMP085_SCL_CLR();
-        BMP085I2CDelay();
-    }
-    return(BMP085_RecvACK());
+	while(t--)
+	{
+		xSysCtlDelay(20000);
+	}
 }
 
 //*****************************************************************************
 //
-//! \brief Receive data byte on I2C BUS.
+//! \brief Read a block of registers in one transfer.
 //!
-//! \param ack Specifies the ACK type, 0->NACK, 1->ACK.
+//! \param ucReg Specifies the first register address.
+//! \param pucBuf Specifies where to store the data.
+//! \param ulLen Specifies how many bytes to read.
 //!
-//! \return result of the reading operation.
+//! \return None.
 //
 //*****************************************************************************
-unsigned char BMP085I2CRecvByte(unsigned char ack)
+static void BMP085ReadBuf(unsigned char ucReg, unsigned char *pucBuf,
+                          unsigned long ulLen)
 {
-    unsigned char i;
-    unsigned char dat = 0;
-
-    BMP085_SCL_CLR();
-    BMP085I2CDelay();
-    BMP085_SDA_DDR_IN();
-    xGPIOSPinWrite(BMP085_I2C_PIN_SDA,1);  //pull up,
-    for (i=0; i<8; i++)
-    {
-        dat <<= 1;
-        BMP085_SCL_SET();
-        BMP085I2CDelay();
-        if(xGPIOSPinRead(BMP085_I2C_PIN_SDA))
-        {
-        	dat++;
-        }
-        BMP085_SCL_CLR();
-        BMP085I2CDelay();
-    }
-    BMP085_SDA_DDR_OUT();
-    BMP085I2CSendACK(ack);
-
-    return dat;
+	//
+	//  Register address, then a repeated start to read.
+	//
+	BMP085I2C(MasterWriteRequestS1)(BMP085_I2C_BUS, BMP085_ADDR, ucReg, xfalse);
+	BMP085I2C(MasterReadBufS1)(BMP085_I2C_BUS, BMP085_ADDR, pucBuf, ulLen,
+	                           xtrue);
 }
 
-#endif
-
 //*****************************************************************************
 //
 //! \brief Read data from EEPROM.
@@ -268,62 +188,17 @@ unsigned char BMP085I2CRecvByte(unsigned char ack)
 //*****************************************************************************
 unsigned long BMP085ReadData(unsigned char ucReg, unsigned char ucDataLen)
 {
-	unsigned char tmp = 0;
+	unsigned char ucBuf[4];
 	unsigned long res = 0;
+	unsigned char i;
 
-#ifndef BMP085_USE_HARDWARE_I2C
-
-	BMP085I2CStart();
-	//  send slave address(write)
-	BMP085I2CSendByte(BMP085_ADDR << 1);
-	//  send register address
-	BMP085I2CSendByte(ucReg);
-	//  restart transmission
-	BMP085I2CStart();
-	//  send slave address(read)
-	BMP085I2CSendByte((BMP085_ADDR << 1)+1);
-	//  read data
-	while(ucDataLen-- >1)
-	{
-		res <<= 8;
-		res += BMP085I2CRecvByte(1);
-	}
-	res <<= 8;
-	res += BMP085I2CRecvByte(0);
-	BMP085I2CStop();
-#else
+	xASSERT((ucDataLen >= 1) && (ucDataLen <= 4));
 
-	//  send slave address(write) and register address and not end transmission
-	xI2CMasterWriteRequestS1(BMP085_I2C_PORT, BMP085_ADDR, ucReg, xfalse);
-
-	//  restart transmission, send slave address(read) and read a byte
-	if(ucDataLen > 1)
-	{
-		xI2CMasterReadS1(BMP085_I2C_PORT, BMP085_ADDR, &tmp, xfalse);
-		res = tmp;
-		//  continue reading
-		while((ucDataLen-1)&&(ucDataLen<5))
-		{
-			if(ucDataLen-1 != 1)
-			{
-				xI2CMasterReadS2(BMP085_I2C_PORT, &tmp, xfalse);
-			}
-			else
-			{
-				//  read over, end transmission
-				xI2CMasterReadS2(BMP085_I2C_PORT, &tmp, xtrue);
-			}
-			res <<= 8;
-			res += tmp;
-			ucDataLen--;
-		}
-	}
-	else
+	BMP085ReadBuf(ucReg, ucBuf, ucDataLen);
+	for(i = 0; i < ucDataLen; i++)
 	{
-		xI2CMasterReadS1(BMP085_I2C_PORT, BMP085_ADDR, &tmp, xtrue);
-		res = tmp;
+		res = (res << 8) | ucBuf[i];
 	}
-#endif
 	return res;
 }
 
@@ -339,16 +214,8 @@ unsigned long BMP085ReadData(unsigned char ucReg, unsigned char ucDataLen)
 //*****************************************************************************
 void BMP085WriteData(unsigned char ucReg, unsigned char ucData)
 {
-#ifndef BMP085_USE_HARDWARE_I2C
-	BMP085I2CStart();
-	BMP085I2CSendByte(BMP085_ADDR << 1);
-	BMP085I2CSendByte(ucReg);
-	BMP085I2CSendByte(ucData);
-	BMP085I2CStop();
-#else
-	xI2CMasterWriteRequestS1(BMP085_I2C_PORT, BMP085_ADDR, ucReg, xfalse);
-	xI2CMasterWriteRequestS2(BMP085_I2C_PORT, ucData, xtrue);
-#endif
+	BMP085I2C(MasterWriteRequestS1)(BMP085_I2C_BUS, BMP085_ADDR, ucReg, xfalse);
+	BMP085I2C(MasterWriteRequestS2)(BMP085_I2C_BUS, ucData, xtrue);
 }
 
 //*****************************************************************************
@@ -374,10 +241,12 @@ static void BMP085I2CInit(unsigned long ulBitRate)
     I2CMasterInit(BMP085_I2C_PORT, xSysCtlClockGet()/2, xfalse, xtrue);
     xI2CMasterEnable(BMP085_I2C_PORT);
 #else
-    xGPIOSDirModeSet(BMP085_I2C_PIN_SCL, xGPIO_DIR_MODE_OD);
-    xGPIOSDirModeSet(BMP085_I2C_PIN_SDA, xGPIO_DIR_MODE_OD);
-    xGPIOSPinWrite(BMP085_I2C_PIN_SDA,1);
-    xGPIOSPinWrite(BMP085_I2C_PIN_SCL,1);
+    SoftI2CBusInit(&sBMP085I2C,
+                   xGPIOSPinToPort(BMP085_I2C_PIN_SCL),
+                   xGPIOSPinToPin(BMP085_I2C_PIN_SCL),
+                   xGPIOSPinToPort(BMP085_I2C_PIN_SDA),
+                   xGPIOSPinToPin(BMP085_I2C_PIN_SDA));
+    SoftI2CMasterInit(BMP085_I2C_BUS, ulBitRate);
 #endif
 }
 
@@ -393,26 +262,124 @@ static void BMP085I2CInit(unsigned long ulBitRate)
 unsigned long BMP085Init(unsigned long ulBitRate)
 {
 	unsigned long ulBmpId;
+	unsigned char ucEeprom[22];
+
 	BMP085I2CInit(ulBitRate);
 	ulBmpId = BMP085ReadData(BMP085_REG_ID, 1);
 	if(ulBmpId != BMP085_ID)
 	{
 		return 1;
 	}
-	BMP085CalibData.ac1 = BMP085ReadData(BMP085_REG_AC1, 2);
-	BMP085CalibData.ac2 = BMP085ReadData(BMP085_REG_AC2, 2);
-	BMP085CalibData.ac3 = BMP085ReadData(BMP085_REG_AC3, 2);
-	BMP085CalibData.ac4 = BMP085ReadData(BMP085_REG_AC4, 2);
-	BMP085CalibData.ac5 = BMP085ReadData(BMP085_REG_AC5, 2);
-	BMP085CalibData.ac6 = BMP085ReadData(BMP085_REG_AC6, 2);
-	BMP085CalibData.b1  = BMP085ReadData(BMP085_REG_B1 , 2);
-	BMP085CalibData.b2  = BMP085ReadData(BMP085_REG_B2 , 2);
-	BMP085CalibData.mb  = BMP085ReadData(BMP085_REG_MB , 2);
-	BMP085CalibData.mc  = BMP085ReadData(BMP085_REG_MC , 2);
-	BMP085CalibData.md  = BMP085ReadData(BMP085_REG_MD , 2);
+
+	//
+	//  The 11 coefficients are read in one transfer, MSB first.
+	//
+	BMP085ReadBuf(BMP085_REG_AC1, ucEeprom, sizeof(ucEeprom));
+	BMP085CalibData.ac1 = (short)((ucEeprom[0] << 8) | ucEeprom[1]);
+	BMP085CalibData.ac2 = (short)((ucEeprom[2] << 8) | ucEeprom[3]);
+	BMP085CalibData.ac3 = (short)((ucEeprom[4] << 8) | ucEeprom[5]);
+	BMP085CalibData.ac4 = (unsigned short)((ucEeprom[6] << 8) | ucEeprom[7]);
+	BMP085CalibData.ac5 = (unsigned short)((ucEeprom[8] << 8) | ucEeprom[9]);
+	BMP085CalibData.ac6 = (unsigned short)((ucEeprom[10] << 8) | ucEeprom[11]);
+	BMP085CalibData.b1  = (short)((ucEeprom[12] << 8) | ucEeprom[13]);
+	BMP085CalibData.b2  = (short)((ucEeprom[14] << 8) | ucEeprom[15]);
+	BMP085CalibData.mb  = (short)((ucEeprom[16] << 8) | ucEeprom[17]);
+	BMP085CalibData.mc  = (short)((ucEeprom[18] << 8) | ucEeprom[19]);
+	BMP085CalibData.md  = (short)((ucEeprom[20] << 8) | ucEeprom[21]);
 	return 0;
 }
 
+//*****************************************************************************
+//
+//! \brief Compensate a temperature conversion.
+//!
+//! \param lUT Specifies the uncompensated temperature.
+//!
+//! The function updates the temperature and the terms of the pressure
+//! compensation that only depend on it, so the pressure conversions until the
+//! next temperature conversion take only the pressure terms.
+//!
+//! \return None.
+//
+//*****************************************************************************
+static void BMP085CompTemperature(long lUT)
+{
+	long x1,x2,x3,b5,b6;
+
+	x1 = ((lUT - (long)BMP085CalibData.ac6)*(long)BMP085CalibData.ac5) >> 15;
+	x2 = ((long)BMP085CalibData.mc << 11) / (x1 + BMP085CalibData.md);
+	b5 = x1 + x2;
+	BMP085TempComp.lTemp = (b5 + 8) >> 4;
+
+	b6 = b5 - 4000;
+	// B3 before the over-sample shift
+	x1 = (BMP085CalibData.b2 * (b6 * b6)>>12)>>11;
+	x2 = (BMP085CalibData.ac2 * b6)>>11;
+	x3 = x1 + x2;
+	BMP085TempComp.lB3 = ((long)BMP085CalibData.ac1)*4 + x3;
+
+	// Calculate B4
+	x1 = (BMP085CalibData.ac3 * b6)>>13;
+	x2 = (BMP085CalibData.b1 * ((b6 * b6)>>12))>>16;
+	x3 = ((x1 + x2) + 2)>>2;
+	BMP085TempComp.ulB4 = (BMP085CalibData.ac4 *
+	                       (unsigned long)(x3 + 32768))>>15;
+}
+
+//*****************************************************************************
+//
+//! \brief Compensate a pressure conversion.
+//!
+//! \param lUP Specifies the uncompensated pressure.
+//! \param oss Specifies the over-sample rate of the conversion.
+//!
+//! BMP085CompTemperature() must have been called before.
+//!
+//! \return pressure in Pa.
+//
+//*****************************************************************************
+static long BMP085CompPressure(long lUP, unsigned char oss)
+{
+	long x1,x2,b3,p;
+	unsigned long b4,b7;
+
+	b3 = ((BMP085TempComp.lB3<<oss) + 2)>>2;
+	b4 = BMP085TempComp.ulB4;
+
+	b7 = ((unsigned long)(lUP - b3) * (50000>>oss));
+	if (b7 < 0x80000000)
+	{
+		p = (b7<<1)/b4;
+	}
+	else
+	{
+		p = (b7/b4)<<1;
+	}
+
+	x1 = (p>>8) * (p>>8);
+	x1 = (x1 * 3038)>>16;
+	x2 = (-7357 * p)>>16;
+	return p+((x1 + x2 + 3791)>>4);
+}
+
+//*****************************************************************************
+//
+//! \brief Read a pressure conversion.
+//!
+//! \param oss Specifies the over-sample rate of the conversion.
+//!
+//! \return uncompensated pressure.
+//
+//*****************************************************************************
+static long BMP085ReadPressure(unsigned char oss)
+{
+	if(oss==0)
+	{
+		return BMP085ReadData(BMP085_REG_READ, 2);
+	}
+	return BMP085ReadData(BMP085_REG_READ, 3) >> (8-oss);
+}
+
 //*****************************************************************************
 //
 //! \brief Get temperature.
@@ -428,19 +395,12 @@ unsigned long BMP085Init(unsigned long ulBitRate)
 //*****************************************************************************
 long BMP085GetTemperature(void)
 {
-	long temp;
-	long x1,x2,b5;
-
 	BMP085WriteData(BMP085_REG_PRES_OS3, BMP085_REG_TEMP);
 
 	//  At least 4.5ms delay is needed
 	BMP085DelayMs(5);
-	temp = BMP085ReadData(BMP085_REG_READ, 2);
-	x1 = (((long)temp - (long)BMP085CalibData.ac6)*(long)BMP085CalibData.ac5) >> 15;
-	x2 = ((long)BMP085CalibData.mc << 11) / (x1 + BMP085CalibData.md);
-	b5 = x1 + x2;
-	temp = ((b5 + 8) >> 4);
-	return temp;
+	BMP085CompTemperature(BMP085ReadData(BMP085_REG_READ, 2));
+	return BMP085TempComp.lTemp;
 }
 
 //*****************************************************************************
@@ -459,10 +419,6 @@ long BMP085GetTemperature(void)
 //*****************************************************************************
 long BMP085GetPressure(unsigned char oss)
 {
-	long temp;
-	long x1,x2,x3,b3,b5,b6,p;
-	unsigned long b4,b7;
-
 	oss = oss>3 ? 3:oss;
 
 	//
@@ -472,10 +428,7 @@ long BMP085GetPressure(unsigned char oss)
 
 	//  At least 4.5ms delay is needed
 	BMP085DelayMs(5);
-	temp = BMP085ReadData(BMP085_REG_READ, 2);
-	x1 = (((long)temp - (long)BMP085CalibData.ac6)*(long)BMP085CalibData.ac5) >> 15;
-	x2 = ((long)BMP085CalibData.mc << 11) / (x1 + BMP085CalibData.md);
-	b5 = x1 + x2;
+	BMP085CompTemperature(BMP085ReadData(BMP085_REG_READ, 2));
 
 	//
 	// Read uncompensated pressure value
@@ -485,69 +438,251 @@ long BMP085GetPressure(unsigned char oss)
 	//  This delay is important, the bigger oss is, the longer delay need.
 	//  If delay is not enough, the read out data maybe error.
 	BMP085DelayMs(2+((unsigned long)3<<oss));
-	if(oss==0)
+	return BMP085CompPressure(BMP085ReadPressure(oss), oss);
+}
+
+//*****************************************************************************
+//
+//! \brief Get altitude.
+//!
+//! \param None.
+//!
+//! The function will return the altitude according to the barometric pressure,
+//! taking the standard 101325 Pa as the sea level pressure. The weather moves
+//! it by some 10 m, so it can only be used as a reference.
+//!
+//! \return altitude in m.
+//
+//*****************************************************************************
+long BMP085GetAltitude(void)
+{
+	long Altitude;
+
+	Altitude = BMP085CalcAltitude(BMP085GetPressure(BMP085_OSS_0), 101325);
+
+	return (Altitude + (Altitude < 0 ? -5 : 5)) / 10;
+}
+
+//*****************************************************************************
+//
+//! \brief Compute the altitude of a pressure.
+//!
+//! \param lPressure Specifies the pressure in Pa.
+//! \param lSeaLevel Specifies the sea level pressure in Pa.
+//!
+//! The function uses the international barometric formula through a table
+//! at 101325 Pa, the pressure is scaled to it first. Pressures out of
+//! 30 kPa ~ 110 kPa are clamped.
+//!
+//! \return altitude in 0.1 m.
+//
+//*****************************************************************************
+long BMP085CalcAltitude(long lPressure, long lSeaLevel)
+{
+	unsigned long i, ulFrac;
+
+	xASSERT((lSeaLevel > 90000) && (lSeaLevel < 110000));
+
+	//
+	// p * 101325 / p0 without overflow, the difference is small.
+	//
+	lPressure += (lPressure / 2) * (101325 - lSeaLevel) / (lSeaLevel / 2);
+	lPressure -= BMP085_ALT_TAB_MIN;
+	if(lPressure < 0)
 	{
-		temp = BMP085ReadData(BMP085_REG_READ, 2);
+		return lAltTab[0];
 	}
-	else
+	i = (unsigned long)lPressure >> 10;
+	if(i >= BMP085_ALT_TAB_LEN - 1)
 	{
-		temp = BMP085ReadData(BMP085_REG_READ, 3);
-		temp >>= (8-oss);
+		return lAltTab[BMP085_ALT_TAB_LEN - 1];
 	}
+	ulFrac = (unsigned long)lPressure & 1023;
 
-	b6 = b5 - 4000;
-	// Calculate B3
-	x1 = (BMP085CalibData.b2 * (b6 * b6)>>12)>>11;
-	x2 = (BMP085CalibData.ac2 * b6)>>11;
-	x3 = x1 + x2;
-	b3 = (((((long)BMP085CalibData.ac1)*4 + x3)<<oss) + 2)>>2;
-
-	// Calculate B4
-	x1 = (BMP085CalibData.ac3 * b6)>>13;
-	x2 = (BMP085CalibData.b1 * ((b6 * b6)>>12))>>16;
-	x3 = ((x1 + x2) + 2)>>2;
-	b4 = (BMP085CalibData.ac4 * (unsigned long)(x3 + 32768))>>15;
+	return lAltTab[i] - (((lAltTab[i] - lAltTab[i + 1]) * (long)ulFrac) >> 10);
+}
 
-	b7 = ((unsigned long)(temp - b3) * (50000>>oss));
-	if (b7 < 0x80000000)
+//*****************************************************************************
+//
+//! \brief Start a conversion of the measurement.
+//!
+//! \param ucState Specifies BMP085_MEAS_TEMP or BMP085_MEAS_PRES.
+//!
+//! \return None.
+//
+//*****************************************************************************
+static void BMP085MeasureConvert(unsigned char ucState)
+{
+	if(ucState == BMP085_MEAS_TEMP)
 	{
-		p = (b7<<1)/b4;
+		BMP085WriteData(BMP085_REG_PRES_OS3, BMP085_REG_TEMP);
+		ulMeasWait = BMP085_TICKS(4500);
 	}
 	else
 	{
-		p = (b7/b4)<<1;
+		BMP085WriteData(BMP085_REG_PRES_OS3,
+		                BMP085_REG_PRES_OS0+(ucMeasOss<<6));
+		ulMeasWait = BMP085_TICKS(ulPresConvUs[ucMeasOss]);
 	}
+	ucMeasState = ucState;
+}
 
-	x1 = (p>>8) * (p>>8);
-	x1 = (x1 * 3038)>>16;
-	x2 = (-7357 * p)>>16;
-	temp = p+((x1 + x2 + 3791)>>4);
-	return temp;
+//*****************************************************************************
+//
+//! \brief BMP085 measurement timer callback function.
+//!
+//! \return 0.
+//
+//*****************************************************************************
+static unsigned long BMP085TimerHandler(void *pvCBData, unsigned long ulEvent,
+                                        unsigned long ulMsgParam,
+                                        void *pvMsgData)
+{
+	BMP085MeasureTick();
+	return 0;
 }
 
 //*****************************************************************************
 //
-//! \brief Get altitude.
+//! \brief Initialize the measurement timer.
 //!
 //! \param None.
 //!
-//! The function will return the altitude according to the barometric pressure.
-//! The result is not accurate enough, it can only be used as a reference.
+//! The function sets BMP085_TIMER to call BMP085MeasureTick() at
+//! BMP085_TICK_FREQ. The timer only runs while a measurement is going on.
 //!
-//! \return temperature.
+//! \return None.
 //
 //*****************************************************************************
-long BMP085GetAltitude(void)
+void BMP085TimerInit(void)
 {
-	//P0  sea level barometric pressure as the zero height pressure
-	long P0 = 101325;
-	long P = BMP085GetPressure(BMP085_OSS_0);
-	long Altitude;
+	xSysCtlPeripheralEnable2(BMP085_TIMER);
+	xTimerInitConfig(BMP085_TIMER, BMP085_TIMER_CHANNEL,
+	                 xTIMER_MODE_PERIODIC, BMP085_TICK_FREQ);
+	xTimerIntEnable(BMP085_TIMER, BMP085_TIMER_CHANNEL, xTIMER_INT_MATCH);
+	xTimerIntCallbackInit(BMP085_TIMER, BMP085TimerHandler);
+	xIntEnable(BMP085_TIMER_INT);
+}
 
-	Altitude = (P0-P)*83/1000;
+//*****************************************************************************
+//
+//! \brief Start a non-blocking measurement.
+//!
+//! \param oss Specifies the over-sample rate(BMP085_OSS_0 ~ BMP085_OSS_3).
+//! \param bContinuous Specifies whether to go on measuring.
+//!
+//! The function starts a temperature conversion and returns. The timer reads
+//! it when it is done and starts the pressure conversion, whose result is
+//! taken by BMP085GetMeasure(). In continuous mode the pressure is converted
+//! again right away and the temperature every BMP085_TEMP_PERIOD pressures,
+//! so with BMP085_OSS_0 more than 128 results a second are given.
+//! \note The blocking functions must not be used while measuring.
+//!
+//! \return None.
+//
+//*****************************************************************************
+void BMP085StartMeasure(unsigned char oss, xtBoolean bContinuous)
+{
+	BMP085StopMeasure();
+
+	ucMeasOss = oss>3 ? 3:oss;
+	bMeasContinuous = bContinuous;
+	ulMeasCount = 0;
+	bMeasNew = xfalse;
+	BMP085MeasureConvert(BMP085_MEAS_TEMP);
+	xTimerStart(BMP085_TIMER, BMP085_TIMER_CHANNEL);
+}
 
-	return Altitude;
+//*****************************************************************************
+//
+//! \brief Stop the non-blocking measurement.
+//!
+//! \param None.
+//!
+//! \return None.
+//
+//*****************************************************************************
+void BMP085StopMeasure(void)
+{
+	xTimerStop(BMP085_TIMER, BMP085_TIMER_CHANNEL);
+	ucMeasState = BMP085_MEAS_IDLE;
 }
 
+//*****************************************************************************
+//
+//! \brief Get the result of the non-blocking measurement.
+//!
+//! \param plTemperature Specifies where to store the temperature in 0.1
+//! Celsius degree, can be 0.
+//! \param plPressure Specifies where to store the pressure in Pa.
+//!
+//! \return xtrue if a new result was stored, xfalse if there is none since
+//! the last call.
+//
+//*****************************************************************************
+xtBoolean BMP085GetMeasure(long *plTemperature, long *plPressure)
+{
+	xASSERT(plPressure != 0);
+
+	if(!bMeasNew)
+	{
+		return xfalse;
+	}
+
+	xIntDisable(BMP085_TIMER_INT);
+	if(plTemperature != 0)
+	{
+		*plTemperature = lMeasTemp;
+	}
+	*plPressure = lMeasPres;
+	bMeasNew = xfalse;
+	xIntEnable(BMP085_TIMER_INT);
 
+	return xtrue;
+}
 
+//*****************************************************************************
+//
+//! \brief Run the measurement for one timer tick.
+//!
+//! \param None.
+//!
+//! The function is called from the timer set by BMP085TimerInit(). When the
+//! wait of a conversion is over it reads the result and starts the next one,
+//! the other ticks only count down.
+//!
+//! \return None.
+//
+//*****************************************************************************
+void BMP085MeasureTick(void)
+{
+	if((ucMeasState == BMP085_MEAS_IDLE) || (--ulMeasWait != 0))
+	{
+		return;
+	}
+
+	if(ucMeasState == BMP085_MEAS_TEMP)
+	{
+		BMP085CompTemperature(BMP085ReadData(BMP085_REG_READ, 2));
+		BMP085MeasureConvert(BMP085_MEAS_PRES);
+		return;
+	}
+
+	lMeasPres = BMP085CompPressure(BMP085ReadPressure(ucMeasOss), ucMeasOss);
+	lMeasTemp = BMP085TempComp.lTemp;
+	bMeasNew = xtrue;
+
+	if(!bMeasContinuous)
+	{
+		BMP085StopMeasure();
+	}
+	else if(++ulMeasCount >= BMP085_TEMP_PERIOD)
+	{
+		ulMeasCount = 0;
+		BMP085MeasureConvert(BMP085_MEAS_TEMP);
+	}
+	else
+	{
+		BMP085MeasureConvert(BMP085_MEAS_PRES);
+	}
+}
@@ -138,7 +138,8 @@ extern "C"
 //*****************************************************************************
 
 //! Define this macro to enable hardware I2C or the driver will use software I2C
-//! (GPIO simulation). If you don't use hardware I2C disable this define
+//! (SoftI2C on the pins below). If you don't use hardware I2C disable this
+//! define
 #define BMP085_USE_HARDWARE_I2C
 
 //! I2C pins define
@@ -150,6 +151,21 @@ extern "C"
 #define BMP085_I2C_SDA                 I2C1SDA
 #define BMP085_I2C_PORT                I2C1_BASE
 #endif
+
+//! Timer that paces BMP085StartMeasure(), and its channel and interrupt.
+//! Don't share it with another driver's xTimerInitConfig(), e.g.
+//! SEVEN_SEGMENT_TIMER, the last one takes the timer and its callback.
+#define BMP085_TIMER                   xTIMER3_BASE
+#define BMP085_TIMER_CHANNEL           xTIMER_CHANNEL0
+#define BMP085_TIMER_INT               xINT_TIMER3
+
+//! Tick frequency of the measurement timer in Hz. The conversion waits are
+//! rounded up to whole ticks.
+#define BMP085_TICK_FREQ               2000
+
+//! In continuous mode the temperature is converted again after this many
+//! pressure conversions, about once a second at 128 Hz.
+#define BMP085_TEMP_PERIOD             128
 //*****************************************************************************
 //
 //! @}
@@ -202,6 +218,20 @@ extern long BMP085GetTemperature(void);
 //
 extern long BMP085GetPressure(unsigned char oss);
 extern long BMP085GetAltitude(void);
+
+//
+//! Altitude in 0.1 m of a pressure, lSeaLevel is the sea level pressure in Pa
+//
+extern long BMP085CalcAltitude(long lPressure, long lSeaLevel);
+
+//
+//! Non-blocking measurement, paced by BMP085_TIMER
+//
+extern void BMP085TimerInit(void);
+extern void BMP085StartMeasure(unsigned char oss, xtBoolean bContinuous);
+extern void BMP085StopMeasure(void);
+extern xtBoolean BMP085GetMeasure(long *plTemperature, long *plPressure);
+extern void BMP085MeasureTick(void);
 //*****************************************************************************
 //
 //! @}
@@ -26,6 +26,7 @@
 //! <h2>Test Cases</h2>
 //! The module contain those sub tests:<br><br>
 //! - \subpage test_BMP085_Function
+//! - \subpage test_BMP085_Measure
 //! .
 //! \file BMP085Test.c
 //! \brief BMP085 test source file
@@ -101,6 +102,75 @@ static void BMP085Execute(void)
     TestAssert((altitude > -100)&&(altitude < 5000), "BMP085 API \"BMP085GetAltitude()\" Error!");
 }
 
+//*****************************************************************************
+//
+//! \brief Get the Test description of BMP085 Measure test.
+//!
+//! \return the desccription of the BMP085 test.
+//
+//*****************************************************************************
+static char* BMP085MeasureGetTest(void)
+{
+
+    return "BMP085 Measure test";
+}
+
+//*****************************************************************************
+//
+//! \brief BMP085 non-blocking measure test execute main body.
+//!
+//! \return None.
+//
+//*****************************************************************************
+static void BMP085MeasureExecute(void)
+{
+    long temperature, pressure, blocking;
+    unsigned long i, count;
+
+    //
+    //  The table follows the barometric formula, 1000.1 m at 89875 Pa.
+    //
+    TestAssert((BMP085CalcAltitude(101325, 101325) >= -1) &&
+               (BMP085CalcAltitude(101325, 101325) <= 1) &&
+               (BMP085CalcAltitude(89875, 101325) >= 9999) &&
+               (BMP085CalcAltitude(89875, 101325) <= 10003) &&
+               (BMP085CalcAltitude(100000, 100000) >= -1) &&
+               (BMP085CalcAltitude(100000, 100000) <= 1),
+               "BMP085 API \"BMP085CalcAltitude()\" Error!");
+
+    //
+    //  A single measurement agrees with the blocking one.
+    //
+    blocking = BMP085GetPressure(BMP085_OSS_3);
+    BMP085TimerInit();
+    BMP085StartMeasure(BMP085_OSS_3, xfalse);
+    for(i = 0; (i < 1000000) && !BMP085GetMeasure(&temperature, &pressure); i++);
+    TestAssert((i < 1000000) && (temperature > -10) && (temperature < 500) &&
+               (pressure > blocking - 100) && (pressure < blocking + 100),
+               "BMP085 API \"BMP085GetMeasure()\" Error!");
+
+    //
+    //  Continuous measurement keeps giving results until stopped.
+    //
+    BMP085StartMeasure(BMP085_OSS_0, xtrue);
+    for(i = 0, count = 0; (i < 5000000) && (count < 300); i++)
+    {
+        if(BMP085GetMeasure(0, &pressure))
+        {
+            count++;
+        }
+    }
+    BMP085StopMeasure();
+    TestAssert((count == 300) && (pressure > 90000) && (pressure < 120000),
+               "BMP085 API \"BMP085StartMeasure()\" Error!");
+    for(i = 0; i < 100000; i++)
+    {
+        BMP085MeasureTick();
+    }
+    TestAssert(!BMP085GetMeasure(0, &pressure),
+               "BMP085 API \"BMP085StopMeasure()\" Error!");
+}
+
 //
 // BMP085 Function test case struct.
 //
@@ -111,12 +181,23 @@ const tTestCase sTestBMP085Function = {
     BMP085Execute
 };
 
+//
+// BMP085 Measure test case struct.
+//
+const tTestCase sTestBMP085Measure = {
+    BMP085MeasureGetTest,
+    BMP085Setup,
+    BMP085TearDown,
+    BMP085MeasureExecute
+};
+
 //
 // BMP085 test suits.
 //
 const tTestCase * const psPatternBMP085Test[] =
 {
     &sTestBMP085Function,
+    &sTestBMP085Measure,
     0
 };
 
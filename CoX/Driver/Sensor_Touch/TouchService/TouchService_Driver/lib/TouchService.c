@@ -0,0 +1,461 @@
+//*****************************************************************************
+//
+//! \file TouchService.c
+//! \brief Touch sampling service with median and IIR filtering.
+//! \version V2.2.1.0
+//! \date 10/19/2026
+//! \author CooCox
+//! \copy
+//!
+//! Copyright (c)  2013, CooCox
+//! All rights reserved.
+//!
+//! Redistribution and use in source and binary forms, with or without
+//! modification, are permitted provided that the following conditions
+//! are met:
+//!
+//!     * Redistributions of source code must retain the above copyright
+//! notice, this list of conditions and the following disclaimer.
+//!     * Redistributions in binary form must reproduce the above copyright
+//! notice, this list of conditions and the following disclaimer in the
+//! documentation and/or other materials provided with the distribution.
+//!     * Neither the name of the <ORGANIZATION> nor the names of its
+//! contributors may be used to endorse or promote products derived
+//! from this software without specific prior written permission.
+//!
+//! THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+//! AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+//! IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+//! ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+//! LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+//! CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+//! SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+//! INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//! CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+//! ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+//! THE POSSIBILITY OF SUCH DAMAGE.
+//
+//*****************************************************************************
+
+#include "xhw_types.h"
+#include "xdebug.h"
+#include "TouchService.h"
+
+//
+// Service states.
+//
+#define TOUCH_STATE_UP             0
+#define TOUCH_STATE_SETTLE         1
+#define TOUCH_STATE_PRESSED        2
+
+//
+// Fraction bits kept in the IIR state.
+//
+#define TOUCH_FILT_SHIFT           4
+
+//*****************************************************************************
+//
+//! \brief Median of the raw sample ring.
+//!
+//! \param pusRing is the ring of TOUCH_SERVICE_MEDIAN_LEN samples.
+//!
+//! \return the median.
+//
+//*****************************************************************************
+static unsigned short
+TouchServiceMedian(const unsigned short *pusRing)
+{
+    unsigned short usSort[TOUCH_SERVICE_MEDIAN_LEN];
+    unsigned short usTmp;
+    unsigned long i, j;
+
+    for(i = 0; i < TOUCH_SERVICE_MEDIAN_LEN; i++)
+    {
+        usTmp = pusRing[i];
+        for(j = i; (j > 0) && (usSort[j - 1] > usTmp); j--)
+        {
+            usSort[j] = usSort[j - 1];
+        }
+        usSort[j] = usTmp;
+    }
+
+    return usSort[TOUCH_SERVICE_MEDIAN_LEN / 2];
+}
+
+//*****************************************************************************
+//
+//! \brief Move the IIR state towards a new median.
+//!
+//! \return the new state.
+//
+//*****************************************************************************
+static unsigned long
+TouchServiceIIR(unsigned long ulFilt, unsigned short usMedian)
+{
+    long lDiff = ((long)usMedian << TOUCH_FILT_SHIFT) - (long)ulFilt;
+
+    return ulFilt + lDiff / (1L << TOUCH_SERVICE_IIR_SHIFT);
+}
+
+//*****************************************************************************
+//
+//! \brief Apply one row of the calibration matrix.
+//!
+//! \return the screen coordinate, clamped to [0, usSize).
+//
+//*****************************************************************************
+static unsigned short
+TouchServiceMap(long lA, long lB, long lC, unsigned long ulFiltX,
+                unsigned long ulFiltY, unsigned short usSize)
+{
+    long lVal;
+
+    //
+    // Drop the IIR fraction bits with rounding, then 16.16 multiply.
+    //
+    ulFiltX = (ulFiltX + (1 << (TOUCH_FILT_SHIFT - 1))) >> TOUCH_FILT_SHIFT;
+    ulFiltY = (ulFiltY + (1 << (TOUCH_FILT_SHIFT - 1))) >> TOUCH_FILT_SHIFT;
+    lVal = lA * (long)ulFiltX + lB * (long)ulFiltY + lC;
+
+    if(lVal < 0)
+    {
+        return 0;
+    }
+    lVal = (lVal + 0x8000) >> 16;
+
+    return (lVal >= usSize) ? (usSize - 1) : (unsigned short)lVal;
+}
+
+//*****************************************************************************
+//
+//! \brief Signed division with a 16.16 result, without 64-bit math.
+//!
+//! \return xfalse if the quotient is 4 or more.
+//
+//*****************************************************************************
+static xtBoolean
+TouchServiceFixedDiv(long lNum, long lDen, long *plQuot)
+{
+    unsigned long ulNum = (lNum < 0) ? -lNum : lNum;
+    unsigned long ulDen = (lDen < 0) ? -lDen : lDen;
+    unsigned long ulQuot = ulNum / ulDen;
+    unsigned long ulRem = ulNum % ulDen;
+    unsigned long i;
+
+    if(ulQuot >= 4)
+    {
+        return xfalse;
+    }
+
+    for(i = 0; i < 16; i++)
+    {
+        ulQuot <<= 1;
+        ulRem <<= 1;
+        if(ulRem >= ulDen)
+        {
+            ulQuot |= 1;
+            ulRem -= ulDen;
+        }
+    }
+
+    *plQuot = ((lNum < 0) != (lDen < 0)) ? -(long)ulQuot : (long)ulQuot;
+    return xtrue;
+}
+
+//*****************************************************************************
+//
+//! \brief Queue an event, dropped when the queue is full.
+//!
+//! \return None.
+//
+//*****************************************************************************
+static void
+TouchServiceEventPut(tTouchService *psService, unsigned char ucType)
+{
+    unsigned long ulHead = psService->ulHead;
+    unsigned long ulNext = (ulHead + 1) & (TOUCH_SERVICE_QUEUE_SIZE - 1);
+
+    if(ulNext == psService->ulTail)
+    {
+        psService->ulDropped++;
+        return;
+    }
+
+    psService->sQueue[ulHead].ucType = ucType;
+    psService->sQueue[ulHead].usX = psService->usLastX;
+    psService->sQueue[ulHead].usY = psService->usLastY;
+    psService->ulHead = ulNext;
+}
+
+//*****************************************************************************
+//
+//! \brief Initialize a touch service.
+//!
+//! \param psService is the service state.
+//! \param usWidth is the screen width in pixels.
+//! \param usHeight is the screen height in pixels.
+//!
+//! Until TouchServiceCalibrate() is called, the 12-bit raw range is mapped
+//! onto the whole screen.
+//!
+//! \return None.
+//
+//*****************************************************************************
+void
+TouchServiceInit(tTouchService *psService, unsigned short usWidth,
+                 unsigned short usHeight)
+{
+    xASSERT(psService != 0);
+    xASSERT((usWidth != 0) && (usHeight != 0));
+
+    psService->usWidth = usWidth;
+    psService->usHeight = usHeight;
+
+    psService->sCalib.lA = (long)usWidth << 4;
+    psService->sCalib.lB = 0;
+    psService->sCalib.lC = 0;
+    psService->sCalib.lD = 0;
+    psService->sCalib.lE = (long)usHeight << 4;
+    psService->sCalib.lF = 0;
+
+    psService->ucRawCnt = 0;
+    psService->ucRawPos = 0;
+    psService->ucState = TOUCH_STATE_UP;
+    psService->ulHead = 0;
+    psService->ulTail = 0;
+    psService->ulDropped = 0;
+}
+
+//*****************************************************************************
+//
+//! \brief Compute the calibration matrix from three touched points.
+//!
+//! \param psService is the service state.
+//! \param pusRaw is the raw x0, y0, x1, y1, x2, y2 read at the points.
+//! \param pusScreen is the screen x0, y0, x1, y1, x2, y2 of the points.
+//!
+//! The points must not be on one line. Rotation, mirroring and a swapped
+//! panel are handled by the matrix. For a panel calibrated by its edges,
+//! e.g. by ADS7843Calibration(), pass three corners.
+//!
+//! \return xfalse if the points give no usable matrix, the old one is kept.
+//
+//*****************************************************************************
+xtBoolean
+TouchServiceCalibrate(tTouchService *psService, const unsigned short *pusRaw,
+                      const unsigned short *pusScreen)
+{
+    tTouchCalib sCalib;
+    long lXr0, lXr1, lYr0, lYr1, lK;
+    long lS0, lS1;
+
+    xASSERT(psService != 0);
+    xASSERT((pusRaw != 0) && (pusScreen != 0));
+
+    //
+    // Points 0 and 1 relative to point 2.
+    //
+    lXr0 = (long)pusRaw[0] - pusRaw[4];
+    lYr0 = (long)pusRaw[1] - pusRaw[5];
+    lXr1 = (long)pusRaw[2] - pusRaw[4];
+    lYr1 = (long)pusRaw[3] - pusRaw[5];
+    lK = lXr0 * lYr1 - lXr1 * lYr0;
+    if(lK == 0)
+    {
+        return xfalse;
+    }
+
+    lS0 = (long)pusScreen[0] - pusScreen[4];
+    lS1 = (long)pusScreen[2] - pusScreen[4];
+    if(!TouchServiceFixedDiv(lS0 * lYr1 - lS1 * lYr0, lK, &sCalib.lA) ||
+       !TouchServiceFixedDiv(lXr0 * lS1 - lXr1 * lS0, lK, &sCalib.lB))
+    {
+        return xfalse;
+    }
+    sCalib.lC = ((long)pusScreen[4] << 16) - sCalib.lA * pusRaw[4] -
+                sCalib.lB * pusRaw[5];
+
+    lS0 = (long)pusScreen[1] - pusScreen[5];
+    lS1 = (long)pusScreen[3] - pusScreen[5];
+    if(!TouchServiceFixedDiv(lS0 * lYr1 - lS1 * lYr0, lK, &sCalib.lD) ||
+       !TouchServiceFixedDiv(lXr0 * lS1 - lXr1 * lS0, lK, &sCalib.lE))
+    {
+        return xfalse;
+    }
+    sCalib.lF = ((long)pusScreen[5] << 16) - sCalib.lD * pusRaw[4] -
+                sCalib.lE * pusRaw[5];
+
+    psService->sCalib = sCalib;
+    return xtrue;
+}
+
+//*****************************************************************************
+//
+//! \brief Tell the service that the pen went down.
+//!
+//! \param psService is the service state.
+//!
+//! Called from the pen interrupt. The down event is sent when the median has
+//! been filled with samples.
+//!
+//! \return None.
+//
+//*****************************************************************************
+void
+TouchServicePenDown(tTouchService *psService)
+{
+    xASSERT(psService != 0);
+
+    if(psService->ucState == TOUCH_STATE_UP)
+    {
+        psService->ucRawCnt = 0;
+        psService->ucRawPos = 0;
+        psService->ucState = TOUCH_STATE_SETTLE;
+    }
+}
+
+//*****************************************************************************
+//
+//! \brief Feed one raw sample.
+//!
+//! \param psService is the service state.
+//! \param usRawX is the raw x conversion.
+//! \param usRawY is the raw y conversion.
+//!
+//! Called from the sampling timer or FIFO interrupt while the pen is down.
+//! The cost is the same for every sample.
+//!
+//! \return None.
+//
+//*****************************************************************************
+void
+TouchServiceSamplePut(tTouchService *psService, unsigned short usRawX,
+                      unsigned short usRawY)
+{
+    unsigned short usX, usY;
+
+    xASSERT(psService != 0);
+
+    if(psService->ucState == TOUCH_STATE_UP)
+    {
+        return;
+    }
+
+    psService->usRawX[psService->ucRawPos] = usRawX;
+    psService->usRawY[psService->ucRawPos] = usRawY;
+    if(++psService->ucRawPos == TOUCH_SERVICE_MEDIAN_LEN)
+    {
+        psService->ucRawPos = 0;
+    }
+    if(psService->ucRawCnt < TOUCH_SERVICE_MEDIAN_LEN)
+    {
+        if(++psService->ucRawCnt < TOUCH_SERVICE_MEDIAN_LEN)
+        {
+            return;
+        }
+    }
+
+    usX = TouchServiceMedian(psService->usRawX);
+    usY = TouchServiceMedian(psService->usRawY);
+    if(psService->ucState == TOUCH_STATE_SETTLE)
+    {
+        psService->ulFiltX = (unsigned long)usX << TOUCH_FILT_SHIFT;
+        psService->ulFiltY = (unsigned long)usY << TOUCH_FILT_SHIFT;
+    }
+    else
+    {
+        psService->ulFiltX = TouchServiceIIR(psService->ulFiltX, usX);
+        psService->ulFiltY = TouchServiceIIR(psService->ulFiltY, usY);
+    }
+
+    usX = TouchServiceMap(psService->sCalib.lA, psService->sCalib.lB,
+                          psService->sCalib.lC, psService->ulFiltX,
+                          psService->ulFiltY, psService->usWidth);
+    usY = TouchServiceMap(psService->sCalib.lD, psService->sCalib.lE,
+                          psService->sCalib.lF, psService->ulFiltX,
+                          psService->ulFiltY, psService->usHeight);
+
+    if(psService->ucState == TOUCH_STATE_SETTLE)
+    {
+        psService->ucState = TOUCH_STATE_PRESSED;
+        psService->usLastX = usX;
+        psService->usLastY = usY;
+        TouchServiceEventPut(psService, TOUCH_EVENT_DOWN);
+    }
+    else if((usX >= psService->usLastX + TOUCH_SERVICE_MOVE_MIN) ||
+            (usX + TOUCH_SERVICE_MOVE_MIN <= psService->usLastX) ||
+            (usY >= psService->usLastY + TOUCH_SERVICE_MOVE_MIN) ||
+            (usY + TOUCH_SERVICE_MOVE_MIN <= psService->usLastY))
+    {
+        psService->usLastX = usX;
+        psService->usLastY = usY;
+        TouchServiceEventPut(psService, TOUCH_EVENT_MOVE);
+    }
+}
+
+//*****************************************************************************
+//
+//! \brief Tell the service that the pen went up.
+//!
+//! \param psService is the service state.
+//!
+//! \return None.
+//
+//*****************************************************************************
+void
+TouchServicePenUp(tTouchService *psService)
+{
+    xASSERT(psService != 0);
+
+    if(psService->ucState == TOUCH_STATE_PRESSED)
+    {
+        TouchServiceEventPut(psService, TOUCH_EVENT_UP);
+    }
+    psService->ucState = TOUCH_STATE_UP;
+}
+
+//*****************************************************************************
+//
+//! \brief Get the next touch event.
+//!
+//! \param psService is the service state.
+//! \param psEvent is where the event is copied.
+//!
+//! \return xtrue if an event was copied, xfalse if the queue is empty.
+//
+//*****************************************************************************
+xtBoolean
+TouchServiceEventGet(tTouchService *psService, tTouchEvent *psEvent)
+{
+    unsigned long ulTail;
+
+    xASSERT((psService != 0) && (psEvent != 0));
+
+    ulTail = psService->ulTail;
+    if(ulTail == psService->ulHead)
+    {
+        return xfalse;
+    }
+
+    *psEvent = psService->sQueue[ulTail];
+    psService->ulTail = (ulTail + 1) & (TOUCH_SERVICE_QUEUE_SIZE - 1);
+
+    return xtrue;
+}
+
+//*****************************************************************************
+//
+//! \brief Check whether the pen is down and a down event was sent.
+//!
+//! \param psService is the service state.
+//!
+//! \return xtrue while pressed.
+//
+//*****************************************************************************
+xtBoolean
+TouchServicePressed(tTouchService *psService)
+{
+    xASSERT(psService != 0);
+
+    return (psService->ucState == TOUCH_STATE_PRESSED) ? xtrue : xfalse;
+}
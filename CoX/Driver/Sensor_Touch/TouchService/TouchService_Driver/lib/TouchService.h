@@ -0,0 +1,249 @@
+//*****************************************************************************
+//
+//! \file TouchService.h
+//! \brief Prototypes for the interrupt driven touch sampling service.
+//! \version V2.2.1.0
+//! \date 10/19/2026
+//! \author CooCox
+//! \copy
+//!
+//! Copyright (c)  2013, CooCox
+//! All rights reserved.
+//!
+//! Redistribution and use in source and binary forms, with or without
+//! modification, are permitted provided that the following conditions
+//! are met:
+//!
+//!     * Redistributions of source code must retain the above copyright
+//! notice, this list of conditions and the following disclaimer.
+//!     * Redistributions in binary form must reproduce the above copyright
+//! notice, this list of conditions and the following disclaimer in the
+//! documentation and/or other materials provided with the distribution.
+//!     * Neither the name of the <ORGANIZATION> nor the names of its
+//! contributors may be used to endorse or promote products derived
+//! from this software without specific prior written permission.
+//!
+//! THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+//! AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+//! IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+//! ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+//! LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+//! CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+//! SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+//! INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//! CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+//! ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+//! THE POSSIBILITY OF SUCH DAMAGE.
+//
+//*****************************************************************************
+#ifndef __TOUCHSERVICE_H__
+#define __TOUCHSERVICE_H__
+
+//*****************************************************************************
+//
+// If building with a C++ compiler, make all of the definitions in this header
+// have a C binding.
+//
+//*****************************************************************************
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+//*****************************************************************************
+//
+//! \addtogroup CoX_Driver_Lib
+//! @{
+//
+//! \addtogroup Sensor
+//! @{
+//
+//! \addtogroup TouchService
+//! \brief The touch controller driver feeds raw X/Y samples from its pen
+//! interrupt and sampling timer (or its FIFO). Each sample goes through a
+//! running median and an IIR filter, both of fixed cost, and a 16.16
+//! calibration matrix. Down, move and up events are queued for the
+//! application, so nothing waits on the controller outside the interrupts.
+//! @{
+//
+//*****************************************************************************
+
+//*****************************************************************************
+//! \addtogroup TouchService_User_Config
+//! @{
+//
+//*****************************************************************************
+
+//
+//! Length of the running median, 3 or 5. The first event comes after this
+//! many samples.
+//
+#define TOUCH_SERVICE_MEDIAN_LEN   5
+
+//
+//! IIR filter weight, each output moves 1/2^n of the way to the new median.
+//! 0 turns the IIR off.
+//
+#define TOUCH_SERVICE_IIR_SHIFT    1
+
+//
+//! Move events are sent when the point moves this many pixels.
+//
+#define TOUCH_SERVICE_MOVE_MIN     1
+
+//
+//! Number of events the queue holds (must be a power of 2).
+//
+#define TOUCH_SERVICE_QUEUE_SIZE   8
+
+//*****************************************************************************
+//
+//! @}
+//
+//*****************************************************************************
+
+//*****************************************************************************
+//! \addtogroup TouchService_Event TouchService Event Type
+//! \brief Values of tTouchEvent.ucType.
+//! @{
+//
+//*****************************************************************************
+
+//
+//! The pen touched the screen.
+//
+#define TOUCH_EVENT_DOWN           1
+
+//
+//! The pen moved on the screen.
+//
+#define TOUCH_EVENT_MOVE           2
+
+//
+//! The pen left the screen, the point is the last one seen.
+//
+#define TOUCH_EVENT_UP             3
+
+//*****************************************************************************
+//
+//! @}
+//
+//*****************************************************************************
+
+//*****************************************************************************
+//! \addtogroup TouchService_Types
+//! @{
+//
+//*****************************************************************************
+
+//
+//! A touch event.
+//
+typedef struct
+{
+    unsigned char ucType;
+    unsigned short usX;
+    unsigned short usY;
+}
+tTouchEvent;
+
+//
+//! Calibration matrix in 16.16 fixed point.
+//! X = A * rawx + B * rawy + C, Y = D * rawx + E * rawy + F.
+//
+typedef struct
+{
+    long lA;
+    long lB;
+    long lC;
+    long lD;
+    long lE;
+    long lF;
+}
+tTouchCalib;
+
+//
+//! Service state, one per touch controller. The sample side is run from the
+//! controller interrupts and the event queue head is written only there, the
+//! tail only by TouchServiceEventGet(), so the queue needs no lock.
+//
+typedef struct
+{
+    tTouchCalib sCalib;
+    unsigned short usWidth;
+    unsigned short usHeight;
+
+    //
+    // Last raw samples for the running median.
+    //
+    unsigned short usRawX[TOUCH_SERVICE_MEDIAN_LEN];
+    unsigned short usRawY[TOUCH_SERVICE_MEDIAN_LEN];
+    unsigned char ucRawCnt;
+    unsigned char ucRawPos;
+
+    //
+    // IIR state, raw value with 4 fraction bits.
+    //
+    unsigned long ulFiltX;
+    unsigned long ulFiltY;
+
+    unsigned char ucState;
+    unsigned short usLastX;
+    unsigned short usLastY;
+
+    tTouchEvent sQueue[TOUCH_SERVICE_QUEUE_SIZE];
+    volatile unsigned long ulHead;
+    volatile unsigned long ulTail;
+    unsigned long ulDropped;
+}
+tTouchService;
+
+//*****************************************************************************
+//
+//! @}
+//
+//*****************************************************************************
+
+//*****************************************************************************
+//! \addtogroup TouchService_Export_APIs
+//! @{
+//
+//*****************************************************************************
+extern void TouchServiceInit(tTouchService *psService, unsigned short usWidth,
+                             unsigned short usHeight);
+extern xtBoolean TouchServiceCalibrate(tTouchService *psService,
+                                       const unsigned short *pusRaw,
+                                       const unsigned short *pusScreen);
+extern void TouchServicePenDown(tTouchService *psService);
+extern void TouchServiceSamplePut(tTouchService *psService,
+                                  unsigned short usRawX,
+                                  unsigned short usRawY);
+extern void TouchServicePenUp(tTouchService *psService);
+extern xtBoolean TouchServiceEventGet(tTouchService *psService,
+                                      tTouchEvent *psEvent);
+extern xtBoolean TouchServicePressed(tTouchService *psService);
+
+//*****************************************************************************
+//
+//! @}
+//
+//*****************************************************************************
+
+//*****************************************************************************
+//
+//! @}
+//! @}
+//! @}
+//
+//*****************************************************************************
+
+//*****************************************************************************
+//
+// Mark the end of the C bindings section for C++ compilers.
+//
+//*****************************************************************************
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,246 @@
+//*****************************************************************************
+//
+//! @page TouchService_testcase TouchService test
+//!
+//! File: @ref TouchService.c
+//!
+//! <h2>Description</h2>
+//! This module implements the test sequence for the touch sampling
+//! service.<br><br>
+//! - \p Board: STM32 <br><br>
+//! - \p Last-Time(about): 0.1s <br><br>
+//! - \p Phenomenon: Success or failure information will be printed on the UART. <br><br>
+//! .
+//!
+//! <h2>Preconditions</h2>
+//! The module requires the following options:<br><br>
+//! - \p Option-define:
+//! <br>(1)None.<br><br>
+//! - \p Option-hardware:
+//! <br>(1)None, the test feeds raw samples to the service itself.<br><br>
+//! - \p Option-OtherModule:
+//! <br>Connect an COM cable to the development board.<br>
+//! .
+//! In case some of the required options are not enabled then some or all tests
+//! may be skipped or result FAILED.<br>
+//!
+//! <h2>Test Cases</h2>
+//! The module contain those sub tests:<br><br>
+//! - \subpage test_TouchService_Filter
+//! .
+//! \file TouchService.c
+//! \brief TouchService test source file
+//! \file TouchService.h
+//! \brief TouchService test header file <br>
+//
+//*****************************************************************************
+
+#include "test.h"
+#include "TouchService.h"
+
+static tTouchService sTouch;
+
+//*****************************************************************************
+//
+//! \brief Feed the same raw sample some times.
+//!
+//! \return None.
+//
+//*****************************************************************************
+static void TouchServiceTestFeed(unsigned short usX, unsigned short usY,
+                                 unsigned long ulCount)
+{
+    while(ulCount--)
+    {
+        TouchServiceSamplePut(&sTouch, usX, usY);
+    }
+}
+
+//*****************************************************************************
+//
+//! \brief Drain the queue and keep the last event.
+//!
+//! \return the number of events.
+//
+//*****************************************************************************
+static unsigned long TouchServiceTestDrain(tTouchEvent *psLast)
+{
+    unsigned long ulCount = 0;
+
+    while(TouchServiceEventGet(&sTouch, psLast))
+    {
+        ulCount++;
+    }
+
+    return ulCount;
+}
+
+//*****************************************************************************
+//
+//! \brief Get the Test description of TouchService test.
+//!
+//! \return the desccription of the TouchService test.
+//
+//*****************************************************************************
+static char* TouchServiceGetTest(void)
+{
+    return "TouchService filter test";
+}
+
+//*****************************************************************************
+//
+//! \brief something should do before the test execute of TouchService test.
+//!
+//! \return None.
+//
+//*****************************************************************************
+static void TouchServiceSetup(void)
+{
+    TouchServiceInit(&sTouch, 320, 240);
+}
+
+//*****************************************************************************
+//
+//! \brief something should do after the test execute of TouchService test.
+//!
+//! \return None.
+//
+//*****************************************************************************
+static void TouchServiceTearDown(void)
+{
+
+}
+
+//*****************************************************************************
+//
+//! \brief TouchService test execute main body.
+//!
+//! \return None.
+//
+//*****************************************************************************
+static void TouchServiceExecute(void)
+{
+    tTouchEvent sEvent;
+    unsigned short usRaw[6], usScreen[6];
+    unsigned long i;
+
+    //
+    // Samples before the pen interrupt are ignored, the down event waits
+    // until the median is full.
+    //
+    TouchServiceTestFeed(100, 100, 10);
+    TouchServicePenDown(&sTouch);
+    TouchServiceTestFeed(2048, 2048, TOUCH_SERVICE_MEDIAN_LEN - 1);
+    TestAssert(!TouchServicePressed(&sTouch) &&
+               !TouchServiceEventGet(&sTouch, &sEvent),
+               "TouchService API \"TouchServiceSamplePut()\"error!");
+    TouchServiceTestFeed(2048, 2048, 1);
+    TestAssert(TouchServicePressed(&sTouch) &&
+               TouchServiceEventGet(&sTouch, &sEvent) &&
+               (sEvent.ucType == TOUCH_EVENT_DOWN) &&
+               (sEvent.usX == 160) && (sEvent.usY == 120),
+               "TouchService API \"TouchServiceSamplePut()\"error!");
+
+    //
+    // A single spike does not get through the median.
+    //
+    TouchServiceTestFeed(4000, 10, 1);
+    TouchServiceTestFeed(2048, 2048, 1);
+    TestAssert(!TouchServiceEventGet(&sTouch, &sEvent),
+               "TouchService API \"TouchServiceSamplePut()\"error!");
+
+    //
+    // A step is smoothed by the IIR and then settles on the new point.
+    //
+    TouchServiceTestFeed(1024, 3072, TOUCH_SERVICE_MEDIAN_LEN / 2 + 1);
+    TestAssert(TouchServiceEventGet(&sTouch, &sEvent) &&
+               (sEvent.ucType == TOUCH_EVENT_MOVE) &&
+               (sEvent.usX > 80) && (sEvent.usX < 160) &&
+               (sEvent.usY > 120) && (sEvent.usY < 180),
+               "TouchService API \"TouchServiceSamplePut()\"error!");
+    for(i = 0; i < 20; i++)
+    {
+        TouchServiceTestFeed(1024, 3072, 1);
+        TouchServiceTestDrain(&sEvent);
+    }
+    TestAssert((sEvent.ucType == TOUCH_EVENT_MOVE) &&
+               (sEvent.usX == 80) && (sEvent.usY == 180),
+               "TouchService API \"TouchServiceSamplePut()\"error!");
+
+    //
+    // The up event carries the last point.
+    //
+    TouchServicePenUp(&sTouch);
+    TestAssert(!TouchServicePressed(&sTouch) &&
+               (TouchServiceTestDrain(&sEvent) == 1) &&
+               (sEvent.ucType == TOUCH_EVENT_UP) &&
+               (sEvent.usX == 80) && (sEvent.usY == 180),
+               "TouchService API \"TouchServicePenUp()\"error!");
+
+    //
+    // Calibrate a panel mounted rotated: raw x falls with screen y and raw
+    // y rises with screen x, 12 counts a pixel.
+    //
+    usScreen[0] = 20;  usScreen[1] = 20;
+    usScreen[2] = 300; usScreen[3] = 120;
+    usScreen[4] = 160; usScreen[5] = 220;
+    for(i = 0; i < 3; i++)
+    {
+        usRaw[i * 2] = 4000 - usScreen[i * 2 + 1] * 12;
+        usRaw[i * 2 + 1] = 200 + usScreen[i * 2] * 12;
+    }
+    TestAssert(TouchServiceCalibrate(&sTouch, usRaw, usScreen),
+               "TouchService API \"TouchServiceCalibrate()\"error!");
+    TouchServicePenDown(&sTouch);
+    TouchServiceTestFeed(4000 - 50 * 12, 200 + 100 * 12,
+                         TOUCH_SERVICE_MEDIAN_LEN);
+    TestAssert((TouchServiceTestDrain(&sEvent) == 1) &&
+               (sEvent.ucType == TOUCH_EVENT_DOWN) &&
+               (sEvent.usX == 100) && (sEvent.usY == 50),
+               "TouchService API \"TouchServiceCalibrate()\"error!");
+    TouchServicePenUp(&sTouch);
+    TouchServiceTestDrain(&sEvent);
+
+    //
+    // Points on one line are refused.
+    //
+    usRaw[4] = (usRaw[0] + usRaw[2]) / 2;
+    usRaw[5] = (usRaw[1] + usRaw[3]) / 2;
+    TestAssert(!TouchServiceCalibrate(&sTouch, usRaw, usScreen),
+               "TouchService API \"TouchServiceCalibrate()\"error!");
+
+    //
+    // A full queue drops the new events and counts them.
+    //
+    TouchServicePenDown(&sTouch);
+    for(i = 0; i < 2 * TOUCH_SERVICE_QUEUE_SIZE; i++)
+    {
+        TouchServiceTestFeed(1000 + i * 100, 2000, TOUCH_SERVICE_MEDIAN_LEN);
+    }
+    TestAssert((sTouch.ulDropped > 0) &&
+               (TouchServiceTestDrain(&sEvent) ==
+                TOUCH_SERVICE_QUEUE_SIZE - 1),
+               "TouchService API \"TouchServiceEventGet()\"error!");
+    TouchServicePenUp(&sTouch);
+    TestAssert(TouchServiceTestDrain(&sEvent) == 1,
+               "TouchService API \"TouchServicePenUp()\"error!");
+}
+
+//
+// TouchService test case struct.
+//
+const tTestCase sTestTouchServiceFilter = {
+        TouchServiceGetTest,
+        TouchServiceSetup,
+        TouchServiceTearDown,
+        TouchServiceExecute
+};
+
+//
+// TouchService test suits.
+//
+const tTestCase * const psPatternTouchServiceTest[] =
+{
+    &sTestTouchServiceFilter,
+    0
+};
@@ -51,6 +51,10 @@
 
 unsigned long ulX, ulY, ulZ;
 xtBoolean TouchDetect = xfalse;
+
+#ifdef STMPE811_TOUCH_SERVICE
+static tTouchService *psTouchService = 0;
+#endif
                                        
 //*****************************************************************************
 //
@@ -295,9 +299,48 @@ unsigned long STMPE811IntCallback(void *pvCBData, unsigned long ulEvent,
    unsigned char ucInt = 0;
    unsigned char ucXYZ[4];
    unsigned long ulXYZ;
+#ifdef STMPE811_TOUCH_SERVICE
+   unsigned char ucSize;
+#endif
    
    ucInt = STMPE811GetINTStatus();
    
+#ifdef STMPE811_TOUCH_SERVICE
+   if(psTouchService != 0)
+   {
+     //
+     // The pen state comes from the touch detect interrupt, the samples
+     // from the FIFO, so nothing is read while the pen is up.
+     //
+     if(ucInt & STMPE811_INT_STA_DET)
+     {
+       STMPE811Read(STMPE811_TSC_CTRL, 1, ucXYZ);
+       if(ucXYZ[0] & STMPE811_TSC_CTRL_STA)
+       {
+         TouchServicePenDown(psTouchService);
+       }
+       else
+       {
+         TouchServicePenUp(psTouchService);
+       }
+     }
+     if(ucInt & (STMPE811_INT_STA_TH | STMPE811_INT_STA_OFLOW))
+     {
+       STMPE811Read(STMPE811_FIFO_SIZE, 1, &ucSize);
+       while(ucSize--)
+       {
+         STMPE811Read(0xD7, 4, ucXYZ);
+         ulXYZ = (ucXYZ[0] << 24)|(ucXYZ[1] << 16)|(ucXYZ[2] << 8)|(ucXYZ[3] << 0);
+         TouchServiceSamplePut(psTouchService,
+                               (unsigned short)((ulXYZ >> 20) & 0x00000FFF),
+                               (unsigned short)((ulXYZ >>  8) & 0x00000FFF));
+       }
+     }
+     STMPE811INTClear(ucInt);
+     return 0;
+   }
+#endif
+
    if(ucInt & 0x02)
    {
      STMPE811Read(0xD7, 4, ucXYZ);
@@ -310,6 +353,37 @@ unsigned long STMPE811IntCallback(void *pvCBData, unsigned long ulEvent,
    }    
    return 0;
 }
+#ifdef STMPE811_TOUCH_SERVICE
+//*****************************************************************************
+//
+//! \brief Send the touch samples to a TouchService.
+//!
+//! \param psService is the service, initialized by TouchServiceInit().
+//!
+//! From now on the pen and FIFO threshold interrupts feed \e psService, and
+//! the application takes the events with TouchServiceEventGet(). Call it
+//! after STMPE811Init().
+//!
+//! \return None.
+//
+//*****************************************************************************
+void STMPE811ServiceStart(tTouchService *psService)
+{
+    xASSERT(psService != 0);
+
+    xGPIOPinIntDisable(STMPE811_INT_PORT, STMPE811_INT_GPIO);
+    psTouchService = psService;
+
+    //
+    // Drop the samples taken so far and start with the pen state.
+    //
+    STMPE811Write (STMPE811_FIFO_STA, 1, STMPE811_FIFO_STA_RESET);
+    STMPE811Write (STMPE811_FIFO_STA, 1, 0x00);
+    STMPE811INTClear(0xFF);
+    xGPIOPinIntEnable(STMPE811_INT_PORT, STMPE811_INT_GPIO, xGPIO_FALLING_EDGE);
+}
+#endif
+
 //*****************************************************************************
 //
 //! \brief Set tracking index, TSC operation mode or enable the TSC. 
@@ -49,6 +49,7 @@
 extern "C"
 {
 #endif
+
 //*****************************************************************************
 //
 //! \addtogroup CoX_Driver_Lib
@@ -112,6 +113,16 @@ extern "C"
 #define STMPE811_ADDRESS        0x82
 //#define STMPE811_ADDRESS        0x88
 
+//
+//! Feed the touch samples to a TouchService set by STMPE811ServiceStart(),
+//! instead of ulX, ulY and TouchDetect.
+//
+//#define STMPE811_TOUCH_SERVICE
+
+#ifdef STMPE811_TOUCH_SERVICE
+#include "TouchService.h"
+#endif
+
 //*****************************************************************************
 //
 //! @}
@@ -135,6 +146,9 @@ extern unsigned long STMPE811IntCallback(void *pvCBData, unsigned long ulEvent,
 extern void STMPE811SetOperatingMode(unsigned long ulMode);
 extern unsigned STMPE811GetINTStatus(void);
 extern void STMPE811INTClear(unsigned char ucVal);
+#ifdef STMPE811_TOUCH_SERVICE
+extern void STMPE811ServiceStart(tTouchService *psService);
+#endif
 //*****************************************************************************
 //
 //! @}
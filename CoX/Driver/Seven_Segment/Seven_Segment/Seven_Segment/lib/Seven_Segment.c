@@ -40,8 +40,11 @@
 #include "xdebug.h"
 #include "xhw_memmap.h"
 #include "xhw_ints.h"
+#include "xhw_gpio.h"
+#include "xhw_timer.h"
 #include "xcore.h"
 #include "xgpio.h"
+#include "xtimer.h"
 #include "seven_segment.h"
 
 const unsigned long GPIO_LED_PIN[LEDn] = {LED_A_GPIO_PIN, LED_B_GPIO_PIN,                                
@@ -463,3 +466,374 @@ xtBoolean SevenSegmentScan(unsigned long ulData, unsigned char ucForm)
 
     return xtrue;
 }
+
+//
+// Segments of the hex digits, bit 0 is A and bit 7 is DP. The glyphs are the
+// ones of SevenSegmentShow().
+//
+static const unsigned char g_ucSevenSegFont[16] =
+{
+    0x3F, 0x06, 0x5B, 0x4F, 0x66, 0x6D, 0x7D, 0x07,
+    0x7F, 0x6F, 0x5F, 0x7C, 0x39, 0x5E, 0x7B, 0x71
+};
+
+//
+// Segment and chip select ports and the pins used on them.
+//
+static unsigned long g_ulSevenSegPort;
+static unsigned long g_ulSevenSegMask;
+static unsigned long g_ulSevenSegSelPort;
+
+//
+// GPIO_BSRR value that selects a digit.
+//
+static unsigned long g_ulSevenSegSel[CHIP_SEL_NUM];
+
+//
+// GPIO_BSRR value that shows the digit, written by the set APIs.
+//
+static volatile unsigned long g_ulSevenSegBSRR[CHIP_SEL_NUM];
+
+//
+// Ticks a digit is lit per slot.
+//
+static volatile unsigned char g_ucSevenSegLevel[CHIP_SEL_NUM];
+
+//
+// The digit that is lit and the tick in its slot.
+//
+static unsigned char g_ucSevenSegDigit;
+static unsigned char g_ucSevenSegSlot;
+
+//*****************************************************************************
+//
+//! \brief Get the GPIO_BSRR value of a segment pattern.
+//!
+//! \param ucSegments is the pattern, bit 0 is A and bit 7 is DP.
+//!
+//! \return the GPIO_BSRR value, the lit segments are driven low.
+//
+//*****************************************************************************
+static unsigned long SevenSegmentPattern(unsigned char ucSegments)
+{
+    unsigned long ulI, ulOn = 0;
+
+    for(ulI = 0; ulI < LEDn; ulI++)
+    {
+        if(ucSegments & (1 << ulI))
+        {
+            ulOn |= GPIO_LED_PIN[ulI];
+        }
+    }
+
+    return (g_ulSevenSegMask & ~ulOn) | (ulOn << 16);
+}
+
+//*****************************************************************************
+//
+//! \brief Get the segment pattern of a character.
+//!
+//! \param c is 0-9, A-F, a-f, '-', '.' or ' '.
+//!
+//! \return the pattern, 0 for other characters.
+//
+//*****************************************************************************
+static unsigned char SevenSegmentGlyph(char c)
+{
+    if((c >= '0') && (c <= '9'))
+    {
+        return g_ucSevenSegFont[c - '0'];
+    }
+    if((c >= 'A') && (c <= 'F'))
+    {
+        return g_ucSevenSegFont[c - 'A' + 10];
+    }
+    if((c >= 'a') && (c <= 'f'))
+    {
+        return g_ucSevenSegFont[c - 'a' + 10];
+    }
+    if(c == '-')
+    {
+        return 0x40;
+    }
+    if(c == '.')
+    {
+        return 0x80;
+    }
+
+    return 0;
+}
+
+//*****************************************************************************
+//
+//! \brief The multiplexer timer interrupt handler.
+//!
+//! \return 0.
+//
+//*****************************************************************************
+static unsigned long
+SevenSegmentTimerHandler(void *pvCBData, unsigned long ulEvent,
+                         unsigned long ulMsgParam, void *pvMsgData)
+{
+    SevenSegmentTick();
+    return 0;
+}
+
+//*****************************************************************************
+//
+//! \brief Initialize the background multiplexer.
+//!
+//! \param None
+//!
+//! This function initialize the digital tubes and blanks the digit buffer,
+//! every digit is at full brightness. The display is driven by
+//! SevenSegmentTick(), see SevenSegmentTimerInit().
+//! 
+//! \return None.
+//
+//*****************************************************************************
+void SevenSegmentMuxInit(void)
+{
+    unsigned long ulI, ulSelMask;
+
+    SevenSegmentInit();
+    SevenSegmentClear();
+
+    g_ulSevenSegPort = GPIO_LED_PORT[0];
+    g_ulSevenSegSelPort = GPIO_SEL_PORT[0];
+    g_ulSevenSegMask = 0;
+    for(ulI = 0; ulI < LEDn; ulI++)
+    {
+        xASSERT(GPIO_LED_PORT[ulI] == g_ulSevenSegPort);
+        g_ulSevenSegMask |= GPIO_LED_PIN[ulI];
+    }
+
+    ulSelMask = 0;
+    for(ulI = 0; ulI < CHIP_SEL_NUM; ulI++)
+    {
+        xASSERT(GPIO_SEL_PORT[ulI] == g_ulSevenSegSelPort);
+        ulSelMask |= GPIO_SEL_PIN[ulI];
+    }
+
+    //
+    // The selected digit is driven low, the others high.
+    //
+    for(ulI = 0; ulI < CHIP_SEL_NUM; ulI++)
+    {
+        g_ulSevenSegSel[ulI] = (ulSelMask & ~GPIO_SEL_PIN[ulI]) |
+                               (GPIO_SEL_PIN[ulI] << 16);
+        g_ulSevenSegBSRR[ulI] = g_ulSevenSegMask;
+        g_ucSevenSegLevel[ulI] = SEVEN_SEGMENT_LEVELS;
+    }
+
+    g_ucSevenSegDigit = 0;
+    g_ucSevenSegSlot = 0;
+}
+
+//*****************************************************************************
+//
+//! \brief Let the multiplexer tick from SEVEN_SEGMENT_TIMER.
+//!
+//! \param None
+//!
+//! The timer is configured for SEVEN_SEGMENT_TICK_FREQ and started.
+//! 
+//! \return None.
+//
+//*****************************************************************************
+void SevenSegmentTimerInit(void)
+{
+    xSysCtlPeripheralEnable2(SEVEN_SEGMENT_TIMER);
+
+    xTimerInitConfig(SEVEN_SEGMENT_TIMER, SEVEN_SEGMENT_CHANNEL,
+                     xTIMER_MODE_PERIODIC, SEVEN_SEGMENT_TICK_FREQ);
+    xTimerIntEnable(SEVEN_SEGMENT_TIMER, SEVEN_SEGMENT_CHANNEL,
+                    xTIMER_INT_MATCH);
+    xTimerIntCallbackInit(SEVEN_SEGMENT_TIMER, SevenSegmentTimerHandler);
+    xIntEnable(SEVEN_SEGMENT_TIMER_INT);
+    xTimerStart(SEVEN_SEGMENT_TIMER, SEVEN_SEGMENT_CHANNEL);
+}
+
+//*****************************************************************************
+//
+//! \brief Drive the display for one tick.
+//!
+//! \param None
+//!
+//! Each digit gets a slot of SEVEN_SEGMENT_LEVELS ticks. At the start of the
+//! slot the segments are blanked, the digit is selected and its pattern is
+//! written, each with one store to GPIO_BSRR. The segments are blanked again
+//! when the on time of the digit is over, the other ticks write nothing.
+//! 
+//! \return None.
+//
+//*****************************************************************************
+void SevenSegmentTick(void)
+{
+    unsigned long ulDigit = g_ucSevenSegDigit;
+
+    if(g_ucSevenSegSlot == 0)
+    {
+        //
+        // Blank first, so the last digit does not show on the new one.
+        //
+        xHWREG(g_ulSevenSegPort + GPIO_BSRR) = g_ulSevenSegMask;
+        xHWREG(g_ulSevenSegSelPort + GPIO_BSRR) = g_ulSevenSegSel[ulDigit];
+        if(g_ucSevenSegLevel[ulDigit] != 0)
+        {
+            xHWREG(g_ulSevenSegPort + GPIO_BSRR) = g_ulSevenSegBSRR[ulDigit];
+        }
+    }
+    else if(g_ucSevenSegSlot == g_ucSevenSegLevel[ulDigit])
+    {
+        xHWREG(g_ulSevenSegPort + GPIO_BSRR) = g_ulSevenSegMask;
+    }
+
+    if(++g_ucSevenSegSlot == SEVEN_SEGMENT_LEVELS)
+    {
+        g_ucSevenSegSlot = 0;
+        g_ucSevenSegDigit = (ulDigit + 1 == CHIP_SEL_NUM) ? 0 : ulDigit + 1;
+    }
+}
+
+//*****************************************************************************
+//
+//! \brief Set the segments of a digit.
+//!
+//! \param usLED specifies the digit, LED_ONE to LED_FOUR.
+//! \param ucSegments is the pattern, bit 0 is A and bit 7 is DP.
+//!
+//! \return None.
+//
+//*****************************************************************************
+void SevenSegmentDigitSet(unsigned short usLED, unsigned char ucSegments)
+{
+    xASSERT(usLED < CHIP_SEL_NUM);
+
+    g_ulSevenSegBSRR[usLED] = SevenSegmentPattern(ucSegments);
+}
+
+//*****************************************************************************
+//
+//! \brief Set a number to display.
+//!
+//! \param ulData The data need to display.
+//! \param ucForm the data's form(decimal or hexadecimal ).
+//!
+//! Unlike SevenSegmentScan() this function returns at once, the number is
+//! shown by SevenSegmentTick().
+//! 
+//! \return xfalse if the number does not fit, the display is not changed.
+//
+//*****************************************************************************
+xtBoolean SevenSegmentNumberSet(unsigned long ulData, unsigned char ucForm)
+{
+    unsigned char ucDigit[CHIP_SEL_NUM];
+    unsigned long ulI, ulBase;
+
+    if(ucForm == DECIMAL)
+    {
+        ulBase = 10;
+    }
+    else if(ucForm == HEXADECIMAL)
+    {
+        ulBase = 16;
+    }
+    else
+    {
+        return xfalse;
+    }
+
+    for(ulI = 0; ulI < CHIP_SEL_NUM; ulI++)
+    {
+        ucDigit[ulI] = ulData % ulBase;
+        ulData /= ulBase;
+    }
+    if(ulData != 0)
+    {
+        return xfalse;
+    }
+
+    for(ulI = 0; ulI < CHIP_SEL_NUM; ulI++)
+    {
+        g_ulSevenSegBSRR[ulI] =
+            SevenSegmentPattern(g_ucSevenSegFont[ucDigit[ulI]]);
+    }
+
+    return xtrue;
+}
+
+//*****************************************************************************
+//
+//! \brief Set a text to display.
+//!
+//! \param pcText is the text, the first character is shown on LED_FOUR.
+//!
+//! Characters can be 0-9, A-F, a-f, '-' and ' ', others are blank. A '.'
+//! lights the point of the character before it. Digits the text does not
+//! reach are blank.
+//! 
+//! \return None.
+//
+//*****************************************************************************
+void SevenSegmentTextSet(const char *pcText)
+{
+    unsigned char ucSeg[CHIP_SEL_NUM];
+    unsigned long ulI, ulNext = CHIP_SEL_NUM;
+
+    xASSERT(pcText != 0);
+
+    for(ulI = 0; ulI < CHIP_SEL_NUM; ulI++)
+    {
+        ucSeg[ulI] = 0;
+    }
+
+    while(*pcText != 0)
+    {
+        if((*pcText == '.') && (ulNext < CHIP_SEL_NUM))
+        {
+            ucSeg[ulNext] |= 0x80;
+        }
+        else if(ulNext != 0)
+        {
+            ucSeg[--ulNext] = SevenSegmentGlyph(*pcText);
+        }
+        else
+        {
+            break;
+        }
+        pcText++;
+    }
+
+    for(ulI = 0; ulI < CHIP_SEL_NUM; ulI++)
+    {
+        g_ulSevenSegBSRR[ulI] = SevenSegmentPattern(ucSeg[ulI]);
+    }
+}
+
+//*****************************************************************************
+//
+//! \brief Set the brightness of a digit.
+//!
+//! \param usLED specifies the digit, LED_ONE to LED_FOUR or LED_ALL.
+//! \param ucLevel is the number of ticks the digit is lit per slot, 0 (off)
+//! to SEVEN_SEGMENT_LEVELS (full).
+//! 
+//! \return None.
+//
+//*****************************************************************************
+void SevenSegmentBrightnessSet(unsigned short usLED, unsigned char ucLevel)
+{
+    unsigned long ulI;
+
+    xASSERT((usLED < CHIP_SEL_NUM) || (usLED == LED_ALL));
+    xASSERT(ucLevel <= SEVEN_SEGMENT_LEVELS);
+
+    for(ulI = 0; ulI < CHIP_SEL_NUM; ulI++)
+    {
+        if((usLED == LED_ALL) || (usLED == ulI))
+        {
+            g_ucSevenSegLevel[ulI] = ucLevel;
+        }
+    }
+}
@@ -155,6 +155,28 @@ extern "C"
 #define CHIP_SEL_3_GPIO_PORT    GPIOC_BASE
 #define CHIP_SEL_4_GPIO_PIN     xGPIO_PIN_7
 #define CHIP_SEL_4_GPIO_PORT    GPIOC_BASE
+
+//
+// Background multiplexer. The segment pins must be on one port and the
+// chip select pins on one port. The timer must not be shared with another
+// driver's xTimerInitConfig(), the last one takes the timer and its
+// callback. TIM3 is the BMP085_TIMER default, so TIM5 is used here.
+//
+#define SEVEN_SEGMENT_TIMER     xTIMER5_BASE
+#define SEVEN_SEGMENT_CHANNEL   xTIMER_CHANNEL0
+#define SEVEN_SEGMENT_TIMER_INT xINT_TIMER5
+
+//
+// Brightness levels, a digit is lit for 0 to SEVEN_SEGMENT_LEVELS ticks of
+// its SEVEN_SEGMENT_LEVELS ticks slot.
+//
+#define SEVEN_SEGMENT_LEVELS    8
+
+//
+// Tick frequency in Hz, the display refresh rate is
+// SEVEN_SEGMENT_TICK_FREQ / (SEVEN_SEGMENT_LEVELS * CHIP_SEL_NUM).
+//
+#define SEVEN_SEGMENT_TICK_FREQ 3200
 //*****************************************************************************
 //
 //! @}
@@ -174,6 +196,16 @@ extern void SevenLEDOff(void);
 extern void LEDChipSel(unsigned short usLED);
 extern xtBoolean SevenSegmentShow (unsigned short usLED, unsigned char ucData);
 extern xtBoolean SevenSegmentScan(unsigned long ulData, unsigned char ucForm);
+
+extern void SevenSegmentMuxInit(void);
+extern void SevenSegmentTimerInit(void);
+extern void SevenSegmentTick(void);
+extern void SevenSegmentDigitSet(unsigned short usLED, unsigned char ucSegments);
+extern xtBoolean SevenSegmentNumberSet(unsigned long ulData,
+                                       unsigned char ucForm);
+extern void SevenSegmentTextSet(const char *pcText);
+extern void SevenSegmentBrightnessSet(unsigned short usLED,
+                                      unsigned char ucLevel);
 //*****************************************************************************
 //
 //! @}
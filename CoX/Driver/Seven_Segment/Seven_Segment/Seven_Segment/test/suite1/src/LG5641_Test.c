@@ -26,6 +26,7 @@
 //! <h2>Test Cases</h2>
 //! The module contain those sub tests:<br><br>
 //! - \subpage test_LG5641_Function
+//! - \subpage test_LG5641_Mux
 //! .
 //! \file LG5641_Test.c
 //! \brief LG5641 test source file
@@ -33,9 +34,22 @@
 //
 //*****************************************************************************
 
+#include "xhw_types.h"
+#include "xhw_memmap.h"
+#include "xhw_gpio.h"
+#include "xgpio.h"
 #include "test.h"
 #include "Seven_Segment.h"
 
+static const unsigned long ulSegPin[LEDn] = {LED_A_GPIO_PIN, LED_B_GPIO_PIN,
+                                             LED_C_GPIO_PIN, LED_D_GPIO_PIN,
+                                             LED_E_GPIO_PIN, LED_F_GPIO_PIN,
+                                             LED_G_GPIO_PIN, LED_DP_GPIO_PIN};
+static const unsigned long ulSelPin[CHIP_SEL_NUM] = {CHIP_SEL_1_GPIO_PIN,
+                                                     CHIP_SEL_2_GPIO_PIN,
+                                                     CHIP_SEL_3_GPIO_PIN,
+                                                     CHIP_SEL_4_GPIO_PIN};
+
 //*****************************************************************************
 //
 //! \brief Get the Test description of LG5641 Function test.
@@ -102,6 +116,146 @@ static void LG5641Execute(void)
     }
 }
 
+//*****************************************************************************
+//
+//! \brief Check the segment and chip select pins.
+//!
+//! \return xtrue if \e usLED is selected and shows \e ucSegments.
+//
+//*****************************************************************************
+static xtBoolean LG5641MuxCheck(unsigned short usLED, unsigned char ucSegments)
+{
+    unsigned long ulI, ulSeg, ulSel;
+
+    ulSeg = xHWREG(LED_A_GPIO_PORT + GPIO_ODR);
+    ulSel = xHWREG(CHIP_SEL_1_GPIO_PORT + GPIO_ODR);
+
+    for(ulI = 0; ulI < LEDn; ulI++)
+    {
+        if(((ulSeg & ulSegPin[ulI]) == 0) != ((ucSegments >> ulI) & 1))
+        {
+            return xfalse;
+        }
+    }
+    for(ulI = 0; ulI < CHIP_SEL_NUM; ulI++)
+    {
+        if(((ulSel & ulSelPin[ulI]) == 0) != (ulI == usLED))
+        {
+            return xfalse;
+        }
+    }
+
+    return xtrue;
+}
+
+//*****************************************************************************
+//
+//! \brief Run the multiplexer some ticks.
+//!
+//! \return None.
+//
+//*****************************************************************************
+static void LG5641MuxTicks(unsigned long ulTicks)
+{
+    while(ulTicks--)
+    {
+        SevenSegmentTick();
+    }
+}
+
+//*****************************************************************************
+//
+//! \brief Get the Test description of LG5641 Mux test.
+//!
+//! \return the desccription of the LG5641 Mux test.
+//
+//*****************************************************************************
+static char* LG5641MuxGetTest(void)
+{
+    return "LG5641 Mux test";
+}
+
+//*****************************************************************************
+//
+//! \brief something should do before the test execute of LG5641 Mux test.
+//!
+//! \return None.
+//
+//*****************************************************************************
+static void LG5641MuxSetup(void)
+{
+    SevenSegmentMuxInit();
+}
+
+//*****************************************************************************
+//
+//! \brief LG5641 Mux test execute main body.
+//!
+//! The test ticks the multiplexer itself and reads back the output pins.
+//!
+//! \return None.
+//
+//*****************************************************************************
+static void LG5641MuxExecute(void)
+{
+    TestAssert(SevenSegmentNumberSet(1234, DECIMAL) &&
+               !SevenSegmentNumberSet(10000, DECIMAL) &&
+               !SevenSegmentNumberSet(0x10000, HEXADECIMAL),
+               "LG5641 API \"SevenSegmentNumberSet()\"error!");
+
+    //
+    // One digit per slot, units first.
+    //
+    LG5641MuxTicks(1);
+    TestAssert(LG5641MuxCheck(LED_ONE, 0x66),
+               "LG5641 API \"SevenSegmentTick()\"error!");
+    LG5641MuxTicks(SEVEN_SEGMENT_LEVELS);
+    TestAssert(LG5641MuxCheck(LED_TWO, 0x4F),
+               "LG5641 API \"SevenSegmentTick()\"error!");
+    LG5641MuxTicks(SEVEN_SEGMENT_LEVELS * 2);
+    TestAssert(LG5641MuxCheck(LED_FOUR, 0x06),
+               "LG5641 API \"SevenSegmentTick()\"error!");
+
+    //
+    // A dimmed digit is blanked after its on time.
+    //
+    SevenSegmentBrightnessSet(LED_ONE, 2);
+    LG5641MuxTicks(SEVEN_SEGMENT_LEVELS);
+    TestAssert(LG5641MuxCheck(LED_ONE, 0x66),
+               "LG5641 API \"SevenSegmentBrightnessSet()\"error!");
+    LG5641MuxTicks(2);
+    TestAssert(LG5641MuxCheck(LED_ONE, 0),
+               "LG5641 API \"SevenSegmentBrightnessSet()\"error!");
+    SevenSegmentBrightnessSet(LED_ALL, SEVEN_SEGMENT_LEVELS);
+
+    //
+    // Text with a point, the digits it does not reach are blank.
+    //
+    SevenSegmentTextSet("-1.2");
+    LG5641MuxTicks(SEVEN_SEGMENT_LEVELS - 2);
+    TestAssert(LG5641MuxCheck(LED_TWO, 0x5B),
+               "LG5641 API \"SevenSegmentTextSet()\"error!");
+    LG5641MuxTicks(SEVEN_SEGMENT_LEVELS);
+    TestAssert(LG5641MuxCheck(LED_THREE, 0x86),
+               "LG5641 API \"SevenSegmentTextSet()\"error!");
+    LG5641MuxTicks(SEVEN_SEGMENT_LEVELS);
+    TestAssert(LG5641MuxCheck(LED_FOUR, 0x40),
+               "LG5641 API \"SevenSegmentTextSet()\"error!");
+    LG5641MuxTicks(SEVEN_SEGMENT_LEVELS);
+    TestAssert(LG5641MuxCheck(LED_ONE, 0),
+               "LG5641 API \"SevenSegmentTextSet()\"error!");
+}
+
+//
+// LG5641 Mux test case struct.
+//
+const tTestCase sTestLG5641Mux = {
+    LG5641MuxGetTest,
+    LG5641MuxSetup,
+    LG5641TearDown,
+    LG5641MuxExecute
+};
+
 //
 // LG5641 Function test case struct.
 //
@@ -117,6 +271,7 @@ const tTestCase sTestLG5641Function = {
 //
 const tTestCase * const psPatternLG5641Test[] =
 {
+    &sTestLG5641Mux,
     &sTestLG5641Function,
     0
 };
@@ -46,6 +46,7 @@
 #include "xuart.h"
 #include "xgpio.h"
 #include "hw_TEL0026.h"
+#include "ATCmd.h"
 #include "TEL0026.h"
 #include "hw_sdcard.h"
 #include "sdcard.h"
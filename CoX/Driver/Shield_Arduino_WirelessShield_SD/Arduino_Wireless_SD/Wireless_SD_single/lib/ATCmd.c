@@ -0,0 +1,532 @@
+//*****************************************************************************
+//
+//! \file ATCmd.c
+//! \brief Line-oriented, non-blocking AT command engine.
+//! \version V2.2.1.0
+//! \date 10/19/2026
+//! \author CooCox
+//! \copy
+//!
+//! Copyright (c)  2013, CooCox
+//! All rights reserved.
+//!
+//! Redistribution and use in source and binary forms, with or without
+//! modification, are permitted provided that the following conditions
+//! are met:
+//!
+//!     * Redistributions of source code must retain the above copyright
+//! notice, this list of conditions and the following disclaimer.
+//!     * Redistributions in binary form must reproduce the above copyright
+//! notice, this list of conditions and the following disclaimer in the
+//! documentation and/or other materials provided with the distribution.
+//!     * Neither the name of the <ORGANIZATION> nor the names of its
+//! contributors may be used to endorse or promote products derived
+//! from this software without specific prior written permission.
+//!
+//! THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+//! AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+//! IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+//! ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+//! LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+//! CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+//! SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+//! INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//! CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+//! ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+//! THE POSSIBILITY OF SUCH DAMAGE.
+//
+//*****************************************************************************
+#include "xhw_types.h"
+#include "xdebug.h"
+#include "ATCmd.h"
+
+//
+// Default final response patterns used when ATCmdSend() gets 0.
+//
+static const char s_cATDefaultOk[] = "OK";
+static const char s_cATDefaultErr[] = "ERROR*|FAIL";
+
+//*****************************************************************************
+//
+//! \brief Match one alternative of a pattern against a line.
+//!
+//! \param pcPat Points to the alternative, terminated by '|' or '\\0'.
+//! \param pcStr The line to be matched.
+//!
+//! '*' matches any run of characters and '?' matches any single character.
+//!
+//! \return xtrue if the whole line matches.
+//
+//*****************************************************************************
+static xtBoolean ATCmdGlob(const char *pcPat, const char *pcStr)
+{
+    const char *pcStarPat = 0;
+    const char *pcStarStr = 0;
+
+    while(*pcStr)
+    {
+        if((*pcPat == '?') ||
+           ((*pcPat == *pcStr) && (*pcPat != '*') && (*pcPat != '|')))
+        {
+            pcPat++;
+            pcStr++;
+        }
+        else if(*pcPat == '*')
+        {
+            pcStarPat = ++pcPat;
+            pcStarStr = pcStr;
+        }
+        else if(pcStarPat)
+        {
+            //
+            // Let the last '*' swallow one more character and retry.
+            //
+            pcPat = pcStarPat;
+            pcStr = ++pcStarStr;
+        }
+        else
+        {
+            return xfalse;
+        }
+    }
+
+    while(*pcPat == '*')
+    {
+        pcPat++;
+    }
+
+    return ((*pcPat == 0) || (*pcPat == '|'));
+}
+
+//*****************************************************************************
+//
+//! \brief Match a response pattern against a received line.
+//!
+//! \param pcPattern The pattern, alternatives are separated by '|', e.g.
+//! "ERROR*|FAIL". '*' and '?' are wildcards.
+//! \param pcLine The received line without "\r\n".
+//!
+//! \return xtrue if any alternative matches the whole line.
+//
+//*****************************************************************************
+xtBoolean
+ATCmdMatch(const char *pcPattern, const char *pcLine)
+{
+    xASSERT(pcPattern != 0);
+    xASSERT(pcLine != 0);
+
+    while(1)
+    {
+        if(ATCmdGlob(pcPattern, pcLine))
+        {
+            return xtrue;
+        }
+
+        while(*pcPattern && (*pcPattern != '|'))
+        {
+            pcPattern++;
+        }
+        if(*pcPattern == 0)
+        {
+            return xfalse;
+        }
+        pcPattern++;
+    }
+}
+
+//*****************************************************************************
+//
+//! \brief Send the command at the queue tail to the module.
+//!
+//! \param psEngine The AT engine.
+//!
+//! \return None.
+//
+//*****************************************************************************
+static void ATCmdStart(tATEngine *psEngine)
+{
+    tATCmd *psCmd = &psEngine->sCmd[psEngine->ucCmdTail];
+    unsigned long ulLen = 0;
+
+    while(psCmd->cCmd[ulLen])
+    {
+        ulLen++;
+    }
+
+    psEngine->ulTicksLeft = psCmd->ulTimeout;
+    psEngine->ucActive = 1;
+    psEngine->pfnSend(psEngine->pvPort, psCmd->cCmd, ulLen);
+    psEngine->pfnSend(psEngine->pvPort, "\r\n", 2);
+}
+
+//*****************************************************************************
+//
+//! \brief Finish the active command and start the next queued one.
+//!
+//! \param psEngine The AT engine.
+//! \param ucResult The result passed to the command callback.
+//! \param pcLine The final line, or 0.
+//!
+//! The queue slot is released before the callback runs, so the callback may
+//! queue the next command of a sequence.
+//!
+//! \return None.
+//
+//*****************************************************************************
+static void ATCmdComplete(tATEngine *psEngine, unsigned char ucResult,
+                          const char *pcLine)
+{
+    tATCmd *psCmd = &psEngine->sCmd[psEngine->ucCmdTail];
+    tATCmdCallback pfnCallback = psCmd->pfnCallback;
+    void *pvArg = psCmd->pvArg;
+
+    psEngine->ucActive = 0;
+    psEngine->ucCmdTail = (psEngine->ucCmdTail + 1) & (AT_CMD_QUEUE_SIZE - 1);
+
+    if(pfnCallback)
+    {
+        pfnCallback(pvArg, ucResult, pcLine);
+    }
+
+    if(!psEngine->ucActive && (psEngine->ucCmdTail != psEngine->ucCmdHead))
+    {
+        ATCmdStart(psEngine);
+    }
+}
+
+//*****************************************************************************
+//
+//! \brief Route one received line.
+//!
+//! \param psEngine The AT engine.
+//! \param pcLine The received line.
+//!
+//! The final patterns of the active command are checked first, then the
+//! registered URC patterns. Anything else is handed to the active command
+//! as an intermediate line, or dropped when no command is pending.
+//!
+//! \return None.
+//
+//*****************************************************************************
+static void ATCmdLineDispatch(tATEngine *psEngine, const char *pcLine)
+{
+    tATCmd *psCmd = &psEngine->sCmd[psEngine->ucCmdTail];
+    unsigned long i;
+
+    if(psEngine->ucActive)
+    {
+        if(ATCmdMatch(psCmd->pcOk, pcLine))
+        {
+            ATCmdComplete(psEngine, AT_RES_OK, pcLine);
+            return;
+        }
+        if(ATCmdMatch(psCmd->pcErr, pcLine))
+        {
+            ATCmdComplete(psEngine, AT_RES_ERROR, pcLine);
+            return;
+        }
+    }
+
+    for(i = 0; i < AT_URC_MAX; i++)
+    {
+        if(psEngine->sURC[i].pcPattern &&
+           ATCmdMatch(psEngine->sURC[i].pcPattern, pcLine))
+        {
+            psEngine->sURC[i].pfnCallback(psEngine->sURC[i].pvArg, pcLine);
+            return;
+        }
+    }
+
+    if(psEngine->ucActive && psCmd->pfnCallback)
+    {
+        psCmd->pfnCallback(psCmd->pvArg, AT_RES_LINE, pcLine);
+    }
+}
+
+//*****************************************************************************
+//
+//! \brief Initialize an AT engine.
+//!
+//! \param psEngine The AT engine to initialize.
+//! \param pfnSend The port function used to write command bytes.
+//! \param pvPort Passed back to \e pfnSend unchanged.
+//!
+//! \return None.
+//
+//*****************************************************************************
+void
+ATCmdEngineInit(tATEngine *psEngine, tATSend pfnSend, void *pvPort)
+{
+    unsigned long i;
+
+    xASSERT(psEngine != 0);
+    xASSERT(pfnSend != 0);
+
+    psEngine->pfnSend = pfnSend;
+    psEngine->pvPort = pvPort;
+    psEngine->ucCmdHead = 0;
+    psEngine->ucCmdTail = 0;
+    psEngine->ucActive = 0;
+    psEngine->ulTicksLeft = 0;
+    psEngine->ucLineHead = 0;
+    psEngine->ucLineTail = 0;
+    psEngine->ucLineLen = 0;
+    psEngine->ucLineOverflow = 0;
+
+    for(i = 0; i < AT_URC_MAX; i++)
+    {
+        psEngine->sURC[i].pcPattern = 0;
+    }
+}
+
+//*****************************************************************************
+//
+//! \brief Queue an AT command.
+//!
+//! \param psEngine The AT engine.
+//! \param pcCmd The command without "\r\n". It is copied into the queue.
+//! \param pcOk The success pattern, 0 for "OK".
+//! \param pcErr The error pattern, 0 for "ERROR*|FAIL".
+//! \param ulTimeout Timeout in ATCmdTick() ticks, 0 to wait forever.
+//! \param pfnCallback Called for each intermediate line and once with the
+//! final result. Can be 0.
+//! \param pvArg Passed back to \e pfnCallback unchanged.
+//!
+//! The command is sent at once if the engine is idle, otherwise when the
+//! commands queued before it have completed. This function must be called
+//! from the same context as ATCmdPoll(), not from an ISR.
+//!
+//! \return xtrue if the command was queued, xfalse if the queue is full or
+//! the command is too long.
+//
+//*****************************************************************************
+xtBoolean
+ATCmdSend(tATEngine *psEngine, const char *pcCmd, const char *pcOk,
+          const char *pcErr, unsigned long ulTimeout,
+          tATCmdCallback pfnCallback, void *pvArg)
+{
+    tATCmd *psCmd;
+    unsigned char ucNext;
+    unsigned long i;
+
+    xASSERT(psEngine != 0);
+    xASSERT(pcCmd != 0);
+
+    ucNext = (psEngine->ucCmdHead + 1) & (AT_CMD_QUEUE_SIZE - 1);
+    if(ucNext == psEngine->ucCmdTail)
+    {
+        return xfalse;
+    }
+
+    psCmd = &psEngine->sCmd[psEngine->ucCmdHead];
+    for(i = 0; pcCmd[i]; i++)
+    {
+        if(i >= AT_CMD_LEN_MAX - 1)
+        {
+            return xfalse;
+        }
+        psCmd->cCmd[i] = pcCmd[i];
+    }
+    psCmd->cCmd[i] = 0;
+    psCmd->pcOk = pcOk ? pcOk : s_cATDefaultOk;
+    psCmd->pcErr = pcErr ? pcErr : s_cATDefaultErr;
+    psCmd->ulTimeout = ulTimeout;
+    psCmd->pfnCallback = pfnCallback;
+    psCmd->pvArg = pvArg;
+    psEngine->ucCmdHead = ucNext;
+
+    if(!psEngine->ucActive)
+    {
+        ATCmdStart(psEngine);
+    }
+
+    return xtrue;
+}
+
+//*****************************************************************************
+//
+//! \brief Register a handler for unsolicited result codes.
+//!
+//! \param psEngine The AT engine.
+//! \param pcPattern The line pattern, e.g. "+DISC:*". The string is not
+//! copied and must stay valid.
+//! \param pfnCallback Called from ATCmdPoll() for each matching line.
+//! \param pvArg Passed back to \e pfnCallback unchanged.
+//!
+//! \return xtrue if registered, xfalse if the URC table is full.
+//
+//*****************************************************************************
+xtBoolean
+ATCmdURCRegister(tATEngine *psEngine, const char *pcPattern,
+                 tATURCCallback pfnCallback, void *pvArg)
+{
+    unsigned long i;
+
+    xASSERT(psEngine != 0);
+    xASSERT(pcPattern != 0);
+    xASSERT(pfnCallback != 0);
+
+    for(i = 0; i < AT_URC_MAX; i++)
+    {
+        if(psEngine->sURC[i].pcPattern == 0)
+        {
+            psEngine->sURC[i].pfnCallback = pfnCallback;
+            psEngine->sURC[i].pvArg = pvArg;
+            psEngine->sURC[i].pcPattern = pcPattern;
+            return xtrue;
+        }
+    }
+
+    return xfalse;
+}
+
+//*****************************************************************************
+//
+//! \brief Feed one received byte to the line assembler.
+//!
+//! \param psEngine The AT engine.
+//! \param cChar The received byte.
+//!
+//! This function is meant to be called from the UART RX interrupt. Lines are
+//! terminated by '\\r' or '\\n', empty lines are skipped. A completed line is
+//! dropped and \e ucLineOverflow is set when the line queue is full.
+//!
+//! \return None.
+//
+//*****************************************************************************
+void
+ATCmdRxByte(tATEngine *psEngine, char cChar)
+{
+    unsigned char ucNext;
+    char *pcLine = psEngine->cLine[psEngine->ucLineHead];
+
+    if((cChar != '\r') && (cChar != '\n'))
+    {
+        if(psEngine->ucLineLen < AT_LINE_LEN_MAX - 1)
+        {
+            pcLine[psEngine->ucLineLen++] = cChar;
+        }
+        return;
+    }
+
+    if(psEngine->ucLineLen == 0)
+    {
+        return;
+    }
+
+    pcLine[psEngine->ucLineLen] = 0;
+    psEngine->ucLineLen = 0;
+
+    ucNext = (psEngine->ucLineHead + 1) & (AT_LINE_QUEUE_SIZE - 1);
+    if(ucNext == psEngine->ucLineTail)
+    {
+        psEngine->ucLineOverflow = 1;
+        return;
+    }
+    psEngine->ucLineHead = ucNext;
+}
+
+//*****************************************************************************
+//
+//! \brief Advance the AT engine timebase.
+//!
+//! \param psEngine The AT engine.
+//! \param ulTicks Ticks elapsed since the last call.
+//!
+//! Typically called from a periodic timer or SysTick interrupt. Timeouts
+//! are reported by the next ATCmdPoll().
+//!
+//! \return None.
+//
+//*****************************************************************************
+void
+ATCmdTick(tATEngine *psEngine, unsigned long ulTicks)
+{
+    if(psEngine->ulTicksLeft > ulTicks)
+    {
+        psEngine->ulTicksLeft -= ulTicks;
+    }
+    else
+    {
+        psEngine->ulTicksLeft = 0;
+    }
+}
+
+//*****************************************************************************
+//
+//! \brief Process received lines and timeouts.
+//!
+//! \param psEngine The AT engine.
+//!
+//! All command and URC callbacks are called from this function. It never
+//! waits, so it can be called from the application main loop.
+//!
+//! \return None.
+//
+//*****************************************************************************
+void
+ATCmdPoll(tATEngine *psEngine)
+{
+    xASSERT(psEngine != 0);
+
+    while(psEngine->ucLineTail != psEngine->ucLineHead)
+    {
+        ATCmdLineDispatch(psEngine, psEngine->cLine[psEngine->ucLineTail]);
+        psEngine->ucLineTail = (psEngine->ucLineTail + 1) &
+                               (AT_LINE_QUEUE_SIZE - 1);
+    }
+
+    if(psEngine->ucActive &&
+       psEngine->sCmd[psEngine->ucCmdTail].ulTimeout &&
+       (psEngine->ulTicksLeft == 0))
+    {
+        ATCmdComplete(psEngine, AT_RES_TIMEOUT, 0);
+    }
+}
+
+//*****************************************************************************
+//
+//! \brief Drop the active command and all queued commands.
+//!
+//! \param psEngine The AT engine.
+//!
+//! Each dropped command gets its callback called with AT_RES_ABORTED.
+//!
+//! \return None.
+//
+//*****************************************************************************
+void
+ATCmdAbort(tATEngine *psEngine)
+{
+    tATCmd *psCmd;
+
+    xASSERT(psEngine != 0);
+
+    psEngine->ucActive = 0;
+    while(psEngine->ucCmdTail != psEngine->ucCmdHead)
+    {
+        psCmd = &psEngine->sCmd[psEngine->ucCmdTail];
+        psEngine->ucCmdTail = (psEngine->ucCmdTail + 1) &
+                              (AT_CMD_QUEUE_SIZE - 1);
+        if(psCmd->pfnCallback)
+        {
+            psCmd->pfnCallback(psCmd->pvArg, AT_RES_ABORTED, 0);
+        }
+    }
+}
+
+//*****************************************************************************
+//
+//! \brief Check whether the AT engine has no command pending.
+//!
+//! \param psEngine The AT engine.
+//!
+//! \return xtrue if no command is active or queued.
+//
+//*****************************************************************************
+xtBoolean
+ATCmdIdle(tATEngine *psEngine)
+{
+    return ((!psEngine->ucActive) &&
+            (psEngine->ucCmdTail == psEngine->ucCmdHead));
+}
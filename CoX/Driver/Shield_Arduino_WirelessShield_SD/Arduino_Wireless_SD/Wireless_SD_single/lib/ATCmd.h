@@ -0,0 +1,275 @@
+//*****************************************************************************
+//
+//! \file ATCmd.h
+//! \brief Prototypes for the line-oriented, non-blocking AT command engine.
+//! \version V2.2.1.0
+//! \date 10/19/2026
+//! \author CooCox
+//! \copy
+//!
+//! Copyright (c)  2013, CooCox
+//! All rights reserved.
+//!
+//! Redistribution and use in source and binary forms, with or without
+//! modification, are permitted provided that the following conditions
+//! are met:
+//!
+//!     * Redistributions of source code must retain the above copyright
+//! notice, this list of conditions and the following disclaimer.
+//!     * Redistributions in binary form must reproduce the above copyright
+//! notice, this list of conditions and the following disclaimer in the
+//! documentation and/or other materials provided with the distribution.
+//!     * Neither the name of the <ORGANIZATION> nor the names of its
+//! contributors may be used to endorse or promote products derived
+//! from this software without specific prior written permission.
+//!
+//! THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+//! AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+//! IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+//! ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+//! LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+//! CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+//! SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+//! INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//! CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+//! ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+//! THE POSSIBILITY OF SUCH DAMAGE.
+//
+//*****************************************************************************
+#ifndef __ATCMD_H__
+#define __ATCMD_H__
+
+//*****************************************************************************
+//
+// If building with a C++ compiler, make all of the definitions in this header
+// have a C binding.
+//
+//*****************************************************************************
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+//*****************************************************************************
+//
+//! \addtogroup CoX_Driver_Lib
+//! @{
+//
+//! \addtogroup Wireless
+//! @{
+//
+//! \addtogroup ATCmd
+//! @{
+//
+//*****************************************************************************
+
+//*****************************************************************************
+//! \addtogroup ATCmd_User_Config
+//! @{
+//
+//*****************************************************************************
+
+//
+//! Number of commands that can wait in the queue (must be a power of 2).
+//
+#define AT_CMD_QUEUE_SIZE          4
+
+//
+//! Max command length, not including the "\r\n" appended on sending.
+//
+#define AT_CMD_LEN_MAX             32
+
+//
+//! Number of received lines buffered between ISR and AT poll (power of 2).
+//
+#define AT_LINE_QUEUE_SIZE         4
+
+//
+//! Max received line length, longer lines are truncated.
+//
+#define AT_LINE_LEN_MAX            64
+
+//
+//! Number of unsolicited result code handlers that can be registered.
+//
+#define AT_URC_MAX                 4
+
+//*****************************************************************************
+//
+//! @}
+//
+//*****************************************************************************
+
+//*****************************************************************************
+//! \addtogroup ATCmd_Result ATCmd Command Result
+//! \brief Values of the \e ucResult parameter passed to tATCmdCallback.
+//! @{
+//
+//*****************************************************************************
+
+//
+//! An intermediate response line, the command is still pending.
+//
+#define AT_RES_LINE                0
+
+//
+//! The final line matched the command's success pattern.
+//
+#define AT_RES_OK                  1
+
+//
+//! The final line matched the command's error pattern.
+//
+#define AT_RES_ERROR               2
+
+//
+//! No final line was received before the command timed out.
+//
+#define AT_RES_TIMEOUT             3
+
+//
+//! The command was dropped by ATCmdAbort().
+//
+#define AT_RES_ABORTED             4
+
+//*****************************************************************************
+//
+//! @}
+//
+//*****************************************************************************
+
+//*****************************************************************************
+//! \addtogroup ATCmd_Types
+//! @{
+//
+//*****************************************************************************
+
+//
+//! Command response callback. \e pcLine is the received line or 0 for a
+//! timeout or abort.
+//
+typedef void (*tATCmdCallback)(void *pvArg, unsigned char ucResult,
+                               const char *pcLine);
+
+//
+//! Unsolicited result code callback.
+//
+typedef void (*tATURCCallback)(void *pvArg, const char *pcLine);
+
+//
+//! Port send function, writes \e ulLen bytes of \e pcData to the module.
+//
+typedef void (*tATSend)(void *pvPort, const char *pcData, unsigned long ulLen);
+
+//
+//! A queued command.
+//
+typedef struct
+{
+    char cCmd[AT_CMD_LEN_MAX];
+    const char *pcOk;
+    const char *pcErr;
+    unsigned long ulTimeout;
+    tATCmdCallback pfnCallback;
+    void *pvArg;
+}
+tATCmd;
+
+//
+//! An unsolicited result code handler.
+//
+typedef struct
+{
+    const char *pcPattern;
+    tATURCCallback pfnCallback;
+    void *pvArg;
+}
+tATURC;
+
+//
+//! AT engine instance, one per AT-style module.
+//
+typedef struct
+{
+    //
+    // Port glue
+    //
+    tATSend pfnSend;
+    void *pvPort;
+
+    //
+    // Command queue, written and read from the poll context only.
+    //
+    tATCmd sCmd[AT_CMD_QUEUE_SIZE];
+    unsigned char ucCmdHead;
+    unsigned char ucCmdTail;
+    unsigned char ucActive;
+
+    //
+    // Ticks left for the active command, decremented by ATCmdTick().
+    //
+    volatile unsigned long ulTicksLeft;
+
+    //
+    // Line queue, filled by ATCmdRxByte() in the ISR and drained by
+    // ATCmdPoll(). Each side owns one index so no locking is needed.
+    //
+    char cLine[AT_LINE_QUEUE_SIZE][AT_LINE_LEN_MAX];
+    volatile unsigned char ucLineHead;
+    volatile unsigned char ucLineTail;
+    unsigned char ucLineLen;
+    volatile unsigned char ucLineOverflow;
+
+    tATURC sURC[AT_URC_MAX];
+}
+tATEngine;
+
+//*****************************************************************************
+//
+//! @}
+//
+//*****************************************************************************
+
+//*****************************************************************************
+//! \addtogroup ATCmd_Export_APIs
+//! @{
+//
+//*****************************************************************************
+extern void ATCmdEngineInit(tATEngine *psEngine, tATSend pfnSend, void *pvPort);
+extern xtBoolean ATCmdSend(tATEngine *psEngine, const char *pcCmd,
+                           const char *pcOk, const char *pcErr,
+                           unsigned long ulTimeout,
+                           tATCmdCallback pfnCallback, void *pvArg);
+extern xtBoolean ATCmdURCRegister(tATEngine *psEngine, const char *pcPattern,
+                                  tATURCCallback pfnCallback, void *pvArg);
+extern void ATCmdRxByte(tATEngine *psEngine, char cChar);
+extern void ATCmdTick(tATEngine *psEngine, unsigned long ulTicks);
+extern void ATCmdPoll(tATEngine *psEngine);
+extern void ATCmdAbort(tATEngine *psEngine);
+extern xtBoolean ATCmdIdle(tATEngine *psEngine);
+extern xtBoolean ATCmdMatch(const char *pcPattern, const char *pcLine);
+
+//*****************************************************************************
+//
+//! @}
+//
+//*****************************************************************************
+
+//*****************************************************************************
+//
+//! @}
+//! @}
+//! @}
+//
+//*****************************************************************************
+
+//*****************************************************************************
+//
+// Mark the end of the C bindings section for C++ compilers.
+//
+//*****************************************************************************
+#ifdef __cplusplus
+}
+#endif
+
+#endif
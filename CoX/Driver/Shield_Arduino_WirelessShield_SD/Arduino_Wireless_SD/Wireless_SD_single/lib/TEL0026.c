@@ -46,6 +46,7 @@
 #include "xuart.h"
 #include "xgpio.h"
 #include "hw_TEL0026.h"
+#include "ATCmd.h"
 #include "TEL0026.h"
 
 //
@@ -74,6 +75,10 @@ static unsigned char s_ucRecBufOverFlow = 0;
 //
 static unsigned char s_ucLinesCnt = 0;
 
+//
+// AT engine used by the non-blocking BT...Async APIs
+//
+static tATEngine s_sBTATEngine;
 
 
 //*****************************************************************************
@@ -104,6 +109,22 @@ unsigned long UartInterruptReceive(void *pvCBData,  unsigned long ulEvent,
 	// ucTail - ucHead == UART_RXD_BUFFER_SIZE-1 or ucHead-ucTail ==1.
 	// If the buffer is full, the extra received data will be abandoned.
 	//
+	char cChar;
+
+	//
+	//! \note Since interrupt flags are cleared in system interrupt program before
+	// invoking this interrupt function, we should only use register read, or
+	// we will not get the right value!!! If you use this driver, the following
+	// sentence(read data register of UART) may need to modify.
+	//
+	//ucUartRecBuffer[ucReceivedBytes++] = xUARTCharGetNonBlocking(TEL0026_UART_BASE);
+	cChar = xHWREG(TEL0026_UART_BASE + 0x00000004);//read DR
+
+	//
+	// Feed the AT engine line assembler first, it keeps its own line queue.
+	//
+	ATCmdRxByte(&s_sBTATEngine, cChar);
+
 	if(((ucTail - ucHead) > (UART_RXD_BUFFER_SIZE-1))||((ucHead-ucTail)==1))
 	{
 		s_ucRecBufOverFlow = 1;
@@ -114,15 +135,7 @@ unsigned long UartInterruptReceive(void *pvCBData,  unsigned long ulEvent,
 		s_ucRecBufOverFlow = 0;
 	}
 
-
-	//
-	//! \note Since interrupt flags are cleared in system interrupt program before
-	// invoking this interrupt function, we should only use register read, or
-	// we will not get the right value!!! If you use this driver, the following
-	// sentence(read data register of UART) may need to modify.
-	//
-	//ucUartRecBuffer[ucReceivedBytes++] = xUARTCharGetNonBlocking(TEL0026_UART_BASE);
-	s_cUartRecBuffer[ucTail++] = xHWREG(TEL0026_UART_BASE + 0x00000004);//read DR
+	s_cUartRecBuffer[ucTail++] = cChar;
 
 	if(s_cUartRecBuffer[ucTail-1] == '\n')
 	{
@@ -236,7 +249,7 @@ void ClearRecBuf(void)
 //*****************************************************************************
 void BTSendBytes(unsigned long ulLength, unsigned char *pData)
 {
-	while(ulLength > 0)
+	while(ulLength-- > 0)
 	{
 		xUARTCharPut(TEL0026_UART_BASE, *pData++);
 	}
@@ -414,7 +427,7 @@ void BTAddrConv(char *pDevAddr)
 //! \return Error number refer to hw_TEL0026.h.
 //
 //*****************************************************************************
-static tBtResult BTErrorDecode(char *pErrStr)
+static tBtResult BTErrorDecode(const char *pErrStr)
 {
 	unsigned char ucRes;
 	char cRes = StrCmp(BtResOk, pErrStr);
@@ -498,6 +511,25 @@ tBtResult BTGetResponse(void)
 	return ucRes;
 }
 
+//*****************************************************************************
+//
+//! \brief AT engine port send function.
+//!
+//! \param pvPort Not used.
+//! \param pcData Data to be sent.
+//! \param ulLen The length of data.
+//!
+//! \return None.
+//
+//*****************************************************************************
+static void BTATSend(void *pvPort, const char *pcData, unsigned long ulLen)
+{
+	while(ulLen-- > 0)
+	{
+		xUARTCharPut(TEL0026_UART_BASE, *pcData++);
+	}
+}
+
 //*****************************************************************************
 //
 //! \brief MCU UART initialization.
@@ -552,6 +584,7 @@ static void UartInit(unsigned long ulBaudRate, unsigned char ucParity, unsigned
     //
     // Enable UART interrupt
     //
+    ATCmdEngineInit(&s_sBTATEngine, BTATSend, 0);
     xIntEnable(TEL0026_UART_INT);
     xUARTEnable(TEL0026_UART_BASE, (xUART_BLOCK_UART | xUART_BLOCK_TX | xUART_BLOCK_RX));
     xSysCtlPeripheralEnable(SYSCTL_PERIPH_AFIO);
@@ -1555,15 +1588,174 @@ tBtResult BTInit(void)
 	return ucRes;
 }
 
+//*****************************************************************************
+//
+//! \brief Decode a TEL0026 result line.
+//!
+//! \param pcLine The line passed to a tATCmdCallback.
+//!
+//! This function is to map the final line of an asynchronous command to the
+//! error codes used by the blocking APIs.
+//!
+//! \return Error number refer to hw_TEL0026.h, BT_ERR_NORESPONSE if \e pcLine
+//! is 0 (timeout or abort).
+//
+//*****************************************************************************
+tBtResult BTResultDecode(const char *pcLine)
+{
+	if(pcLine == 0)
+	{
+		return BT_ERR_NORESPONSE;
+	}
+	return BTErrorDecode(pcLine);
+}
 
+//*****************************************************************************
+//
+//! \brief Queue an AT command without waiting for the response.
+//!
+//! \param pcCmd Command string without "\r\n", it is copied.
+//! \param ulTimeOut Timeout in BTATTick() ticks, 0 to wait forever.
+//! \param pfnCallback Called from BTATPoll() for each response line and once
+//! with the final result, can be 0.
+//! \param pvArg Passed back to \e pfnCallback.
+//!
+//! "OK" completes the command with AT_RES_OK, "FAIL" and "ERROR:(n)" with
+//! AT_RES_ERROR. Use BTResultDecode() to get the error code.
+//!
+//! \note Do not mix the asynchronous APIs with the blocking ones while a
+//! command is pending, both consume the same responses.
+//!
+//! \return xtrue if queued, xfalse if the command queue is full.
+//
+//*****************************************************************************
+xtBoolean BTCmdAsync(const char *pcCmd, unsigned long ulTimeOut,
+		tATCmdCallback pfnCallback, void *pvArg)
+{
+	return ATCmdSend(&s_sBTATEngine, pcCmd, 0, 0, ulTimeOut,
+			pfnCallback, pvArg);
+}
 
+//*****************************************************************************
+//
+//! \brief Pair with a remote device without blocking.
+//!
+//! \param pRemoteDevAddr The remote device address(format like: 1234,56,abcdef)
+//! \param ucTimeOut Pairing timeout in seconds.
+//! \param pfnCallback Called with the pairing result.
+//! \param pvArg Passed back to \e pfnCallback.
+//!
+//! \return xtrue if queued, xfalse if the command queue is full.
+//
+//*****************************************************************************
+xtBoolean BTPairingAsync(char *pRemoteDevAddr, unsigned char ucTimeOut,
+		tATCmdCallback pfnCallback, void *pvArg)
+{
+	char cCmd[AT_CMD_LEN_MAX];
+	char cTmp[5];
 
+	cCmd[0] = 0;
+	StrCat(cCmd, BtCmdDevicePairing);
+	StrCat(cCmd, pRemoteDevAddr);
+	StrCat(cCmd, ",");
+	StrCat(cCmd, Num2Str(ucTimeOut, cTmp, 10));
 
+	//
+	// Give the module one more second than its own pairing timeout.
+	//
+	return ATCmdSend(&s_sBTATEngine, cCmd, 0, 0,
+			((unsigned long)ucTimeOut + 1) * TEL0026_AT_TICKS_PER_SEC,
+			pfnCallback, pvArg);
+}
 
+//*****************************************************************************
+//
+//! \brief Connect to a remote device without blocking.
+//!
+//! \param pRemoteDevAddr The remote device address(format like: 1234,56,abcdef)
+//! \param pfnCallback Called with the result of the link command.
+//! \param pvArg Passed back to \e pfnCallback.
+//!
+//! This function queues the same sequence as BTDeviceConnect(): master role,
+//! SPP init (an already initialized SPP lib is accepted) and link.
+//!
+//! \return xtrue if queued, xfalse if the command queue is full.
+//
+//*****************************************************************************
+xtBoolean BTDeviceConnectAsync(char *pRemoteDevAddr,
+		tATCmdCallback pfnCallback, void *pvArg)
+{
+	char cCmd[AT_CMD_LEN_MAX];
+	char cRole[2];
+
+	cRole[0] = BT_ROLE_MASTER;
+	cRole[1] = 0;
+	cCmd[0] = 0;
+	StrCat(cCmd, BtCmdRoleSet);
+	StrCat(cCmd, cRole);
+	if(!ATCmdSend(&s_sBTATEngine, cCmd, 0, 0, TEL0026_AT_TIMEOUT,
+			0, 0))
+	{
+		return xfalse;
+	}
+	if(!ATCmdSend(&s_sBTATEngine, BtCmdInitSppLib, "OK|ERROR:(17)", 0,
+			TEL0026_AT_TIMEOUT, 0, 0))
+	{
+		return xfalse;
+	}
 
+	cCmd[0] = 0;
+	StrCat(cCmd, BtCmdDevConnect);
+	StrCat(cCmd, pRemoteDevAddr);
+	return ATCmdSend(&s_sBTATEngine, cCmd, 0, 0,
+			TEL0026_AT_LINK_TIMEOUT, pfnCallback, pvArg);
+}
 
+//*****************************************************************************
+//
+//! \brief Register a handler for unsolicited lines from TEL0026.
+//!
+//! \param pcPattern The line pattern, e.g. "+DISC:*" or "CONNECT*".
+//! \param pfnCallback Called from BTATPoll() for each matching line.
+//! \param pvArg Passed back to \e pfnCallback.
+//!
+//! \return xtrue if registered, xfalse if the handler table is full.
+//
+//*****************************************************************************
+xtBoolean BTURCRegister(const char *pcPattern, tATURCCallback pfnCallback,
+		void *pvArg)
+{
+	return ATCmdURCRegister(&s_sBTATEngine, pcPattern, pfnCallback, pvArg);
+}
 
+//*****************************************************************************
+//
+//! \brief Process TEL0026 responses and timeouts.
+//!
+//! This function is to be called from the application main loop. It never
+//! blocks, all the asynchronous callbacks are called from here.
+//!
+//! \return None.
+//
+//*****************************************************************************
+void BTATPoll(void)
+{
+	ATCmdPoll(&s_sBTATEngine);
+}
 
-
-
-
+//*****************************************************************************
+//
+//! \brief Advance the TEL0026 command timeout timebase.
+//!
+//! \param ulTicks Ticks elapsed since the last call, see
+//! TEL0026_AT_TICKS_PER_SEC.
+//!
+//! This function is to be called from a periodic timer interrupt.
+//!
+//! \return None.
+//
+//*****************************************************************************
+void BTATTick(unsigned long ulTicks)
+{
+	ATCmdTick(&s_sBTATEngine, ulTicks);
+}
@@ -85,6 +85,13 @@ extern "C"
 #define TEL0026_DEFAULT_BAUDRATE   38400
 
 #define TEL0026_MAX_SCAN_DEVICES   4
+
+//
+// Asynchronous AT command timing, in BTATTick() ticks
+//
+#define TEL0026_AT_TICKS_PER_SEC   1000
+#define TEL0026_AT_TIMEOUT         1000
+#define TEL0026_AT_LINK_TIMEOUT    20000
 //*****************************************************************************
 //
 //! @}
@@ -157,6 +164,17 @@ extern tBtResult BTAutoConnect(void);
 extern tBtResult BTSingleIOControl(char *pPioBit, char *pLevel);
 extern void BTWaitForConnect(void);
 extern tBtResult BTInit(void);
+extern tBtResult BTResultDecode(const char *pcLine);
+extern xtBoolean BTCmdAsync(const char *pcCmd, unsigned long ulTimeOut,
+		tATCmdCallback pfnCallback, void *pvArg);
+extern xtBoolean BTPairingAsync(char *pRemoteDevAddr, unsigned char ucTimeOut,
+		tATCmdCallback pfnCallback, void *pvArg);
+extern xtBoolean BTDeviceConnectAsync(char *pRemoteDevAddr,
+		tATCmdCallback pfnCallback, void *pvArg);
+extern xtBoolean BTURCRegister(const char *pcPattern,
+		tATURCCallback pfnCallback, void *pvArg);
+extern void BTATPoll(void);
+extern void BTATTick(unsigned long ulTicks);
 //*****************************************************************************
 //
 //! @}
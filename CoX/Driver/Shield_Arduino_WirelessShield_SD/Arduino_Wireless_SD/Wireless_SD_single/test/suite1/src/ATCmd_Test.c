@@ -0,0 +1,236 @@
+//*****************************************************************************
+//
+//! @page ATCmd_testcase ATCmd engine test
+//!
+//! File: @ref ATCmd.c
+//!
+//! <h2>Description</h2>
+//! This module implements the test sequence for the AT command engine.<br><br>
+//! - \p Board: STM32 <br><br>
+//! - \p Last-Time(about): 0.1s <br><br>
+//! - \p Phenomenon: Success or failure information will be printed on the UART. <br><br>
+//! .
+//!
+//! <h2>Preconditions</h2>
+//! The module requires the following options:<br><br>
+//! - \p Option-define:
+//! <br>(1)None.<br><br>
+//! - \p Option-hardware:
+//! <br>(1)None, the module responses are fed to the engine by the test.<br><br>
+//! - \p Option-OtherModule:
+//! <br>Connect an COM cable to the development board.<br>
+//! .
+//! In case some of the required options are not enabled then some or all tests
+//! may be skipped or result FAILED.<br>
+//!
+//! <h2>Test Cases</h2>
+//! The module contain those sub tests:<br><br>
+//! - \subpage test_ATCmd_Engine
+//! .
+//! \file ATCmd.c
+//! \brief ATCmd test source file
+//! \file ATCmd.h
+//! \brief ATCmd test header file <br>
+//
+//*****************************************************************************
+
+#include "test.h"
+#include "ATCmd.h"
+
+static tATEngine sATEngine;
+
+//
+// What the engine sent to the "module".
+//
+static char cSent[64];
+static unsigned long ulSentLen;
+
+//
+// What the callbacks saw.
+//
+static unsigned char ucLastResult;
+static unsigned long ulLineCnt;
+static unsigned long ulDoneCnt;
+static unsigned long ulURCCnt;
+
+//*****************************************************************************
+//
+//! \brief Fake port send function, records the sent bytes.
+//!
+//! \return None.
+//
+//*****************************************************************************
+static void ATCmdTestSend(void *pvPort, const char *pcData, unsigned long ulLen)
+{
+    while(ulLen--)
+    {
+        if(ulSentLen < sizeof(cSent) - 1)
+        {
+            cSent[ulSentLen++] = *pcData;
+        }
+        pcData++;
+    }
+    cSent[ulSentLen] = 0;
+}
+
+//*****************************************************************************
+//
+//! \brief Feed a string to the engine as if received by the UART ISR.
+//!
+//! \return None.
+//
+//*****************************************************************************
+static void ATCmdTestFeed(const char *pcStr)
+{
+    while(*pcStr)
+    {
+        ATCmdRxByte(&sATEngine, *pcStr++);
+    }
+}
+
+static void ATCmdTestCallback(void *pvArg, unsigned char ucResult,
+                              const char *pcLine)
+{
+    if(ucResult == AT_RES_LINE)
+    {
+        ulLineCnt++;
+    }
+    else
+    {
+        ucLastResult = ucResult;
+        ulDoneCnt++;
+    }
+}
+
+static void ATCmdTestURC(void *pvArg, const char *pcLine)
+{
+    ulURCCnt++;
+}
+
+//*****************************************************************************
+//
+//! \brief Get the Test description of ATCmd engine test.
+//!
+//! \return the desccription of the ATCmd test.
+//
+//*****************************************************************************
+static char* ATCmdGetTest(void)
+{
+    return "ATCmd engine test";
+}
+
+//*****************************************************************************
+//
+//! \brief something should do before the test execute of ATCmd test.
+//!
+//! \return None.
+//
+//*****************************************************************************
+static void ATCmdSetup(void)
+{
+    ATCmdEngineInit(&sATEngine, ATCmdTestSend, 0);
+    ulSentLen = 0;
+    ulLineCnt = 0;
+    ulDoneCnt = 0;
+    ulURCCnt = 0;
+}
+
+//*****************************************************************************
+//
+//! \brief something should do after the test execute of ATCmd test.
+//!
+//! \return None.
+//
+//*****************************************************************************
+static void ATCmdTearDown(void)
+{
+
+}
+
+//*****************************************************************************
+//
+//! \brief ATCmd test execute main body.
+//!
+//! \return None.
+//
+//*****************************************************************************
+static void ATCmdExecute(void)
+{
+    TestAssert(ATCmdMatch("OK", "OK"), "ATCmd API \"ATCmdMatch()\"error!");
+    TestAssert(ATCmdMatch("ERROR*|FAIL", "FAIL"),
+               "ATCmd API \"ATCmdMatch()\"error!");
+    TestAssert(ATCmdMatch("ERROR*|FAIL", "ERROR:(1D)"),
+               "ATCmd API \"ATCmdMatch()\"error!");
+    TestAssert(ATCmdMatch("+NAME:*", "+NAME:Bee"),
+               "ATCmd API \"ATCmdMatch()\"error!");
+    TestAssert(!ATCmdMatch("OK", "OKAY"), "ATCmd API \"ATCmdMatch()\"error!");
+
+    //
+    // The first command is sent at once, the second one waits.
+    //
+    TestAssert(ATCmdSend(&sATEngine, "AT+NAME?", 0, 0, 100,
+                         ATCmdTestCallback, 0),
+               "ATCmd API \"ATCmdSend()\"error!");
+    TestAssert(ATCmdSend(&sATEngine, "AT+LINK=1,2,3", 0, 0, 100,
+                         ATCmdTestCallback, 0),
+               "ATCmd API \"ATCmdSend()\"error!");
+    TestAssert((ulSentLen == 10) && (cSent[8] == '\r'),
+               "ATCmd API \"ATCmdSend()\"error!");
+
+    TestAssert(ATCmdURCRegister(&sATEngine, "+DISC:*", ATCmdTestURC, 0),
+               "ATCmd API \"ATCmdURCRegister()\"error!");
+
+    //
+    // Intermediate line, URC and final line split across feeds.
+    //
+    ATCmdTestFeed("+NAME:Bee\r\n+DISC:SUCC");
+    ATCmdTestFeed("ESS\r\nO");
+    ATCmdPoll(&sATEngine);
+    TestAssert((ulLineCnt == 1) && (ulURCCnt == 1) && (ulDoneCnt == 0),
+               "ATCmd API \"ATCmdPoll()\"error!");
+    ATCmdTestFeed("K\r\n");
+    ATCmdPoll(&sATEngine);
+    TestAssert((ulDoneCnt == 1) && (ucLastResult == AT_RES_OK),
+               "ATCmd API \"ATCmdPoll()\"error!");
+    TestAssert(ulSentLen == 25, "ATCmd API \"ATCmdPoll()\"error!");
+
+    //
+    // The second command times out.
+    //
+    ATCmdTick(&sATEngine, 99);
+    ATCmdPoll(&sATEngine);
+    TestAssert(ulDoneCnt == 1, "ATCmd API \"ATCmdTick()\"error!");
+    ATCmdTick(&sATEngine, 1);
+    ATCmdPoll(&sATEngine);
+    TestAssert((ulDoneCnt == 2) && (ucLastResult == AT_RES_TIMEOUT),
+               "ATCmd API \"ATCmdTick()\"error!");
+    TestAssert(ATCmdIdle(&sATEngine), "ATCmd API \"ATCmdIdle()\"error!");
+
+    //
+    // Error response.
+    //
+    ATCmdSend(&sATEngine, "AT+INIT", 0, 0, 0, ATCmdTestCallback, 0);
+    ATCmdTestFeed("ERROR:(17)\r\n");
+    ATCmdPoll(&sATEngine);
+    TestAssert((ulDoneCnt == 3) && (ucLastResult == AT_RES_ERROR),
+               "ATCmd API \"ATCmdPoll()\"error!");
+}
+
+//
+// ATCmd engine test case struct.
+//
+const tTestCase sTestATCmdEngine = {
+        ATCmdGetTest,
+        ATCmdSetup,
+        ATCmdTearDown,
+        ATCmdExecute
+};
+
+//
+// ATCmd test suits.
+//
+const tTestCase * const psPatternATCmdTest[] =
+{
+    &sTestATCmdEngine,
+    0
+};
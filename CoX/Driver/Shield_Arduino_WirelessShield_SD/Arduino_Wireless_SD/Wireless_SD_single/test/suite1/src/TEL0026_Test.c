@@ -37,6 +37,7 @@
 
 #include "test.h"
 #include "hw_TEL0026.h"
+#include "ATCmd.h"
 #include "TEL0026.h"
 
 #define Length 64
@@ -24,6 +24,7 @@ const tTestCase * const* g_psPatterns[] =  {
     // .... test
     //
     psPatternTEL0026Test,
+    psPatternATCmdTest,
 
     //
     // end
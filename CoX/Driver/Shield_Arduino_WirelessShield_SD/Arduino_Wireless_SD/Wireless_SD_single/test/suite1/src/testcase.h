@@ -58,6 +58,7 @@ extern const tTestCase * const* g_psPatterns[];
 //
 //*****************************************************************************
 extern const tTestCase * const psPatternTEL0026Test[];
+extern const tTestCase * const psPatternATCmdTest[];
 
 
 
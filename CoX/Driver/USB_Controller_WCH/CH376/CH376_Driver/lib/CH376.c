@@ -50,6 +50,15 @@
 #ifdef CH376_USE_HARDWARE_SPI
 #include "xhw_spi.h"
 #include "xspi.h"
+#ifdef CH376_USE_SPI_DMA
+#include "xhw_dma.h"
+#include "xdma.h"
+#endif
+#endif
+
+#ifdef CH376_INT_IRQ
+#include "xhw_ints.h"
+#include "xcore.h"
 #endif
 
 
@@ -57,6 +66,53 @@
 #define CH376_INT_REQ() xGPIOSPinRead(CH376_INT_PIN)
 #endif
 
+#ifdef CH376_INT_IRQ
+//
+// User callback called from the INT# interrupt
+//
+static xtEventCallback s_pfnCH376IntCallback = 0;
+
+//*****************************************************************************
+//
+//! \brief CH376 INT# falling edge interrupt handler.
+//!
+//! \param pvCBData Not used.
+//! \param ulEvent Not used.
+//! \param ulMsgParam Not used.
+//! \param pvMsgData Not used.
+//!
+//! \return Always 0.
+//
+//*****************************************************************************
+static unsigned long CH376IntHandler(void *pvCBData, unsigned long ulEvent,
+                                     unsigned long ulMsgParam, void *pvMsgData)
+{
+    if(s_pfnCH376IntCallback)
+    {
+        s_pfnCH376IntCallback(0, 0, 0, 0);
+    }
+    return 0;
+}
+
+//*****************************************************************************
+//
+//! \brief Register a callback for the CH376 INT# falling edge.
+//!
+//! \param pfnCallback Called from the GPIO interrupt when CH376 asserts INT#,
+//! 0 to remove it.
+//!
+//! \details A caller can start a CH376 command, do other work or sleep, and
+//! fetch the status with CH376GetIntStatus() once notified.
+//!
+//! \return None.
+//
+//*****************************************************************************
+void CH376IntCallbackInit( xtEventCallback pfnCallback )
+{
+    s_pfnCH376IntCallback = pfnCallback;
+}
+#endif
+
 
 #ifdef CH376_USE_HARDWARE_SPI  //hardware spi macros and read/write function define
 #define CH376_SPI_CS_SET    xGPIOSPinWrite(CH376_SPI_CS_PIN,1)
@@ -135,6 +191,144 @@ void    xWriteCH376Data( UINT8 mData )
     xSPISingleDataReadWrite( CH376_SPI_PORT, mData);
 }
 
+#ifdef CH376_USE_SPI_DMA
+static unsigned long s_ulCH376DMARx = xDMA_CHANNEL_NOT_EXIST;
+static unsigned long s_ulCH376DMATx = xDMA_CHANNEL_NOT_EXIST;
+
+//*****************************************************************************
+//
+//! \brief Assign and configure the SPI RX/TX DMA channels.
+//!
+//! \param None
+//!
+//! \return None.
+//
+//*****************************************************************************
+static void CH376DMAInit( void )
+{
+    xSysCtlPeripheralEnable(xSYSCTL_PERIPH_DMA1);
+    s_ulCH376DMARx = DMAChannelDynamicAssign(CH376_DMA_RX_REQUEST,
+                                             DMA_REQUEST_MEM);
+    s_ulCH376DMATx = DMAChannelDynamicAssign(DMA_REQUEST_MEM,
+                                             CH376_DMA_TX_REQUEST);
+    DMAChannelControlSet(s_ulCH376DMARx, DMA_MEM_WIDTH_8BIT |
+                                         DMA_PER_WIDTH_8BIT |
+                                         DMA_MEM_DIR_INC |
+                                         DMA_PER_DIR_FIXED);
+    DMAChannelControlSet(s_ulCH376DMATx, DMA_MEM_WIDTH_8BIT |
+                                         DMA_PER_WIDTH_8BIT |
+                                         DMA_MEM_DIR_INC |
+                                         DMA_PER_DIR_FIXED);
+}
+
+//*****************************************************************************
+//
+//! \brief Wait for a DMA channel to complete and clear its flag.
+//!
+//! \param ulChannelID DMA channel to wait for.
+//!
+//! \return None.
+//
+//*****************************************************************************
+static void CH376DMAWait( unsigned long ulChannelID )
+{
+    while(!DMAChannelIntFlagGet(ulChannelID, DMA_INT_TC));
+    DMAChannelIntFlagClear(ulChannelID, DMA_INT_TC);
+    DMADisable(ulChannelID);
+}
+#endif
+
+//*****************************************************************************
+//
+//! \brief Read a block of data from CH376.
+//!
+//! \param buf Buffer to store the data.
+//! \param len Number of bytes to read.
+//!
+//! \details With CH376_USE_SPI_DMA the block is clocked in by DMA. The
+//! buffer is filled with 0xFF first and also used as the TX source, so the
+//! dummy bytes on MOSI need no extra buffer.
+//!
+//! \return None.
+//
+//*****************************************************************************
+void xReadCH376Block( PUINT8 buf, UINT8 len )
+{
+#ifdef CH376_USE_SPI_DMA
+    UINT8 i;
+
+    if(len >= CH376_DMA_MIN_LEN)
+    {
+        for(i = 0; i < len; i++)
+        {
+            buf[i] = 0xFF;
+        }
+
+        //
+        // DMAChannelTransferSet() writes its source to CPAR, so the data
+        // register goes first for both directions.
+        //
+        DMAChannelTransferSet(s_ulCH376DMARx, (void *)(CH376_SPI_PORT + SPI_DR),
+                              buf, len);
+        DMAChannelTransferSet(s_ulCH376DMATx, (void *)(CH376_SPI_PORT + SPI_DR),
+                              buf, len);
+        DMAEnable(s_ulCH376DMARx);
+        DMAEnable(s_ulCH376DMATx);
+        xSPIDMAEnable(CH376_SPI_PORT, xSPI_DMA_BOTH);
+
+        CH376DMAWait(s_ulCH376DMARx);
+        CH376DMAWait(s_ulCH376DMATx);
+        xSPIDMADisable(CH376_SPI_PORT, xSPI_DMA_BOTH);
+        return;
+    }
+#endif
+    while(len--)
+    {
+        *buf++ = xSPISingleDataReadWrite(CH376_SPI_PORT, 0xFF);
+    }
+}
+
+//*****************************************************************************
+//
+//! \brief Write a block of data to CH376.
+//!
+//! \param buf Data to be written.
+//! \param len Number of bytes to write.
+//!
+//! \details With CH376_USE_SPI_DMA the block is clocked out by DMA, the
+//! received bytes are dropped.
+//!
+//! \return None.
+//
+//*****************************************************************************
+void xWriteCH376Block( PUINT8 buf, UINT8 len )
+{
+#ifdef CH376_USE_SPI_DMA
+    if(len >= CH376_DMA_MIN_LEN)
+    {
+        DMAChannelTransferSet(s_ulCH376DMATx, (void *)(CH376_SPI_PORT + SPI_DR),
+                              buf, len);
+        DMAEnable(s_ulCH376DMATx);
+        xSPIDMAEnable(CH376_SPI_PORT, xSPI_DMA_TX);
+        CH376DMAWait(s_ulCH376DMATx);
+        xSPIDMADisable(CH376_SPI_PORT, xSPI_DMA_TX);
+
+        //
+        // Let the last byte leave the shifter, then drop RXNE and OVR.
+        //
+        while(!(xHWREG(CH376_SPI_PORT + SPI_SR) & SPI_SR_TXE));
+        while(xHWREG(CH376_SPI_PORT + SPI_SR) & SPI_SR_BSY);
+        xHWREG(CH376_SPI_PORT + SPI_DR);
+        xHWREG(CH376_SPI_PORT + SPI_SR);
+        return;
+    }
+#endif
+    while(len--)
+    {
+        xSPISingleDataReadWrite(CH376_SPI_PORT, *buf++);
+    }
+}
+
 #endif  //End of define CH376_USE_HARDWARE_SPI
 
 
@@ -272,6 +466,42 @@ UINT8 xReadCH376Data( void )
     return( SPIDataIn());
 }
 
+//*****************************************************************************
+//
+//! \brief Read a block of data from CH376.
+//!
+//! \param buf Buffer to store the data.
+//! \param len Number of bytes to read.
+//!
+//! \return None.
+//
+//*****************************************************************************
+void xReadCH376Block( PUINT8 buf, UINT8 len )
+{
+    while(len--)
+    {
+        *buf++ = SPIDataIn();
+    }
+}
+
+//*****************************************************************************
+//
+//! \brief Write a block of data to CH376.
+//!
+//! \param buf Data to be written.
+//! \param len Number of bytes to write.
+//!
+//! \return None.
+//
+//*****************************************************************************
+void xWriteCH376Block( PUINT8 buf, UINT8 len )
+{
+    while(len--)
+    {
+        SPIDataOut(*buf++);
+    }
+}
+
 #endif  //End of define CH376_USE_SOFTWARE_SPI
 
 #ifdef CH376_USE_PARALLEL  //parallel macros and read/write function define
@@ -398,6 +628,51 @@ unsigned char xReadCH376Data(void)
     CH376_PCS_SET;
     return res;
 }
+
+//*****************************************************************************
+//
+//! \brief Read a block of data from CH376.
+//!
+//! \param buf Buffer to store the data.
+//! \param len Number of bytes to read.
+//!
+//! \return None.
+//
+//*****************************************************************************
+void xReadCH376Block( PUINT8 buf, UINT8 len )
+{
+    while(len--)
+    {
+        *buf++ = xReadCH376Data();
+    }
+}
+
+//*****************************************************************************
+//
+//! \brief Write a block of data to CH376.
+//!
+//! \param buf Data to be written.
+//! \param len Number of bytes to write.
+//!
+//! \details The data port is switched to output once for the whole block.
+//!
+//! \return None.
+//
+//*****************************************************************************
+void xWriteCH376Block( PUINT8 buf, UINT8 len )
+{
+    xGPIODirModeSet( CH376_DATA_PORT, 0xFF, xGPIO_DIR_MODE_OUT );
+    CH376_A0_CLR;
+    while(len--)
+    {
+        CH376_PCS_CLR;
+        CH376_WR_CLR;
+        CH376_PARA_DATA_OUT( *buf++ );
+        CH376_WR_SET;
+        CH376_PCS_SET;
+    }
+    xGPIODirModeSet( CH376_DATA_PORT, 0xFF, xGPIO_DIR_MODE_IN );
+}
 #endif  //End of define CH376_USE_PARALLEL
 
 //*****************************************************************************
@@ -504,6 +779,13 @@ void	CH376PortInit( void )
     xSysCtlPeripheralEnable2(CH376_INT_PORT);
     xGPIOSPinDirModeSet(CH376_INT_PIN, xGPIO_DIR_MODE_IN); //pass
     xGPIOSPinWrite(CH376_INT_PIN, 1);
+#ifdef CH376_INT_IRQ
+    xSysCtlPeripheralEnable(SYSCTL_PERIPH_AFIO);
+    xGPIOPinIntCallbackInit(xGPIOSPinToPort(CH376_INT_PIN),
+                            xGPIOSPinToPin(CH376_INT_PIN), CH376IntHandler);
+    xGPIOSPinIntEnable(CH376_INT_PIN, xGPIO_FALLING_EDGE);
+    xIntEnable(CH376_INT_IRQ_NUM);
+#endif
 #endif
 #ifdef CH376_USE_HARDWARE_SPI
     xSysCtlPeripheralEnable2(CH376_SPI_CS_PORT);
@@ -528,6 +810,9 @@ void	CH376PortInit( void )
     xSPISSSet( CH376_SPI_PORT, xSPI_SS_SOFTWARE, xSPI_SS0 );
     SPIEnble(CH376_SPI_PORT);
     CH376_SPI_CS_SET;
+#ifdef CH376_USE_SPI_DMA
+    CH376DMAInit( );
+#endif
 #endif  //End of CH376_USE_HARDWARE_SPI define
 
 #ifdef CH376_USE_SOFTWARE_SPI
@@ -114,6 +114,20 @@ extern "C"
 #define CH376_INT_WIRE
 //#define CH376_SPI_SDO_INT
 
+//
+//! Define CH376_INT_IRQ to catch the falling edge of INT# with a GPIO
+//! interrupt and call the callback set by CH376IntCallbackInit(), so the MCU
+//! can do other work or sleep while CH376 is busy instead of polling the pin.
+//! Only valid together with CH376_INT_WIRE.
+//
+//#define CH376_INT_IRQ
+
+//
+//! Define CH376_USE_SPI_DMA to move the 64-byte endpoint buffers with DMA
+//! instead of one SPI call per byte. Only valid with CH376_USE_HARDWARE_SPI.
+//
+//#define CH376_USE_SPI_DMA
+
 
 //
 //! specify interrupt input pin of MCU
@@ -121,6 +135,9 @@ extern "C"
 #ifdef CH376_INT_WIRE
 #define CH376_INT_PORT     xGPIO_PORTC_BASE
 #define CH376_INT_PIN      PC0
+#ifdef CH376_INT_IRQ
+#define CH376_INT_IRQ_NUM  INT_EXTI0
+#endif
 #endif
 
 //
@@ -142,6 +159,17 @@ extern "C"
 #define CH376_SPI_CS_PORT      xGPIO_PORTA_BASE
 #define CH376_SPI_CS_PIN       PA1
 
+//
+//! DMA requests of CH376_SPI_PORT, used when CH376_USE_SPI_DMA is defined
+//
+#define CH376_DMA_RX_REQUEST   DMA_REQUEST_SPI1_RX
+#define CH376_DMA_TX_REQUEST   DMA_REQUEST_SPI1_TX
+
+//
+//! Blocks shorter than this are moved by the CPU, DMA setup costs more
+//
+#define CH376_DMA_MIN_LEN      8
+
 #endif
 
 //
@@ -231,11 +259,28 @@ extern void	xWriteCH376Data( UINT8 mData );
 //
 extern UINT8	xReadCH376Data( void );
 
+//
+//! Read a block of data from CH376
+//
+extern void	xReadCH376Block( PUINT8 buf, UINT8 len );
+
+//
+//! Write a block of data to CH376
+//
+extern void	xWriteCH376Block( PUINT8 buf, UINT8 len );
+
 //
 //! Query interrupt(low level of INT#)
 //
 extern UINT8	Query376Interrupt( void );
 
+#ifdef CH376_INT_IRQ
+//
+//! Register a callback for the INT# falling edge
+//
+extern void	CH376IntCallbackInit( xtEventCallback pfnCallback );
+#endif
+
 //
 //! Initialize CH376
 //
@@ -15,6 +15,7 @@
 /*  EN_LONG_NAME ṩֳ֧ļӳ,Ĭǲṩ */
 /*  DEF_IC_V43_U ȥֵ֧Ͱ汾ĳ,֧V4.3ϰ汾CH376оƬ,Ĭֵ֧Ͱ汾 */
 
+#include    "xhw_types.h"
 #include	"hw_CH376INC.H"
 #include    "CH376.H"
 #include	"CH376_FS.H"
@@ -24,15 +25,7 @@ UINT8	CH376ReadBlock( PUINT8 buf )  /* 
     UINT8	s, l;
     xWriteCH376Cmd( CMD01_RD_USB_DATA0 );
     s = l = xReadCH376Data( );  /*  */
-    if ( l )
-    {
-        do
-        {
-            *buf = xReadCH376Data( );
-            buf ++;
-        }
-        while ( -- l );
-    }
+    if ( l ) xReadCH376Block( buf, l );  /* one burst, DMA when the port has it */
     xEndCH376Cmd( );
     return( s );
 }
@@ -42,15 +35,7 @@ UINT8	CH376WriteReqBlock( PUINT8 buf )  /* 
     UINT8	s, l;
     xWriteCH376Cmd( CMD01_WR_REQ_DATA );
     s = l = xReadCH376Data( );  /*  */
-    if ( l )
-    {
-        do
-        {
-            xWriteCH376Data( *buf );
-            buf ++;
-        }
-        while ( -- l );
-    }
+    if ( l ) xWriteCH376Block( buf, l );  /* one burst, DMA when the port has it */
     xEndCH376Cmd( );
     return( s );
 }
@@ -59,15 +44,7 @@ void	CH376WriteHostBlock( PUINT8 buf, UINT8 len )  /* 
 {
     xWriteCH376Cmd( CMD10_WR_HOST_DATA );
     xWriteCH376Data( len );  /*  */
-    if ( len )
-    {
-        do
-        {
-            xWriteCH376Data( *buf );
-            buf ++;
-        }
-        while ( -- len );
-    }
+    if ( len ) xWriteCH376Block( buf, len );
     xEndCH376Cmd( );
 }
 
@@ -76,15 +53,7 @@ void	CH376WriteOfsBlock( PUINT8 buf, UINT8 ofs, UINT8 len )  /* 
     xWriteCH376Cmd( CMD20_WR_OFS_DATA );
     xWriteCH376Data( ofs );  /* ƫƵַ */
     xWriteCH376Data( len );  /*  */
-    if ( len )
-    {
-        do
-        {
-            xWriteCH376Data( *buf );
-            buf ++;
-        }
-        while ( -- len );
-    }
+    if ( len ) xWriteCH376Block( buf, len );
     xEndCH376Cmd( );
 }
 
@@ -612,6 +581,91 @@ UINT8	CH376DiskWriteSec( PUINT8 buf, UINT32 iLbaStart, UINT8 iSectorCount )  /*
     return( s );  /* ʧ */
 }
 
+UINT8	CH376DiskReadSecStream( UINT32 iLbaStart, UINT8 iSectorCount, tCH376SecStream pfnSecBuf, void *pvArg )  /* Read sectors from the disk into buffers supplied per sector */
+/* pfnSecBuf is called before each sector with the sector index, the sector returned by the previous call is complete at that point */
+{
+    UINT8	s, err, i, n, d;
+    PUINT8	buf;
+    s = USB_INT_SUCCESS;
+    d = 0;  /* sectors already done by earlier tries */
+    for ( err = 0; err != 3 && iSectorCount != 0; ++ err )    /* retry from the failed sector */
+    {
+        xWriteCH376Cmd( CMD5H_DISK_READ );  /* one command for the whole run */
+        xWriteCH376Data( (UINT8)iLbaStart );
+        xWriteCH376Data( (UINT8)( (UINT16)iLbaStart >> 8 ) );
+        xWriteCH376Data( (UINT8)( iLbaStart >> 16 ) );
+        xWriteCH376Data( (UINT8)( iLbaStart >> 24 ) );
+        xWriteCH376Data( iSectorCount );
+        xEndCH376Cmd( );
+        for ( i = 0; i != iSectorCount; ++ i )
+        {
+            buf = pfnSecBuf( pvArg, (UINT8)( d + i ) );
+            for ( n = DEF_SECTOR_SIZE / CH376_DAT_BLOCK_LEN; n != 0; -- n )
+            {
+                s = Wait376Interrupt( );
+                if ( s != USB_INT_DISK_READ ) break;
+                buf += CH376ReadBlock( buf );
+                xWriteCH376Cmd( CMD0H_DISK_RD_GO );
+                xEndCH376Cmd( );
+            }
+            if ( n != 0 ) break;  /* sector i incomplete */
+        }
+        if ( i == iSectorCount )
+        {
+            return( Wait376Interrupt( ) );  /* all data moved, final status */
+        }
+        if ( s == USB_INT_DISCONNECT ) return( s );  /* disk removed */
+        CH376DiskReqSense( );
+        iLbaStart += i;  /* sectors before i are done */
+        iSectorCount -= i;
+        d += i;
+    }
+    return( s );
+}
+
+UINT8	CH376DiskWriteSecStream( UINT32 iLbaStart, UINT8 iSectorCount, tCH376SecStream pfnSecBuf, void *pvArg )  /* Write sectors to the disk from buffers supplied per sector */
+/* pfnSecBuf is called before each sector with the sector index, the sector returned by the previous call has been consumed at that point */
+{
+    UINT8	s, err, i, n, d;
+    PUINT8	buf;
+    s = USB_INT_SUCCESS;
+    d = 0;  /* sectors already done by earlier tries */
+    for ( err = 0; err != 3 && iSectorCount != 0; ++ err )    /* retry from the failed sector */
+    {
+        xWriteCH376Cmd( CMD5H_DISK_WRITE );  /* one command for the whole run */
+        xWriteCH376Data( (UINT8)iLbaStart );
+        xWriteCH376Data( (UINT8)( (UINT16)iLbaStart >> 8 ) );
+        xWriteCH376Data( (UINT8)( iLbaStart >> 16 ) );
+        xWriteCH376Data( (UINT8)( iLbaStart >> 24 ) );
+        xWriteCH376Data( iSectorCount );
+        xEndCH376Cmd( );
+        for ( i = 0; i != iSectorCount; ++ i )
+        {
+            buf = pfnSecBuf( pvArg, (UINT8)( d + i ) );
+            for ( n = DEF_SECTOR_SIZE / CH376_DAT_BLOCK_LEN; n != 0; -- n )
+            {
+                s = Wait376Interrupt( );
+                if ( s != USB_INT_DISK_WRITE ) break;
+                CH376WriteHostBlock( buf, CH376_DAT_BLOCK_LEN );
+                xWriteCH376Cmd( CMD0H_DISK_WR_GO );
+                xEndCH376Cmd( );
+                buf += CH376_DAT_BLOCK_LEN;
+            }
+            if ( n != 0 ) break;  /* sector i incomplete */
+        }
+        if ( i == iSectorCount )
+        {
+            return( Wait376Interrupt( ) );  /* all data moved, final status */
+        }
+        if ( s == USB_INT_DISCONNECT ) return( s );  /* disk removed */
+        CH376DiskReqSense( );
+        iLbaStart += i;  /* sectors before i are done */
+        iSectorCount -= i;
+        d += i;
+    }
+    return( s );
+}
+
 UINT8	CH376SecRead( PUINT8 buf, UINT8 ReqCount, PUINT8 RealCount )  /* Ϊλӵǰλöȡݿ,֧SD */
 {
     UINT8	s;
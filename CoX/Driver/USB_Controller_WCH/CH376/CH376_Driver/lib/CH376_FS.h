@@ -312,6 +312,25 @@ extern UINT8	CH376DiskReadSec( PUINT8 buf, UINT32 iLbaStart, UINT8 iSectorCount
 //
 extern UINT8	CH376DiskWriteSec( PUINT8 buf, UINT32 iLbaStart, UINT8 iSectorCount );
 
+//
+//! Per-sector buffer callback for the stream functions, returns the 512 byte
+//! buffer for sector \e ucSector of the run. When it is called for sector n,
+//! the buffer of sector n-1 has been filled (read) or consumed (write).
+//! \e ucSector counts from 0 at \e iLbaStart. After an error the run is
+//! retried from the failed sector, so the same sector may be requested again.
+//
+typedef PUINT8 (*tCH376SecStream)( void *pvArg, UINT8 ucSector );
+
+//
+//! Read multiple sectors with one disk command into buffers given per sector
+//
+extern UINT8	CH376DiskReadSecStream( UINT32 iLbaStart, UINT8 iSectorCount, tCH376SecStream pfnSecBuf, void *pvArg );
+
+//
+//! Write multiple sectors with one disk command from buffers given per sector
+//
+extern UINT8	CH376DiskWriteSecStream( UINT32 iLbaStart, UINT8 iSectorCount, tCH376SecStream pfnSecBuf, void *pvArg );
+
 //
 //! Read data block from current address by unit of sector, do not support SD card
 //
@@ -26,6 +26,7 @@
 //! <h2>Test Cases</h2>
 //! The module contain those sub tests:<br><br>
 //! - \subpage test_CH376_Function
+//! - \subpage test_CH376_Block
 //! .
 //! \file CH376Test.c
 //! \brief CH376 test source file
@@ -43,6 +44,11 @@
 unsigned char ucWriteData[Length] = "U-disk write test\n\rOk\n\rsafhui3324\n\r";
 unsigned char ucReadData[Length] = {0};
 
+//
+// Bytes of the block transfer test, 8 full 64-byte endpoint buffers.
+//
+#define BLOCK_TEST_LEN  512
+
 //*****************************************************************************
 //
 //! \brief Get the Test description of CH376 Function test.
@@ -189,6 +195,108 @@ static void CH376Execute(void)
     printf("\n\r All test over!\n\r");
 
 }
+//*****************************************************************************
+//
+//!\page test_CH376_Block test_CH376_Block
+//!
+//!<h2>Description</h2>
+//!Test the block transfers, xWriteCH376Block() and xReadCH376Block() through
+//!CH376WriteReqBlock() and CH376ReadBlock(), in SPI DMA mode when
+//!CH376_USE_SPI_DMA is defined. <br>
+//!
+//
+//*****************************************************************************
+
+//*****************************************************************************
+//
+//! \brief Get the Test description of CH376 block transfer test.
+//!
+//! \return the desccription of the CH376 block test.
+//
+//*****************************************************************************
+static char *CH376BlockGetTest(void)
+{
+    return "CH376 block transfer test";
+}
+
+//*****************************************************************************
+//
+//! \brief CH376 block transfer test execute main body.
+//!
+//! \return None.
+//
+//*****************************************************************************
+static void CH376BlockExecute(void)
+{
+    unsigned char s;
+    UINT16 usDataCnt;
+    unsigned long i;
+
+    for ( s = 0; s < 10; s ++ )
+    {
+        mDelaymS( 50 );
+        if ( CH376DiskMount( ) == USB_INT_SUCCESS ) break;
+    }
+
+    //
+    // A pattern that differs in every byte of a 64-byte block, so a lost or
+    // repeated byte in a burst shows up.
+    //
+    for(i = 0; i < BLOCK_TEST_LEN; i++)
+    {
+        ucWriteData[i] = (unsigned char)(i * 7 + 3);
+    }
+
+    //
+    // Each USB_INT_DISK_WRITE takes one CH376WriteReqBlock() of up to 64
+    // bytes.
+    //
+    s = CH376FileCreatePath("/CH376TST/BLK.BIN");
+    TestAssert((s == USB_INT_SUCCESS), "CH376 API \"CH376FileCreatePath()\"error!");
+    s = CH376ByteWrite(ucWriteData, BLOCK_TEST_LEN, &usDataCnt);
+    TestAssert((s == USB_INT_SUCCESS) && (usDataCnt == BLOCK_TEST_LEN),
+               "CH376 API \"CH376WriteReqBlock()\"error!");
+    CH376FileClose(TRUE);
+
+    //
+    // Each USB_INT_DISK_READ takes one CH376ReadBlock() of up to 64 bytes.
+    //
+    s = CH376FileOpenPath("/CH376TST/BLK.BIN");
+    TestAssert((s == USB_INT_SUCCESS), "CH376 API \"CH376FileOpenPath()\"error!");
+    TestAssert((CH376GetFileSize() == BLOCK_TEST_LEN),
+               "CH376 API \"CH376WriteReqBlock()\"error!");
+    for(i = 0; i < BLOCK_TEST_LEN; i++)
+    {
+        ucReadData[i] = 0;
+    }
+    s = CH376ByteRead(ucReadData, BLOCK_TEST_LEN, &usDataCnt);
+    TestAssert((s == USB_INT_SUCCESS) && (usDataCnt == BLOCK_TEST_LEN),
+               "CH376 API \"CH376ReadBlock()\"error!");
+    for(i = 0; i < BLOCK_TEST_LEN; i++)
+    {
+        TestAssert((ucReadData[i] == ucWriteData[i]),
+                   "CH376 API \"CH376ReadBlock()\"error!");
+    }
+
+    //
+    // From an odd offset the last block is short, 100 = 64 + 36.
+    //
+    CH376ByteLocate(1);
+    for(i = 0; i < 100; i++)
+    {
+        ucReadData[i] = 0;
+    }
+    s = CH376ByteRead(ucReadData, 100, &usDataCnt);
+    TestAssert((s == USB_INT_SUCCESS) && (usDataCnt == 100),
+               "CH376 API \"CH376ReadBlock()\"error!");
+    for(i = 0; i < 100; i++)
+    {
+        TestAssert((ucReadData[i] == ucWriteData[i + 1]),
+                   "CH376 API \"CH376ReadBlock()\"error!");
+    }
+    CH376FileClose(FALSE);
+}
+
 //
 // CH376 Function test case struct.
 //
@@ -200,11 +308,23 @@ const tTestCase sTestCH376Function =
     CH376Execute
 };
 
+//
+// CH376 block transfer test case struct.
+//
+const tTestCase sTestCH376Block =
+{
+    CH376BlockGetTest,
+    CH376Setup,
+    CH376TearDown,
+    CH376BlockExecute
+};
+
 //
 // CH376 test suits.
 //
 const tTestCase *const psPatternCH376Test[] =
 {
     &sTestCH376Function,
+    &sTestCH376Block,
     0
 };
@@ -26,6 +26,7 @@
 #include "xtimer.h"
 #include "cookie_cfg.h"
 #include "cookie.h"
+#include "StepMotion.h"
 #include "MotorShield.h"
 
 //
@@ -55,6 +56,16 @@ static unsigned long g_ul74HC595LatchState = 0;
 //
 static unsigned long g_ulStepsDelay = 0;
 
+//
+//! Phase of each stepper in the 8 phase sequence, used by the motion engine
+//
+static unsigned char g_ucStepPhase[2] = {0, 0};
+
+//
+//! 74HC595 bits of each stepper, merged and latched once per engine tick
+//
+static unsigned char g_ucStepLatch[2] = {0, 0};
+
 //*****************************************************************************
 //
 //! \brief Init the PWM corresponding pins, and enable the corresponding port.
@@ -678,7 +689,109 @@ MSDelay(unsigned long ulDelay)
 	  
 }
 
+//*****************************************************************************
+//
+//! \brief Advance one stepper by one phase, called by the motion engine.
+//!
+//! \param ulAxis is the stepper number.
+//! \param ulDir is STEP_MOTION_FORWARD or STEP_MOTION_BACKWARD.
+//!
+//! Only the stepper's latch bits are updated here, MSStepMotionCommit() sends
+//! them.
+//!
+//! \return None.
+//
+//*****************************************************************************
+static void
+MSStepMotionStep(unsigned long ulAxis, unsigned long ulDir)
+{
+    if(ulDir == STEP_MOTION_FORWARD)
+    {
+        g_ucStepPhase[ulAxis] = (g_ucStepPhase[ulAxis] + 1) & 7;
+    }
+    else
+    {
+        g_ucStepPhase[ulAxis] = (g_ucStepPhase[ulAxis] - 1) & 7;
+    }
+    g_ucStepLatch[ulAxis] =
+        (unsigned char)g_ul42BYGHForward[ulAxis][g_ucStepPhase[ulAxis]];
+}
 
+//*****************************************************************************
+//
+//! \brief Latch the bits of both steppers, called by the motion engine.
+//!
+//! \return None.
+//
+//*****************************************************************************
+static void
+MSStepMotionCommit(void)
+{
+    MS74HC595DataSend(g_ucStepLatch[0] | g_ucStepLatch[1]);
+}
 
+//*****************************************************************************
+//
+//! \brief Init the timer driven motion engine for both steppers.
+//!
+//! \param None
+//!
+//! The steppers in use must be initialized with MSStepMotorInit() as well.
+//! The engine uses STEP_MOTION_TIMER, which must differ from MS_DELAY_TIMER.
+//! 
+//! \return None.
+//
+//*****************************************************************************
+void 
+MSStepMotionInit(void)
+{
+    StepMotionInit(MSStepMotionStep, MSStepMotionCommit);
+    StepMotionTimerInit();
+}
 
+//*****************************************************************************
+//
+//! \brief Queue a move of a stepper and return at once.
+//!
+//! \param ulStepperNum is the selection of Stepper number.
+//! \param ulDir is the selection of Step Motor running direction.
+//! \param ulSteps is the number of phases to move, 8 for one pass of the
+//! sequence MSStepMotorRun() steps through.
+//! \param ulSpeed is the cruise speed in phases per second.
+//! \param ulAccel is the acceleration in phases per second squared, 0 for
+//! none.
+//! \param pfnDone is called from the timer interrupt when the move ends, can
+//! be 0.
+//! \param pvArg is passed to \e pfnDone.
+//!
+//! The \e ulStepperNum parameter can be one of the values:
+//! \b MS_STEPPER_NUM1, \b MS_STEPPER_NUM2.
+//!
+//! The \e ulDir parameter can be one of the values:
+//! \b MS_RUN_FORWARD, \b MS_RUN_BACKWARD.
+//!
+//! Both steppers can move at once, and moves of one stepper run one after
+//! the other. StepMotionIdle() and StepMotionStop() take the stepper number
+//! as the axis.
+//! 
+//! \return xtrue if the move was queued, xfalse if the queue was full.
+//
+//*****************************************************************************
+xtBoolean 
+MSStepMotorMove(unsigned long ulStepperNum, unsigned long ulDir,
+                unsigned long ulSteps, unsigned long ulSpeed,
+                unsigned long ulAccel, tStepMotionDone pfnDone, void *pvArg)
+{
+    //
+    // Check the arguments.
+    //
+    xASSERT((ulStepperNum == MS_STEPPER_NUM1) || 
+	        (ulStepperNum == MS_STEPPER_NUM2));
+    xASSERT((ulDir == MS_RUN_FORWARD) || 
+	        (ulDir == MS_RUN_BACKWARD));
 
+    return StepMotionMove(ulStepperNum,
+                          (ulDir == MS_RUN_FORWARD) ? STEP_MOTION_FORWARD :
+                                                      STEP_MOTION_BACKWARD,
+                          ulSteps, ulSpeed, ulAccel, pfnDone, pvArg);
+}
@@ -200,6 +200,12 @@ extern void MSStepsDelaySet(unsigned long ulDelay);
 extern void MSStepMotorRun(unsigned long ulDir, unsigned long ulSteps);
 extern void MSStepMotorStop(void);
 
+extern void MSStepMotionInit(void);
+extern xtBoolean MSStepMotorMove(unsigned long ulStepperNum, unsigned long ulDir,
+                                 unsigned long ulSteps, unsigned long ulSpeed,
+                                 unsigned long ulAccel,
+                                 tStepMotionDone pfnDone, void *pvArg);
+
 extern void MSDelay(unsigned long ulDelay);
 
 //*****************************************************************************
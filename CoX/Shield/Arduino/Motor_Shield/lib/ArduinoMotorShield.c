@@ -26,6 +26,7 @@
 #include "xadc.h"
 #include "cookie.h"
 #include "cookie_cfg.h"
+#include "StepMotion.h"
 #include "ArduinoMotorShield.h"
 
 //
@@ -39,6 +40,11 @@ static unsigned long g_ul42BYGHForward[8] = {0x09, 0x0D, 0x01, 0x02, 0x06, 0x07,
 //
 static unsigned long g_ulStepsDelay = 10;
 
+//
+//! Phase in the 8 phase sequence, used by the motion engine
+//
+static unsigned char g_ucStepPhase = 0;
+
 //*****************************************************************************
 //
 //! \brief Init the PWM corresponding pins, and enable the corresponding port.
@@ -459,6 +465,98 @@ AMSStepMotorStop(void)
 	xGPIOSPinWrite(sD11,0);
 }
 
+//*****************************************************************************
+//
+//! \brief Advance the stepper by one phase, called by the motion engine.
+//!
+//! \param ulAxis is the axis, always 0.
+//! \param ulDir is STEP_MOTION_FORWARD or STEP_MOTION_BACKWARD.
+//! 
+//! \return None.
+//
+//*****************************************************************************
+static void
+AMSStepMotionStep(unsigned long ulAxis, unsigned long ulDir)
+{
+    unsigned long ulPhase;
+
+    if(ulDir == STEP_MOTION_FORWARD)
+    {
+        g_ucStepPhase = (g_ucStepPhase + 1) & 7;
+    }
+    else
+    {
+        g_ucStepPhase = (g_ucStepPhase - 1) & 7;
+    }
+    ulPhase = g_ul42BYGHForward[g_ucStepPhase];
+
+    xGPIOSPinWrite(sD12, ((ulPhase >> 3) & 0x1));
+    xGPIOSPinWrite(sD9, ((ulPhase >> 2) & 0x1));
+    xGPIOSPinWrite(sD13, ((ulPhase >> 1) & 0x1));
+    xGPIOSPinWrite(sD8, (ulPhase & 0x1));
+}
+
+//*****************************************************************************
+//
+//! \brief Init the timer driven motion engine.
+//!
+//! \param None
+//!
+//! AMSStepMotorInit() must be called as well. The engine uses
+//! STEP_MOTION_TIMER, which must differ from MS_DELAY_TIMER.
+//! 
+//! \return None.
+//
+//*****************************************************************************
+void 
+AMSStepMotionInit(void)
+{
+    StepMotionInit(AMSStepMotionStep, 0);
+    StepMotionTimerInit();
+}
+
+//*****************************************************************************
+//
+//! \brief Queue a move of the stepper and return at once.
+//!
+//! \param ulDir is the selection of Step Motor running direction.
+//! \param ulSteps is the number of phases to move.
+//! \param ulSpeed is the cruise speed in phases per second.
+//! \param ulAccel is the acceleration in phases per second squared, 0 for
+//! none.
+//! \param pfnDone is called from the timer interrupt when the move ends, can
+//! be 0.
+//! \param pvArg is passed to \e pfnDone.
+//!
+//! The \e ulDir parameter can be one of the values:
+//! \b AMS_RUN_FORWARD, \b AMS_RUN_BACKWARD.
+//!
+//! The bridges are enabled here and stay enabled until AMSStepMotorStop().
+//! Moves run one after the other. StepMotionIdle() and StepMotionStop() take
+//! axis 0.
+//! 
+//! \return xtrue if the move was queued, xfalse if the queue was full.
+//
+//*****************************************************************************
+xtBoolean 
+AMSStepMotorMove(unsigned long ulDir, unsigned long ulSteps,
+                 unsigned long ulSpeed, unsigned long ulAccel,
+                 tStepMotionDone pfnDone, void *pvArg)
+{
+    //
+    // Check the arguments.
+    //
+    xASSERT((ulDir == AMS_RUN_FORWARD) ||
+	        (ulDir == AMS_RUN_BACKWARD));
+
+	xGPIOSPinWrite(sD3,1);
+	xGPIOSPinWrite(sD11,1);
+
+    return StepMotionMove(0, (ulDir == AMS_RUN_FORWARD) ? STEP_MOTION_FORWARD :
+                                                          STEP_MOTION_BACKWARD,
+                          ulSteps, ulSpeed, ulAccel, pfnDone, pvArg);
+}
+
 //*****************************************************************************
 //
 //! \brief Init the ADC of the motor shield for current get.
@@ -147,6 +147,11 @@ extern void AMSStepsDelaySet(unsigned long ulDelay);
 extern void AMSStepMotorRun(unsigned long ulDir, unsigned long ulSteps);
 extern void AMSStepMotorStop(void);
 
+extern void AMSStepMotionInit(void);
+extern xtBoolean AMSStepMotorMove(unsigned long ulDir, unsigned long ulSteps,
+                                  unsigned long ulSpeed, unsigned long ulAccel,
+                                  tStepMotionDone pfnDone, void *pvArg);
+
 extern void AMSMotorADCInit(void);
 extern unsigned long AMSMotorCurrentGet(unsigned long ulMotor);
 
@@ -78,6 +78,7 @@ static void delay(volatile uint32_t tick)
 void WiFi_Init(void)
 {
     WiFiDrv_Init();
+    WiFiSocket_Init();
 }
 
 //*****************************************************************************
@@ -60,6 +60,7 @@ extern "C"
 #include "spi_drv.h"
 #include "wifi_drv.h"
 #include "WiFiClient.h"
+#include "WiFiSocket.h"
 
 // Network encrytion type
 // used in WiFiBegin Function
@@ -41,6 +41,7 @@
 //#include "wl_types.h"
 #include "WiFi.h"
 #include "WiFiClient.h"
+#include "WiFiSocket.h"
 #include "server_drv.h"
 
 //static uint16_t _srcport = 1024;
@@ -154,8 +155,7 @@ static int32_t _ConnectViaIP(uint8_t* ip, uint16_t port)
     //_sock = WiFi_SocketAvilGet();
     if (_sock != NO_SOCKET_AVAIL)
     {
-        ServerDrv_StartClient(*((uint32_t *)ip), port, _sock);
-        //_state[_sock] = _sock;
+        WiFiSocket_Connect(_sock, ip, port);
 
         while(cnt-- > 0)
         {
@@ -202,33 +202,13 @@ uint16_t WiFiClient_WriteByte(uint8_t b)
 //! \param size is the length of buffer.
 //!
 //! \return 0: FAILURE others is the number of write.
+//! \note small writes are sent together when the socket buffer is full or
+//! the client is read.
 //
 //*****************************************************************************
 uint16_t WiFiClient_WriteBlock(uint8_t *buf, uint16_t size) 
 {
-    if (_sock >= MAX_SOCK_NUM)
-    {
-        //setWriteError();
-        return (0);
-    }
-    if (size==0)
-    {
-        //setWriteError();
-        return (0);
-    }
-
-    if (!ServerDrv_SendData(_sock, buf, size))
-    {
-        //setWriteError();
-        return (0);
-    }
-    if (!ServerDrv_CheckDataSent(_sock))
-    {
-        //setWriteError();
-        return (0);
-    }
-
-    return (size);
+    return WiFiSocket_Write(_sock, buf, size);
 }
 
 //*****************************************************************************
@@ -242,12 +222,7 @@ uint16_t WiFiClient_WriteBlock(uint8_t *buf, uint16_t size)
 //*****************************************************************************
 int32_t WiFiClient_Available(void) 
 {
-    if (_sock != 255)
-    {
-        return ServerDrv_AvailData(_sock);
-    }
-
-    return (0);
+    return WiFiSocket_Available(_sock);
 }
 
 //*****************************************************************************
@@ -261,16 +236,7 @@ int32_t WiFiClient_Available(void)
 //*****************************************************************************
 uint8_t WiFiClient_ReadByte(void) 
 {
-    uint8_t b;
-
-    if (!WiFiClient_Available())
-    {
-        return (-1);
-    }
-
-    ServerDrv_GetData(_sock, &b, 0);
-
-    return (b);
+    return (uint8_t)WiFiSocket_ReadByte(_sock);
 }
 
 //*****************************************************************************
@@ -285,7 +251,7 @@ uint8_t WiFiClient_ReadByte(void)
 //*****************************************************************************
 int32_t WiFiClient_ReadBlock(uint8_t* buf, uint16_t size)
 {
-    if (!ServerDrv_GetDataBuf(_sock, buf, &size))
+    if (WiFiSocket_Read(_sock, buf, size) == 0)
     {
         return (-1);
     }
@@ -303,16 +269,7 @@ int32_t WiFiClient_ReadBlock(uint8_t* buf, uint16_t size)
 //*****************************************************************************
 int32_t WiFiClient_Peek(void) 
 {
-    uint8_t b;
-
-    if (!WiFiClient_Available())
-    {
-        return -1;
-    }
-
-    ServerDrv_GetData(_sock, &b, 1);
-
-    return (b);
+    return WiFiSocket_Peek(_sock);
 }
 
 //*****************************************************************************
@@ -350,10 +307,10 @@ void WiFiClient_Stop(void)
         return;
     }
 
-    ServerDrv_StopClient(_sock);
+    WiFiSocket_Close(_sock);
 
     // wait a second for the connection to close
-    while ((WiFiClient_Status() != CLOSED) && (i++ < 1000))
+    while ((ServerDrv_GetClientState(_sock) != CLOSED) && (i++ < 1000))
     {
         delay(10);
     }
@@ -371,21 +328,7 @@ void WiFiClient_Stop(void)
 //*****************************************************************************
 uint8_t WiFiClient_Connected(void) 
 {
-    uint8_t s = 0;
-
-    if (_sock == 255) 
-    {
-        return 0;
-    }
-    else 
-    {
-        s = WiFiClient_Status();
-
-        return !(s == LISTEN || s == CLOSED || s == FIN_WAIT_1 ||
-                s == FIN_WAIT_2 || s == TIME_WAIT ||
-                s == SYN_SENT || s== SYN_RCVD ||
-                (s == CLOSE_WAIT && !WiFiClient_Available()));
-    }
+    return WiFiSocket_Connected(_sock);
 }
 
 //*****************************************************************************
@@ -399,14 +342,7 @@ uint8_t WiFiClient_Connected(void)
 //*****************************************************************************
 uint8_t WiFiClient_Status(void) 
 {
-    if (_sock == 255) 
-    {
-        return (CLOSED);
-    }
-    else 
-    {
-        return ServerDrv_GetClientState(_sock);
-    }
+    return WiFiSocket_Status(_sock);
 }
 
 /*--------------------------- FILE END --------------------------------------*/
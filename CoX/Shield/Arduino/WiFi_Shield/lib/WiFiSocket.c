@@ -0,0 +1,472 @@
+//*****************************************************************************
+//
+//! \file WiFiSocket.c
+//! \brief Buffered multi-socket layer for Arduino WiFi Shield.
+//! \version 2.1.1.0
+//! \date 19/10/2026
+//! \author CooCoX
+//! \copy
+//!
+//! Copyright (c)  2013, CooCoX
+//! All rights reserved.
+//!
+//! Redistribution and use in source and binary forms, with or without
+//! modification, are permitted provided that the following conditions
+//! are met:
+//!
+//!     * Redistributions of source code must retain the above copyright
+//! notice, this list of conditions and the following disclaimer.
+//!     * Redistributions in binary form must reproduce the above copyright
+//! notice, this list of conditions and the following disclaimer in the
+//! documentation and/or other materials provided with the distribution.
+//!     * Neither the name of the <ORGANIZATION> nor the names of its
+//! contributors may be used to endorse or promote products derived
+//! from this software without specific prior written permission.
+//!
+//! THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+//! AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+//! IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+//! ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+//! LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+//! CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+//! SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+//! INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//! CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+//! ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+//! THE POSSIBILITY OF SUCH DAMAGE.
+//
+
+#include <string.h>
+#include "WiFiSocket.h"
+#include "server_drv.h"
+
+typedef struct
+{
+    uint8_t  used;
+    uint16_t rx_pos;
+    uint16_t rx_len;
+    uint16_t tx_len;
+    uint8_t  rx_buf[WIFI_SOCKET_RX_SIZE];
+    uint8_t  tx_buf[WIFI_SOCKET_TX_SIZE];
+}tWiFiSocket;
+
+static tWiFiSocket _sockets[MAX_SOCK_NUM];
+
+//*****************************************************************************
+//
+//! \brief Send a block and wait until the shield has sent it.
+//!
+//! \param sock is the socket.
+//! \param buf is the data.
+//! \param size is the length of data.
+//!
+//! \return 0: FAILURE 1:SUCCESS
+//! \note This function is only used internal.
+//
+//*****************************************************************************
+static int32_t _SendBlock(uint8_t sock, uint8_t *buf, uint16_t size)
+{
+    if (!ServerDrv_SendData(sock, buf, size))
+    {
+        return (0);
+    }
+    return ServerDrv_CheckDataSent(sock);
+}
+
+//*****************************************************************************
+//
+//! \brief Reset the state of a socket.
+//!
+//! \param sock is the socket.
+//!
+//! \return none.
+//! \note This function is only used internal.
+//
+//*****************************************************************************
+static void _Reset(uint8_t sock)
+{
+    _sockets[sock].rx_pos = 0;
+    _sockets[sock].rx_len = 0;
+    _sockets[sock].tx_len = 0;
+}
+
+//*****************************************************************************
+//
+//! \brief Init the socket layer, all sockets are free.
+//!
+//! \param none.
+//!
+//! \return none.
+//
+//*****************************************************************************
+void WiFiSocket_Init(void)
+{
+    uint8_t i = 0;
+
+    for (i = 0; i < MAX_SOCK_NUM; i++)
+    {
+        _sockets[i].used = 0;
+        _Reset(i);
+    }
+}
+
+//*****************************************************************************
+//
+//! \brief Get a free socket.
+//!
+//! \param none.
+//!
+//! \return the socket, NO_SOCKET_AVAIL when all are in use.
+//
+//*****************************************************************************
+uint8_t WiFiSocket_Alloc(void)
+{
+    uint8_t i = 0;
+
+    for (i = 0; i < MAX_SOCK_NUM; i++)
+    {
+        if (!_sockets[i].used)
+        {
+            _sockets[i].used = 1;
+            _Reset(i);
+            return (i);
+        }
+    }
+
+    return (NO_SOCKET_AVAIL);
+}
+
+//*****************************************************************************
+//
+//! \brief Start a client connection on a socket.
+//!
+//! \param sock is the socket.
+//! \param ip is the 4 bytes server address.
+//! \param port is the server port.
+//!
+//! \return 0: FAILURE 1:SUCCESS
+//! \note the connection is set up by the shield, poll WiFiSocket_Connected()
+//! to know when it is done.
+//
+//*****************************************************************************
+int32_t WiFiSocket_Connect(uint8_t sock, uint8_t* ip, uint16_t port)
+{
+    uint32_t addr = 0;
+
+    if (sock >= MAX_SOCK_NUM)
+    {
+        return (0);
+    }
+
+    _sockets[sock].used = 1;
+    _Reset(sock);
+
+    memcpy(&addr, ip, sizeof(addr));
+    ServerDrv_StartClient(addr, port, sock);
+
+    return (1);
+}
+
+//*****************************************************************************
+//
+//! \brief Start a server on a socket.
+//!
+//! \param sock is the socket.
+//! \param port is the listen port.
+//!
+//! \return 0: FAILURE 1:SUCCESS
+//! \note a client that connects to the port is served on the same socket,
+//! WiFiSocket_Connected() becomes 1 when it is there.
+//
+//*****************************************************************************
+int32_t WiFiSocket_Listen(uint8_t sock, uint16_t port)
+{
+    if (sock >= MAX_SOCK_NUM)
+    {
+        return (0);
+    }
+
+    _sockets[sock].used = 1;
+    _Reset(sock);
+
+    ServerDrv_StartServer(port, sock);
+
+    return (ServerDrv_GetServerState(sock) == LISTEN);
+}
+
+//*****************************************************************************
+//
+//! \brief Write data to a socket.
+//!
+//! \param sock is the socket.
+//! \param buf is the buffer of store data.
+//! \param size is the length of buffer.
+//!
+//! \return 0: FAILURE others is the number of write.
+//! \note small writes are kept in the socket until the buffer is full,
+//! WiFiSocket_Flush() is called or the socket is read.
+//
+//*****************************************************************************
+uint16_t WiFiSocket_Write(uint8_t sock, uint8_t *buf, uint16_t size)
+{
+    tWiFiSocket *s = NULL;
+    uint16_t len   = 0;
+    uint16_t done  = 0;
+
+    if ((sock >= MAX_SOCK_NUM) || (size == 0))
+    {
+        return (0);
+    }
+
+    s = &_sockets[sock];
+    while (done < size)
+    {
+        // A block that fills the buffer by itself is sent without a copy
+        if ((s->tx_len == 0) && (size - done >= WIFI_SOCKET_TX_SIZE))
+        {
+            if (!_SendBlock(sock, buf + done, size - done))
+            {
+                return (0);
+            }
+            break;
+        }
+
+        len = WIFI_SOCKET_TX_SIZE - s->tx_len;
+        if (len > size - done)
+        {
+            len = size - done;
+        }
+        memcpy(&s->tx_buf[s->tx_len], buf + done, len);
+        s->tx_len += len;
+        done      += len;
+
+        if ((s->tx_len == WIFI_SOCKET_TX_SIZE) && !WiFiSocket_Flush(sock))
+        {
+            return (0);
+        }
+    }
+
+    return (size);
+}
+
+//*****************************************************************************
+//
+//! \brief Send the data kept in a socket.
+//!
+//! \param sock is the socket.
+//!
+//! \return 0: FAILURE 1:SUCCESS
+//
+//*****************************************************************************
+int32_t WiFiSocket_Flush(uint8_t sock)
+{
+    uint16_t len = 0;
+
+    if (sock >= MAX_SOCK_NUM)
+    {
+        return (0);
+    }
+
+    len = _sockets[sock].tx_len;
+    if (len == 0)
+    {
+        return (1);
+    }
+
+    _sockets[sock].tx_len = 0;
+    return _SendBlock(sock, _sockets[sock].tx_buf, len);
+}
+
+//*****************************************************************************
+//
+//! \brief Get the number of bytes that can be read without waiting.
+//!
+//! \param sock is the socket.
+//!
+//! \return the number of bytes in the receive buffer.
+//! \note when the buffer is empty, kept data is sent first and the buffer is
+//! refilled from the shield with one block read.
+//
+//*****************************************************************************
+int32_t WiFiSocket_Available(uint8_t sock)
+{
+    tWiFiSocket *s = NULL;
+    uint16_t len   = WIFI_SOCKET_RX_SIZE;
+
+    if (sock >= MAX_SOCK_NUM)
+    {
+        return (0);
+    }
+
+    s = &_sockets[sock];
+    if (s->rx_pos == s->rx_len)
+    {
+        // The peer usually answers what was written, push it out first
+        WiFiSocket_Flush(sock);
+
+        s->rx_pos = 0;
+        s->rx_len = 0;
+        if (ServerDrv_AvailData(sock) &&
+            ServerDrv_GetDataBuf(sock, s->rx_buf, &len))
+        {
+            s->rx_len = len;
+        }
+    }
+
+    return (s->rx_len - s->rx_pos);
+}
+
+//*****************************************************************************
+//
+//! \brief Read data from a socket.
+//!
+//! \param sock is the socket.
+//! \param buf is the buffer of store data.
+//! \param size is the length of buffer.
+//!
+//! \return the number of bytes read.
+//
+//*****************************************************************************
+int32_t WiFiSocket_Read(uint8_t sock, uint8_t *buf, uint16_t size)
+{
+    tWiFiSocket *s = NULL;
+    int32_t len    = 0;
+    int32_t done   = 0;
+
+    if (sock >= MAX_SOCK_NUM)
+    {
+        return (0);
+    }
+
+    s = &_sockets[sock];
+    while (done < size)
+    {
+        len = WiFiSocket_Available(sock);
+        if (len == 0)
+        {
+            break;
+        }
+        if (len > size - done)
+        {
+            len = size - done;
+        }
+        memcpy(buf + done, &s->rx_buf[s->rx_pos], len);
+        s->rx_pos += len;
+        done      += len;
+    }
+
+    return (done);
+}
+
+//*****************************************************************************
+//
+//! \brief Read a byte from a socket.
+//!
+//! \param sock is the socket.
+//!
+//! \return -1: no data, others is the data.
+//
+//*****************************************************************************
+int32_t WiFiSocket_ReadByte(uint8_t sock)
+{
+    if (!WiFiSocket_Available(sock))
+    {
+        return (-1);
+    }
+
+    return (_sockets[sock].rx_buf[_sockets[sock].rx_pos++]);
+}
+
+//*****************************************************************************
+//
+//! \brief Get the next byte of a socket without removing it.
+//!
+//! \param sock is the socket.
+//!
+//! \return -1: no data, others is the data.
+//
+//*****************************************************************************
+int32_t WiFiSocket_Peek(uint8_t sock)
+{
+    if (!WiFiSocket_Available(sock))
+    {
+        return (-1);
+    }
+
+    return (_sockets[sock].rx_buf[_sockets[sock].rx_pos]);
+}
+
+//*****************************************************************************
+//
+//! \brief Send the kept data, stop the connection and free the socket.
+//!
+//! \param sock is the socket.
+//!
+//! \return none.
+//
+//*****************************************************************************
+void WiFiSocket_Close(uint8_t sock)
+{
+    if ((sock >= MAX_SOCK_NUM) || !_sockets[sock].used)
+    {
+        return;
+    }
+
+    WiFiSocket_Flush(sock);
+    ServerDrv_StopClient(sock);
+
+    _sockets[sock].used = 0;
+    _Reset(sock);
+}
+
+//*****************************************************************************
+//
+//! \brief Get the TCP state of a socket.
+//!
+//! \param sock is the socket.
+//!
+//! \return the status, CLOSED for a free socket.
+//
+//*****************************************************************************
+uint8_t WiFiSocket_Status(uint8_t sock)
+{
+    if ((sock >= MAX_SOCK_NUM) || !_sockets[sock].used)
+    {
+        return (CLOSED);
+    }
+
+    return ServerDrv_GetClientState(sock);
+}
+
+//*****************************************************************************
+//
+//! \brief Check whether a socket is connected.
+//!
+//! \param sock is the socket.
+//!
+//! \return 1: connected or received data is left, 0: not connected.
+//
+//*****************************************************************************
+uint8_t WiFiSocket_Connected(uint8_t sock)
+{
+    uint8_t s = 0;
+
+    if ((sock >= MAX_SOCK_NUM) || !_sockets[sock].used)
+    {
+        return (0);
+    }
+
+    if (_sockets[sock].rx_pos != _sockets[sock].rx_len)
+    {
+        return (1);
+    }
+
+    s = WiFiSocket_Status(sock);
+
+    return !(s == LISTEN || s == CLOSED || s == FIN_WAIT_1 ||
+            s == FIN_WAIT_2 || s == TIME_WAIT ||
+            s == SYN_SENT || s== SYN_RCVD ||
+            (s == CLOSE_WAIT && !WiFiSocket_Available(sock)));
+}
+
+/*--------------------------- FILE END --------------------------------------*/
@@ -0,0 +1,93 @@
+//*****************************************************************************
+//
+//! \file WiFiSocket.h
+//! \brief Prototypes for the buffered socket layer of Arduino WiFi Shield
+//! \version 2.1.1.0
+//! \date 19/10/2026
+//! \author CooCoX
+//! \copy
+//!
+//! Copyright (c)  2013, CooCoX
+//! All rights reserved.
+//!
+//! Redistribution and use in source and binary forms, with or without
+//! modification, are permitted provided that the following conditions
+//! are met:
+//!
+//!     * Redistributions of source code must retain the above copyright
+//! notice, this list of conditions and the following disclaimer.
+//!     * Redistributions in binary form must reproduce the above copyright
+//! notice, this list of conditions and the following disclaimer in the
+//! documentation and/or other materials provided with the distribution.
+//!     * Neither the name of the <ORGANIZATION> nor the names of its
+//! contributors may be used to endorse or promote products derived
+//! from this software without specific prior written permission.
+//!
+//! THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+//! AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+//! IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+//! ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+//! LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+//! CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+//! SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+//! INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//! CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+//! ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+//! THE POSSIBILITY OF SUCH DAMAGE.
+//
+//*****************************************************************************
+#ifndef _WIFISOCKET_H_
+#define _WIFISOCKET_H_
+
+//*****************************************************************************
+//
+// If building with a C++ compiler, make all of the definitions in this header
+// have a C binding.
+//
+//*****************************************************************************
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+#include <stdint.h>
+#include "wl_definitions.h"
+
+//
+// Receive buffer of each socket. It is filled by one GET_DATABUF_TCP command,
+// so make it as large as the chunks the shield hands out, bytes beyond it
+// are dropped.
+//
+#define WIFI_SOCKET_RX_SIZE     128
+
+//
+// Transmit buffer of each socket. Small writes are collected here and sent
+// with one SEND_DATA_TCP command.
+//
+#define WIFI_SOCKET_TX_SIZE     64
+
+void     WiFiSocket_Init(void);
+uint8_t  WiFiSocket_Alloc(void);
+int32_t  WiFiSocket_Connect(uint8_t sock, uint8_t* ip, uint16_t port);
+int32_t  WiFiSocket_Listen(uint8_t sock, uint16_t port);
+uint16_t WiFiSocket_Write(uint8_t sock, uint8_t *buf, uint16_t size);
+int32_t  WiFiSocket_Flush(uint8_t sock);
+int32_t  WiFiSocket_Available(uint8_t sock);
+int32_t  WiFiSocket_Read(uint8_t sock, uint8_t *buf, uint16_t size);
+int32_t  WiFiSocket_ReadByte(uint8_t sock);
+int32_t  WiFiSocket_Peek(uint8_t sock);
+void     WiFiSocket_Close(uint8_t sock);
+uint8_t  WiFiSocket_Status(uint8_t sock);
+uint8_t  WiFiSocket_Connected(uint8_t sock);
+
+//*****************************************************************************
+//
+// Mark the end of the C bindings section for C++ compilers.
+//
+//*****************************************************************************
+#ifdef __cplusplus
+}
+#endif
+
+#endif //_WIFISOCKET_H_
+
@@ -319,7 +319,8 @@ int32_t ServerDrv_GetData(uint8_t sock, uint8_t *data, uint8_t peek)
 //!
 //! \param sock is the socket you want to check.
 //! \param _data is the buffer store the data.
-//! \param _datalen is the length of read data.
+//! \param _datalen is the size of \e _data on entry and the length of read
+//! data on return.
 //! 
 //! \return 1: get the data, 0: not get the data.
 //
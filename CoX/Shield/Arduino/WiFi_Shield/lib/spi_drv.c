@@ -40,8 +40,14 @@
 
 #include "spi_drv.h"
 
-//About 15us
-#define DELAY_TRANSFER() delay(0x5F)
+//About 15us, the slave needs it to enter its command interrupt
+#define DELAY_START_CMD() delay(0x5F)
+
+#if SPI_DRV_BYTE_DELAY
+#define DELAY_TRANSFER() delay(SPI_DRV_BYTE_DELAY)
+#else
+#define DELAY_TRANSFER()
+#endif
 
 //*****************************************************************************
 //
@@ -66,6 +72,8 @@ static void delay(volatile uint32_t tick)
 //! uint8_t SpiDrv_Transfer(uint8_t data)
 //! void    SpiDrv_WaitForSlaveReady(void)
 
+#if !SPI_DRV_PORT_EXTERNAL
+
 //*****************************************************************************
 //
 //! \brief Init Spi communction port and wifi handshake pin.
@@ -164,7 +172,8 @@ void SpiDrv_SlaveDeselect(void)
 //! \param data is the byte to be transfered.
 //!
 //! \return the byte read back from spi salave.
-//! \note after read byte, you must wait 10us.
+//! \note the bus is paced by SpiDrv_WaitForSlaveReady() around each command,
+//! not by a delay after every byte.
 //
 //*****************************************************************************
 uint8_t SpiDrv_Transfer(uint8_t ucData)
@@ -187,7 +196,7 @@ uint8_t SpiDrv_Transfer(uint8_t ucData)
 	SPIDataPut(xSPI1_BASE, ucData);
 	while(SPIIsRxNotEmpty(xSPI1_BASE) == xfalse);
 	xSPIDataGet(xSPI1_BASE, &ucRecv);
-	delay(0x5F);
+	DELAY_TRANSFER();
 	return (ucRecv);
 }
 
@@ -209,6 +218,8 @@ void SpiDrv_WaitForSlaveReady(void)
     while(xGPIOPinRead(xGPIO_PORTA_BASE, xGPIO_PIN_3) != 0);
 }
 
+#endif
+
 //////////////////////////////////////////////////////////////////////////
 
 //*****************************************************************************
@@ -352,7 +363,8 @@ int32_t SpiDrv_WaitResponseCmd(uint8_t cmd, uint8_t numParam, uint8_t* param, ui
 //!
 //! \param cmd is the command you want to wait.
 //! \param Param is buffer to store received param.
-//! \param param_len is the lenght of param.
+//! \param param_len is the size of \e Param on entry and the lenght of param
+//! on return. Bytes that do not fit are read from the bus and dropped.
 //!
 //! \return 0: failure 1:success.
 //! 
@@ -363,6 +375,7 @@ int32_t SpiDrv_WaitResponseData16(uint8_t cmd, uint8_t* param, uint16_t* param_l
     uint8_t  _data    = 0;
     uint8_t  numParam = 0;
     uint16_t i        = 0;
+    uint16_t max_len  = *param_len;
     
     if(!SpiDrv_WaitChar(START_CMD))
     {
@@ -375,13 +388,22 @@ int32_t SpiDrv_WaitResponseData16(uint8_t cmd, uint8_t* param, uint16_t* param_l
             return 0;
         }
         numParam = SpiDrv_ReadChar();
+        *param_len = 0;
         if (numParam != 0)
         {
             SpiDrv_ReadParamLen16(param_len);
             for (i=0; i<(*param_len); ++i)
             {
                 // Get Params data
-                SpiDrv_GetParam(&param[i]);
+                SpiDrv_GetParam(&_data);
+                if (i < max_len)
+                {
+                    param[i] = _data;
+                }
+            }
+            if (*param_len > max_len)
+            {
+                *param_len = max_len;
             }
         }
         
@@ -755,8 +777,7 @@ void SpiDrv_SendCmd(uint8_t cmd, uint8_t numParam)
     SpiDrv_Transfer(START_CMD);
     
     //wait the interrupt trigger on slave
-    DELAY_TRANSFER();
-    DELAY_TRANSFER();
+    DELAY_START_CMD();
     
     // Send Spi C + cmd
     SpiDrv_Transfer(cmd & ~(REPLY_FLAG));
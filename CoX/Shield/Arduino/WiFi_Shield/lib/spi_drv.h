@@ -68,6 +68,21 @@ extern "C"
 
 #define DUMMY_DATA                     0xFF
 
+//
+// Busy loops after each SPI byte. The shield signals when it can take a
+// command through the handshake pin, so no per-byte pacing is needed. Set it
+// to 0x5F to get back the old ~15us gap for firmware that drops bytes.
+//
+#define SPI_DRV_BYTE_DELAY             0
+
+//
+// Set to 1 when SpiDrv_Init() ... SpiDrv_WaitForSlaveReady() are supplied
+// by another file, e.g. the host side fake shield of the socket test.
+//
+#ifndef SPI_DRV_PORT_EXTERNAL
+#define SPI_DRV_PORT_EXTERNAL          0
+#endif
+
 
 void     SpiDrv_Init(void);
 void     SpiDrv_Stop(void);
@@ -0,0 +1,225 @@
+//*****************************************************************************
+//
+//! @page WiFiSocket_testcase WiFiSocket test
+//!
+//! File: @ref WiFiSocket.c
+//!
+//! <h2>Description</h2>
+//! This module implements the test sequence for the WiFi shield socket
+//! layer.<br><br>
+//! - \p Board: STM32 <br><br>
+//! - \p Last-Time(about): 0.1s <br><br>
+//! - \p Phenomenon: Success or failure information will be printed on the UART. <br><br>
+//! .
+//!
+//! <h2>Preconditions</h2>
+//! The module requires the following options:<br><br>
+//! - \p Option-define:
+//! <br>(1)SPI_DRV_PORT_EXTERNAL, spi_drv.c talks to the fake shield in
+//! WiFiSpiFake.c.<br><br>
+//! - \p Option-hardware:
+//! <br>(1)None, the shield is not needed.<br><br>
+//! - \p Option-OtherModule:
+//! <br>Connect an COM cable to the development board.<br>
+//! .
+//! In case some of the required options are not enabled then some or all tests
+//! may be skipped or result FAILED.<br>
+//!
+//! <h2>Test Cases</h2>
+//! The module contain those sub tests:<br><br>
+//! - \subpage test_WiFiSocket_Layer
+//! .
+//! \file WiFiSocket.c
+//! \brief WiFiSocket test source file
+//! \file WiFiSocket.h
+//! \brief WiFiSocket test header file <br>
+//
+//*****************************************************************************
+
+#include <string.h>
+#include "test.h"
+#include "WiFiSocket.h"
+#include "server_drv.h"
+#include "WiFiSpiFake.h"
+
+static uint8_t ucIP[4] = {192, 168, 1, 2};
+static uint8_t ucData[300];
+
+//*****************************************************************************
+//
+//! \brief Get the Test description of WiFiSocket test.
+//!
+//! \return the desccription of the WiFiSocket test.
+//
+//*****************************************************************************
+static char* WiFiSocketGetTest(void)
+{
+    return "WiFiSocket layer test";
+}
+
+//*****************************************************************************
+//
+//! \brief something should do before the test execute of WiFiSocket test.
+//!
+//! \return None.
+//
+//*****************************************************************************
+static void WiFiSocketSetup(void)
+{
+    unsigned long i;
+
+    WiFiFake_Reset();
+    WiFiSocket_Init();
+    for(i = 0; i < sizeof(ucData); i++)
+    {
+        ucData[i] = (uint8_t)(i * 7);
+    }
+}
+
+//*****************************************************************************
+//
+//! \brief something should do after the test execute of WiFiSocket test.
+//!
+//! \return None.
+//
+//*****************************************************************************
+static void WiFiSocketTearDown(void)
+{
+
+}
+
+//*****************************************************************************
+//
+//! \brief WiFiSocket test execute main body.
+//!
+//! \return None.
+//
+//*****************************************************************************
+static void WiFiSocketExecute(void)
+{
+    unsigned long i;
+    unsigned long ulBlock, ulSingle;
+    uint8_t a, b, c, ucByte;
+    uint8_t *pucSent;
+
+    //
+    // Two clients at once.
+    //
+    a = WiFiSocket_Alloc();
+    b = WiFiSocket_Alloc();
+    TestAssert((a == 0) && (b == 1), "WiFiSocket API \"WiFiSocket_Alloc()\"error!");
+    WiFiSocket_Connect(a, ucIP, 80);
+    WiFiSocket_Connect(b, ucIP, 8080);
+    TestAssert(WiFiSocket_Connected(a) && WiFiSocket_Connected(b),
+               "WiFiSocket API \"WiFiSocket_Connect()\"error!");
+
+    //
+    // Interleaved reads keep the streams apart.
+    //
+    WiFiFake_RemoteSend(a, ucData, 300);
+    WiFiFake_RemoteSend(b, ucData + 100, 50);
+    for(i = 0; i < 300; i++)
+    {
+        if(WiFiSocket_ReadByte(a) != ucData[i])
+        {
+            break;
+        }
+        if((i < 50) && (WiFiSocket_ReadByte(b) != ucData[100 + i]))
+        {
+            break;
+        }
+    }
+    TestAssert((i == 300) && (WiFiSocket_ReadByte(a) == -1) &&
+               (WiFiSocket_Peek(b) == -1),
+               "WiFiSocket API \"WiFiSocket_ReadByte()\"error!");
+
+    //
+    // Bus bytes per payload byte, block reads against the old byte reads.
+    //
+    WiFiFake_StatReset();
+    WiFiFake_RemoteSend(a, ucData, 300);
+    TestAssert(WiFiSocket_Read(a, ucData, 300) == 300,
+               "WiFiSocket API \"WiFiSocket_Read()\"error!");
+    ulBlock = WiFiFake_SpiBytes() * 100 / 300;
+    TestAssert(WiFiFake_CmdCount(GET_DATABUF_TCP_CMD) == 4,
+               "WiFiSocket API \"WiFiSocket_Read()\"error!");
+
+    WiFiFake_StatReset();
+    WiFiFake_RemoteSend(a, ucData, 20);
+    for(i = 0; i < 20; i++)
+    {
+        ServerDrv_GetData(a, &ucByte, 0);
+    }
+    ulSingle = WiFiFake_SpiBytes() * 100 / 20;
+    TestAssert((ulBlock < 150) && (ulSingle > ulBlock * 10),
+               "WiFiSocket API \"WiFiSocket_Read()\"error!");
+
+    //
+    // Small writes go out as one command.
+    //
+    WiFiFake_StatReset();
+    for(i = 0; i < 20; i++)
+    {
+        WiFiSocket_Write(a, ucData + i * 3, 3);
+    }
+    TestAssert(WiFiFake_CmdCount(SEND_DATA_TCP_CMD) == 0,
+               "WiFiSocket API \"WiFiSocket_Write()\"error!");
+    TestAssert(WiFiSocket_Flush(a) &&
+               (WiFiFake_CmdCount(SEND_DATA_TCP_CMD) == 1) &&
+               (WiFiFake_Received(a, &pucSent) == 60) &&
+               (memcmp(pucSent, ucData, 60) == 0),
+               "WiFiSocket API \"WiFiSocket_Flush()\"error!");
+
+    //
+    // A large block is sent at once, the rest waits until the socket is read.
+    //
+    WiFiSocket_Write(a, ucData, 10);
+    WiFiSocket_Write(a, ucData + 10, 200);
+    TestAssert(WiFiFake_CmdCount(SEND_DATA_TCP_CMD) == 3,
+               "WiFiSocket API \"WiFiSocket_Write()\"error!");
+    WiFiSocket_Write(a, ucData, 5);
+    WiFiSocket_Available(a);
+    TestAssert((WiFiFake_CmdCount(SEND_DATA_TCP_CMD) == 4) &&
+               (WiFiFake_Received(a, &pucSent) == 275) &&
+               (memcmp(pucSent + 60, ucData, 210) == 0),
+               "WiFiSocket API \"WiFiSocket_Available()\"error!");
+
+    //
+    // Server socket.
+    //
+    c = WiFiSocket_Alloc();
+    TestAssert(WiFiSocket_Listen(c, 80) && !WiFiSocket_Connected(c),
+               "WiFiSocket API \"WiFiSocket_Listen()\"error!");
+    WiFiFake_RemoteConnect(c);
+    TestAssert(WiFiSocket_Connected(c),
+               "WiFiSocket API \"WiFiSocket_Listen()\"error!");
+
+    //
+    // A closed socket is given out again.
+    //
+    WiFiSocket_Close(b);
+    TestAssert((WiFiSocket_Status(b) == CLOSED) && !WiFiSocket_Connected(b),
+               "WiFiSocket API \"WiFiSocket_Close()\"error!");
+    TestAssert((WiFiSocket_Alloc() == b) && (WiFiSocket_Alloc() == 3) &&
+               (WiFiSocket_Alloc() == NO_SOCKET_AVAIL),
+               "WiFiSocket API \"WiFiSocket_Alloc()\"error!");
+}
+
+//
+// WiFiSocket test case struct.
+//
+const tTestCase sTestWiFiSocketLayer = {
+        WiFiSocketGetTest,
+        WiFiSocketSetup,
+        WiFiSocketTearDown,
+        WiFiSocketExecute
+};
+
+//
+// WiFiSocket test suits.
+//
+const tTestCase * const psPatternWiFiSocketTest[] =
+{
+    &sTestWiFiSocketLayer,
+    0
+};
@@ -0,0 +1,410 @@
+//*****************************************************************************
+//
+//! \file WiFiSpiFake.c
+//! \brief Fake WiFi shield on the SPI port functions of spi_drv.c.
+//! \version 2.1.1.0
+//! \date 19/10/2026
+//! \author CooCoX
+//! \copy
+//!
+//! Copyright (c)  2013, CooCoX
+//! All rights reserved.
+//!
+//! The fake decodes the command frames written by spi_drv.c, runs the TCP
+//! commands against local socket buffers and shifts the reply frame out on
+//! the following dummy bytes. It counts the SPI bytes and the commands, so
+//! the cost of a transfer can be measured without the shield. Build spi_drv.c
+//! with SPI_DRV_PORT_EXTERNAL to use it.
+//
+//*****************************************************************************
+
+#include <string.h>
+#include "spi_drv.h"
+#include "WiFiSpiFake.h"
+
+//
+// Command frame decoder states.
+//
+#define FAKE_IDLE               0
+#define FAKE_CMD                1
+#define FAKE_NPARAM             2
+#define FAKE_LEN_HI             3
+#define FAKE_LEN                4
+#define FAKE_DATA               5
+#define FAKE_END                6
+
+#define FAKE_PARAM_SIZE         8
+
+typedef struct
+{
+    uint8_t  state;
+    uint16_t rx_pos;
+    uint16_t rx_len;
+    uint16_t tx_len;
+    uint8_t  rx_buf[WIFI_FAKE_BUF_SIZE];
+    uint8_t  tx_buf[WIFI_FAKE_BUF_SIZE];
+}tFakeSocket;
+
+static tFakeSocket _fake[MAX_SOCK_NUM];
+
+static uint8_t  _parse;
+static uint8_t  _cmd;
+static uint8_t  _nparam;
+static uint8_t  _idx;
+static uint16_t _len;
+static uint16_t _pos;
+static uint8_t  _param[MAX_PARAMS][FAKE_PARAM_SIZE];
+
+static uint8_t  _reply[WIFI_FAKE_CHUNK + 8];
+static uint16_t _reply_len;
+static uint16_t _reply_pos;
+
+static unsigned long _spi_bytes;
+static unsigned long _cmd_cnt[0x50];
+
+//*****************************************************************************
+//
+//! \brief Build a reply with one 8-bit length param.
+//!
+//! \return none.
+//
+//*****************************************************************************
+static void _Reply8(uint8_t value)
+{
+    _reply[0] = START_CMD;
+    _reply[1] = _cmd | REPLY_FLAG;
+    _reply[2] = 1;
+    _reply[3] = 1;
+    _reply[4] = value;
+    _reply[5] = END_CMD;
+    _reply_len = 6;
+}
+
+//*****************************************************************************
+//
+//! \brief Build a GET_DATABUF_TCP reply from the data of a socket.
+//!
+//! \return none.
+//
+//*****************************************************************************
+static void _ReplyData(tFakeSocket *s)
+{
+    uint16_t len = s->rx_len - s->rx_pos;
+
+    if (len > WIFI_FAKE_CHUNK)
+    {
+        len = WIFI_FAKE_CHUNK;
+    }
+
+    _reply[0] = START_CMD;
+    _reply[1] = _cmd | REPLY_FLAG;
+    _reply[2] = 1;
+    _reply[3] = (uint8_t)(len >> 8);
+    _reply[4] = (uint8_t)len;
+    memcpy(&_reply[5], &s->rx_buf[s->rx_pos], len);
+    _reply[5 + len] = END_CMD;
+    _reply_len = 6 + len;
+    s->rx_pos += len;
+}
+
+//*****************************************************************************
+//
+//! \brief Run a decoded command.
+//!
+//! \return none.
+//
+//*****************************************************************************
+static void _Execute(void)
+{
+    tFakeSocket *s = &_fake[_param[0][0] % MAX_SOCK_NUM];
+
+    _cmd_cnt[_cmd]++;
+
+    switch (_cmd)
+    {
+        case START_SERVER_TCP_CMD:
+            s = &_fake[_param[1][0] % MAX_SOCK_NUM];
+            s->state = LISTEN;
+            _Reply8(1);
+            break;
+
+        case START_CLIENT_TCP_CMD:
+            s = &_fake[_param[2][0] % MAX_SOCK_NUM];
+            s->state = ESTABLISHED;
+            _Reply8(1);
+            break;
+
+        case STOP_CLIENT_TCP_CMD:
+            s->state  = CLOSED;
+            s->rx_pos = 0;
+            s->rx_len = 0;
+            _Reply8(1);
+            break;
+
+        case GET_STATE_TCP_CMD:
+        case GET_CLIENT_STATE_TCP_CMD:
+            _Reply8(s->state);
+            break;
+
+        case AVAIL_DATA_TCP_CMD:
+            _Reply8(s->rx_pos != s->rx_len);
+            break;
+
+        case GET_DATA_TCP_CMD:
+            _Reply8(s->rx_buf[s->rx_pos]);
+            if ((s->rx_pos != s->rx_len) && !_param[1][1])
+            {
+                s->rx_pos++;
+            }
+            break;
+
+        case GET_DATABUF_TCP_CMD:
+            _ReplyData(s);
+            break;
+
+        default:
+            _Reply8(1);
+            break;
+    }
+}
+
+//*****************************************************************************
+//
+//! \brief Go to the length of the next param, or the end of the frame.
+//!
+//! \return none.
+//
+//*****************************************************************************
+static void _NextParam(void)
+{
+    if (_idx == _nparam)
+    {
+        _parse = FAKE_END;
+    }
+    else
+    {
+        _len   = 0;
+        _parse = (_cmd & DATA_FLAG) ? FAKE_LEN_HI : FAKE_LEN;
+    }
+}
+
+//*****************************************************************************
+//
+//! \brief Clear the fake shield and the counters.
+//!
+//! \return none.
+//
+//*****************************************************************************
+void WiFiFake_Reset(void)
+{
+    memset(_fake, 0, sizeof(_fake));
+    _parse     = FAKE_IDLE;
+    _reply_len = 0;
+    _reply_pos = 0;
+    WiFiFake_StatReset();
+}
+
+//*****************************************************************************
+//
+//! \brief Clear the counters.
+//!
+//! \return none.
+//
+//*****************************************************************************
+void WiFiFake_StatReset(void)
+{
+    _spi_bytes = 0;
+    memset(_cmd_cnt, 0, sizeof(_cmd_cnt));
+}
+
+//*****************************************************************************
+//
+//! \brief Get the number of bytes clocked on the bus.
+//!
+//! \return the byte count.
+//
+//*****************************************************************************
+unsigned long WiFiFake_SpiBytes(void)
+{
+    return (_spi_bytes);
+}
+
+//*****************************************************************************
+//
+//! \brief Get how many times a command was run.
+//!
+//! \return the command count.
+//
+//*****************************************************************************
+unsigned long WiFiFake_CmdCount(uint8_t cmd)
+{
+    return (_cmd_cnt[cmd % 0x50]);
+}
+
+//*****************************************************************************
+//
+//! \brief Data sent by the peer arrives on a socket.
+//!
+//! \return none.
+//
+//*****************************************************************************
+void WiFiFake_RemoteSend(uint8_t sock, uint8_t *buf, uint16_t len)
+{
+    tFakeSocket *s = &_fake[sock];
+
+    if (s->rx_pos == s->rx_len)
+    {
+        s->rx_pos = 0;
+        s->rx_len = 0;
+    }
+    if (len > WIFI_FAKE_BUF_SIZE - s->rx_len)
+    {
+        len = WIFI_FAKE_BUF_SIZE - s->rx_len;
+    }
+    memcpy(&s->rx_buf[s->rx_len], buf, len);
+    s->rx_len += len;
+}
+
+//*****************************************************************************
+//
+//! \brief A client connects to a listening socket.
+//!
+//! \return none.
+//
+//*****************************************************************************
+void WiFiFake_RemoteConnect(uint8_t sock)
+{
+    _fake[sock].state = ESTABLISHED;
+}
+
+//*****************************************************************************
+//
+//! \brief Get the data a socket sent to the peer.
+//!
+//! \return the data length.
+//
+//*****************************************************************************
+uint16_t WiFiFake_Received(uint8_t sock, uint8_t **buf)
+{
+    *buf = _fake[sock].tx_buf;
+    return (_fake[sock].tx_len);
+}
+
+//*****************************************************************************
+//
+// SPI port functions of spi_drv.c.
+//
+//*****************************************************************************
+void SpiDrv_Init(void)
+{
+}
+
+void SpiDrv_Stop(void)
+{
+}
+
+void SpiDrv_SlaveSelect(void)
+{
+    _parse     = FAKE_IDLE;
+    _reply_len = 0;
+    _reply_pos = 0;
+}
+
+void SpiDrv_SlaveDeselect(void)
+{
+    _reply_len = 0;
+    _reply_pos = 0;
+}
+
+void SpiDrv_WaitForSlaveReady(void)
+{
+}
+
+uint8_t SpiDrv_Transfer(uint8_t data)
+{
+    tFakeSocket *s = NULL;
+
+    _spi_bytes++;
+
+    if (_reply_pos < _reply_len)
+    {
+        return (_reply[_reply_pos++]);
+    }
+
+    switch (_parse)
+    {
+        case FAKE_IDLE:
+            if (data == START_CMD)
+            {
+                _parse = FAKE_CMD;
+            }
+            break;
+
+        case FAKE_CMD:
+            _cmd   = data % 0x50;
+            _parse = FAKE_NPARAM;
+            break;
+
+        case FAKE_NPARAM:
+            _nparam = (data < MAX_PARAMS) ? data : MAX_PARAMS;
+            _idx    = 0;
+            _NextParam();
+            break;
+
+        case FAKE_LEN_HI:
+            _len   = (uint16_t)data << 8;
+            _parse = FAKE_LEN;
+            break;
+
+        case FAKE_LEN:
+            _len |= data;
+            _pos  = 0;
+            if (_len == 0)
+            {
+                _idx++;
+                _NextParam();
+            }
+            else
+            {
+                _parse = FAKE_DATA;
+            }
+            break;
+
+        case FAKE_DATA:
+            if (_pos < FAKE_PARAM_SIZE)
+            {
+                _param[_idx][_pos] = data;
+            }
+
+            //
+            // The payload of SEND_DATA_TCP goes to the peer.
+            //
+            if ((_cmd == SEND_DATA_TCP_CMD) && (_idx == 1))
+            {
+                s = &_fake[_param[0][0] % MAX_SOCK_NUM];
+                if (s->tx_len < WIFI_FAKE_BUF_SIZE)
+                {
+                    s->tx_buf[s->tx_len++] = data;
+                }
+            }
+
+            if (++_pos == _len)
+            {
+                _idx++;
+                _NextParam();
+            }
+            break;
+
+        case FAKE_END:
+            if (data == END_CMD)
+            {
+                _Execute();
+            }
+            _parse = FAKE_IDLE;
+            break;
+    }
+
+    return (DUMMY_DATA);
+}
+
+/*--------------------------- FILE END --------------------------------------*/
@@ -0,0 +1,57 @@
+//*****************************************************************************
+//
+//! \file WiFiSpiFake.h
+//! \brief Fake WiFi shield on the SPI port functions of spi_drv.c.
+//! \version 2.1.1.0
+//! \date 19/10/2026
+//! \author CooCoX
+//! \copy
+//!
+//! Copyright (c)  2013, CooCoX
+//! All rights reserved.
+//
+//*****************************************************************************
+#ifndef _WIFISPIFAKE_H_
+#define _WIFISPIFAKE_H_
+
+//*****************************************************************************
+//
+// If building with a C++ compiler, make all of the definitions in this header
+// have a C binding.
+//
+//*****************************************************************************
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+#include <stdint.h>
+
+//
+// Largest block the fake hands out for one GET_DATABUF_TCP command.
+//
+#define WIFI_FAKE_CHUNK         96
+
+//
+// Bytes the fake keeps per socket and direction.
+//
+#define WIFI_FAKE_BUF_SIZE      512
+
+void          WiFiFake_Reset(void);
+void          WiFiFake_StatReset(void);
+unsigned long WiFiFake_SpiBytes(void);
+unsigned long WiFiFake_CmdCount(uint8_t cmd);
+void          WiFiFake_RemoteSend(uint8_t sock, uint8_t *buf, uint16_t len);
+void          WiFiFake_RemoteConnect(uint8_t sock);
+uint16_t      WiFiFake_Received(uint8_t sock, uint8_t **buf);
+
+//*****************************************************************************
+//
+// Mark the end of the C bindings section for C++ compilers.
+//
+//*****************************************************************************
+#ifdef __cplusplus
+}
+#endif
+
+#endif //_WIFISPIFAKE_H_
@@ -25,6 +25,7 @@
 #include "xtimer.h"
 #include "cookie_cfg.h"
 #include "cookie.h"
+#include "StepMotion.h"
 #include "MotorShield.h"
 
 //
@@ -37,6 +38,11 @@ static unsigned char g_ul28BYJ48Forward[8] = {0x3, 0x2, 0x6, 0x4, 0xc, 0x8, 0x9,
 //
 static unsigned long g_ulStepsDelay = 10;
 
+//
+//! Phase in the 8 phase sequence, used by the motion engine
+//
+static unsigned char g_ucStepPhase = 0;
+
 //*****************************************************************************
 //
 //! \brief Init the ULN2003 connected pin 
@@ -215,4 +221,92 @@ MSDelay(unsigned long ulDelay)
 
     xTimerStop(MS_DELAY_TIMER, MS_DELAY_CHANNEL);
     xSysCtlPeripheralDisable2(MS_DELAY_TIMER); 
+}
+
+//*****************************************************************************
+//
+//! \brief Advance the stepper by one phase, called by the motion engine.
+//!
+//! \param ulAxis is the axis, always 0.
+//! \param ulDir is STEP_MOTION_FORWARD or STEP_MOTION_BACKWARD.
+//! 
+//! \return None.
+//
+//*****************************************************************************
+static void
+MSStepMotionStep(unsigned long ulAxis, unsigned long ulDir)
+{
+    unsigned char ucPhase;
+
+    if(ulDir == STEP_MOTION_FORWARD)
+    {
+        g_ucStepPhase = (g_ucStepPhase + 1) & 7;
+    }
+    else
+    {
+        g_ucStepPhase = (g_ucStepPhase - 1) & 7;
+    }
+    ucPhase = g_ul28BYJ48Forward[g_ucStepPhase];
+
+    xGPIOSPinWrite(ULN2003_PIN_IN1, ((ucPhase >> 3) & 0x1));
+    xGPIOSPinWrite(ULN2003_PIN_IN2, ((ucPhase >> 2) & 0x1));
+    xGPIOSPinWrite(ULN2003_PIN_IN3, ((ucPhase >> 1) & 0x1));
+    xGPIOSPinWrite(ULN2003_PIN_IN4, (ucPhase & 0x1));
+}
+
+//*****************************************************************************
+//
+//! \brief Init the timer driven motion engine.
+//!
+//! \param None
+//!
+//! MSStepMotorInit() must be called as well. The engine uses
+//! STEP_MOTION_TIMER, which must differ from MS_DELAY_TIMER.
+//! 
+//! \return None.
+//
+//*****************************************************************************
+void 
+MSStepMotionInit(void)
+{
+    StepMotionInit(MSStepMotionStep, 0);
+    StepMotionTimerInit();
+}
+
+//*****************************************************************************
+//
+//! \brief Queue a move of the stepper and return at once.
+//!
+//! \param ulDir is the selection of Step Motor running direction.
+//! \param ulSteps is the number of phases to move.
+//! \param ulSpeed is the cruise speed in phases per second.
+//! \param ulAccel is the acceleration in phases per second squared, 0 for
+//! none.
+//! \param pfnDone is called from the timer interrupt when the move ends, can
+//! be 0.
+//! \param pvArg is passed to \e pfnDone.
+//!
+//! The \e ulDir parameter can be one of the values:
+//! \b MS_RUN_FORWARD, \b MS_RUN_BACKWARD.
+//!
+//! Moves run one after the other. StepMotionIdle() and StepMotionStop() take
+//! axis 0.
+//! 
+//! \return xtrue if the move was queued, xfalse if the queue was full.
+//
+//*****************************************************************************
+xtBoolean 
+MSStepMotorMove(unsigned long ulDir, unsigned long ulSteps,
+                unsigned long ulSpeed, unsigned long ulAccel,
+                tStepMotionDone pfnDone, void *pvArg)
+{
+    //
+    // Check the arguments.
+    //
+    xASSERT((ulDir == MS_RUN_FORWARD) ||
+            (ulDir == MS_RUN_BACKWARD));
+
+    return StepMotionMove(0, (ulDir == MS_RUN_FORWARD) ? STEP_MOTION_FORWARD :
+                                                         STEP_MOTION_BACKWARD,
+                          ulSteps, ulSpeed, ulAccel, pfnDone, pvArg);
 }
\ No newline at end of file
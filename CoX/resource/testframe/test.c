@@ -21,6 +21,9 @@ static void ClearTokens(void);
 static void PrintTokens(void);
 static void ExecuteTest(const tTestCase *psTest);
 static void PrintNewLine(void);
+#ifdef TEST_BENCH
+static void ExecuteBench(const tBenchCase *psBench);
+#endif
 static xtBoolean _TestFail(void);
 
 
@@ -413,6 +416,114 @@ PrintNewLine(void)
     TestIOPut('\n');
 }
 
+#ifdef TEST_BENCH
+//*****************************************************************************
+//
+//! \brief Execute a benchmark and print the result line.
+//!
+//! \param psBench is the point of the benchmark case.
+//!
+//! \details The first run only warms up and is not kept. The cost of reading
+//! the counter is taken off every sample.
+//!
+//! \return None.
+//
+//*****************************************************************************
+static void 
+ExecuteBench(const tBenchCase *psBench)
+{
+    unsigned long pulCycle[TEST_BENCH_MAX_RUNS];
+    unsigned long ulRuns, ulOverhead, ulStart, ulCycle, ulMedian, i, j;
+    unsigned long long ullRate;
+
+    ulRuns = psBench->ulRuns;
+    if (ulRuns > TEST_BENCH_MAX_RUNS)
+    {
+        ulRuns = TEST_BENCH_MAX_RUNS;
+    }
+    if (ulRuns == 0)
+    {
+        ulRuns = 1;
+    }
+
+    ulOverhead = TEST_CYCLE_MASK;
+    for (i = 0; i < 4; i++)
+    {
+        ulStart = TestCycleGet();
+        ulCycle = (TestCycleGet() - ulStart) & TEST_CYCLE_MASK;
+        if (ulCycle < ulOverhead)
+        {
+            ulOverhead = ulCycle;
+        }
+    }
+
+    for (i = 0; i <= ulRuns; i++)
+    {
+        if (psBench->Setup != 0)
+        {
+            psBench->Setup();
+        }
+
+        ulStart = TestCycleGet();
+        psBench->Run();
+        ulCycle = (TestCycleGet() - ulStart) & TEST_CYCLE_MASK;
+
+        if (psBench->TearDown != 0)
+        {
+            psBench->TearDown();
+        }
+
+        if (i == 0)
+        {
+            continue;
+        }
+
+        //
+        // Keep the samples sorted.
+        //
+        ulCycle = (ulCycle > ulOverhead) ? (ulCycle - ulOverhead) : 0;
+        for (j = i - 1; (j > 0) && (pulCycle[j - 1] > ulCycle); j--)
+        {
+            pulCycle[j] = pulCycle[j - 1];
+        }
+        pulCycle[j] = ulCycle;
+    }
+
+    ulMedian = pulCycle[ulRuns / 2];
+    if ((ulRuns & 1) == 0)
+    {
+        ulMedian = (ulMedian + pulCycle[ulRuns / 2 - 1]) / 2;
+    }
+
+    ullRate = 0;
+    if (ulMedian != 0)
+    {
+        ullRate = (unsigned long long)psBench->ulBytes * TestCycleFreq() /
+                  ulMedian;
+        if (ullRate > (unsigned long)~0UL)
+        {
+            ullRate = (unsigned long)~0UL;
+        }
+    }
+
+    Print("BENCH name=\"");
+    Print(psBench->GetTest());
+    Print("\" runs=");
+    PrintN(ulRuns);
+    Print(" min=");
+    PrintN(pulCycle[0]);
+    Print(" median=");
+    PrintN(ulMedian);
+    Print(" max=");
+    PrintN(pulCycle[ulRuns - 1]);
+    Print(" hz=");
+    PrintN(TestCycleFreq());
+    Print(" bytes_per_s=");
+    PrintN((unsigned long)ullRate);
+    PrintLine("");
+}
+#endif
+
 //*****************************************************************************
 //
 //! \brief Test execution thread function.
@@ -490,6 +601,30 @@ TestMain(void)
         i++;
     }
 
+#ifdef TEST_BENCH
+    TestCycleInit();
+    i = 0;
+    while (g_psBenchPatterns[i]) 
+    {
+        j = 0;
+        while (g_psBenchPatterns[i][j]) 
+        {
+            PrintNewLine();
+            Print("--- Bench Case ");
+            PrintN(i + 1);
+            Print(".");
+            PrintN(j + 1);
+            Print(" (");
+            Print(g_psBenchPatterns[i][j]->GetTest());
+            PrintLine(")");
+
+            ExecuteBench(g_psBenchPatterns[i][j]);
+            j++;
+        }
+        i++;
+    }
+#endif
+
     PrintNewLine();
     PrintLine("");
     Print("Final result: ");
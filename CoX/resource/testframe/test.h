@@ -75,6 +75,11 @@ extern "C" {
 //
 #define TEST_IO_PORT_NUC1XX     1
 
+//
+// Test runs on the PC, print with putchar() and time with the OS clock.
+//
+#define TEST_IO_PORT_HOST       2
+
 //
 // Default Test Board is NUC1xx
 //
@@ -84,6 +89,32 @@ extern "C" {
 
 #endif
 
+//
+//! \brief Run the benchmark suites in g_psBenchPatterns after the tests.
+//
+//#define TEST_BENCH
+
+//
+//! \brief Time the benchmarks with the DWT cycle counter (Cortex-M3/M4),
+//! else SysTick is used, which must not be used by the benchmarks then.
+//
+//#define TEST_CYCLE_DWT
+
+//
+//! \brief Max timed runs of one benchmark (samples kept for the median)
+//
+#define TEST_BENCH_MAX_RUNS     32
+
+//
+// Valid bits of the cycle counter.
+//
+#if defined(TEST_CYCLE_DWT) ||                                                \
+    (defined(TEST_IO_PORT) && (TEST_IO_PORT_BOARD == TEST_IO_PORT_HOST))
+#define TEST_CYCLE_MASK         0xFFFFFFFF
+#else
+#define TEST_CYCLE_MASK         0x00FFFFFF
+#endif
+
 //*****************************************************************************
 //
 //! \brief   Structure representing a test case.
@@ -113,6 +144,50 @@ typedef struct
 }
 tTestCase;
 
+//*****************************************************************************
+//
+//! \brief   Structure representing a benchmark case.
+//!
+//! Setup(), Run() and TearDown() are called \b ulRuns times, only Run() is
+//! timed. The result line is
+//! <tt>BENCH name="..." runs=N min=C median=C max=C hz=F bytes_per_s=B</tt>
+//! with C in cycles of the counter and F the counter frequency.
+//
+//*****************************************************************************
+typedef struct 
+{
+    //
+    //! \brief Benchmark name get function. 
+    //
+    char* (*GetTest)(void);
+
+    //
+    //! \brief Preparation before each run, not timed.
+    //
+    void (*Setup)(void);
+
+    //
+    //! \brief Clean up after each run, not timed.
+    //
+    void (*TearDown)(void);
+
+    //
+    //! \brief The timed function.
+    //
+    void (*Run)(void);
+
+    //
+    //! \brief Number of timed runs, at most TEST_BENCH_MAX_RUNS.
+    //
+    unsigned long ulRuns;
+
+    //
+    //! \brief Bytes moved by one run, 0 if bytes/s is not wanted.
+    //
+    unsigned long ulBytes;
+}
+tBenchCase;
+
 
 extern xtBoolean TestMain(void);
 extern void TestEmitToken(char token);
@@ -134,6 +209,16 @@ extern void TestIOInit(void);
 extern void TestIOPut(char ch);
 extern void TestEnableIRQ(void);
 extern void TestDisableIRQ(void);
+extern void TestCycleInit(void);
+extern unsigned long TestCycleGet(void);
+extern unsigned long TestCycleFreq(void);
+
+#ifdef TEST_BENCH
+//
+// Benchmark Suites Buffer, defined beside g_psPatterns.
+//
+extern const tBenchCase * const* g_psBenchPatterns[];
+#endif
 
 //*****************************************************************************
 //
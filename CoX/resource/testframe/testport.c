@@ -1,5 +1,17 @@
 #include "test.h"
 
+#if defined(TEST_IO_PORT) && (TEST_IO_PORT_BOARD == TEST_IO_PORT_HOST)
+#include <stdio.h>
+#include <time.h>
+#endif
+
+//
+// DWT cycle counter registers.
+//
+#define TEST_DWT_CTRL           0xE0001000
+#define TEST_DWT_CYCCNT         0xE0001004
+#define TEST_DEMCR_TRCENA       0x01000000
+
 //*****************************************************************************
 //
 //! \brief Init uart to print.
@@ -40,6 +52,12 @@ TestIOInit(void)
 
     xUARTEnable(UART0_BASE, (UART_BLOCK_UART | UART_BLOCK_TX | UART_BLOCK_RX));
 }
+#elif (TEST_IO_PORT_BOARD == TEST_IO_PORT_HOST)
+void
+TestIOInit(void)
+{
+    setvbuf(stdout, 0, _IONBF, 0);
+}
 #else
 void
 TestIOInit(void)
@@ -79,6 +97,15 @@ TestIOPut(char ch)
     //
     xUARTCharPut(xUART0_BASE, c);
 }
+#elif (TEST_IO_PORT_BOARD == TEST_IO_PORT_HOST)
+void 
+TestIOPut(char ch)
+{
+    if(ch != '\r')
+    {
+        putchar(ch);
+    }
+}
 #else
 void 
 TestIOPut(char ch)
@@ -97,10 +124,17 @@ TestIOPut(char ch)
 //! \return None.
 //
 //*****************************************************************************
+#if defined(TEST_IO_PORT) && (TEST_IO_PORT_BOARD == TEST_IO_PORT_HOST)
+void TestEnableIRQ(void)
+{
+
+}
+#else
 void TestEnableIRQ(void)
 {
     xCPUcpsie();
 }
+#endif
 
 //*****************************************************************************
 //
@@ -111,8 +145,87 @@ void TestEnableIRQ(void)
 //! \return None.
 //
 //*****************************************************************************
+#if defined(TEST_IO_PORT) && (TEST_IO_PORT_BOARD == TEST_IO_PORT_HOST)
+void TestDisableIRQ(void)
+{
+
+}
+
+//
+// SysCtlDelay() of the test frame, the host has no libcox.
+//
+void SysCtlDelay(unsigned long ulCount)
+{
+
+}
+#else
 void TestDisableIRQ(void)
 {
     xCPUcpsid();
 }
+#endif
 
+//*****************************************************************************
+//
+//! \brief Start the benchmark cycle counter.
+//!
+//! \param None
+//!
+//! \details With TEST_CYCLE_DWT the DWT cycle counter is used, else SysTick
+//! runs free from the core clock with the full 24-bit period.
+//!
+//! \return None.
+//
+//*****************************************************************************
+void TestCycleInit(void)
+{
+#if defined(TEST_IO_PORT) && (TEST_IO_PORT_BOARD == TEST_IO_PORT_HOST)
+#elif defined(TEST_CYCLE_DWT)
+    xHWREG(NVIC_DBG_INT) |= TEST_DEMCR_TRCENA;
+    xHWREG(TEST_DWT_CTRL) |= 1;
+#else
+    xSysTickPeriodSet(0x01000000);
+    xSysTickEnable();
+#endif
+}
+
+//*****************************************************************************
+//
+//! \brief Read the benchmark cycle counter.
+//!
+//! \param None
+//!
+//! \return The counter, counting up, valid bits are TEST_CYCLE_MASK.
+//
+//*****************************************************************************
+unsigned long TestCycleGet(void)
+{
+#if defined(TEST_IO_PORT) && (TEST_IO_PORT_BOARD == TEST_IO_PORT_HOST)
+    struct timespec sTime;
+
+    clock_gettime(CLOCK_MONOTONIC, &sTime);
+    return (unsigned long)sTime.tv_sec * 1000000000UL + sTime.tv_nsec;
+#elif defined(TEST_CYCLE_DWT)
+    return xHWREG(TEST_DWT_CYCCNT);
+#else
+    return TEST_CYCLE_MASK - xSysTickValueGet();
+#endif
+}
+
+//*****************************************************************************
+//
+//! \brief Get the frequency of the benchmark cycle counter.
+//!
+//! \param None
+//!
+//! \return The counter frequency in Hz.
+//
+//*****************************************************************************
+unsigned long TestCycleFreq(void)
+{
+#if defined(TEST_IO_PORT) && (TEST_IO_PORT_BOARD == TEST_IO_PORT_HOST)
+    return 1000000000UL;
+#else
+    return xSysCtlClockGet();
+#endif
+}
@@ -0,0 +1,1002 @@
+//*****************************************************************************
+//
+//! \file boardgen.c
+//! \brief PC generator of the STM32F1xx board init code.
+//! \version V2.2.1.0
+//! \date 10/19/2026
+//! \author CooCox
+//! \copy
+//!
+//! Copyright (c)  2013, CooCox
+//! All rights reserved.
+//! 
+//! Redistribution and use in source and binary forms, with or without 
+//! modification, are permitted provided that the following conditions 
+//! are met: 
+//! 
+//!     * Redistributions of source code must retain the above copyright 
+//! notice, this list of conditions and the following disclaimer. 
+//!     * Redistributions in binary form must reproduce the above copyright
+//! notice, this list of conditions and the following disclaimer in the
+//! documentation and/or other materials provided with the distribution. 
+//!     * Neither the name of the <ORGANIZATION> nor the names of its 
+//! contributors may be used to endorse or promote products derived 
+//! from this software without specific prior written permission. 
+//! 
+//! THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+//! AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE 
+//! IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+//! ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE 
+//! LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR 
+//! CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF 
+//! SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+//! INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN 
+//! CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) 
+//! ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF 
+//! THE POSSIBILITY OF SUCH DAMAGE.
+//!
+//! Build with any C compiler, e.g. "gcc -o boardgen boardgen.c", and run
+//! "boardgen board.txt board_config" to write board_config.h and
+//! board_config.c from a board description (see boardgen.h). The generated
+//! BoardInit() writes every RCC enable, GPIO CRL/CRH/ODR, AFIO_MAPR and NVIC
+//! register the board uses once with the values worked out here, instead of
+//! xSysCtlPeripheralEnable2(), xGPIODirModeSet() and GPIOPinConfigure()
+//! calls that look up tables and loop over pins at run time. It is meant to
+//! run once after reset: the registers it stores whole are assumed to hold
+//! their reset value, the pins that are not listed stay floating inputs.
+//!
+//! The host unit tests are in boardgen_test.c, build them with
+//! "gcc -DBOARDGEN_NO_MAIN -o boardgen_test boardgen.c boardgen_test.c".
+//
+//*****************************************************************************
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <ctype.h>
+#include "boardgen.h"
+
+//
+// Register addresses, see xhw_memmap.h, xhw_sysctl.h, xhw_gpio.h and
+// xhw_nvic.h.
+//
+#define RCC_AHBENR              0x40021014
+#define RCC_APB2ENR             0x40021018
+#define RCC_APB1ENR             0x4002101C
+#define AFIO_MAPR               0x40010004
+#define GPIOA_BASE              0x40010800
+#define GPIO_PORT_SIZE          0x00000400
+#define GPIO_CRL                0x00000000
+#define GPIO_CRH                0x00000004
+#define GPIO_ODR                0x0000000C
+#define NVIC_EN0                0xE000E100
+#define NVIC_PRI0               0xE000E400
+
+//
+// Reset value of GPIO CRL/CRH, every pin a floating input.
+//
+#define GPIO_CR_RESET           0x44444444
+
+//
+// Enable bits of GPIOA (IOPAEN) and AFIO (AFIOEN) in RCC_APB2ENR.
+//
+#define RCC_APB2ENR_IOPAEN      2
+#define RCC_APB2ENR_AFIOEN      0
+
+//
+// Priority bits of the STM32F1xx (NUM_PRIORITY_BITS).
+//
+#define BOARD_PRIO_BITS         4
+
+#define BOARD_TOKEN_NUM         8
+#define BOARD_LINE_SIZE         256
+
+//
+// Pin modes. ulCNF is the CNF field of CRL/CRH, already shifted left by 2.
+//
+#define PIN_INPUT               0
+#define PIN_OUTPUT              1
+#define PIN_AF                  2
+
+static const struct
+{
+    const char *pcName;
+    unsigned long ulCNF;
+    int iKind;
+    int iPull;
+}
+g_sPinMode[] =
+{
+    {"analog", 0x0, PIN_INPUT,  -1},
+    {"in",     0x4, PIN_INPUT,  -1},
+    {"in_pu",  0x8, PIN_INPUT,  1},
+    {"in_pd",  0x8, PIN_INPUT,  0},
+    {"out",    0x0, PIN_OUTPUT, -1},
+    {"out_od", 0x4, PIN_OUTPUT, -1},
+    {"af",     0x8, PIN_AF,     -1},
+    {"af_od",  0xC, PIN_AF,     -1},
+};
+
+//
+// Output speeds, the MODE field of CRL/CRH.
+//
+static const struct
+{
+    const char *pcName;
+    unsigned long ulMode;
+}
+g_sPinSpeed[] =
+{
+    {"10M", 0x1},
+    {"2M",  0x2},
+    {"50M", 0x3},
+};
+
+//
+// RCC clock enable bits.
+//
+static const struct
+{
+    const char *pcName;
+    int iBus;
+    int iBit;
+}
+g_sClock[] =
+{
+    {"DMA1",   BOARD_BUS_AHB,  0},  {"DMA2",   BOARD_BUS_AHB,  1},
+    {"SRAM",   BOARD_BUS_AHB,  2},  {"FLITF",  BOARD_BUS_AHB,  4},
+    {"CRC",    BOARD_BUS_AHB,  6},  {"FSMC",   BOARD_BUS_AHB,  8},
+    {"SDIO",   BOARD_BUS_AHB,  10}, {"OTGFS",  BOARD_BUS_AHB,  12},
+    {"ETHMAC", BOARD_BUS_AHB,  14},
+    {"AFIO",   BOARD_BUS_APB2, 0},  {"GPIOA",  BOARD_BUS_APB2, 2},
+    {"GPIOB",  BOARD_BUS_APB2, 3},  {"GPIOC",  BOARD_BUS_APB2, 4},
+    {"GPIOD",  BOARD_BUS_APB2, 5},  {"GPIOE",  BOARD_BUS_APB2, 6},
+    {"GPIOF",  BOARD_BUS_APB2, 7},  {"GPIOG",  BOARD_BUS_APB2, 8},
+    {"ADC1",   BOARD_BUS_APB2, 9},  {"ADC2",   BOARD_BUS_APB2, 10},
+    {"TIM1",   BOARD_BUS_APB2, 11}, {"SPI1",   BOARD_BUS_APB2, 12},
+    {"TIM8",   BOARD_BUS_APB2, 13}, {"USART1", BOARD_BUS_APB2, 14},
+    {"ADC3",   BOARD_BUS_APB2, 15}, {"TIM9",   BOARD_BUS_APB2, 19},
+    {"TIM10",  BOARD_BUS_APB2, 20}, {"TIM11",  BOARD_BUS_APB2, 21},
+    {"TIM2",   BOARD_BUS_APB1, 0},  {"TIM3",   BOARD_BUS_APB1, 1},
+    {"TIM4",   BOARD_BUS_APB1, 2},  {"TIM5",   BOARD_BUS_APB1, 3},
+    {"TIM6",   BOARD_BUS_APB1, 4},  {"TIM7",   BOARD_BUS_APB1, 5},
+    {"TIM12",  BOARD_BUS_APB1, 6},  {"TIM13",  BOARD_BUS_APB1, 7},
+    {"TIM14",  BOARD_BUS_APB1, 8},  {"WWDG",   BOARD_BUS_APB1, 11},
+    {"SPI2",   BOARD_BUS_APB1, 14}, {"SPI3",   BOARD_BUS_APB1, 15},
+    {"USART2", BOARD_BUS_APB1, 17}, {"USART3", BOARD_BUS_APB1, 18},
+    {"UART4",  BOARD_BUS_APB1, 19}, {"UART5",  BOARD_BUS_APB1, 20},
+    {"I2C1",   BOARD_BUS_APB1, 21}, {"I2C2",   BOARD_BUS_APB1, 22},
+    {"USB",    BOARD_BUS_APB1, 23}, {"CAN1",   BOARD_BUS_APB1, 25},
+    {"CAN2",   BOARD_BUS_APB1, 26}, {"BKP",    BOARD_BUS_APB1, 27},
+    {"PWR",    BOARD_BUS_APB1, 28}, {"DAC",    BOARD_BUS_APB1, 29},
+};
+
+static const char * const g_pcBusReg[3] =
+{
+    "RCC_AHBENR", "RCC_APB2ENR", "RCC_APB1ENR"
+};
+
+static const unsigned long g_ulBusAddr[3] =
+{
+    RCC_AHBENR, RCC_APB2ENR, RCC_APB1ENR
+};
+
+//
+// AFIO_MAPR fields. A field of one bit is set by naming it, a wider field
+// takes one of its options ("name=value" separated by spaces).
+//
+static const struct
+{
+    const char *pcName;
+    int iShift;
+    int iWidth;
+    const char *pcOption;
+}
+g_sRemap[] =
+{
+    {"SPI1",         0,  1, 0},
+    {"I2C1",         1,  1, 0},
+    {"USART1",       2,  1, 0},
+    {"USART2",       3,  1, 0},
+    {"USART3",       4,  2, "partial=1 full=3"},
+    {"TIM1",         6,  2, "partial=1 full=3"},
+    {"TIM2",         8,  2, "partial1=1 partial2=2 full=3"},
+    {"TIM3",         10, 2, "partial=2 full=3"},
+    {"TIM4",         12, 1, 0},
+    {"CAN1",         13, 2, "pb=2 pd=3"},
+    {"PD01",         15, 1, 0},
+    {"TIM5CH4",      16, 1, 0},
+    {"ADC1_ETRGINJ", 17, 1, 0},
+    {"ADC1_ETRGREG", 18, 1, 0},
+    {"ADC2_ETRGINJ", 19, 1, 0},
+    {"ADC2_ETRGREG", 20, 1, 0},
+    {"SWJ",          24, 3, "full=0 nonjrst=1 nojtag=2 off=4"},
+};
+
+//
+// External interrupts, the names of xhw_ints.h without INT_.
+//
+static const char * const g_pcIRQ[BOARD_IRQ_NUM] =
+{
+    "WWDG", "PVD", "TAMPER", "RTC", "FLASH", "RCC", "EXTI0", "EXTI1",
+    "EXTI2", "EXTI3", "EXTI4", "DMA1C1", "DMA1C2", "DMA1C3", "DMA1C4",
+    "DMA1C5", "DMA1C6", "DMA1C7", "ADC12", "CAN1TX", "CAN1RX0", "CAN1RX1",
+    "CAN1SCE", "EXTI95", "TIM1BRK", "TIM1UP", "TIM1TRGCOM", "TIM1CC",
+    "TIM2", "TIM3", "TIM4", "I2C1EV", "I2C1ER", "I2C2EV", "I2C2ER", "SPI1",
+    "SPI2", "USART1", "USART2", "USART3", "EXTI1510", "RTCALARM",
+    "OTGFSWKUP", 0, 0, 0, 0, 0, 0, 0, "TIM5", "SPI3", "UART4", "UART5",
+    "TIM6", "TIM7", "DMA2C1", "DMA2C2", "DMA2C3", "DMA2C4", "DMA2C5", "ETH",
+    "ETHWKUP", "CAN2TX", "CAN2RX0", "CAN2RX1", "CAN2SCE", "OTGFS"
+};
+
+//*****************************************************************************
+//
+//! \brief Compare two names, ignoring the case.
+//
+//*****************************************************************************
+static int
+NameEqual(const char *pcA, const char *pcB)
+{
+    while(*pcA && *pcB)
+    {
+        if(toupper((unsigned char)*pcA) != toupper((unsigned char)*pcB))
+        {
+            return (0);
+        }
+        pcA++;
+        pcB++;
+    }
+    return (*pcA == *pcB);
+}
+
+//*****************************************************************************
+//
+//! \brief Record an error of the current line.
+//!
+//! \return -1.
+//
+//*****************************************************************************
+static int
+ErrorSet(tBoard *psBoard, const char *pcFormat, const char *pcArg)
+{
+    snprintf(psBoard->pcError, BOARD_ERROR_SIZE, pcFormat, pcArg);
+    return (-1);
+}
+
+//*****************************************************************************
+//
+//! \brief Check that a token is a C identifier.
+//
+//*****************************************************************************
+static int
+LabelValid(const char *pcLabel)
+{
+    if(!isalpha((unsigned char)*pcLabel) && *pcLabel != '_')
+    {
+        return (0);
+    }
+    while(*pcLabel)
+    {
+        if(!isalnum((unsigned char)*pcLabel) && *pcLabel != '_')
+        {
+            return (0);
+        }
+        pcLabel++;
+    }
+    return (1);
+}
+
+//*****************************************************************************
+//
+//! \brief Set the RCC enable bit of a clock name.
+//!
+//! \return 0 on success, -1 if the name is unknown.
+//
+//*****************************************************************************
+static int
+ClockAdd(tBoard *psBoard, const char *pcName)
+{
+    unsigned long i;
+
+    for(i = 0; i < sizeof(g_sClock) / sizeof(g_sClock[0]); i++)
+    {
+        if(NameEqual(pcName, g_sClock[i].pcName))
+        {
+            psBoard->ulENR[g_sClock[i].iBus] |= 1UL << g_sClock[i].iBit;
+            return (0);
+        }
+    }
+    return (ErrorSet(psBoard, "unknown clock \"%s\"", pcName));
+}
+
+//*****************************************************************************
+//
+//! \brief Parse "pin Pxn mode [speed] [level] [label]".
+//
+//*****************************************************************************
+static int
+PinParse(tBoard *psBoard, char **ppcToken, int iNum)
+{
+    tBoardPort *psPort;
+    unsigned long ulPort, ulPin, ulShift, i;
+    unsigned long ulMode = 0;
+    int iMode, iLevel = -1, iArg;
+    const char *pcLabel = 0;
+    char *pcEnd;
+
+    //
+    // Pin name.
+    //
+    if(iNum < 3)
+    {
+        return (ErrorSet(psBoard, "%s needs a pin and a mode", ppcToken[0]));
+    }
+    ulPort = toupper((unsigned char)ppcToken[1][1]) - 'A';
+    ulPin = strtoul(&ppcToken[1][2], &pcEnd, 10);
+    if(toupper((unsigned char)ppcToken[1][0]) != 'P' ||
+       ulPort >= BOARD_PORT_NUM || !isdigit((unsigned char)ppcToken[1][2]) ||
+       *pcEnd || ulPin > 15)
+    {
+        return (ErrorSet(psBoard, "bad pin \"%s\"", ppcToken[1]));
+    }
+    psPort = &psBoard->sPort[ulPort];
+    if(psPort->ulUsed & (1UL << ulPin))
+    {
+        return (ErrorSet(psBoard, "%s is configured twice", ppcToken[1]));
+    }
+
+    //
+    // Mode.
+    //
+    for(iMode = 0; iMode < (int)(sizeof(g_sPinMode) / sizeof(g_sPinMode[0]));
+        iMode++)
+    {
+        if(NameEqual(ppcToken[2], g_sPinMode[iMode].pcName))
+        {
+            break;
+        }
+    }
+    if(iMode == (int)(sizeof(g_sPinMode) / sizeof(g_sPinMode[0])))
+    {
+        return (ErrorSet(psBoard, "unknown pin mode \"%s\"", ppcToken[2]));
+    }
+
+    //
+    // Options. Outputs default to 2 MHz, alternate functions to 50 MHz like
+    // GPIOPinConfigure().
+    //
+    if(g_sPinMode[iMode].iKind == PIN_OUTPUT)
+    {
+        ulMode = 0x2;
+    }
+    else if(g_sPinMode[iMode].iKind == PIN_AF)
+    {
+        ulMode = 0x3;
+    }
+    for(iArg = 3; iArg < iNum; iArg++)
+    {
+        for(i = 0; i < sizeof(g_sPinSpeed) / sizeof(g_sPinSpeed[0]); i++)
+        {
+            if(NameEqual(ppcToken[iArg], g_sPinSpeed[i].pcName))
+            {
+                break;
+            }
+        }
+        if(i < sizeof(g_sPinSpeed) / sizeof(g_sPinSpeed[0]))
+        {
+            if(g_sPinMode[iMode].iKind == PIN_INPUT)
+            {
+                return (ErrorSet(psBoard, "input %s has no speed",
+                                 ppcToken[1]));
+            }
+            ulMode = g_sPinSpeed[i].ulMode;
+        }
+        else if(NameEqual(ppcToken[iArg], "low") ||
+                NameEqual(ppcToken[iArg], "high"))
+        {
+            if(g_sPinMode[iMode].iKind != PIN_OUTPUT)
+            {
+                return (ErrorSet(psBoard, "only an output of %s has a level",
+                                 ppcToken[1]));
+            }
+            iLevel = NameEqual(ppcToken[iArg], "high");
+        }
+        else if(!pcLabel && LabelValid(ppcToken[iArg]) &&
+                strlen(ppcToken[iArg]) < BOARD_LABEL_SIZE)
+        {
+            pcLabel = ppcToken[iArg];
+        }
+        else
+        {
+            return (ErrorSet(psBoard, "bad pin option \"%s\"", ppcToken[iArg]));
+        }
+    }
+
+    //
+    // Labels become macros, so they must be unique.
+    //
+    if(pcLabel)
+    {
+        for(ulPort = 0; ulPort < BOARD_PORT_NUM; ulPort++)
+        {
+            for(i = 0; i < 16; i++)
+            {
+                if(NameEqual(psBoard->sPort[ulPort].pcLabel[i], pcLabel))
+                {
+                    return (ErrorSet(psBoard, "label %s is used twice",
+                                     pcLabel));
+                }
+            }
+        }
+        strcpy(psPort->pcLabel[ulPin], pcLabel);
+    }
+
+    //
+    // Work out the 4 configuration bits of the pin, as GPIODirModeSet().
+    //
+    ulShift = (ulPin & 7) * 4;
+    psPort->ulCR[ulPin >> 3] &= ~(0xFUL << ulShift);
+    psPort->ulCR[ulPin >> 3] |= (g_sPinMode[iMode].ulCNF | ulMode) << ulShift;
+    psPort->ulUsed |= 1UL << ulPin;
+
+    if(g_sPinMode[iMode].iPull >= 0)
+    {
+        iLevel = g_sPinMode[iMode].iPull;
+    }
+    if(g_sPinMode[iMode].iKind == PIN_OUTPUT ||
+       g_sPinMode[iMode].iPull >= 0)
+    {
+        psPort->ulODRUsed |= 1UL << ulPin;
+        if(iLevel == 1)
+        {
+            psPort->ulODR |= 1UL << ulPin;
+        }
+    }
+
+    psBoard->ulENR[BOARD_BUS_APB2] |=
+        1UL << (RCC_APB2ENR_IOPAEN + (psPort - psBoard->sPort));
+    return (0);
+}
+
+//*****************************************************************************
+//
+//! \brief Parse "remap name [option]".
+//
+//*****************************************************************************
+static int
+RemapParse(tBoard *psBoard, char **ppcToken, int iNum)
+{
+    unsigned long i, ulValue, ulMask;
+    const char *pcOption;
+    size_t iLen;
+
+    if(iNum < 2 || iNum > 3)
+    {
+        return (ErrorSet(psBoard, "%s needs a name and an option",
+                         ppcToken[0]));
+    }
+    for(i = 0; i < sizeof(g_sRemap) / sizeof(g_sRemap[0]); i++)
+    {
+        if(NameEqual(ppcToken[1], g_sRemap[i].pcName))
+        {
+            break;
+        }
+    }
+    if(i == sizeof(g_sRemap) / sizeof(g_sRemap[0]))
+    {
+        return (ErrorSet(psBoard, "unknown remap \"%s\"", ppcToken[1]));
+    }
+
+    //
+    // Look the option up in "name=value name=value".
+    //
+    if(!g_sRemap[i].pcOption)
+    {
+        if(iNum != 2)
+        {
+            return (ErrorSet(psBoard, "remap %s has no option", ppcToken[1]));
+        }
+        ulValue = 1;
+    }
+    else
+    {
+        if(iNum != 3)
+        {
+            return (ErrorSet(psBoard, "remap %s needs an option",
+                             ppcToken[1]));
+        }
+        iLen = strlen(ppcToken[2]);
+        for(pcOption = g_sRemap[i].pcOption; *pcOption; )
+        {
+            if(strncmp(pcOption, ppcToken[2], iLen) == 0 &&
+               pcOption[iLen] == '=')
+            {
+                break;
+            }
+            pcOption = strchr(pcOption, ' ');
+            if(!pcOption)
+            {
+                break;
+            }
+            pcOption++;
+        }
+        if(!pcOption || !*pcOption)
+        {
+            return (ErrorSet(psBoard, "bad remap option \"%s\"", ppcToken[2]));
+        }
+        ulValue = strtoul(pcOption + iLen + 1, 0, 0);
+    }
+
+    //
+    // A field is set once, it has one value.
+    //
+    ulMask = ((1UL << g_sRemap[i].iWidth) - 1) << g_sRemap[i].iShift;
+    ulValue <<= g_sRemap[i].iShift;
+    if((psBoard->ulMAPRUsed & ulMask) &&
+       (psBoard->ulMAPR & ulMask) != ulValue)
+    {
+        return (ErrorSet(psBoard, "remap %s conflicts with a former one",
+                         ppcToken[1]));
+    }
+    psBoard->ulMAPR = (psBoard->ulMAPR & ~ulMask) | ulValue;
+    psBoard->ulMAPRUsed |= ulMask;
+    psBoard->ulENR[BOARD_BUS_APB2] |= 1UL << RCC_APB2ENR_AFIOEN;
+    return (0);
+}
+
+//*****************************************************************************
+//
+//! \brief Parse "irq name priority [enable]".
+//
+//*****************************************************************************
+static int
+IrqParse(tBoard *psBoard, char **ppcToken, int iNum)
+{
+    unsigned long ulIRQ, ulPrio;
+    char *pcEnd;
+
+    if(iNum < 3 || iNum > 4 || (iNum == 4 && !NameEqual(ppcToken[3], "enable")))
+    {
+        return (ErrorSet(psBoard, "%s needs a name, a priority and "
+                         "optionally enable", ppcToken[0]));
+    }
+    for(ulIRQ = 0; ulIRQ < BOARD_IRQ_NUM; ulIRQ++)
+    {
+        if(g_pcIRQ[ulIRQ] && NameEqual(ppcToken[1], g_pcIRQ[ulIRQ]))
+        {
+            break;
+        }
+    }
+    if(ulIRQ == BOARD_IRQ_NUM)
+    {
+        return (ErrorSet(psBoard, "unknown irq \"%s\"", ppcToken[1]));
+    }
+    if(psBoard->ulPrioUsed[ulIRQ / 32] & (1UL << (ulIRQ % 32)))
+    {
+        return (ErrorSet(psBoard, "irq %s is configured twice",
+                         ppcToken[1]));
+    }
+    ulPrio = strtoul(ppcToken[2], &pcEnd, 10);
+    if(!isdigit((unsigned char)ppcToken[2][0]) || *pcEnd ||
+       ulPrio >= (1UL << BOARD_PRIO_BITS))
+    {
+        return (ErrorSet(psBoard, "bad priority \"%s\"", ppcToken[2]));
+    }
+
+    //
+    // The priority is in the high bits of the byte, as IntPrioritySet().
+    //
+    psBoard->ucPrio[ulIRQ] = (unsigned char)(ulPrio << (8 - BOARD_PRIO_BITS));
+    psBoard->ulPrioUsed[ulIRQ / 32] |= 1UL << (ulIRQ % 32);
+    if(iNum == 4)
+    {
+        psBoard->ulISER[ulIRQ / 32] |= 1UL << (ulIRQ % 32);
+    }
+    return (0);
+}
+
+//*****************************************************************************
+//
+//! \brief Clear a board, every register at its reset value.
+//!
+//! \return None.
+//
+//*****************************************************************************
+void
+BoardReset(tBoard *psBoard)
+{
+    int i;
+
+    memset(psBoard, 0, sizeof(tBoard));
+    for(i = 0; i < BOARD_PORT_NUM; i++)
+    {
+        psBoard->sPort[i].ulCR[0] = GPIO_CR_RESET;
+        psBoard->sPort[i].ulCR[1] = GPIO_CR_RESET;
+    }
+}
+
+//*****************************************************************************
+//
+//! \brief Add one line of a board description.
+//!
+//! \return 0 on success, -1 with the reason in pcError on an error.
+//
+//*****************************************************************************
+int
+BoardLineParse(tBoard *psBoard, const char *pcLine)
+{
+    char cLine[BOARD_LINE_SIZE];
+    char *ppcToken[BOARD_TOKEN_NUM];
+    char *pcPos;
+    int iNum = 0;
+
+    psBoard->pcError[0] = 0;
+    if(strlen(pcLine) >= BOARD_LINE_SIZE)
+    {
+        return (ErrorSet(psBoard, "line is too long%s", ""));
+    }
+    strcpy(cLine, pcLine);
+    pcPos = strchr(cLine, '#');
+    if(pcPos)
+    {
+        *pcPos = 0;
+    }
+
+    for(pcPos = strtok(cLine, " \t\r\n"); pcPos;
+        pcPos = strtok(0, " \t\r\n"))
+    {
+        if(iNum == BOARD_TOKEN_NUM)
+        {
+            return (ErrorSet(psBoard, "too many words%s", ""));
+        }
+        ppcToken[iNum++] = pcPos;
+    }
+    if(iNum == 0)
+    {
+        return (0);
+    }
+
+    if(NameEqual(ppcToken[0], "pin"))
+    {
+        return (PinParse(psBoard, ppcToken, iNum));
+    }
+    if(NameEqual(ppcToken[0], "clock"))
+    {
+        if(iNum != 2)
+        {
+            return (ErrorSet(psBoard, "clock needs one name%s", ""));
+        }
+        return (ClockAdd(psBoard, ppcToken[1]));
+    }
+    if(NameEqual(ppcToken[0], "remap"))
+    {
+        return (RemapParse(psBoard, ppcToken, iNum));
+    }
+    if(NameEqual(ppcToken[0], "irq"))
+    {
+        return (IrqParse(psBoard, ppcToken, iNum));
+    }
+    return (ErrorSet(psBoard, "unknown statement \"%s\"", ppcToken[0]));
+}
+
+//*****************************************************************************
+//
+//! \brief Read a board description file.
+//!
+//! The errors are printed as "file:line: reason".
+//!
+//! \return the number of errors.
+//
+//*****************************************************************************
+int
+BoardFileParse(tBoard *psBoard, FILE *pFile, const char *pcFile)
+{
+    char cLine[BOARD_LINE_SIZE + 2];
+    int iLine = 0, iError = 0;
+
+    while(fgets(cLine, sizeof(cLine), pFile))
+    {
+        iLine++;
+        if(BoardLineParse(psBoard, cLine) != 0)
+        {
+            fprintf(stderr, "%s:%d: %s\n", pcFile, iLine, psBoard->pcError);
+            iError++;
+        }
+    }
+    return (iError);
+}
+
+//*****************************************************************************
+//
+//! \brief Add one write to the list.
+//
+//*****************************************************************************
+static unsigned long
+WriteAdd(tBoardWrite *psWrite, unsigned long ulNum, const char *pcReg,
+         const char *pcName, unsigned long ulAddr, unsigned long ulValue,
+         int bOr)
+{
+    snprintf(psWrite[ulNum].pcReg, sizeof(psWrite[ulNum].pcReg), "%s", pcReg);
+    snprintf(psWrite[ulNum].pcName, sizeof(psWrite[ulNum].pcName), "%s",
+             pcName);
+    psWrite[ulNum].ulAddr = ulAddr;
+    psWrite[ulNum].ulValue = ulValue;
+    psWrite[ulNum].bOr = bOr;
+    return (ulNum + 1);
+}
+
+//*****************************************************************************
+//
+//! \brief Get the register writes of BoardInit() in their order.
+//!
+//! \param psWrite receives up to BOARD_WRITE_MAX writes.
+//!
+//! Clocks come first, so the GPIO and AFIO registers can be written. The
+//! ODR of a port is written before its CRL/CRH, so the outputs start at
+//! their level. The interrupts are enabled last. Registers without a
+//! configured bit are left out.
+//!
+//! \return the number of writes.
+//
+//*****************************************************************************
+unsigned long
+BoardWritesGet(const tBoard *psBoard, tBoardWrite *psWrite)
+{
+    const tBoardPort *psPort;
+    unsigned long ulNum = 0, ulValue;
+    char cReg[32], cName[24];
+    int i, j;
+
+    for(i = 0; i < 3; i++)
+    {
+        if(psBoard->ulENR[i])
+        {
+            ulNum = WriteAdd(psWrite, ulNum, g_pcBusReg[i], g_pcBusReg[i],
+                             g_ulBusAddr[i], psBoard->ulENR[i], 1);
+        }
+    }
+
+    for(i = 0; i < BOARD_PORT_NUM; i++)
+    {
+        psPort = &psBoard->sPort[i];
+        if(psPort->ulODRUsed)
+        {
+            sprintf(cReg, "GPIO%c_BASE + GPIO_ODR", 'A' + i);
+            sprintf(cName, "GPIO%c_ODR", 'A' + i);
+            ulNum = WriteAdd(psWrite, ulNum, cReg, cName,
+                             GPIOA_BASE + i * GPIO_PORT_SIZE + GPIO_ODR,
+                             psPort->ulODR, 0);
+        }
+        for(j = 0; j < 2; j++)
+        {
+            if(psPort->ulUsed & (0xFFUL << (j * 8)))
+            {
+                sprintf(cReg, "GPIO%c_BASE + GPIO_CR%c", 'A' + i,
+                        j ? 'H' : 'L');
+                sprintf(cName, "GPIO%c_CR%c", 'A' + i, j ? 'H' : 'L');
+                ulNum = WriteAdd(psWrite, ulNum, cReg, cName,
+                                 GPIOA_BASE + i * GPIO_PORT_SIZE +
+                                 (j ? GPIO_CRH : GPIO_CRL),
+                                 psPort->ulCR[j], 0);
+            }
+        }
+    }
+
+    if(psBoard->ulMAPRUsed)
+    {
+        ulNum = WriteAdd(psWrite, ulNum, "AFIO_MAPR", "AFIO_MAPR", AFIO_MAPR,
+                         psBoard->ulMAPR, 0);
+    }
+
+    //
+    // Four priorities per register.
+    //
+    for(i = 0; i < BOARD_IRQ_NUM; i += 4)
+    {
+        if((psBoard->ulPrioUsed[i / 32] >> (i % 32)) & 0xF)
+        {
+            ulValue = 0;
+            for(j = 0; j < 4; j++)
+            {
+                ulValue |= (unsigned long)psBoard->ucPrio[i + j] << (j * 8);
+            }
+            sprintf(cReg, "NVIC_PRI%d", i / 4);
+            ulNum = WriteAdd(psWrite, ulNum, cReg, cReg, NVIC_PRI0 + i,
+                             ulValue, 0);
+        }
+    }
+    for(i = 0; i < 3; i++)
+    {
+        if(psBoard->ulISER[i])
+        {
+            sprintf(cReg, "NVIC_EN%d", i);
+            ulNum = WriteAdd(psWrite, ulNum, cReg, cReg, NVIC_EN0 + i * 4,
+                             psBoard->ulISER[i], 0);
+        }
+    }
+
+    return (ulNum);
+}
+
+//*****************************************************************************
+//
+//! \brief Make the include guard of a generated file.
+//
+//*****************************************************************************
+static void
+GuardGet(char *pcGuard, const char *pcName)
+{
+    const char *pcBase;
+    int i = 0;
+
+    //
+    // Use the file name without its directories.
+    //
+    pcBase = strrchr(pcName, '/');
+    pcBase = pcBase ? pcBase + 1 : pcName;
+    sprintf(pcGuard, "__");
+    for(pcGuard += 2; *pcBase && i < 64; pcBase++, i++)
+    {
+        *pcGuard++ = isalnum((unsigned char)*pcBase) ?
+                     (char)toupper((unsigned char)*pcBase) : '_';
+    }
+    strcpy(pcGuard, "_H__");
+}
+
+//*****************************************************************************
+//
+//! \brief Write the header: register values, pin labels and BoardInit().
+//!
+//! \return None.
+//
+//*****************************************************************************
+void
+BoardHeaderWrite(const tBoard *psBoard, FILE *pFile, const char *pcName,
+                 const char *pcSource)
+{
+    tBoardWrite sWrite[BOARD_WRITE_MAX];
+    unsigned long ulNum, i;
+    char cGuard[80], cMacro[BOARD_LABEL_SIZE + 8];
+    int iPort, iPin;
+
+    GuardGet(cGuard, pcName);
+    ulNum = BoardWritesGet(psBoard, sWrite);
+
+    fprintf(pFile,
+            "//\n"
+            "// Generated by boardgen from %s, do not edit.\n"
+            "//\n"
+            "#ifndef %s\n"
+            "#define %s\n\n"
+            "#ifdef __cplusplus\n"
+            "extern \"C\"\n"
+            "{\n"
+            "#endif\n\n"
+            "//\n"
+            "// Register values written by BoardInit().\n"
+            "//\n", pcSource, cGuard, cGuard);
+    for(i = 0; i < ulNum; i++)
+    {
+        fprintf(pFile, "#define BOARD_%-24s0x%08lX\n", sWrite[i].pcName,
+                sWrite[i].ulValue);
+    }
+
+    fprintf(pFile, "\n//\n// Board pins.\n//\n");
+    for(iPort = 0; iPort < BOARD_PORT_NUM; iPort++)
+    {
+        for(iPin = 0; iPin < 16; iPin++)
+        {
+            if(psBoard->sPort[iPort].pcLabel[iPin][0])
+            {
+                sprintf(cMacro, "%s_PORT", psBoard->sPort[iPort].pcLabel[iPin]);
+                fprintf(pFile, "#define %-30sGPIO%c_BASE\n", cMacro,
+                        'A' + iPort);
+                sprintf(cMacro, "%s_PIN", psBoard->sPort[iPort].pcLabel[iPin]);
+                fprintf(pFile, "#define %-30sGPIO_PIN_%d\n", cMacro, iPin);
+            }
+        }
+    }
+
+    fprintf(pFile,
+            "\nextern void BoardInit(void);\n\n"
+            "#ifdef __cplusplus\n"
+            "}\n"
+            "#endif\n\n"
+            "#endif // %s\n", cGuard);
+}
+
+//*****************************************************************************
+//
+//! \brief Write the source of BoardInit().
+//!
+//! \return None.
+//
+//*****************************************************************************
+void
+BoardSourceWrite(const tBoard *psBoard, FILE *pFile, const char *pcName,
+                 const char *pcSource)
+{
+    tBoardWrite sWrite[BOARD_WRITE_MAX];
+    unsigned long ulNum, i;
+    const char *pcBase;
+
+    ulNum = BoardWritesGet(psBoard, sWrite);
+    pcBase = strrchr(pcName, '/');
+    pcBase = pcBase ? pcBase + 1 : pcName;
+
+    fprintf(pFile,
+            "//\n"
+            "// Generated by boardgen from %s, do not edit.\n"
+            "//\n"
+            "#include \"xhw_types.h\"\n"
+            "#include \"xhw_memmap.h\"\n"
+            "#include \"xhw_sysctl.h\"\n"
+            "#include \"xhw_gpio.h\"\n"
+            "#include \"xhw_nvic.h\"\n"
+            "#include \"%s.h\"\n\n"
+            "//\n"
+            "// Configure the board, call it once after reset.\n"
+            "//\n"
+            "void\n"
+            "BoardInit(void)\n"
+            "{\n", pcSource, pcBase);
+    for(i = 0; i < ulNum; i++)
+    {
+        fprintf(pFile, "    xHWREG(%s) %s= BOARD_%s;\n", sWrite[i].pcReg,
+                sWrite[i].bOr ? "|" : "", sWrite[i].pcName);
+    }
+    fprintf(pFile, "}\n");
+}
+
+#ifndef BOARDGEN_NO_MAIN
+int
+main(int argc, char *argv[])
+{
+    char cFile[260];
+    tBoard sBoard;
+    FILE *pFile;
+    int iError;
+
+    if(argc != 3 || strlen(argv[2]) > sizeof(cFile) - 3)
+    {
+        fprintf(stderr, "usage: boardgen board.txt board_config\n");
+        return (1);
+    }
+
+    pFile = fopen(argv[1], "r");
+    if(!pFile)
+    {
+        fprintf(stderr, "can not open %s\n", argv[1]);
+        return (1);
+    }
+    BoardReset(&sBoard);
+    iError = BoardFileParse(&sBoard, pFile, argv[1]);
+    fclose(pFile);
+    if(iError)
+    {
+        return (1);
+    }
+
+    sprintf(cFile, "%s.h", argv[2]);
+    pFile = fopen(cFile, "w");
+    if(!pFile)
+    {
+        fprintf(stderr, "can not write %s\n", cFile);
+        return (1);
+    }
+    BoardHeaderWrite(&sBoard, pFile, argv[2], argv[1]);
+    fclose(pFile);
+
+    sprintf(cFile, "%s.c", argv[2]);
+    pFile = fopen(cFile, "w");
+    if(!pFile)
+    {
+        fprintf(stderr, "can not write %s\n", cFile);
+        return (1);
+    }
+    BoardSourceWrite(&sBoard, pFile, argv[2], argv[1]);
+    fclose(pFile);
+
+    return (0);
+}
+#endif
@@ -0,0 +1,168 @@
+//*****************************************************************************
+//
+//! \file boardgen.h
+//! \brief Board description model of the boardgen tool.
+//! \version V2.2.1.0
+//! \date 10/19/2026
+//! \author CooCox
+//! \copy
+//!
+//! Copyright (c)  2013, CooCox
+//! All rights reserved.
+//! 
+//! Redistribution and use in source and binary forms, with or without 
+//! modification, are permitted provided that the following conditions 
+//! are met: 
+//! 
+//!     * Redistributions of source code must retain the above copyright 
+//! notice, this list of conditions and the following disclaimer. 
+//!     * Redistributions in binary form must reproduce the above copyright
+//! notice, this list of conditions and the following disclaimer in the
+//! documentation and/or other materials provided with the distribution. 
+//!     * Neither the name of the <ORGANIZATION> nor the names of its 
+//! contributors may be used to endorse or promote products derived 
+//! from this software without specific prior written permission. 
+//! 
+//! THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+//! AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE 
+//! IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+//! ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE 
+//! LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR 
+//! CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF 
+//! SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+//! INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN 
+//! CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) 
+//! ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF 
+//! THE POSSIBILITY OF SUCH DAMAGE.
+//!
+//! A board description is a text file with one statement per line, '#'
+//! starts a comment:
+//!
+//!     pin   PC13 out 2M high LED
+//!     pin   PA9  af 50M UART1_TX
+//!     clock USART1
+//!     remap USART3 partial
+//!     irq   USART1 5 enable
+//!
+//! A pin takes a mode (analog, in, in_pu, in_pd, out, out_od, af, af_od),
+//! for outputs an optional speed (2M, 10M, 50M) and level (low, high), and
+//! an optional label that names it in the header. An irq takes a priority
+//! from 0 to 15 and is enabled in the NVIC only with "enable".
+//!
+//! The clocks of the used GPIO ports and of AFIO (if anything is remapped)
+//! are added by the tool.
+//
+//*****************************************************************************
+#ifndef __BOARDGEN_H__
+#define __BOARDGEN_H__
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+#include <stdio.h>
+
+//
+// GPIOA to GPIOG.
+//
+#define BOARD_PORT_NUM          7
+
+//
+// External interrupts of the STM32F1xx (NUM_INTERRUPTS - 16).
+//
+#define BOARD_IRQ_NUM           68
+
+#define BOARD_LABEL_SIZE        32
+#define BOARD_ERROR_SIZE        96
+
+//
+// Most register writes BoardInit() can have: 3 RCC, 3 per port, AFIO, 17
+// priority and 3 enable registers.
+//
+#define BOARD_WRITE_MAX         (3 + 3 * BOARD_PORT_NUM + 1 + 17 + 3)
+
+//
+// RCC enable registers, index of tBoard.ulENR.
+//
+#define BOARD_BUS_AHB           0
+#define BOARD_BUS_APB2          1
+#define BOARD_BUS_APB1          2
+
+//
+// One GPIO port of the board.
+//
+typedef struct
+{
+    //
+    // Configured pins.
+    //
+    unsigned long ulUsed;
+
+    //
+    // Pins whose ODR bit matters (outputs and pulled inputs).
+    //
+    unsigned long ulODRUsed;
+
+    unsigned long ulCR[2];
+    unsigned long ulODR;
+    char pcLabel[16][BOARD_LABEL_SIZE];
+}
+tBoardPort;
+
+//
+// The whole board, built line by line by BoardLineParse().
+//
+typedef struct
+{
+    tBoardPort sPort[BOARD_PORT_NUM];
+    unsigned long ulENR[3];
+    unsigned long ulMAPR;
+    unsigned long ulMAPRUsed;
+    unsigned char ucPrio[BOARD_IRQ_NUM];
+    unsigned long ulPrioUsed[3];
+    unsigned long ulISER[3];
+    char pcError[BOARD_ERROR_SIZE];
+}
+tBoard;
+
+//
+// One register write of BoardInit().
+//
+typedef struct
+{
+    //
+    // Register expression on the libcox names, e.g. "GPIOA_BASE + GPIO_CRL".
+    //
+    char pcReg[32];
+
+    //
+    // Suffix of the value macro, e.g. "GPIOA_CRL" for BOARD_GPIOA_CRL.
+    //
+    char pcName[24];
+
+    unsigned long ulAddr;
+    unsigned long ulValue;
+
+    //
+    // Set the bits (RCC) instead of storing the whole register.
+    //
+    int bOr;
+}
+tBoardWrite;
+
+extern void BoardReset(tBoard *psBoard);
+extern int BoardLineParse(tBoard *psBoard, const char *pcLine);
+extern int BoardFileParse(tBoard *psBoard, FILE *pFile, const char *pcFile);
+extern unsigned long BoardWritesGet(const tBoard *psBoard,
+                                    tBoardWrite *psWrite);
+extern void BoardHeaderWrite(const tBoard *psBoard, FILE *pFile,
+                             const char *pcName, const char *pcSource);
+extern void BoardSourceWrite(const tBoard *psBoard, FILE *pFile,
+                             const char *pcName, const char *pcSource);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // __BOARDGEN_H__
@@ -0,0 +1,562 @@
+//*****************************************************************************
+//
+//! \file boardgen_test.c
+//! \brief Host unit tests of the boardgen tool.
+//! \version V2.2.1.0
+//! \date 10/19/2026
+//! \author CooCox
+//! \copy
+//!
+//! Copyright (c)  2013, CooCox
+//! All rights reserved.
+//! 
+//! Redistribution and use in source and binary forms, with or without 
+//! modification, are permitted provided that the following conditions 
+//! are met: 
+//! 
+//!     * Redistributions of source code must retain the above copyright 
+//! notice, this list of conditions and the following disclaimer. 
+//!     * Redistributions in binary form must reproduce the above copyright
+//! notice, this list of conditions and the following disclaimer in the
+//! documentation and/or other materials provided with the distribution. 
+//!     * Neither the name of the <ORGANIZATION> nor the names of its 
+//! contributors may be used to endorse or promote products derived 
+//! from this software without specific prior written permission. 
+//! 
+//! THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+//! AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE 
+//! IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+//! ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE 
+//! LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR 
+//! CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF 
+//! SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+//! INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN 
+//! CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) 
+//! ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF 
+//! THE POSSIBILITY OF SUCH DAMAGE.
+//!
+//! Host unit tests of the board description parser and of the register
+//! values and writes of the generated BoardInit(). The GPIO values are
+//! checked against a copy of GPIODirModeSet() run on reset registers, the
+//! way a board was configured before. Build and run with
+//! "gcc -DBOARDGEN_NO_MAIN -o boardgen_test boardgen.c boardgen_test.c" and
+//! "./boardgen_test", it returns 0 when every test passes.
+//
+//*****************************************************************************
+
+#include <stdio.h>
+#include <string.h>
+#include "boardgen.h"
+
+//
+// xgpio.h values of GPIODirModeSet().
+//
+#define GPIO_IN_SPEED_FIXED     0x00000000
+#define GPIO_OUT_SPEED_10M      0x00000001
+#define GPIO_OUT_SPEED_2M       0x00000002
+#define GPIO_OUT_SPEED_50M      0x00000003
+#define GPIO_TYPE_IN_ANALOG     0x00000000
+#define GPIO_TYPE_IN_FLOATING   0x00000004
+#define GPIO_TYPE_IN_WPU_WPD    0x00000008
+#define GPIO_TYPE_OUT_STD       0x00000000
+#define GPIO_TYPE_OUT_OD        0x00000004
+#define GPIO_TYPE_AFOUT_STD     0x00000008
+#define GPIO_TYPE_AFOUT_OD      0x0000000C
+
+#define TestAssert(bCond, pcMsg)                                              \
+        TestAssertion((bCond), (pcMsg), __LINE__)
+
+typedef struct
+{
+    const char *pcName;
+    void (*pfnExecute)(void);
+}
+tBoardTest;
+
+static tBoard g_sBoard;
+static int g_iFail;
+
+//*****************************************************************************
+//
+//! \brief Report a failed check.
+//
+//*****************************************************************************
+static void
+TestAssertion(int bCond, const char *pcMsg, int iLine)
+{
+    if(!bCond)
+    {
+        printf("  line %d: %s\n", iLine, pcMsg);
+        g_iFail++;
+    }
+}
+
+//*****************************************************************************
+//
+//! \brief Parse a board description of several lines.
+//!
+//! \return the number of lines that failed.
+//
+//*****************************************************************************
+static int
+BoardParse(const char * const *ppcLine)
+{
+    int iError = 0;
+
+    BoardReset(&g_sBoard);
+    for(; *ppcLine; ppcLine++)
+    {
+        if(BoardLineParse(&g_sBoard, *ppcLine) != 0)
+        {
+            iError++;
+        }
+    }
+    return (iError);
+}
+
+//*****************************************************************************
+//
+//! \brief Find the write of a register.
+//!
+//! \return the write, or 0 if the register is not written.
+//
+//*****************************************************************************
+static const tBoardWrite *
+WriteFind(const tBoardWrite *psWrite, unsigned long ulNum,
+          unsigned long ulAddr)
+{
+    unsigned long i;
+
+    for(i = 0; i < ulNum; i++)
+    {
+        if(psWrite[i].ulAddr == ulAddr)
+        {
+            return (&psWrite[i]);
+        }
+    }
+    return (0);
+}
+
+//*****************************************************************************
+//
+//! \brief GPIODirModeSet() of xgpio.c on a copy of CRL/CRH.
+//
+//*****************************************************************************
+static void
+RefDirModeSet(unsigned long *pulCR, unsigned long ulBit,
+              unsigned long ulPinType, unsigned long ulPinSpeed)
+{
+    pulCR[ulBit / 8] &= ~(0xFUL << ((ulBit % 8) * 4));
+    pulCR[ulBit / 8] |= (ulPinSpeed | ulPinType) << ((ulBit % 8) * 4);
+}
+
+//*****************************************************************************
+//
+//! \brief Every pin mode gives the CRL/CRH value GPIODirModeSet() gives.
+//
+//*****************************************************************************
+static void
+GPIOModeTest(void)
+{
+    static const char * const ppcLine[] =
+    {
+        "pin PB0 analog",
+        "pin PB1 in",
+        "pin PB2 in_pu",
+        "pin PB3 in_pd",
+        "pin PB4 out",
+        "pin PB5 out 10M",
+        "pin PB6 out_od 50M",
+        "pin PB7 af",
+        "pin PB8 af 2M",
+        "pin PB9 af_od",
+        "pin PB15 OUT_OD 2m",
+        0
+    };
+    unsigned long ulCR[2] = {0x44444444, 0x44444444};
+
+    TestAssert(BoardParse(ppcLine) == 0, "pin modes are not parsed");
+
+    RefDirModeSet(ulCR, 0, GPIO_TYPE_IN_ANALOG, GPIO_IN_SPEED_FIXED);
+    RefDirModeSet(ulCR, 1, GPIO_TYPE_IN_FLOATING, GPIO_IN_SPEED_FIXED);
+    RefDirModeSet(ulCR, 2, GPIO_TYPE_IN_WPU_WPD, GPIO_IN_SPEED_FIXED);
+    RefDirModeSet(ulCR, 3, GPIO_TYPE_IN_WPU_WPD, GPIO_IN_SPEED_FIXED);
+    RefDirModeSet(ulCR, 4, GPIO_TYPE_OUT_STD, GPIO_OUT_SPEED_2M);
+    RefDirModeSet(ulCR, 5, GPIO_TYPE_OUT_STD, GPIO_OUT_SPEED_10M);
+    RefDirModeSet(ulCR, 6, GPIO_TYPE_OUT_OD, GPIO_OUT_SPEED_50M);
+    RefDirModeSet(ulCR, 7, GPIO_TYPE_AFOUT_STD, GPIO_OUT_SPEED_50M);
+    RefDirModeSet(ulCR, 8, GPIO_TYPE_AFOUT_STD, GPIO_OUT_SPEED_2M);
+    RefDirModeSet(ulCR, 9, GPIO_TYPE_AFOUT_OD, GPIO_OUT_SPEED_50M);
+    RefDirModeSet(ulCR, 15, GPIO_TYPE_OUT_OD, GPIO_OUT_SPEED_2M);
+
+    TestAssert(g_sBoard.sPort[1].ulCR[0] == ulCR[0], "GPIOB CRL is wrong");
+    TestAssert(g_sBoard.sPort[1].ulCR[1] == ulCR[1], "GPIOB CRH is wrong");
+    TestAssert(g_sBoard.sPort[1].ulUsed == 0x83FF, "GPIOB pins are wrong");
+
+    //
+    // Pulled inputs and outputs own their ODR bit.
+    //
+    TestAssert(g_sBoard.sPort[1].ulODRUsed == 0x807C, "GPIOB ODR bits are "
+               "wrong");
+    TestAssert(g_sBoard.sPort[1].ulODR == 0x0004, "pull up is not in ODR");
+}
+
+//*****************************************************************************
+//
+//! \brief Output levels, labels and the clocks of the ports.
+//
+//*****************************************************************************
+static void
+GPIOLevelTest(void)
+{
+    static const char * const ppcLine[] =
+    {
+        "# LED and button",
+        "pin PC13 out 2M high LED   # active low LED",
+        "pin PC14 out low",
+        "pin PG0  in_pd KEY",
+        "",
+        0
+    };
+
+    TestAssert(BoardParse(ppcLine) == 0, "levels are not parsed");
+    TestAssert(g_sBoard.sPort[2].ulODR == 0x2000, "GPIOC ODR is wrong");
+    TestAssert(g_sBoard.sPort[2].ulODRUsed == 0x6000, "GPIOC ODR bits are "
+               "wrong");
+    TestAssert(strcmp(g_sBoard.sPort[2].pcLabel[13], "LED") == 0 &&
+               strcmp(g_sBoard.sPort[6].pcLabel[0], "KEY") == 0,
+               "labels are wrong");
+
+    //
+    // IOPCEN and IOPGEN, no AFIO without a remap.
+    //
+    TestAssert(g_sBoard.ulENR[BOARD_BUS_APB2] == ((1UL << 4) | (1UL << 8)),
+               "port clocks are wrong");
+    TestAssert(g_sBoard.ulENR[BOARD_BUS_AHB] == 0 &&
+               g_sBoard.ulENR[BOARD_BUS_APB1] == 0, "extra clocks");
+}
+
+//*****************************************************************************
+//
+//! \brief Peripheral clocks land in their RCC enable register.
+//
+//*****************************************************************************
+static void
+ClockTest(void)
+{
+    static const char * const ppcLine[] =
+    {
+        "clock DMA1",
+        "clock usart1",
+        "clock USART2",
+        "clock TIM2",
+        "clock TIM1",
+        "clock USART2",
+        0
+    };
+
+    TestAssert(BoardParse(ppcLine) == 0, "clocks are not parsed");
+    TestAssert(g_sBoard.ulENR[BOARD_BUS_AHB] == 0x00000001,
+               "RCC_AHBENR is wrong");
+    TestAssert(g_sBoard.ulENR[BOARD_BUS_APB2] == 0x00004800,
+               "RCC_APB2ENR is wrong");
+    TestAssert(g_sBoard.ulENR[BOARD_BUS_APB1] == 0x00020001,
+               "RCC_APB1ENR is wrong");
+}
+
+//*****************************************************************************
+//
+//! \brief AFIO_MAPR fields, their options and conflicts.
+//
+//*****************************************************************************
+static void
+RemapTest(void)
+{
+    static const char * const ppcLine[] =
+    {
+        "remap USART1",
+        "remap USART3 partial",
+        "remap TIM2 partial2",
+        "remap CAN1 pd",
+        "remap SWJ nojtag",
+        "remap USART3 partial",
+        0
+    };
+
+    TestAssert(BoardParse(ppcLine) == 0, "remaps are not parsed");
+    TestAssert(g_sBoard.ulMAPR == ((1UL << 2) | (1UL << 4) | (2UL << 8) |
+                                   (3UL << 13) | (2UL << 24)),
+               "AFIO_MAPR is wrong");
+    TestAssert(g_sBoard.ulENR[BOARD_BUS_APB2] == 1, "AFIO clock is missing");
+
+    TestAssert(BoardLineParse(&g_sBoard, "remap USART3 full") != 0,
+               "conflicting remap is accepted");
+    TestAssert(BoardLineParse(&g_sBoard, "remap TIM2 partial") != 0,
+               "unknown remap option is accepted");
+    TestAssert(BoardLineParse(&g_sBoard, "remap TIM3") != 0,
+               "remap without an option is accepted");
+    TestAssert(BoardLineParse(&g_sBoard, "remap SPI1 full") != 0,
+               "option of a one bit remap is accepted");
+}
+
+//*****************************************************************************
+//
+//! \brief Priorities in the high bits of their byte, enables in NVIC_ENn.
+//
+//*****************************************************************************
+static void
+IrqTest(void)
+{
+    static const char * const ppcLine[] =
+    {
+        "irq USART1 5 enable",
+        "irq EXTI0 15",
+        "irq OTGFS 1 enable",
+        0
+    };
+
+    TestAssert(BoardParse(ppcLine) == 0, "irqs are not parsed");
+
+    //
+    // INT_USART1 is 53, IRQ 37. INT_EXTI0 is 22, IRQ 6. INT_OTGFS is 83.
+    //
+    TestAssert(g_sBoard.ucPrio[37] == 0x50 && g_sBoard.ucPrio[6] == 0xF0 &&
+               g_sBoard.ucPrio[67] == 0x10, "priorities are wrong");
+    TestAssert(g_sBoard.ulISER[0] == 0 &&
+               g_sBoard.ulISER[1] == (1UL << 5) &&
+               g_sBoard.ulISER[2] == (1UL << 3), "enables are wrong");
+
+    TestAssert(BoardLineParse(&g_sBoard, "irq USART1 3") != 0,
+               "irq configured twice is accepted");
+    TestAssert(BoardLineParse(&g_sBoard, "irq USART2 16") != 0,
+               "priority 16 is accepted");
+    TestAssert(BoardLineParse(&g_sBoard, "irq USART2 -1") != 0,
+               "negative priority is accepted");
+    TestAssert(BoardLineParse(&g_sBoard, "irq USART2 2 on") != 0,
+               "bad enable word is accepted");
+    TestAssert(BoardLineParse(&g_sBoard, "irq USART9 2") != 0,
+               "unknown irq is accepted");
+}
+
+//*****************************************************************************
+//
+//! \brief Bad lines are refused with a reason, and change nothing.
+//
+//*****************************************************************************
+static void
+ErrorTest(void)
+{
+    static const char * const ppcBad[] =
+    {
+        "pins PA0 in",
+        "pin PH0 in",
+        "pin PA16 in",
+        "pin PA in",
+        "pin A1 in",
+        "pin PA1x in",
+        "pin PA1",
+        "pin PA1 push",
+        "pin PA1 in 50M",
+        "pin PA1 af high",
+        "pin PA1 out 2M 1abc",
+        "pin PA1 out LED LED2",
+        "clock",
+        "clock UART9",
+        "pin PA1 in a b c d e f",
+        0
+    };
+    const char * const *ppcLine;
+    tBoard sEmpty;
+
+    BoardReset(&sEmpty);
+    for(ppcLine = ppcBad; *ppcLine; ppcLine++)
+    {
+        BoardReset(&g_sBoard);
+        TestAssert(BoardLineParse(&g_sBoard, *ppcLine) != 0 &&
+                   g_sBoard.pcError[0] != 0, *ppcLine);
+        TestAssert(memcmp(g_sBoard.sPort, sEmpty.sPort,
+                          sizeof(sEmpty.sPort)) == 0, *ppcLine);
+    }
+
+    BoardReset(&g_sBoard);
+    TestAssert(BoardLineParse(&g_sBoard, "pin PA1 out LED") == 0 &&
+               BoardLineParse(&g_sBoard, "pin PA1 in") != 0,
+               "pin configured twice is accepted");
+    TestAssert(BoardLineParse(&g_sBoard, "pin PA2 out led") != 0,
+               "label used twice is accepted");
+}
+
+//*****************************************************************************
+//
+//! \brief Each register is written once, clocks first and enables last.
+//
+//*****************************************************************************
+static void
+WriteTest(void)
+{
+    static const char * const ppcLine[] =
+    {
+        "pin PA9  af 50M UART1_TX",
+        "pin PA10 in UART1_RX",
+        "pin PA2  out",
+        "pin PC13 out high",
+        "clock USART1",
+        "clock TIM2",
+        "remap SWJ nojtag",
+        "irq USART1 5 enable",
+        "irq USART2 6",
+        0
+    };
+    tBoardWrite sWrite[BOARD_WRITE_MAX];
+    const tBoardWrite *psWrite;
+    unsigned long ulNum, i, j;
+
+    TestAssert(BoardParse(ppcLine) == 0, "board is not parsed");
+    ulNum = BoardWritesGet(&g_sBoard, sWrite);
+
+    //
+    // APB2ENR, APB1ENR, GPIOA ODR/CRL/CRH, GPIOC ODR/CRH, AFIO_MAPR,
+    // NVIC_PRI9, NVIC_EN1.
+    //
+    TestAssert(ulNum == 10, "number of writes is wrong");
+    for(i = 0; i < ulNum; i++)
+    {
+        for(j = i + 1; j < ulNum; j++)
+        {
+            TestAssert(sWrite[i].ulAddr != sWrite[j].ulAddr,
+                       "register is written twice");
+        }
+    }
+
+    TestAssert(sWrite[0].ulAddr == 0x40021018 && sWrite[0].bOr &&
+               sWrite[0].ulValue == ((1UL << 14) | (1UL << 4) | (1UL << 2) |
+                                     1UL), "RCC_APB2ENR is not first");
+    TestAssert(sWrite[1].ulAddr == 0x4002101C && sWrite[1].bOr,
+               "RCC_APB1ENR is not second");
+    TestAssert(sWrite[ulNum - 1].ulAddr == 0xE000E104 &&
+               sWrite[ulNum - 1].ulValue == (1UL << 5),
+               "NVIC_EN1 is not last");
+    TestAssert(WriteFind(sWrite, ulNum, 0x40011000) == 0,
+               "GPIOC CRL is written");
+
+    psWrite = WriteFind(sWrite, ulNum, 0x40010800 + 0x04);
+    TestAssert(psWrite && psWrite->ulValue == 0x444444B4 &&
+               strcmp(psWrite->pcReg, "GPIOA_BASE + GPIO_CRH") == 0 &&
+               strcmp(psWrite->pcName, "GPIOA_CRH") == 0,
+               "GPIOA CRH write is wrong");
+
+    //
+    // The ODR goes before CRL/CRH, so the output starts high.
+    //
+    TestAssert(WriteFind(sWrite, ulNum, 0x4001100C) <
+               WriteFind(sWrite, ulNum, 0x40011004),
+               "GPIOC ODR is written after CRH");
+
+    psWrite = WriteFind(sWrite, ulNum, 0xE000E424);
+    TestAssert(psWrite && psWrite->ulValue == 0x00605000 &&
+               strcmp(psWrite->pcReg, "NVIC_PRI9") == 0,
+               "NVIC_PRI9 write is wrong");
+    psWrite = WriteFind(sWrite, ulNum, 0x40010004);
+    TestAssert(psWrite && psWrite->ulValue == 0x02000000,
+               "AFIO_MAPR write is wrong");
+
+    //
+    // An empty board writes nothing.
+    //
+    BoardReset(&g_sBoard);
+    TestAssert(BoardWritesGet(&g_sBoard, sWrite) == 0, "empty board writes");
+}
+
+//*****************************************************************************
+//
+//! \brief The generated files hold one line per write and the labels.
+//
+//*****************************************************************************
+static void
+OutputTest(void)
+{
+    static const char * const ppcLine[] =
+    {
+        "pin PC13 out 2M high LED",
+        "clock USART1",
+        "irq USART1 5 enable",
+        0
+    };
+    char cText[4096];
+    char *pcPos;
+    FILE *pFile;
+    size_t iLen;
+    int iCount;
+
+    TestAssert(BoardParse(ppcLine) == 0, "board is not parsed");
+
+    pFile = tmpfile();
+    BoardSourceWrite(&g_sBoard, pFile, "out/board_config", "board.txt");
+    rewind(pFile);
+    iLen = fread(cText, 1, sizeof(cText) - 1, pFile);
+    cText[iLen] = 0;
+    fclose(pFile);
+
+    for(iCount = 0, pcPos = cText; (pcPos = strstr(pcPos, "xHWREG(")) != 0;
+        pcPos++)
+    {
+        iCount++;
+    }
+    //
+    // RCC_APB2ENR, GPIOC ODR/CRH, NVIC_PRI9, NVIC_EN1.
+    //
+    TestAssert(iCount == 5, "source has a wrong number of writes");
+    TestAssert(strstr(cText, "#include \"board_config.h\"") != 0,
+               "source does not include the header");
+    TestAssert(strstr(cText, "xHWREG(RCC_APB2ENR) |= BOARD_RCC_APB2ENR;") &&
+               strstr(cText, "xHWREG(GPIOC_BASE + GPIO_CRH) = "
+                             "BOARD_GPIOC_CRH;"),
+               "source writes are wrong");
+
+    pFile = tmpfile();
+    BoardHeaderWrite(&g_sBoard, pFile, "out/board_config", "board.txt");
+    rewind(pFile);
+    iLen = fread(cText, 1, sizeof(cText) - 1, pFile);
+    cText[iLen] = 0;
+    fclose(pFile);
+
+    TestAssert(strstr(cText, "#ifndef __BOARD_CONFIG_H__") != 0,
+               "header guard is wrong");
+    TestAssert(strstr(cText, "BOARD_GPIOC_CRH               0x44244444") != 0,
+               "header value is wrong");
+    TestAssert(strstr(cText, "LED_PORT                      GPIOC_BASE") &&
+               strstr(cText, "LED_PIN                       GPIO_PIN_13"),
+               "header label is wrong");
+    TestAssert(strstr(cText, "extern void BoardInit(void);") != 0,
+               "header has no BoardInit()");
+}
+
+static const tBoardTest g_sTest[] =
+{
+    {"GPIO modes",    GPIOModeTest},
+    {"GPIO levels",   GPIOLevelTest},
+    {"clocks",        ClockTest},
+    {"remaps",        RemapTest},
+    {"interrupts",    IrqTest},
+    {"errors",        ErrorTest},
+    {"writes",        WriteTest},
+    {"output",        OutputTest},
+};
+
+int
+main(void)
+{
+    unsigned long i;
+    int iFail;
+
+    for(i = 0; i < sizeof(g_sTest) / sizeof(g_sTest[0]); i++)
+    {
+        iFail = g_iFail;
+        g_sTest[i].pfnExecute();
+        printf("%-16s%s\n", g_sTest[i].pcName,
+               iFail == g_iFail ? "pass" : "FAIL");
+    }
+    printf("%d failed check(s)\n", g_iFail);
+
+    return (g_iFail != 0);
+}
@@ -0,0 +1,33 @@
+//
+// Generated by boardgen from stm32f103.txt, do not edit.
+//
+#include "xhw_types.h"
+#include "xhw_memmap.h"
+#include "xhw_sysctl.h"
+#include "xhw_gpio.h"
+#include "xhw_nvic.h"
+#include "board_config.h"
+
+//
+// Configure the board, call it once after reset.
+//
+void
+BoardInit(void)
+{
+    xHWREG(RCC_APB2ENR) |= BOARD_RCC_APB2ENR;
+    xHWREG(RCC_APB1ENR) |= BOARD_RCC_APB1ENR;
+    xHWREG(GPIOA_BASE + GPIO_ODR) = BOARD_GPIOA_ODR;
+    xHWREG(GPIOA_BASE + GPIO_CRL) = BOARD_GPIOA_CRL;
+    xHWREG(GPIOA_BASE + GPIO_CRH) = BOARD_GPIOA_CRH;
+    xHWREG(GPIOB_BASE + GPIO_ODR) = BOARD_GPIOB_ODR;
+    xHWREG(GPIOB_BASE + GPIO_CRL) = BOARD_GPIOB_CRL;
+    xHWREG(GPIOC_BASE + GPIO_ODR) = BOARD_GPIOC_ODR;
+    xHWREG(GPIOC_BASE + GPIO_CRH) = BOARD_GPIOC_CRH;
+    xHWREG(AFIO_MAPR) = BOARD_AFIO_MAPR;
+    xHWREG(NVIC_PRI1) = BOARD_NVIC_PRI1;
+    xHWREG(NVIC_PRI7) = BOARD_NVIC_PRI7;
+    xHWREG(NVIC_PRI8) = BOARD_NVIC_PRI8;
+    xHWREG(NVIC_PRI9) = BOARD_NVIC_PRI9;
+    xHWREG(NVIC_EN0) = BOARD_NVIC_EN0;
+    xHWREG(NVIC_EN1) = BOARD_NVIC_EN1;
+}
@@ -0,0 +1,60 @@
+//
+// Generated by boardgen from stm32f103.txt, do not edit.
+//
+#ifndef __BOARD_CONFIG_H__
+#define __BOARD_CONFIG_H__
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+//
+// Register values written by BoardInit().
+//
+#define BOARD_RCC_APB2ENR             0x0000401D
+#define BOARD_RCC_APB1ENR             0x00240000
+#define BOARD_GPIOA_ODR               0x00000000
+#define BOARD_GPIOA_CRL               0x44444448
+#define BOARD_GPIOA_CRH               0x444444B4
+#define BOARD_GPIOB_ODR               0x00000000
+#define BOARD_GPIOB_CRL               0xFF442444
+#define BOARD_GPIOC_ODR               0x00002800
+#define BOARD_GPIOC_CRH               0x44248B44
+#define BOARD_AFIO_MAPR               0x02000010
+#define BOARD_NVIC_PRI1               0x00800000
+#define BOARD_NVIC_PRI7               0x40000000
+#define BOARD_NVIC_PRI8               0x00000040
+#define BOARD_NVIC_PRI9               0x60005000
+#define BOARD_NVIC_EN0                0x00000040
+#define BOARD_NVIC_EN1                0x000000A0
+
+//
+// Board pins.
+//
+#define KEY_PORT                      GPIOA_BASE
+#define KEY_PIN                       GPIO_PIN_0
+#define UART1_TX_PORT                 GPIOA_BASE
+#define UART1_TX_PIN                  GPIO_PIN_9
+#define UART1_RX_PORT                 GPIOA_BASE
+#define UART1_RX_PIN                  GPIO_PIN_10
+#define SPARE_PORT                    GPIOB_BASE
+#define SPARE_PIN                     GPIO_PIN_3
+#define I2C1_SCL_PORT                 GPIOB_BASE
+#define I2C1_SCL_PIN                  GPIO_PIN_6
+#define I2C1_SDA_PORT                 GPIOB_BASE
+#define I2C1_SDA_PIN                  GPIO_PIN_7
+#define UART3_TX_PORT                 GPIOC_BASE
+#define UART3_TX_PIN                  GPIO_PIN_10
+#define UART3_RX_PORT                 GPIOC_BASE
+#define UART3_RX_PIN                  GPIO_PIN_11
+#define LED_PORT                      GPIOC_BASE
+#define LED_PIN                       GPIO_PIN_13
+
+extern void BoardInit(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // __BOARD_CONFIG_H__
@@ -0,0 +1,537 @@
+//*****************************************************************************
+//
+//! \file xtracedec.c
+//! \brief PC decoder for the xTrace event recorder image.
+//! \version V2.2.1.0
+//! \date 10/19/2026
+//! \author CooCox
+//! \copy
+//!
+//! Copyright (c)  2013, CooCox
+//! All rights reserved.
+//! 
+//! Redistribution and use in source and binary forms, with or without 
+//! modification, are permitted provided that the following conditions 
+//! are met: 
+//! 
+//!     * Redistributions of source code must retain the above copyright 
+//! notice, this list of conditions and the following disclaimer. 
+//!     * Redistributions in binary form must reproduce the above copyright
+//! notice, this list of conditions and the following disclaimer in the
+//! documentation and/or other materials provided with the distribution. 
+//!     * Neither the name of the <ORGANIZATION> nor the names of its 
+//! contributors may be used to endorse or promote products derived 
+//! from this software without specific prior written permission. 
+//! 
+//! THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+//! AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE 
+//! IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+//! ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE 
+//! LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR 
+//! CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF 
+//! SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+//! INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN 
+//! CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) 
+//! ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF 
+//! THE POSSIBILITY OF SUCH DAMAGE.
+//!
+//! Build with any C compiler, e.g. "gcc -o xtracedec xtracedec.c", and run
+//! "xtracedec [-j trace.json] trace.bin" on an image saved from g_sxTrace or
+//! sent by xTRACE_DUMP(). It prints the count, min, avg, max and a log2
+//! histogram of the duration of every interrupt and API, and with -j writes
+//! the events in the Chrome trace format (open it in chrome://tracing).
+//
+//*****************************************************************************
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+//
+// Image layout, see tTraceBuffer in xtrace.h.
+//
+#define TRACE_MAGIC             0x43525458
+#define TRACE_HEADER_SIZE       16
+#define TRACE_EVENT_SIZE        8
+
+//
+// Event types, see xTrace_Event_Type in xtrace.h.
+//
+#define TRACE_ISR_ENTER         0
+#define TRACE_ISR_EXIT          1
+#define TRACE_API_BEGIN         2
+#define TRACE_API_END           3
+#define TRACE_MARK              4
+
+#define TRACE_ISR_NUM           512
+#define TRACE_API_NUM           4096
+#define TRACE_STACK_DEPTH       64
+#define TRACE_HIST_NUM          32
+
+typedef struct
+{
+    unsigned long long ullTime;
+    unsigned long ulInfo;
+}
+tEvent;
+
+typedef struct
+{
+    unsigned long ulCount;
+    unsigned long ulMin;
+    unsigned long ulMax;
+    unsigned long long ullSum;
+    unsigned long ulHist[TRACE_HIST_NUM];
+}
+tStat;
+
+typedef struct
+{
+    int bISR;
+    unsigned long ulID;
+    unsigned long long ullTime;
+}
+tFrame;
+
+static tStat g_sISRStat[TRACE_ISR_NUM];
+static tStat g_sAPIStat[TRACE_API_NUM];
+static tFrame g_sStack[TRACE_STACK_DEPTH];
+static int g_iDepth;
+
+static unsigned long g_ulClock;
+static FILE *g_pJSON;
+static int g_bJSONFirst = 1;
+
+//
+// Names of the Cortex-M core exceptions.
+//
+static const char * const g_pcException[16] =
+{
+    "Thread", "Reset", "NMI", "HardFault", "MemManage", "BusFault",
+    "UsageFault", 0, 0, 0, 0, "SVCall", "DebugMon", 0, "PendSV", "SysTick"
+};
+
+//
+// Names of the libcox APIs marked with xTRACE_API_BEGIN().
+//
+static const struct
+{
+    unsigned long ulID;
+    const char *pcName;
+}
+g_sAPIName[] =
+{
+    {0x001, "UARTBufferWrite"},
+    {0x010, "SPIDataRead"},
+    {0x011, "SPIDataWrite"},
+};
+
+//*****************************************************************************
+//
+//! \brief Read a little endian word of the image.
+//
+//*****************************************************************************
+static unsigned long
+WordGet(const unsigned char *pucData)
+{
+    return ((unsigned long)pucData[0] | ((unsigned long)pucData[1] << 8) |
+            ((unsigned long)pucData[2] << 16) |
+            ((unsigned long)pucData[3] << 24));
+}
+
+//*****************************************************************************
+//
+//! \brief Get the display name of an interrupt or API.
+//
+//*****************************************************************************
+static const char *
+NameGet(int bISR, unsigned long ulID)
+{
+    static char cName[32];
+    unsigned long i;
+
+    if(bISR)
+    {
+        if(ulID < 16 && g_pcException[ulID])
+        {
+            return (g_pcException[ulID]);
+        }
+        if(ulID < 16)
+        {
+            sprintf(cName, "Exception%lu", ulID);
+        }
+        else
+        {
+            sprintf(cName, "IRQ%lu", ulID - 16);
+        }
+        return (cName);
+    }
+
+    for(i = 0; i < sizeof(g_sAPIName) / sizeof(g_sAPIName[0]); i++)
+    {
+        if(g_sAPIName[i].ulID == ulID)
+        {
+            return (g_sAPIName[i].pcName);
+        }
+    }
+    sprintf(cName, "API 0x%03lx", ulID);
+    return (cName);
+}
+
+//*****************************************************************************
+//
+//! \brief Convert cycles to microseconds.
+//
+//*****************************************************************************
+static double
+CycleToUs(unsigned long long ullCycle)
+{
+    return ((double)ullCycle * 1000000.0 / (double)g_ulClock);
+}
+
+//*****************************************************************************
+//
+//! \brief Write one Chrome trace event.
+//
+//*****************************************************************************
+static void
+JSONEvent(const char *pcName, const char *pcPhase, unsigned long long ullTime,
+          const char *pcExtra)
+{
+    if(!g_pJSON)
+    {
+        return;
+    }
+
+    fprintf(g_pJSON, "%s\n  {\"name\":\"%s\",\"ph\":\"%s\",\"ts\":%.3f,"
+            "\"pid\":1,\"tid\":1%s}", g_bJSONFirst ? "" : ",", pcName,
+            pcPhase, CycleToUs(ullTime), pcExtra);
+    g_bJSONFirst = 0;
+}
+
+//*****************************************************************************
+//
+//! \brief Add one duration to a statistic.
+//
+//*****************************************************************************
+static void
+StatAdd(tStat *psStat, unsigned long long ullCycle)
+{
+    unsigned long ulCycle, ulBucket;
+
+    ulCycle = ullCycle > 0xFFFFFFFFUL ? 0xFFFFFFFFUL : (unsigned long)ullCycle;
+    if(psStat->ulCount == 0 || ulCycle < psStat->ulMin)
+    {
+        psStat->ulMin = ulCycle;
+    }
+    if(ulCycle > psStat->ulMax)
+    {
+        psStat->ulMax = ulCycle;
+    }
+    psStat->ulCount++;
+    psStat->ullSum += ulCycle;
+
+    for(ulBucket = 0; ulBucket < TRACE_HIST_NUM - 1 &&
+        (ulCycle >> (ulBucket + 1)) != 0; ulBucket++)
+    {
+    }
+    psStat->ulHist[ulBucket]++;
+}
+
+//*****************************************************************************
+//
+//! \brief Close the innermost open frame that matches, frames above it never
+//! ended in the window and are dropped.
+//
+//*****************************************************************************
+static void
+FrameEnd(int bISR, unsigned long ulID, unsigned long long ullTime)
+{
+    int i, j;
+
+    for(i = g_iDepth - 1; i >= 0; i--)
+    {
+        if(g_sStack[i].bISR == bISR && (bISR || g_sStack[i].ulID == ulID))
+        {
+            break;
+        }
+
+        //
+        // An API never ends outside of the interrupt it began in.
+        //
+        if(!bISR && g_sStack[i].bISR)
+        {
+            return;
+        }
+    }
+
+    //
+    // The begin was overwritten in the ring.
+    //
+    if(i < 0)
+    {
+        return;
+    }
+
+    for(j = g_iDepth - 1; j >= i; j--)
+    {
+        JSONEvent(NameGet(g_sStack[j].bISR, g_sStack[j].ulID), "E", ullTime,
+                  "");
+    }
+
+    ulID = g_sStack[i].ulID;
+    StatAdd(bISR ? &g_sISRStat[ulID] : &g_sAPIStat[ulID],
+            ullTime - g_sStack[i].ullTime);
+    g_iDepth = i;
+}
+
+//*****************************************************************************
+//
+//! \brief Open a frame.
+//
+//*****************************************************************************
+static void
+FrameBegin(int bISR, unsigned long ulID, unsigned long long ullTime)
+{
+    if(g_iDepth == TRACE_STACK_DEPTH)
+    {
+        return;
+    }
+
+    g_sStack[g_iDepth].bISR = bISR;
+    g_sStack[g_iDepth].ulID = ulID;
+    g_sStack[g_iDepth].ullTime = ullTime;
+    g_iDepth++;
+    JSONEvent(NameGet(bISR, ulID), "B", ullTime, "");
+}
+
+//*****************************************************************************
+//
+//! \brief Print the statistics of one table.
+//
+//*****************************************************************************
+static void
+StatPrint(int bISR, tStat *psStat, unsigned long ulNum)
+{
+    unsigned long i, k, ulPeak, ulBar;
+
+    for(i = 0; i < ulNum; i++)
+    {
+        if(psStat[i].ulCount == 0)
+        {
+            continue;
+        }
+
+        printf("%-20s count %-8lu min %-8lu avg %-8llu max %-8lu cycles "
+               "(max %.2f us)\n", NameGet(bISR, i), psStat[i].ulCount,
+               psStat[i].ulMin, psStat[i].ullSum / psStat[i].ulCount,
+               psStat[i].ulMax, CycleToUs(psStat[i].ulMax));
+
+        ulPeak = 0;
+        for(k = 0; k < TRACE_HIST_NUM; k++)
+        {
+            if(psStat[i].ulHist[k] > ulPeak)
+            {
+                ulPeak = psStat[i].ulHist[k];
+            }
+        }
+        for(k = 0; k < TRACE_HIST_NUM; k++)
+        {
+            if(psStat[i].ulHist[k] == 0)
+            {
+                continue;
+            }
+            printf("    %10lu - %-10lu %8lu ", k ? 1UL << k : 0UL,
+                   (unsigned long)((2ULL << k) - 1), psStat[i].ulHist[k]);
+            for(ulBar = (psStat[i].ulHist[k] * 40 + ulPeak - 1) / ulPeak;
+                ulBar; ulBar--)
+            {
+                putchar('#');
+            }
+            putchar('\n');
+        }
+    }
+}
+
+int
+main(int argc, char *argv[])
+{
+    const char *pcImage = 0, *pcJSON = 0;
+    unsigned char *pucData;
+    unsigned long ulLen, ulSize, ulHead, ulNum, ulSlot, ulTime, ulPrev, i;
+    unsigned long ulInfo, ulID;
+    unsigned long long ullTime, ullFirst;
+    tEvent *psEvent;
+    char cExtra[48], cName[32];
+    FILE *pFile;
+    int iArg;
+
+    for(iArg = 1; iArg < argc; iArg++)
+    {
+        if(strcmp(argv[iArg], "-j") == 0 && iArg + 1 < argc)
+        {
+            pcJSON = argv[++iArg];
+        }
+        else
+        {
+            pcImage = argv[iArg];
+        }
+    }
+    if(!pcImage)
+    {
+        fprintf(stderr, "usage: xtracedec [-j trace.json] trace.bin\n");
+        return (1);
+    }
+
+    //
+    // Load the image.
+    //
+    pFile = fopen(pcImage, "rb");
+    if(!pFile)
+    {
+        perror(pcImage);
+        return (1);
+    }
+    fseek(pFile, 0, SEEK_END);
+    ulLen = (unsigned long)ftell(pFile);
+    fseek(pFile, 0, SEEK_SET);
+    pucData = malloc(ulLen + 1);
+    if(!pucData || fread(pucData, 1, ulLen, pFile) != ulLen)
+    {
+        fprintf(stderr, "%s: read error\n", pcImage);
+        return (1);
+    }
+    fclose(pFile);
+
+    if(ulLen < TRACE_HEADER_SIZE || WordGet(pucData) != TRACE_MAGIC)
+    {
+        fprintf(stderr, "%s: not a trace image\n", pcImage);
+        return (1);
+    }
+    g_ulClock = WordGet(pucData + 4);
+    ulSize = WordGet(pucData + 8);
+    ulHead = WordGet(pucData + 12);
+    if(g_ulClock == 0 || ulSize == 0 || (ulSize & (ulSize - 1)) ||
+       ulLen < TRACE_HEADER_SIZE + ulSize * TRACE_EVENT_SIZE)
+    {
+        fprintf(stderr, "%s: bad trace header\n", pcImage);
+        return (1);
+    }
+
+    //
+    // Take the valid events, oldest first, and extend the 32-bit cycle
+    // counter. The delta is signed because an interrupt may record between
+    // the time read and the slot claim of the event it preempted.
+    //
+    ulNum = ulHead < ulSize ? ulHead : ulSize;
+    psEvent = malloc((ulNum + 1) * sizeof(tEvent));
+    if(!psEvent)
+    {
+        return (1);
+    }
+    ullTime = 0;
+    ulPrev = 0;
+    for(i = 0; i < ulNum; i++)
+    {
+        ulSlot = (ulHead - ulNum + i) & (ulSize - 1);
+        ulTime = WordGet(pucData + TRACE_HEADER_SIZE +
+                         ulSlot * TRACE_EVENT_SIZE);
+        if(i == 0)
+        {
+            ullTime = (unsigned long long)1 << 32;
+        }
+        else
+        {
+            ullTime += (long long)(int)(ulTime - ulPrev);
+        }
+        ulPrev = ulTime;
+        psEvent[i].ullTime = ullTime;
+        psEvent[i].ulInfo = WordGet(pucData + TRACE_HEADER_SIZE +
+                                    ulSlot * TRACE_EVENT_SIZE + 4);
+    }
+    ullFirst = ulNum ? psEvent[0].ullTime : 0;
+
+    if(pcJSON)
+    {
+        g_pJSON = fopen(pcJSON, "w");
+        if(!g_pJSON)
+        {
+            perror(pcJSON);
+            return (1);
+        }
+        fprintf(g_pJSON, "{\"traceEvents\":[");
+    }
+
+    //
+    // Pair the begin and end events.
+    //
+    for(i = 0; i < ulNum; i++)
+    {
+        ullTime = psEvent[i].ullTime - ullFirst;
+        ulInfo = psEvent[i].ulInfo;
+        ulID = (ulInfo >> 16) & 0xFFF;
+
+        switch(ulInfo >> 28)
+        {
+            case TRACE_ISR_ENTER:
+            {
+                FrameBegin(1, ulID % TRACE_ISR_NUM, ullTime);
+                break;
+            }
+            case TRACE_ISR_EXIT:
+            {
+                FrameEnd(1, 0, ullTime);
+                break;
+            }
+            case TRACE_API_BEGIN:
+            {
+                FrameBegin(0, ulID, ullTime);
+                break;
+            }
+            case TRACE_API_END:
+            {
+                FrameEnd(0, ulID, ullTime);
+                break;
+            }
+            case TRACE_MARK:
+            {
+                sprintf(cExtra, ",\"s\":\"t\",\"args\":{\"arg\":%lu}",
+                        ulInfo & 0xFFFF);
+                sprintf(cName, "Mark 0x%03lx", ulID);
+                JSONEvent(cName, "i", ullTime, cExtra);
+                break;
+            }
+            default:
+            {
+                break;
+            }
+        }
+    }
+
+    //
+    // Close what is still open at the end of the window.
+    //
+    if(g_pJSON)
+    {
+        while(g_iDepth)
+        {
+            g_iDepth--;
+            JSONEvent(NameGet(g_sStack[g_iDepth].bISR,
+                              g_sStack[g_iDepth].ulID), "E",
+                      ulNum ? psEvent[ulNum - 1].ullTime - ullFirst : 0, "");
+        }
+        fprintf(g_pJSON, "\n]}\n");
+        fclose(g_pJSON);
+    }
+
+    printf("%lu events (%lu recorded, %lu slots), %.2f us, clock %lu Hz\n\n",
+           ulNum, ulHead, ulSize,
+           ulNum ? CycleToUs(psEvent[ulNum - 1].ullTime - ullFirst) : 0.0,
+           g_ulClock);
+    StatPrint(1, g_sISRStat, TRACE_ISR_NUM);
+    StatPrint(0, g_sAPIStat, TRACE_API_NUM);
+
+    free(psEvent);
+    free(pucData);
+    return (0);
+}